@@ -122,7 +122,9 @@ function codeinst_to_ir(interp::AbstractInterpreter, code::CodeInstance)
     src = code.inferred
     mi = code.def
     if isa(src, Vector{UInt8})
-        src = ccall(:jl_uncompress_ir, Any, (Any, Ptr{Cvoid}, Any), mi.def, C_NULL, src)::CodeInfo
+        # irinterp only reads the statements and their types, so skip
+        # decompressing the debug fields (slotnames, codelocs, linetable)
+        src = ccall(:jl_uncompress_ir_stmts, Any, (Any, Ptr{Cvoid}, Any), mi.def, C_NULL, src)::CodeInfo
     else
         isa(src, CodeInfo) || return nothing
     end
@@ -79,7 +79,7 @@ Parameters that control abstract interpretation-based type inference operation.
   can have a more fine-grained control on this configuration with per-module or per-method
   annotation basis.
 ---
-- `inf_params.max_union_splitting::Int = 4`\\
+- `inf_params.max_union_splitting::Int = 8`\\
   Specifies the maximum number of union-tuples to swap or expand before computing the set of
   matching methods or conditional types.
 ---
@@ -154,7 +154,7 @@ end
 function InferenceParams(
     params::InferenceParams = InferenceParams( # default constructor
         #=max_methods::Int=# 3,
-        #=max_union_splitting::Int=# 4,
+        #=max_union_splitting::Int=# 8,
         #=max_apply_union_enum::Int=# 8,
         #=max_tuple_splat::Int=# 32,
         #=tuple_complexity_limit_depth::Int=# 3,
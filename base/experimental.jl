@@ -160,15 +160,17 @@ macro max_methods(n::Int, fdef::Expr)
 end
 
 """
-    Experimental.@compiler_options optimize={0,1,2,3} compile={yes,no,all,min} infer={yes,no} max_methods={default,1,2,3,...}
+    Experimental.@compiler_options optimize={0,1,2,3} compile={yes,no,all,min,lazy} infer={yes,no} max_methods={default,1,2,3,...}
 
 Set compiler options for code in the enclosing module. Options correspond directly to
 command-line options with the same name, where applicable. The following options
 are currently supported:
 
   * `optimize`: Set optimization level.
-  * `compile`: Toggle native code compilation. Currently only `min` is supported, which
-    requests the minimum possible amount of compilation.
+  * `compile`: Toggle native code compilation. Currently only `min` and `lazy` are
+    supported: `min` requests the minimum possible amount of compilation, while `lazy`
+    runs methods in the interpreter until they have been called often enough to be
+    worth compiling natively.
   * `infer`: Enable or disable type inference. If disabled, implies [`@nospecialize`](@ref).
   * `max_methods`: Maximum number of matching methods considered when running type inference.
 """
@@ -183,7 +185,8 @@ macro compiler_options(args...)
                 a = #a === :no  ? 0 :
                     #a === :yes ? 1 :
                     #a === :all ? 2 :
-                    a === :min ? 3 : error("invalid argument to \"compile\" option")
+                    a === :min ? 3 :
+                    a === :lazy ? 4 : error("invalid argument to \"compile\" option")
                 push!(opts.args, Expr(:meta, :compile, a))
             elseif ex.args[1] === :infer
                 a = ex.args[2]
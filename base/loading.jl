@@ -2372,10 +2372,19 @@ function _read_dependency_src(io::IO, filename::AbstractString)
         filenamelen == 0 && break
         fn = String(read(io, filenamelen))
         len = read(io, UInt64)
-        if fn == filename
+        if len == typemax(UInt64)
+            # back-reference to an earlier entry with identical contents
+            offset = read(io, UInt64)
+            if fn == filename
+                seek(io, offset)
+                len = read(io, UInt64)
+                return String(read(io, len))
+            end
+        elseif fn == filename
             return String(read(io, len))
+        else
+            seek(io, position(io) + len)
         end
-        seek(io, position(io) + len)
     end
     error(filename, " is not stored in the source-text cache")
 end
@@ -2400,7 +2409,11 @@ function srctext_files(f::IO, srctextpos::Int64)
         fn = String(read(f, filenamelen))
         len = read(f, UInt64)
         push!(files, fn)
-        seek(f, position(f) + len)
+        if len == typemax(UInt64)
+            read(f, UInt64)   # skip the back-reference offset
+        else
+            seek(f, position(f) + len)
+        end
     end
     return files
 end
@@ -12,6 +12,7 @@ struct JLOptions
     nthreadpools::Int16
     nthreads::Int16
     nthreads_per_pool::Ptr{Int16}
+    ngcthreads::Int16
     nprocs::Int32
     machine_file::Ptr{UInt8}
     project::Ptr{UInt8}
@@ -54,6 +55,8 @@ struct JLOptions
     strip_metadata::Int8
     strip_ir::Int8
     heap_size_hint::UInt64
+    task_sleep_threshold::UInt64
+    gc_promotion_age::Int8
 end
 
 # This runs early in the sysimage != is not defined yet
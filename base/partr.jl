@@ -29,6 +29,78 @@ function unbias_cong(max::UInt32)
 end
 
 
+# work-stealing deques
+#
+# The heap multiqueue keeps strict priority order, but pays for it: every
+# insert and every deletemin probes randomly chosen locked heaps, and with
+# many threads spawning fine-grained tasks the missed probes and lock
+# handoffs come to dominate. Tasks at the default priority (the overwhelming
+# majority -- Base never sets any other) bypass the heaps and go through a
+# per-thread deque instead: the owning thread pushes and pops at the tail
+# for locality, and idle threads steal the oldest task from the head. Tasks
+# with a non-default priority still take the heap path, which preserves the
+# multiqueue's ordering semantics, and sticky tasks never reach here at all
+# (they use the per-thread Workqueues in task.jl).
+
+const default_priority = zero(UInt16)
+
+mutable struct taskdeque
+    const lock::SpinLock
+    const tasks::Vector{Task}
+    taskdeque() = new(SpinLock(), Vector{Task}())
+end
+
+# indexed by threadid; grown on demand, like Workqueues in task.jl
+global deques::Vector{taskdeque} = [taskdeque()]
+const deques_lock = SpinLock()
+
+function deque_for(tid::Int)
+    qs = deques
+    if length(qs) >= tid && isassigned(qs, tid)
+        return @inbounds qs[tid]
+    end
+    # slow path to allocate it
+    @lock deques_lock begin
+        qs = deques
+        if length(qs) < tid
+            nt = maxthreadid()
+            @assert tid <= nt
+            global deques = qs = copyto!(typeof(qs)(undef, length(qs) + nt - 1), qs)
+        end
+        if !isassigned(qs, tid)
+            @inbounds qs[tid] = taskdeque()
+        end
+        return @inbounds qs[tid]
+    end
+end
+
+function deque_pop(q::taskdeque, newest::Bool)
+    task = nothing
+    lock(q.lock)
+    if !isempty(q.tasks)
+        task = newest ? pop!(q.tasks) : popfirst!(q.tasks)
+    end
+    unlock(q.lock)
+    return task
+end
+
+# steal the oldest task from a random victim in our threadpool; FIFO theft
+# takes the task the owner is least likely to want back soon
+function deque_steal(tid::Int, tp::Int)
+    qs = deques
+    nq = UInt32(length(qs))
+    nq == 0 && return nothing
+    for _ = 1:4
+        vtid = Int(cong(nq, unbias_cong(nq)))
+        (vtid == tid || !isassigned(qs, vtid)) && continue
+        ccall(:jl_threadpoolid, Int8, (Int16,), vtid-1) + 1 == tp || continue
+        task = deque_pop(@inbounds(qs[vtid]), false)
+        task === nothing || return task
+    end
+    return nothing
+end
+
+
 function multiq_sift_up(heap::taskheap, idx::Int32)
     while idx > Int32(1)
         parent = (idx - Int32(2)) ÷ heap_d + Int32(1)
@@ -95,6 +167,20 @@ end
 
 function multiq_insert(task::Task, priority::UInt16)
     tpid = ccall(:jl_get_task_threadpoolid, Int8, (Any,), task)
+
+    tid = threadid()
+    if priority == default_priority &&
+            ccall(:jl_threadpoolid, Int8, (Int16,), tid-1) == tpid
+        # common case: push onto our own deque; thieves take from the head
+        task.priority = priority
+        q = deque_for(tid)
+        lock(q.lock)
+        push!(q.tasks, task)
+        unlock(q.lock)
+        return true
+    end
+
+    # prioritized task, or a cross-pool spawn: use the heap multiqueue
     heap_p = multiq_size(tpid)
     tp = tpid + 1
 
@@ -126,11 +212,50 @@ end
 
 
 function multiq_deletemin()
+    tid = Threads.threadid()
+    tp = ccall(:jl_threadpoolid, Int8, (Int16,), tid-1) + 1
+
+    @label retry
+    GC.safepoint()
+    # our own deque first: the newest task has the warmest working set
+    qs = deques
+    if length(qs) >= tid && isassigned(qs, tid)
+        q = @inbounds qs[tid]
+        task = deque_pop(q, true)
+        if task !== nothing
+            if ccall(:jl_set_task_tid, Cint, (Any, Cint), task, tid-1) == 0
+                # lost the claim race; put it back where a thief can find it
+                lock(q.lock)
+                pushfirst!(q.tasks, task)
+                unlock(q.lock)
+                @goto retry
+            end
+            return task
+        end
+    end
+
+    # any prioritized tasks waiting in the heap multiqueue?
+    task = multiq_deletemin_heaps(tp, tid)
+    task === nothing || return task
+
+    # out of local work: go steal some
+    task = deque_steal(tid, tp)
+    task === nothing && return nothing
+    if ccall(:jl_set_task_tid, Cint, (Any, Cint), task, tid-1) == 0
+        q = deque_for(tid)
+        lock(q.lock)
+        pushfirst!(q.tasks, task)
+        unlock(q.lock)
+        @goto retry
+    end
+    return task
+end
+
+
+function multiq_deletemin_heaps(tp::Int, tid::Int)
     local rn1, rn2
     local prio1, prio2
 
-    tid = Threads.threadid()
-    tp = ccall(:jl_threadpoolid, Int8, (Int16,), tid-1) + 1
     tpheaps = heaps[tp]
 
     @label retry
@@ -181,6 +306,12 @@ end
 
 
 function multiq_check_empty()
+    qs = deques
+    for i = 1:length(qs)
+        if isassigned(qs, i) && !isempty(@inbounds(qs[i]).tasks)
+            return false
+        end
+    end
     for j = UInt32(1):length(heaps)
         for i = UInt32(1):length(heaps[j])
             if heaps[j][i].ntasks != 0
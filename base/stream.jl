@@ -1034,6 +1034,22 @@ uv_write(s::LibuvStream, p::Vector{UInt8}) = GC.@preserve p uv_write(s, pointer(
 
 # caller must have acquired the iolock
 function uv_write(s::LibuvStream, p::Ptr{UInt8}, n::UInt)
+    ntotal = n
+    # attempt the write synchronously first: data the OS accepts immediately
+    # skips the request allocation, the loop wakeup, and the task round trip;
+    # errors are left for the queued path below to report as usual
+    if n > 0 && isopen(s)
+        nwritten = ccall(:jl_uv_try_write, Cssize_t,
+                         (Ptr{Cvoid}, Ptr{Cvoid}, UInt), s.handle, p, n)
+        if nwritten == n
+            iolock_end()
+            return Int(n)
+        end
+        if nwritten > 0
+            p += nwritten
+            n -= nwritten % UInt
+        end
+    end
     uvw = uv_write_async(s, p, n)
     ct = current_task()
     preserve_handle(ct)
@@ -1065,33 +1081,30 @@ function uv_write(s::LibuvStream, p::Ptr{UInt8}, n::UInt)
     if status < 0
         throw(_UVError("write", status))
     end
-    return Int(n)
+    # p/n were advanced past any partial synchronous write, so report the
+    # full count, not just the queued remainder
+    return Int(ntotal)
 end
 
 # helper function for uv_write that returns the uv_write_t struct for the write
 # rather than waiting on it, caller must hold the iolock
 function uv_write_async(s::LibuvStream, p::Ptr{UInt8}, n::UInt)
     check_open(s)
-    while true
-        uvw = Libc.malloc(_sizeof_uv_write)
-        uv_req_set_data(uvw, C_NULL) # in case we get interrupted before arriving at the wait call
-        nwrite = min(n, MAX_OS_WRITE) # split up the write into chunks the OS can handle.
-        # TODO: use writev instead of a loop
-        err = ccall(:jl_uv_write,
-                    Int32,
-                    (Ptr{Cvoid}, Ptr{Cvoid}, UInt, Ptr{Cvoid}, Ptr{Cvoid}),
-                    s, p, nwrite, uvw,
-                    @cfunction(uv_writecb_task, Cvoid, (Ptr{Cvoid}, Cint)))
-        if err < 0
-            Libc.free(uvw)
-            uv_error("write", err)
-        end
-        n -= nwrite
-        p += nwrite
-        if n == 0
-            return uvw
-        end
+    uvw = Libc.malloc(_sizeof_uv_write)
+    uv_req_set_data(uvw, C_NULL) # in case we get interrupted before arriving at the wait call
+    # writev-style submission: the write is split into chunks the OS can
+    # handle, but submitted as a single request with one callback
+    err = ccall(:jl_uv_write_chunked,
+                Int32,
+                (Ptr{Cvoid}, Ptr{Cvoid}, UInt, UInt, Ptr{Cvoid}, Ptr{Cvoid}),
+                s, p, n, MAX_OS_WRITE,
+                uvw,
+                @cfunction(uv_writecb_task, Cvoid, (Ptr{Cvoid}, Cint)))
+    if err < 0
+        Libc.free(uvw)
+        uv_error("write", err)
     end
+    return uvw
 end
 
 
@@ -20,6 +20,7 @@ JL_EXPORTED_DATA_SYMBOLS(XX)
 #define XX(name)    JL_DLLEXPORT void name(void);
 typedef void (anonfunc)(void);
 JL_RUNTIME_EXPORTED_FUNCS(XX)
+JL_RUNTIME_EXPORTED_FUNCS_FASTJMP(XX)
 #ifdef _OS_WINDOWS_
 JL_RUNTIME_EXPORTED_FUNCS_WIN(XX)
 #endif
@@ -29,6 +30,7 @@ JL_CODEGEN_EXPORTED_FUNCS(XX)
 // Define holder locations for function addresses as `const void * $(name)_addr = NULL;
 #define XX(name)    JL_HIDDEN anonfunc * name##_addr = NULL;
 JL_RUNTIME_EXPORTED_FUNCS(XX)
+JL_RUNTIME_EXPORTED_FUNCS_FASTJMP(XX)
 #ifdef _OS_WINDOWS_
 JL_RUNTIME_EXPORTED_FUNCS_WIN(XX)
 #endif
@@ -39,6 +41,7 @@ JL_CODEGEN_EXPORTED_FUNCS(XX)
 #define XX(name)    "i" #name,
 static const char *const jl_runtime_exported_func_names[] = {
     JL_RUNTIME_EXPORTED_FUNCS(XX)
+    JL_RUNTIME_EXPORTED_FUNCS_FASTJMP(XX)
 #ifdef _OS_WINDOWS_
     JL_RUNTIME_EXPORTED_FUNCS_WIN(XX)
 #endif
@@ -63,6 +66,7 @@ static const char *const jl_codegen_fallback_func_names[] = {
 #define XX(name)    &name##_addr,
 static anonfunc **const jl_runtime_exported_func_addrs[] = {
     JL_RUNTIME_EXPORTED_FUNCS(XX)
+    JL_RUNTIME_EXPORTED_FUNCS_FASTJMP(XX)
 #ifdef _OS_WINDOWS_
     JL_RUNTIME_EXPORTED_FUNCS_WIN(XX)
 #endif
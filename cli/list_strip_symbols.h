@@ -4,6 +4,7 @@
 #include "trampolines/common.h"
 #define XX(x) --strip-symbol=CNAME(x)
 JL_RUNTIME_EXPORTED_FUNCS(XX)
+JL_RUNTIME_EXPORTED_FUNCS_FASTJMP(XX)
 #ifdef _OS_WINDOWS_
 JL_RUNTIME_EXPORTED_FUNCS_WIN(XX)
 #endif
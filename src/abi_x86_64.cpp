@@ -165,10 +165,20 @@ void classifyType(Classification& accum, jl_datatype_t *dt, uint64_t offset) con
     }
 }
 
+// memoize the most recently classified type: every ccall argument is
+// classified twice (once by needPassByRef, once by preferred_llvm_type),
+// so the field walk only needs to run once per argument
+mutable jl_datatype_t *cached_dt = NULL;
+mutable Classification cached_cl;
+
 Classification classify(jl_datatype_t *dt) const
 {
+    if (dt == cached_dt)
+        return cached_cl;
     Classification cl;
     classifyType(cl, dt, 0);
+    cached_dt = dt;
+    cached_cl = cl;
     return cl;
 }
 
@@ -37,6 +37,7 @@
 #include <llvm/Transforms/Scalar/SimpleLoopUnswitch.h>
 #include <llvm/Transforms/Utils/SimplifyCFGOptions.h>
 #include <llvm/Transforms/Utils/ModuleUtils.h>
+#include <llvm/Transforms/Utils/SplitModule.h>
 #include <llvm/Passes/PassBuilder.h>
 #include <llvm/Passes/PassPlugin.h>
 #if defined(USE_POLLY)
@@ -49,15 +50,21 @@
 #endif
 
 // for outputting code
+#include <llvm/Bitcode/BitcodeReader.h>
 #include <llvm/Bitcode/BitcodeWriter.h>
 #include <llvm/Bitcode/BitcodeWriterPass.h>
 #include "llvm/Object/ArchiveWriter.h"
 #include <llvm/IR/IRPrintingPasses.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/xxhash.h>
 
 #include <llvm/IR/LegacyPassManagers.h>
 #include <llvm/Transforms/Utils/Cloning.h>
 #include <llvm/Linker/Linker.h>
 
+#include <thread>
+
 
 using namespace llvm;
 
@@ -525,6 +532,76 @@ static void injectCRTAlias(Module &M, StringRef name, StringRef alias, FunctionT
     builder.CreateRet(val);
 }
 
+// Number of threads to use when emitting object code for a native image.
+// Instruction selection and MC emission are function-at-a-time, so once the
+// optimization pipeline (which runs whole-module transforms such as
+// multiversioning) has finished, the module can be partitioned and lowered
+// to machine code concurrently.
+static unsigned jl_image_emission_threads(void)
+{
+#if LLVM_ENABLE_THREADS
+    int nthreads = 0;
+    if (char *env = getenv("JULIA_IMAGE_THREADS"))
+        nthreads = atoi(env);
+    if (nthreads <= 0)
+        nthreads = jl_cpu_threads() / 2;
+    return nthreads < 1 ? 1 : nthreads;
+#else
+    return 1;
+#endif
+}
+
+// Optional on-disk cache for sharded object emission, enabled by pointing
+// JULIA_IMAGE_CACHE at a directory. Shards are keyed by a hash of their
+// optimized bitcode together with the target configuration, so rebuilding an
+// image after editing a few methods only runs instruction selection and MC
+// emission for the shards whose code actually changed; the rest are patched
+// in from the objects a previous build left behind. Imaging-mode IR refers
+// to runtime objects through the gvar table instead of embedded addresses,
+// so unchanged code reliably hashes the same across processes (unlike the
+// in-memory JIT cache in jitlayers.cpp, which could never hit on disk).
+// The cache is append-only; prune it externally if it grows too large.
+static std::string jl_image_shard_cache_file(StringRef bitcode, TargetMachine &TM)
+{
+    char *env = getenv("JULIA_IMAGE_CACHE");
+    if (!env || !*env)
+        return std::string();
+    std::string config = (TM.getTargetTriple().str() + Twine("+") +
+                          TM.getTargetCPU() + Twine("+") +
+                          TM.getTargetFeatureString()).str();
+    uint64_t hash = xxHash64(bitcode) ^ xxHash64(config);
+    return (Twine(env) + "/" + Twine::utohexstr(hash) + ".o").str();
+}
+
+static bool jl_image_shard_cache_load(const std::string &file, SmallVectorImpl<char> &obj)
+{
+    if (file.empty())
+        return false;
+    auto buf = MemoryBuffer::getFile(file);
+    if (!buf)
+        return false;
+    StringRef data = (*buf)->getBuffer();
+    obj.append(data.begin(), data.end());
+    return true;
+}
+
+static void jl_image_shard_cache_store(const std::string &file, const SmallVectorImpl<char> &obj)
+{
+    if (file.empty())
+        return;
+    // write to a unique temporary and rename it into place, so that
+    // concurrent builds sharing a cache directory never read a partial file
+    SmallString<256> tmp;
+    int fd;
+    if (sys::fs::createUniqueFile(file + ".tmp%%%%%%", fd, tmp))
+        return;
+    raw_fd_ostream OS(fd, /*shouldClose*/true);
+    OS.write(obj.data(), obj.size());
+    OS.close();
+    if (OS.has_error() || sys::fs::rename(tmp, file))
+        sys::fs::remove(tmp);
+}
+
 
 // takes the running content that has collected in the shadow module and dump it to disk
 // this builds the object file portion of the sysimage files for fast startup
@@ -550,26 +627,29 @@ void jl_dump_native_impl(void *native_code,
     TheTriple.setObjectFormat(Triple::MachO);
     TheTriple.setOS(llvm::Triple::MacOSX);
 #endif
-    std::unique_ptr<TargetMachine> TM(
-        jl_ExecutionEngine->getTarget().createTargetMachine(
-            TheTriple.getTriple(),
-            jl_ExecutionEngine->getTargetCPU(),
-            jl_ExecutionEngine->getTargetFeatureString(),
-            jl_ExecutionEngine->getTargetOptions(),
+    auto createTM = [&TheTriple]() {
+        return std::unique_ptr<TargetMachine>(
+            jl_ExecutionEngine->getTarget().createTargetMachine(
+                TheTriple.getTriple(),
+                jl_ExecutionEngine->getTargetCPU(),
+                jl_ExecutionEngine->getTargetFeatureString(),
+                jl_ExecutionEngine->getTargetOptions(),
 #if defined(_OS_LINUX_) || defined(_OS_FREEBSD_)
-            Reloc::PIC_,
+                Reloc::PIC_,
 #else
-            Optional<Reloc::Model>(),
+                Optional<Reloc::Model>(),
 #endif
 #if defined(_CPU_PPC_) || defined(_CPU_PPC64_)
-            // On PPC the small model is limited to 16bit offsets
-            CodeModel::Medium,
+                // On PPC the small model is limited to 16bit offsets
+                CodeModel::Medium,
 #else
-            // Use small model so that we can use signed 32bits offset in the function and GV tables
-            CodeModel::Small,
+                // Use small model so that we can use signed 32bits offset in the function and GV tables
+                CodeModel::Small,
 #endif
-            CodeGenOpt::Aggressive // -O3 TODO: respect command -O0 flag?
-            ));
+                CodeGenOpt::Aggressive // -O3 TODO: respect command -O0 flag?
+                ));
+    };
+    std::unique_ptr<TargetMachine> TM = createTM();
 
 
     // set up optimization passes
@@ -644,7 +724,7 @@ void jl_dump_native_impl(void *native_code,
     }
 
     // do the actual work
-    auto add_output = [&] (Module &M, StringRef unopt_bc_Name, StringRef bc_Name, StringRef obj_Name, StringRef asm_Name, bool inject_crt) {
+    auto add_output = [&] (Module &M, StringRef unopt_bc_Name, StringRef bc_Name, StringRef obj_Name, StringRef asm_Name, bool inject_crt, unsigned nshards) {
         preopt.run(M, empty.MAM);
         if (bc_fname || obj_fname || asm_fname) {
             assert(!verifyModule(M, &errs()));
@@ -695,19 +775,67 @@ void jl_dump_native_impl(void *native_code,
             };
         }
 
-        emitter.run(M);
+        // The bitcode outputs above are whole-module; only object emission can
+        // be sharded. The emitter pass manager writes the assembly output from
+        // the same run, so a requested assembly file forces the serial path.
+        bool sharded = nshards > 1 && obj_fname && !asm_fname;
+        if (sharded) {
+            // Partition the module and round-trip each part through bitcode so
+            // that every worker gets an independent LLVMContext. Locals shared
+            // between partitions are externalized by SplitModule; the objects
+            // all end up in the same archive, which is linked whole, so the
+            // extra members and symbols are transparent to the final image.
+            SmallVector<SmallVector<char, 0>, 16> shard_bc;
+            SplitModule(M, nshards, [&](std::unique_ptr<Module> MPart) {
+                shard_bc.emplace_back();
+                raw_svector_ostream shard_OS(shard_bc.back());
+                WriteBitcodeToFile(*MPart, shard_OS);
+            }, false);
+            size_t nparts = shard_bc.size();
+            SmallVector<SmallVector<char, 0>, 16> shard_obj(nparts);
+            std::vector<std::thread> workers;
+            for (size_t i = 0; i < nparts; i++) {
+                workers.emplace_back([&, i]() {
+                    auto PartTM = createTM();
+                    StringRef bc(shard_bc[i].data(), shard_bc[i].size());
+                    std::string cachefile = jl_image_shard_cache_file(bc, *PartTM);
+                    if (jl_image_shard_cache_load(cachefile, shard_obj[i]))
+                        return;
+                    LLVMContext PartCtx;
+                    auto MPart = cantFail(parseBitcodeFile(
+                            MemoryBufferRef(bc, obj_Name), PartCtx));
+                    legacy::PassManager PartPM;
+                    addTargetPasses(&PartPM, PartTM->getTargetTriple(), PartTM->getTargetIRAnalysis());
+                    raw_svector_ostream PartOS(shard_obj[i]);
+                    if (!PartTM->addPassesToEmitFile(PartPM, PartOS, nullptr, CGFT_ObjectFile, false)) {
+                        PartPM.run(*MPart);
+                        jl_image_shard_cache_store(cachefile, shard_obj[i]);
+                    }
+                });
+            }
+            for (auto &w : workers)
+                w.join();
+            for (size_t i = 0; i < nparts; i++) {
+                std::string name = i == 0 ? obj_Name.str() :
+                    (obj_Name.drop_back(2) + Twine("_") + Twine(i) + Twine(".o")).str();
+                emit_result(obj_Archive, shard_obj[i], name, outputs);
+            }
+        }
+        else {
+            emitter.run(M);
+        }
 
         if (unopt_bc_fname)
             emit_result(unopt_bc_Archive, unopt_bc_Buffer, unopt_bc_Name, outputs);
         if (bc_fname)
             emit_result(bc_Archive, bc_Buffer, bc_Name, outputs);
-        if (obj_fname)
+        if (obj_fname && !sharded)
             emit_result(obj_Archive, obj_Buffer, obj_Name, outputs);
         if (asm_fname)
             emit_result(asm_Archive, asm_Buffer, asm_Name, outputs);
     };
 
-    add_output(*dataM, "unopt.bc", "text.bc", "text.o", "text.s", true);
+    add_output(*dataM, "unopt.bc", "text.bc", "text.o", "text.s", true, jl_image_emission_threads());
 
     orc::ThreadSafeModule sysimage(std::make_unique<Module>("sysimage", Context), TSCtx);
     auto sysimageM = sysimage.getModuleUnlocked();
@@ -730,7 +858,8 @@ void jl_dump_native_impl(void *native_code,
                                      GlobalVariable::ExternalLinkage,
                                      len, "jl_system_image_size"));
     }
-    add_output(*sysimageM, "data.bc", "data.bc", "data.o", "data.s", false);
+    // the data module is dominated by one huge constant and gains nothing from sharding
+    add_output(*sysimageM, "data.bc", "data.bc", "data.o", "data.s", false, 1);
 
     object::Archive::Kind Kind = getDefaultForHost(TheTriple);
     if (unopt_bc_fname)
@@ -11,6 +11,13 @@
 #include "julia.h"
 #include "julia_internal.h"
 #include "julia_assert.h"
+#include "support/ios.h"
+#ifndef _OS_WINDOWS_
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -138,18 +145,22 @@ static jl_array_t *_new_array_(jl_value_t *atype, uint32_t ndims, size_t *dims,
         data = (char*)a + doffs;
     }
     else {
-        data = jl_gc_managed_malloc(tot);
+        // Let the allocator do the zeroing: large buffers come from fresh
+        // kernel mappings that are already zero-filled, making the memset
+        // (and the eager page commit it causes) unnecessary.
+        data = zeroinit ? jl_gc_managed_malloc_zeroed(tot) : jl_gc_managed_malloc(tot);
         // Allocate the Array **after** allocating the data
         // to make sure the array is still young
         a = (jl_array_t*)jl_gc_alloc(ct->ptls, tsz, atype);
         // No allocation or safepoint allowed after this
         a->flags.how = 2;
         jl_gc_track_malloced_array(ct->ptls, a);
+        zeroinit = 0;
     }
     a->flags.pooled = tsz <= GC_MAX_SZCLASS;
 
     if (zeroinit)
-        memset(data, 0, tot);
+        jl_memset(data, 0, tot);
     a->data = data;
     if (JL_ARRAY_IMPL_NUL && elsz == 1)
         ((char*)data)[tot - 1] = '\0';
@@ -516,11 +527,35 @@ JL_DLLEXPORT jl_value_t *jl_alloc_string(size_t len)
     return s;
 }
 
+// Cache of recently created small strings, keyed by content hash. Workloads
+// that convert the same few byte sequences over and over (field names, log
+// keys, short tokens) get back a shared heap object instead of a fresh
+// allocation each time. Sharing is invisible to user code: `===`, `objectid`
+// and string hashing all compare strings by contents rather than by address.
+// Only `jl_pchar_to_string` consults the cache -- strings from
+// `jl_alloc_string` are handed out with uninitialized contents for the
+// caller to fill in, so they are never shared. Entries are published with
+// a racy store (a lost entry only costs a duplicate allocation) and are
+// kept alive by `mark_roots` in gc.c while resident.
+_Atomic(jl_value_t*) jl_small_string_cache[N_SMALL_STRING_CACHE] JL_GLOBALLY_ROOTED;
+
 JL_DLLEXPORT jl_value_t *jl_pchar_to_string(const char *str, size_t len)
 {
+    if (len == 0)
+        return jl_an_empty_string;
+    _Atomic(jl_value_t*) *slot = NULL;
+    if (len <= SMALL_STRING_MAX_LEN) {
+        uint32_t hv = memhash32_seed(str, len, 0xedc3b677);
+        slot = &jl_small_string_cache[hv & (N_SMALL_STRING_CACHE - 1)];
+        jl_value_t *cached = jl_atomic_load_acquire(slot);
+        if (cached != NULL && jl_string_len(cached) == len &&
+            memcmp(jl_string_data(cached), str, len) == 0)
+            return cached;
+    }
     jl_value_t *s = jl_alloc_string(len);
-    if (len > 0)
-        memcpy(jl_string_data(s), str, len);
+    memcpy(jl_string_data(s), str, len);
+    if (slot != NULL)
+        jl_atomic_store_release(slot, s);
     return s;
 }
 
@@ -728,7 +763,7 @@ static void NOINLINE array_try_unshare(jl_array_t *a)
         int newbuf = array_resize_buffer(a, len);
         assert(newbuf);
         (void)newbuf;
-        memcpy(a->data, olddata, nbytes);
+        jl_memcpy(a->data, olddata, nbytes);
     }
 }
 
@@ -1181,13 +1216,188 @@ JL_DLLEXPORT jl_array_t *jl_array_copy(jl_array_t *ary)
     jl_array_t *new_ary = _new_array_(jl_typeof(ary), jl_array_ndims(ary),
                                       &ary->nrows, !ary->flags.ptrarray,
                                       ary->flags.hasptr, isunion, 0, elsz);
-    memcpy(new_ary->data, ary->data, len * elsz);
+    // the copy's buffer is freshly allocated and will usually not be read
+    // before the caller is done, so prefer non-temporal stores
+    jl_memcpy_nt(new_ary->data, ary->data, len * elsz);
     // ensure isbits union arrays copy their selector bytes correctly
     if (jl_array_isbitsunion(ary))
         memcpy(jl_array_typetagdata(new_ary), jl_array_typetagdata(ary), len);
     return new_ary;
 }
 
+// Bulk comparison of two arrays. Arrays of padding-free elements without
+// pointers compare with a single memcmp over the element bytes (libc already
+// selects the widest compares the CPU offers); everything else falls back to
+// element-wise egal.
+JL_DLLEXPORT int jl_array_isequal_bits(jl_array_t *a, jl_array_t *b)
+{
+    if (a == b)
+        return 1;
+    if (jl_typeof(a) != jl_typeof(b))
+        return 0;
+    size_t len = jl_array_len(a);
+    if (len != jl_array_len(b))
+        return 0;
+    if (len == 0)
+        return 1;
+    jl_value_t *eltype = jl_tparam0(jl_typeof(a));
+    if (!a->flags.ptrarray && !a->flags.hasptr && !jl_is_uniontype(eltype) &&
+        !((jl_datatype_t*)eltype)->layout->haspadding)
+        return memcmp(a->data, b->data, len * a->elsize) == 0;
+    // isbits union arrays may carry garbage in the unused tail of each
+    // element slot, and padded or pointer-containing elements must compare
+    // field-by-field
+    int eq = 1;
+    jl_value_t *x = NULL, *y = NULL;
+    JL_GC_PUSH2(&x, &y);
+    for (size_t i = 0; i < len; i++) {
+        x = jl_arrayref(a, i);
+        y = jl_arrayref(b, i);
+        if (!jl_egal(x, y)) {
+            eq = 0;
+            break;
+        }
+    }
+    JL_GC_POP();
+    return eq;
+}
+
+// Strided bulk copy for arrays of pointer-free elements: copy `n` elements
+// from `src` starting at element `soffs` with stride `ss` into `dest` at
+// `doffs` with stride `ds` (all in elements, 0-indexed offsets). Contiguous
+// copies collapse to a single memmove; strided ones move fixed-width
+// elements, which vectorizes to the widest loads/stores available.
+JL_DLLEXPORT void jl_array_copyto_strided(jl_array_t *dest, size_t doffs, size_t ds,
+                                          jl_array_t *src, size_t soffs, size_t ss, size_t n)
+{
+    if (dest->flags.ptrarray || dest->flags.hasptr ||
+        src->flags.ptrarray || src->flags.hasptr ||
+        jl_array_isbitsunion(dest) || jl_array_isbitsunion(src))
+        jl_exceptionf(jl_argumenterror_type,
+                      "strided copy: element type must not contain pointers");
+    size_t elsz = dest->elsize;
+    if (elsz != src->elsize)
+        jl_exceptionf(jl_argumenterror_type, "strided copy: element sizes must match");
+    if (n == 0)
+        return;
+    if (ds == 0 || ss == 0 ||
+        doffs >= jl_array_len(dest) || (n - 1) > (jl_array_len(dest) - 1 - doffs) / ds ||
+        soffs >= jl_array_len(src) || (n - 1) > (jl_array_len(src) - 1 - soffs) / ss)
+        jl_bounds_error_int((jl_value_t*)dest, doffs + (n - 1) * ds + 1);
+    char *dp = (char*)dest->data + doffs * elsz;
+    const char *sp = (const char*)src->data + soffs * elsz;
+    if (ds == 1 && ss == 1) {
+        memmove(dp, sp, n * elsz);
+        return;
+    }
+    size_t dstep = ds * elsz;
+    size_t sstep = ss * elsz;
+#define COPY_STRIDED(type) \
+        for (size_t i = 0; i < n; i++) { \
+            *(type*)dp = *(const type*)sp; \
+            dp += dstep; \
+            sp += sstep; \
+        } \
+        break
+    switch (elsz) {
+    case 1: COPY_STRIDED(uint8_t);
+    case 2: COPY_STRIDED(uint16_t);
+    case 4: COPY_STRIDED(uint32_t);
+    case 8: COPY_STRIDED(uint64_t);
+    default:
+        for (size_t i = 0; i < n; i++) {
+            memcpy(dp, sp, elsz);
+            dp += dstep;
+            sp += sstep;
+        }
+    }
+#undef COPY_STRIDED
+}
+
+// Field-major (struct-of-arrays) staging for arrays of inline-stored
+// structs. `jl_array_gather_field` copies field `fld` (1-based) of every
+// element into a freshly allocated dense array of the field's type;
+// `jl_array_scatter_field` writes such a dense array back into the field
+// slots. The fixed-width strided loops vectorize, so a hot numeric kernel
+// can gather the fields it touches into contiguous buffers, run SIMD over
+// them, and scatter the results back — field-major access over an
+// array-of-structs without hand-maintained parallel arrays. Only bits-type
+// fields qualify: boxed or pointer-carrying fields would need write
+// barriers, and are not vectorizable anyway.
+
+static jl_datatype_t *array_field_check(jl_array_t *a, size_t fld, const char *fname)
+{
+    jl_value_t *eltype = jl_tparam0(jl_typeof(a));
+    if (a->flags.ptrarray || !jl_is_datatype(eltype) ||
+            ((jl_datatype_t*)eltype)->layout == NULL || jl_array_isbitsunion(a))
+        jl_exceptionf(jl_argumenterror_type,
+                      "%s: expected an array with inline struct elements", fname);
+    jl_datatype_t *et = (jl_datatype_t*)eltype;
+    if (fld < 1 || fld > jl_datatype_nfields(et))
+        jl_bounds_error_int(eltype, fld);
+    if (jl_field_isptr(et, fld - 1) || !jl_isbits(jl_field_type_concrete(et, fld - 1)))
+        jl_exceptionf(jl_argumenterror_type,
+                      "%s: field %zd is not of bits type", fname, fld);
+    return et;
+}
+
+static void strided_field_copy(char *dp, size_t dstep, const char *sp, size_t sstep,
+                               size_t n, size_t fsz) JL_NOTSAFEPOINT
+{
+#define COPY_FIELD(type) \
+        for (size_t i = 0; i < n; i++) { \
+            *(type*)dp = *(const type*)sp; \
+            dp += dstep; \
+            sp += sstep; \
+        } \
+        break
+    switch (fsz) {
+    case 1: COPY_FIELD(uint8_t);
+    case 2: COPY_FIELD(uint16_t);
+    case 4: COPY_FIELD(uint32_t);
+    case 8: COPY_FIELD(uint64_t);
+    default:
+        for (size_t i = 0; i < n; i++) {
+            memcpy(dp, sp, fsz);
+            dp += dstep;
+            sp += sstep;
+        }
+    }
+#undef COPY_FIELD
+}
+
+JL_DLLEXPORT jl_array_t *jl_array_gather_field(jl_array_t *a, size_t fld)
+{
+    jl_datatype_t *et = array_field_check(a, fld, "gather_field");
+    size_t offs = jl_field_offset(et, fld - 1);
+    size_t fsz = jl_field_size(et, fld - 1);
+    size_t len = jl_array_len(a);
+    jl_value_t *atype = jl_apply_array_type(jl_field_type_concrete(et, fld - 1), 1);
+    jl_array_t *dest;
+    JL_GC_PUSH1(&atype);
+    dest = jl_alloc_array_1d(atype, len);
+    JL_GC_POP();
+    strided_field_copy((char*)dest->data, dest->elsize,
+                       (const char*)a->data + offs, a->elsize, len, fsz);
+    return dest;
+}
+
+JL_DLLEXPORT void jl_array_scatter_field(jl_array_t *a, size_t fld, jl_array_t *vals)
+{
+    jl_datatype_t *et = array_field_check(a, fld, "scatter_field");
+    if (jl_tparam0(jl_typeof(vals)) != jl_field_type_concrete(et, fld - 1))
+        jl_exceptionf(jl_argumenterror_type,
+                      "scatter_field: value array element type must match the field type");
+    size_t len = jl_array_len(a);
+    if (jl_array_len(vals) != len)
+        jl_exceptionf(jl_argumenterror_type,
+                      "scatter_field: value array length must match");
+    size_t offs = jl_field_offset(et, fld - 1);
+    size_t fsz = jl_field_size(et, fld - 1);
+    strided_field_copy((char*)a->data + offs, a->elsize,
+                       (const char*)vals->data, vals->elsize, len, fsz);
+}
+
 // Copy element by element until we hit a young object, at which point
 // we can finish by using `memmove`.
 static NOINLINE ssize_t jl_array_ptr_copy_forward(jl_value_t *owner,
@@ -1320,6 +1530,198 @@ JL_DLLEXPORT jl_array_t *jl_array_cconvert_cstring(jl_array_t *a)
     return a;
 }
 
+// dump/restore of arrays of pointer-free elements as a small header plus the
+// raw element bytes. The data is placed at a fixed page-aligned file offset so
+// that restore can alias it with a copy-on-write mapping instead of copying.
+
+#define JL_ARRAY_DUMP_MAGIC ((uint64_t)0x504d445252414c4a) // "JLARRDMP"
+#define JL_ARRAY_DUMP_VERSION 1
+// file offset of the element data; a multiple of the page size on every
+// supported platform, so mapping the whole file exposes it page-aligned
+#define JL_ARRAY_DUMP_DATA_OFFSET 4096
+
+typedef struct {
+    uint64_t magic;
+    uint16_t version;
+    uint16_t elsize;
+    uint16_t ndims;
+    uint16_t reserved;
+    uint64_t nel;
+    // followed by ndims uint64_t dimension sizes
+} jl_array_dump_header_t;
+
+JL_DLLEXPORT void jl_array_dump_file(jl_array_t *a, const char *fname)
+{
+    jl_value_t *eltype = jl_tparam0(jl_typeof(a));
+    if (a->flags.ptrarray || a->flags.hasptr || jl_is_uniontype(eltype))
+        jl_exceptionf(jl_argumenterror_type,
+                      "array dump: element type must not contain pointers");
+    size_t ndims = jl_array_ndims(a);
+    if (sizeof(jl_array_dump_header_t) + ndims * sizeof(uint64_t) > JL_ARRAY_DUMP_DATA_OFFSET)
+        jl_exceptionf(jl_argumenterror_type, "array dump: invalid Array dimensions");
+    ios_t s;
+    if (ios_file(&s, fname, 1, 1, 1, 1) == NULL)
+        jl_errorf("cannot open array dump file \"%s\" for writing", fname);
+    jl_array_dump_header_t hdr;
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.magic = JL_ARRAY_DUMP_MAGIC;
+    hdr.version = JL_ARRAY_DUMP_VERSION;
+    hdr.elsize = a->elsize;
+    hdr.ndims = ndims;
+    hdr.nel = jl_array_len(a);
+    ios_write(&s, (const char*)&hdr, sizeof(hdr));
+    size_t *adims = &a->nrows;
+    for (size_t i = 0; i < ndims; i++) {
+        uint64_t d = adims[i];
+        ios_write(&s, (const char*)&d, sizeof(d));
+    }
+    // the gap up to the data offset reads back as zeros
+    ios_seek(&s, JL_ARRAY_DUMP_DATA_OFFSET);
+    size_t nbytes = hdr.nel * a->elsize;
+    size_t nwritten = ios_write(&s, (const char*)a->data, nbytes);
+    ios_close(&s);
+    if (nwritten != nbytes)
+        jl_errorf("failed to write array dump file \"%s\"", fname);
+}
+
+// validate a dump header against the element layout the caller requested;
+// returns the number of elements, or throws
+static size_t jl_array_dump_check(const jl_array_dump_header_t *hdr, const uint64_t *fdims,
+                                  size_t elsz, size_t databytes, const char *fname)
+{
+    if (hdr->magic != JL_ARRAY_DUMP_MAGIC || hdr->version != JL_ARRAY_DUMP_VERSION)
+        jl_errorf("\"%s\" is not an array dump file", fname);
+    if (hdr->elsize != elsz)
+        jl_errorf("array dump file \"%s\" has element size %d, expected %zd",
+                  fname, (int)hdr->elsize, elsz);
+    size_t ndims = hdr->ndims;
+    if (ndims == 0 ||
+        sizeof(jl_array_dump_header_t) + ndims * sizeof(uint64_t) > JL_ARRAY_DUMP_DATA_OFFSET)
+        jl_errorf("array dump file \"%s\" has invalid dimensions", fname);
+    wideint_t prod = 1;
+    for (size_t i = 0; i < ndims; i++) {
+        prod *= (wideint_t)fdims[i];
+        if (prod > (wideint_t)MAXINTVAL)
+            jl_errorf("array dump file \"%s\" has invalid dimensions", fname);
+    }
+    size_t nel = (size_t)prod;
+    if (nel != hdr->nel || nel * elsz > databytes)
+        jl_errorf("array dump file \"%s\" is truncated", fname);
+    return nel;
+}
+
+#ifndef _OS_WINDOWS_
+static void jl_array_dump_unmap(void *v) JL_NOTSAFEPOINT
+{
+    jl_array_t *a = (jl_array_t*)v;
+    char *base = (char*)a->data - JL_ARRAY_DUMP_DATA_OFFSET;
+    jl_array_dump_header_t *hdr = (jl_array_dump_header_t*)base;
+    munmap(base, JL_ARRAY_DUMP_DATA_OFFSET + hdr->nel * hdr->elsize);
+}
+#endif
+
+JL_DLLEXPORT jl_array_t *jl_array_restore_mmap(jl_value_t *atype, const char *fname)
+{
+    jl_task_t *ct = jl_current_task;
+    if (!jl_is_array_type(atype))
+        jl_exceptionf(jl_argumenterror_type, "array restore: expected an Array type");
+    jl_value_t *eltype = jl_tparam0(atype);
+    if (!jl_stored_inline(eltype) || jl_is_uniontype(eltype) ||
+        ((jl_datatype_t*)eltype)->layout->npointers > 0)
+        jl_exceptionf(jl_argumenterror_type,
+                      "array restore: element type must not contain pointers");
+    size_t elsz = LLT_ALIGN(jl_datatype_size(eltype), jl_datatype_align(eltype));
+#ifndef _OS_WINDOWS_
+    int fd = open(fname, O_RDONLY);
+    if (fd == -1)
+        jl_errorf("cannot open array dump file \"%s\"", fname);
+    struct stat stbuf;
+    if (fstat(fd, &stbuf) == -1 || (size_t)stbuf.st_size < JL_ARRAY_DUMP_DATA_OFFSET) {
+        close(fd);
+        jl_errorf("\"%s\" is not an array dump file", fname);
+    }
+    size_t fsz = (size_t)stbuf.st_size;
+    // MAP_PRIVATE gives copy-on-write aliasing: pages are shared with the
+    // page cache until (unless) the array is written to
+    char *base = (char*)mmap(NULL, fsz, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
+        jl_errorf("cannot map array dump file \"%s\"", fname);
+    jl_array_dump_header_t *hdr = (jl_array_dump_header_t*)base;
+    uint64_t *fdims = (uint64_t*)(base + sizeof(jl_array_dump_header_t));
+    size_t nel = 0;
+    JL_TRY {
+        nel = jl_array_dump_check(hdr, fdims, elsz, fsz - JL_ARRAY_DUMP_DATA_OFFSET, fname);
+    }
+    JL_CATCH {
+        munmap(base, fsz);
+        jl_rethrow();
+    }
+    size_t ndims = hdr->ndims;
+    int ndimwords = jl_array_ndimwords(ndims);
+    int tsz = sizeof(jl_array_t) + ndimwords*sizeof(size_t);
+    jl_array_t *a = (jl_array_t*)jl_gc_alloc(ct->ptls, tsz, atype);
+    // No allocation or safepoint allowed after this
+    a->flags.pooled = tsz <= GC_MAX_SZCLASS;
+    a->data = base + JL_ARRAY_DUMP_DATA_OFFSET;
+    a->length = nel;
+    a->elsize = elsz;
+    a->flags.ptrarray = 0;
+    a->flags.hasptr = 0;
+    a->flags.ndims = ndims;
+    a->offset = 0;
+    a->flags.isshared = 1;
+    a->flags.isaligned = 0;
+    a->flags.how = 0;
+    if (a->flags.ndims != ndims) {
+        munmap(base, fsz);
+        jl_exceptionf(jl_argumenterror_type, "invalid Array dimensions");
+    }
+    size_t *adims = &a->nrows;
+    for (size_t i = 0; i < ndims; i++)
+        adims[i] = fdims[i];
+    if (ndims == 1)
+        a->maxsize = nel;
+    jl_gc_add_ptr_finalizer(ct->ptls, (jl_value_t*)a, (void*)jl_array_dump_unmap);
+    return a;
+#else
+    // no copy-on-write file mappings to lean on here; read the data into a
+    // freshly-allocated array instead
+    ios_t s;
+    if (ios_file(&s, fname, 1, 0, 0, 0) == NULL)
+        jl_errorf("cannot open array dump file \"%s\"", fname);
+    int64_t fsz = ios_filesize(&s);
+    jl_array_dump_header_t hdr;
+    uint64_t fdims[(JL_ARRAY_DUMP_DATA_OFFSET - sizeof(jl_array_dump_header_t)) / sizeof(uint64_t)];
+    if (fsz < JL_ARRAY_DUMP_DATA_OFFSET ||
+        ios_read(&s, (char*)&hdr, sizeof(hdr)) != sizeof(hdr) ||
+        hdr.ndims == 0 || hdr.ndims > sizeof(fdims) / sizeof(uint64_t) ||
+        ios_read(&s, (char*)fdims, hdr.ndims * sizeof(uint64_t)) != hdr.ndims * sizeof(uint64_t)) {
+        ios_close(&s);
+        jl_errorf("\"%s\" is not an array dump file", fname);
+    }
+    size_t nel = 0;
+    JL_TRY {
+        nel = jl_array_dump_check(&hdr, fdims, elsz, (size_t)fsz - JL_ARRAY_DUMP_DATA_OFFSET, fname);
+    }
+    JL_CATCH {
+        ios_close(&s);
+        jl_rethrow();
+    }
+    size_t dims[sizeof(fdims) / sizeof(uint64_t)];
+    for (size_t i = 0; i < hdr.ndims; i++)
+        dims[i] = fdims[i];
+    jl_array_t *a = _new_array(atype, hdr.ndims, dims);
+    ios_seek(&s, JL_ARRAY_DUMP_DATA_OFFSET);
+    size_t nread = ios_readall(&s, (char*)a->data, nel * elsz);
+    ios_close(&s);
+    if (nread != nel * elsz)
+        jl_errorf("array dump file \"%s\" is truncated", fname);
+    (void)ct;
+    return a;
+#endif
+}
+
 #ifdef __cplusplus
 }
 #endif
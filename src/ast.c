@@ -1161,6 +1161,168 @@ JL_DLLEXPORT jl_value_t *jl_macroexpand1(jl_value_t *expr, jl_module_t *inmodule
     return expr;
 }
 
+// Lowering memo table. After macro expansion, most statements lower to a form
+// that depends only on the tree, the module, and the starting location, so
+// identical statements (@eval loops, generated code) can reuse the lowered form
+// instead of taking another round trip through flisp. Lowering is not always
+// replayable, however: closure types and keyword sorters are named from a
+// per-module counter (`current-julia-module-counter` in julia-syntax.scm), and
+// replaying such a form would make two evaluations define (and overwrite) the
+// same global name. Results mentioning any counter-derived name are therefore
+// never inserted; see lowering_is_counter_free. Keys compare mutable leaves
+// (interpolated arrays, functions, etc.) by identity, so a hit can only share
+// literals that were already the same object, and both the stored form and
+// every returned form are deep copies, keeping later in-place mutation (e.g.
+// global resolution during method definition) out of the cache.
+#define LOWERING_CACHE_LEN 256 // power of two; direct-mapped with eviction
+jl_array_t *jl_lowering_cache JL_GLOBALLY_ROOTED = NULL; // 3 slots per entry: AST key, module, lowered form
+typedef struct {
+    uintptr_t hash;
+    jl_sym_t *file; // interned, no rooting needed
+    int32_t line;
+    int32_t kind;   // which lowering entry point made the entry
+} jl_lowering_cache_key_t;
+static jl_lowering_cache_key_t lowering_cache_keys[LOWERING_CACHE_LEN];
+static jl_mutex_t lowering_cache_lock;
+
+#define LOWERING_KIND_THUNK 0
+#define LOWERING_KIND_STMT  1
+#define LOWERING_KIND_WARN  2
+
+static uintptr_t lowering_expr_hash(jl_value_t *v, int depth)
+{
+    if (jl_is_expr(v)) {
+        jl_expr_t *e = (jl_expr_t*)v;
+        uintptr_t h = jl_object_id((jl_value_t*)e->head);
+        if (depth > 0) {
+            size_t i, n = jl_expr_nargs(e);
+            h = bitmix(h, n);
+            for (i = 0; i < n; i++)
+                h = bitmix(h, lowering_expr_hash(jl_exprarg(e, i), depth - 1));
+        }
+        return h;
+    }
+    if (jl_is_quotenode(v) && depth > 0)
+        return bitmix(0x7e907ecd, lowering_expr_hash(jl_quotenode_value(v), depth - 1));
+    // immutable values hash structurally and mutable ones by identity,
+    // matching the comparison below
+    return jl_object_id(v);
+}
+
+static int lowering_expr_egal(jl_value_t *a, jl_value_t *b)
+{
+    if (a == b)
+        return 1;
+    jl_value_t *ta = jl_typeof(a);
+    if (ta != jl_typeof(b))
+        return 0;
+    if (ta == (jl_value_t*)jl_expr_type) {
+        jl_expr_t *ea = (jl_expr_t*)a;
+        jl_expr_t *eb = (jl_expr_t*)b;
+        size_t i, n = jl_expr_nargs(ea);
+        if (ea->head != eb->head || n != jl_expr_nargs(eb))
+            return 0;
+        for (i = 0; i < n; i++)
+            if (!lowering_expr_egal(jl_exprarg(ea, i), jl_exprarg(eb, i)))
+                return 0;
+        return 1;
+    }
+    if (ta == (jl_value_t*)jl_quotenode_type)
+        return lowering_expr_egal(jl_quotenode_value(a), jl_quotenode_value(b));
+    return jl_egal(a, b);
+}
+
+// Whether a lowered form can be replayed for a later evaluation of the same
+// input: names minted from the per-module counter (closure types, keyword
+// sorters, ...) all start with '#', a character ordinary identifiers cannot
+// contain, so any lowered form free of such names is reproducible. Slot names
+// are purely local and may legitimately contain gensyms, so CodeInfo bodies
+// are scanned but their slotnames are not.
+static int lowering_is_counter_free(jl_value_t *v)
+{
+    if (jl_is_symbol(v))
+        return jl_symbol_name((jl_sym_t*)v)[0] != '#';
+    if (jl_is_globalref(v))
+        return jl_symbol_name(jl_globalref_name(v))[0] != '#';
+    if (jl_is_quotenode(v))
+        return lowering_is_counter_free(jl_quotenode_value(v));
+    if (jl_is_expr(v)) {
+        jl_expr_t *e = (jl_expr_t*)v;
+        size_t i, n = jl_expr_nargs(e);
+        for (i = 0; i < n; i++)
+            if (!lowering_is_counter_free(jl_exprarg(e, i)))
+                return 0;
+        return 1;
+    }
+    if (jl_is_code_info(v)) {
+        jl_array_t *body = ((jl_code_info_t*)v)->code;
+        size_t i, n = jl_array_len(body);
+        for (i = 0; i < n; i++)
+            if (!lowering_is_counter_free(jl_array_ptr_ref(body, i)))
+                return 0;
+        return 1;
+    }
+    return 1;
+}
+
+// Returns a fresh copy of the cached lowered form, or NULL on a miss.
+// The combined key hash is passed back for the later insert either way.
+static jl_value_t *lowering_cache_lookup(jl_value_t *expr, jl_module_t *inmodule,
+                                         const char *file, int line, int kind,
+                                         uintptr_t *hash_out)
+{
+    jl_sym_t *fsym = jl_symbol(file);
+    uintptr_t h = lowering_expr_hash(expr, 20);
+    h = bitmix(h, jl_object_id((jl_value_t*)inmodule));
+    h = bitmix(h, jl_object_id((jl_value_t*)fsym));
+    h = bitmix(h, (uintptr_t)(line * 4 + kind));
+    *hash_out = h;
+    size_t slot = h & (LOWERING_CACHE_LEN - 1);
+    jl_value_t *v = NULL;
+    JL_LOCK(&lowering_cache_lock);
+    jl_lowering_cache_key_t *k = &lowering_cache_keys[slot];
+    if (jl_lowering_cache != NULL && k->hash == h && k->file == fsym &&
+        k->line == line && k->kind == kind &&
+        (jl_module_t*)jl_array_ptr_ref(jl_lowering_cache, 3*slot + 1) == inmodule &&
+        lowering_expr_egal(jl_array_ptr_ref(jl_lowering_cache, 3*slot), expr)) {
+        v = jl_array_ptr_ref(jl_lowering_cache, 3*slot + 2);
+    }
+    if (v != NULL) {
+        JL_GC_PUSH1(&v); // keep the entry alive across eviction while copying
+        JL_UNLOCK(&lowering_cache_lock);
+        v = jl_copy_ast(v);
+        JL_GC_POP();
+    }
+    else {
+        JL_UNLOCK(&lowering_cache_lock);
+    }
+    return v;
+}
+
+static void lowering_cache_insert(uintptr_t hash, jl_value_t *key, jl_module_t *inmodule,
+                                  const char *file, int line, int kind, jl_value_t *result)
+{
+    if (!lowering_is_counter_free(result))
+        return;
+    jl_value_t *stored = NULL;
+    JL_GC_PUSH2(&key, &stored);
+    stored = jl_copy_ast(result);
+    JL_LOCK(&lowering_cache_lock);
+    if (jl_lowering_cache == NULL)
+        jl_lowering_cache = jl_alloc_vec_any(3 * LOWERING_CACHE_LEN);
+    size_t slot = hash & (LOWERING_CACHE_LEN - 1);
+    jl_lowering_cache_key_t *k = &lowering_cache_keys[slot];
+    k->hash = hash;
+    k->file = jl_symbol(file);
+    k->line = line;
+    k->kind = kind;
+    jl_array_ptr_set(jl_lowering_cache, 3*slot, key);
+    jl_array_ptr_set(jl_lowering_cache, 3*slot + 1, (jl_value_t*)inmodule);
+    jl_array_ptr_set(jl_lowering_cache, 3*slot + 2, stored);
+    JL_UNLOCK(&lowering_cache_lock);
+    JL_GC_POP();
+}
+
 // Lower an expression tree into Julia's intermediate-representation.
 JL_DLLEXPORT jl_value_t *jl_expand(jl_value_t *expr, jl_module_t *inmodule)
 {
@@ -1179,10 +1341,19 @@ JL_DLLEXPORT jl_value_t *jl_expand_in_world(jl_value_t *expr, jl_module_t *inmod
                                             const char *file, int line, size_t world)
 {
     JL_TIMING(LOWERING);
-    JL_GC_PUSH1(&expr);
+    jl_value_t *key = NULL;
+    JL_GC_PUSH2(&expr, &key);
     expr = jl_copy_ast(expr);
     expr = jl_expand_macros(expr, inmodule, NULL, 0, world, 1);
+    uintptr_t hash;
+    key = expr;
+    jl_value_t *memo = lowering_cache_lookup(key, inmodule, file, line, LOWERING_KIND_THUNK, &hash);
+    if (memo != NULL) {
+        JL_GC_POP();
+        return memo;
+    }
     expr = jl_call_scm_on_ast_and_loc("jl-expand-to-thunk", expr, inmodule, file, line);
+    lowering_cache_insert(hash, key, inmodule, file, line, LOWERING_KIND_THUNK, expr);
     JL_GC_POP();
     return expr;
 }
@@ -1193,16 +1364,28 @@ JL_DLLEXPORT jl_value_t *jl_expand_with_loc_warn(jl_value_t *expr, jl_module_t *
 {
     JL_TIMING(LOWERING);
     jl_array_t *kwargs = NULL;
-    JL_GC_PUSH2(&expr, &kwargs);
+    jl_value_t *key = NULL;
+    JL_GC_PUSH3(&expr, &kwargs, &key);
     expr = jl_copy_ast(expr);
     expr = jl_expand_macros(expr, inmodule, NULL, 0, ~(size_t)0, 1);
-    jl_ast_context_t *ctx = jl_ast_ctx_enter(inmodule);
-    fl_context_t *fl_ctx = &ctx->fl;
-    value_t arg = julia_to_scm(fl_ctx, expr);
-    value_t e = fl_applyn(fl_ctx, 4, symbol_value(symbol(fl_ctx, "jl-expand-to-thunk-warn")), arg,
-                          symbol(fl_ctx, file), fixnum(line), fl_ctx->F);
-    expr = scm_to_julia(fl_ctx, e, inmodule);
-    jl_ast_ctx_leave(ctx);
+    uintptr_t hash;
+    key = expr;
+    // the memoized form still carries the `warn` wrapper, so any lowering
+    // warnings are re-logged below on a cache hit just like on a miss
+    jl_value_t *memo = lowering_cache_lookup(key, inmodule, file, line, LOWERING_KIND_WARN, &hash);
+    if (memo != NULL) {
+        expr = memo;
+    }
+    else {
+        jl_ast_context_t *ctx = jl_ast_ctx_enter(inmodule);
+        fl_context_t *fl_ctx = &ctx->fl;
+        value_t arg = julia_to_scm(fl_ctx, expr);
+        value_t e = fl_applyn(fl_ctx, 4, symbol_value(symbol(fl_ctx, "jl-expand-to-thunk-warn")), arg,
+                              symbol(fl_ctx, file), fixnum(line), fl_ctx->F);
+        expr = scm_to_julia(fl_ctx, e, inmodule);
+        jl_ast_ctx_leave(ctx);
+        lowering_cache_insert(hash, key, inmodule, file, line, LOWERING_KIND_WARN, expr);
+    }
     jl_sym_t *warn_sym = jl_symbol("warn");
     if (jl_is_expr(expr) && ((jl_expr_t*)expr)->head == warn_sym) {
         size_t nargs = jl_expr_nargs(expr);
@@ -1240,10 +1423,19 @@ JL_DLLEXPORT jl_value_t *jl_expand_stmt_with_loc(jl_value_t *expr, jl_module_t *
                                                  const char *file, int line)
 {
     JL_TIMING(LOWERING);
-    JL_GC_PUSH1(&expr);
+    jl_value_t *key = NULL;
+    JL_GC_PUSH2(&expr, &key);
     expr = jl_copy_ast(expr);
     expr = jl_expand_macros(expr, inmodule, NULL, 0, ~(size_t)0, 1);
+    uintptr_t hash;
+    key = expr;
+    jl_value_t *memo = lowering_cache_lookup(key, inmodule, file, line, LOWERING_KIND_STMT, &hash);
+    if (memo != NULL) {
+        JL_GC_POP();
+        return memo;
+    }
     expr = jl_call_scm_on_ast_and_loc("jl-expand-to-thunk-stmt", expr, inmodule, file, line);
+    lowering_cache_insert(hash, key, inmodule, file, line, LOWERING_KIND_STMT, expr);
     JL_GC_POP();
     return expr;
 }
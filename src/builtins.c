@@ -32,6 +32,29 @@ extern "C" {
 
 // egal and object_id ---------------------------------------------------------
 
+// 16-byte vector compares for the flat-immutable fast paths below. SSE2 is
+// part of the x86-64 baseline and NEON of the AArch64 baseline, so no runtime
+// feature dispatch is needed for these widths.
+#if defined(_CPU_X86_64_) || (defined(_CPU_X86_) && defined(__SSE2__))
+#include <emmintrin.h>
+#define JL_HAVE_VEC16_CMP 1
+static int vec16_equal(const void *a, const void *b) JL_NOTSAFEPOINT
+{
+    __m128i va = _mm_loadu_si128((const __m128i*)a);
+    __m128i vb = _mm_loadu_si128((const __m128i*)b);
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)) == 0xffff;
+}
+#elif defined(_CPU_AARCH64_)
+#include <arm_neon.h>
+#define JL_HAVE_VEC16_CMP 1
+static int vec16_equal(const void *a, const void *b) JL_NOTSAFEPOINT
+{
+    uint8x16_t va = vld1q_u8((const uint8_t*)a);
+    uint8x16_t vb = vld1q_u8((const uint8_t*)b);
+    return vminvq_u8(vceqq_u8(va, vb)) == 0xff;
+}
+#endif
+
 static int bits_equal(const void *a, const void *b, int sz) JL_NOTSAFEPOINT
 {
     switch (sz) {
@@ -40,6 +63,13 @@ static int bits_equal(const void *a, const void *b, int sz) JL_NOTSAFEPOINT
     case 2:  return memcmp(a, b, 2) == 0;
     case 4:  return memcmp(a, b, 4) == 0;
     case 8:  return memcmp(a, b, 8) == 0;
+#ifdef JL_HAVE_VEC16_CMP
+    case 16: return vec16_equal(a, b);
+    case 24: return vec16_equal(a, b) &&
+                    memcmp((const char*)a + 16, (const char*)b + 16, 8) == 0;
+    case 32: return vec16_equal(a, b) &&
+                    vec16_equal((const char*)a + 16, (const char*)b + 16);
+#endif
     default: return memcmp(a, b, sz) == 0;
     }
 }
@@ -82,10 +112,12 @@ static int NOINLINE compare_fields(const jl_value_t *a, const jl_value_t *b, jl_
     // npointers is used at end, but fetched here for locality with nfields.
     int npointers = ((jl_datatype_t*)dt)->layout->npointers;
     for (size_t f = 0; f < nf; f++) {
-        size_t offs = jl_field_offset(dt, f);
+        uint32_t offs, fldsz;
+        int isptr;
+        jl_field_getdesc(dt, f, &offs, &fldsz, &isptr);
         char *ao = (char*)a + offs;
         char *bo = (char*)b + offs;
-        if (jl_field_isptr(dt, f)) {
+        if (isptr) {
             // Save ptr recursion until the end -- only recurse if otherwise equal
             // Note that we also skip comparing the pointers for null here, because
             // null fields are rare so it can save CPU to delay this read too.
@@ -94,7 +126,7 @@ static int NOINLINE compare_fields(const jl_value_t *a, const jl_value_t *b, jl_
         else {
             jl_datatype_t *ft = (jl_datatype_t*)jl_field_type_concrete(dt, f);
             if (jl_is_uniontype(ft)) {
-                size_t idx = jl_field_size(dt, f) - 1;
+                size_t idx = fldsz - 1;
                 uint8_t asel = ((uint8_t*)ao)[idx];
                 uint8_t bsel = ((uint8_t*)bo)[idx];
                 if (asel != bsel)
@@ -267,6 +299,17 @@ static uintptr_t bits_hash(const void *b, size_t sz) JL_NOTSAFEPOINT
     case 4:  return int32hash(jl_load_unaligned_i32(b));
 #ifdef _P64
     case 8:  return int64hash(jl_load_unaligned_i64(b));
+    // word-parallel mixing for the sizes common with wide NTuple keys;
+    // substantially cheaper than the byte-oriented memhash below
+    case 16: return bitmix(jl_load_unaligned_i64(b),
+                           jl_load_unaligned_i64((const char*)b + 8));
+    case 24: return bitmix(bitmix(jl_load_unaligned_i64(b),
+                                  jl_load_unaligned_i64((const char*)b + 8)),
+                           jl_load_unaligned_i64((const char*)b + 16));
+    case 32: return bitmix(bitmix(jl_load_unaligned_i64(b),
+                                  jl_load_unaligned_i64((const char*)b + 8)),
+                           bitmix(jl_load_unaligned_i64((const char*)b + 16),
+                                  jl_load_unaligned_i64((const char*)b + 24)));
 #else
     case 8:  return int64to32hash(jl_load_unaligned_i64(b));
 #endif
@@ -435,6 +478,12 @@ JL_DLLEXPORT inline uintptr_t jl_object_id_(jl_value_t *tv, jl_value_t *v) JL_NO
         if (dtv->isconcretetype)
             return dtv->hash;
     }
+    else if (dt->name->mutabl && dt != jl_simplevector_type &&
+             dt != jl_string_type && dt != jl_module_type) {
+        // mutable objects hash by identity, which is stable since the GC
+        // never moves them; this is the hot case for IdDict keys
+        return inthash((uintptr_t)v);
+    }
     return jl_object_id__cold(dt, v);
 }
 
@@ -595,6 +644,50 @@ static jl_value_t *do_apply(jl_value_t **args, uint32_t nargs, jl_value_t *itera
         else if (f == jl_builtin_tuple && jl_is_tuple(args[1])) {
             return args[1];
         }
+        // fast path for splatting a single tuple, svec or array: the element
+        // count is known exactly, so copy the elements straight into a stack
+        // allocated argument vector and skip the counting and growing
+        // machinery below
+        jl_value_t *ai = args[1];
+        size_t al = (size_t)-1;
+        if (jl_is_svec(ai))
+            al = jl_svec_len(ai);
+        else if (jl_is_tuple(ai) || jl_is_namedtuple(ai))
+            al = jl_nfields(ai);
+        else if (jl_is_array(ai))
+            al = jl_array_len(ai);
+        if (al != (size_t)-1 && al + 1 < jl_page_size / sizeof(jl_value_t*)) {
+            size_t j;
+            jl_value_t **newargs;
+            JL_GC_PUSHARGS(newargs, al + 1);
+            newargs[0] = f;
+            if (jl_is_svec(ai)) {
+                memcpy(&newargs[1], jl_svec_data(ai), al * sizeof(jl_value_t*));
+            }
+            else if (jl_is_array(ai) && ((jl_array_t*)ai)->flags.ptrarray) {
+                memcpy(&newargs[1], jl_array_data(ai), al * sizeof(jl_value_t*));
+                for (j = 0; j < al; j++) {
+                    // apply with array splatting may have embedded NULL value (#11772)
+                    if (__unlikely(newargs[j + 1] == NULL))
+                        jl_throw(jl_undefref_exception);
+                }
+            }
+            else if (jl_is_array(ai)) {
+                for (j = 0; j < al; j++) {
+                    // jl_arrayref may allocate.
+                    newargs[j + 1] = jl_arrayref((jl_array_t*)ai, j);
+                }
+            }
+            else {
+                for (j = 0; j < al; j++) {
+                    // jl_fieldref may allocate.
+                    newargs[j + 1] = jl_fieldref(ai, j);
+                }
+            }
+            jl_value_t *result = jl_apply(newargs, al + 1);
+            JL_GC_POP();
+            return result;
+        }
     }
     // estimate how many real arguments we appear to have
     size_t precount = 1;
@@ -938,10 +1031,8 @@ JL_CALLABLE(jl_f_getfield)
         jl_atomic_error("getfield: non-atomic field cannot be accessed atomically");
     if (isatomic && order == jl_memory_order_notatomic)
         jl_atomic_error("getfield: atomic field cannot be accessed non-atomically");
-    v = jl_get_nth_field_checked(v, idx);
-    if (order >= jl_memory_order_acq_rel || order == jl_memory_order_acquire)
-        jl_fence(); // `v` already had at least consume ordering
-    return v;
+    // the ordered load needs no trailing fence, unlike jl_get_nth_field_checked
+    return jl_get_nth_field_checked_ordered(v, idx, order);
 }
 
 JL_CALLABLE(jl_f_setfield)
@@ -27,6 +27,7 @@ STATISTIC(EmittedGetfieldUnknowns, "Number of unknown getfield calls emitted");
 STATISTIC(EmittedGetfieldKnowns, "Number of known getfield calls emitted");
 STATISTIC(EmittedSetfield, "Number of setfield calls emitted");
 STATISTIC(EmittedUnionLoads, "Number of union loads emitted");
+STATISTIC(EmittedUnionGetfields, "Number of union-split getfield calls emitted");
 STATISTIC(EmittedVarargsLength, "Number of varargs length calls emitted");
 STATISTIC(EmittedArraysize, "Number of arraysize calls emitted");
 STATISTIC(EmittedArraylen, "Number of array length calls emitted");
@@ -943,6 +944,26 @@ static void emit_memcpy_llvm(jl_codectx_t &ctx, Value *dst, jl_aliasinfo_t const
         }
     }
 #endif
+    // Expand remaining small fixed-size copies into straight-line chunked
+    // loads and stores sized by the known alignment. These lower to plain
+    // scalar or vector moves and keep the copied bytes visible to SROA,
+    // instead of leaving behind an opaque memcpy that the backend may turn
+    // into a library call.
+    unsigned chunk = align < 16 ? align : 16;
+    if (sz <= 128 && chunk >= 4 && (sz % chunk) == 0 && sz / chunk <= 8 && !is_volatile) {
+        // alignments are powers of two, so every chunk offset stays aligned
+        Type *chunkty = Type::getIntNTy(ctx.builder.getContext(), 8 * chunk);
+        Value *srcp = emit_bitcast(ctx, src, chunkty->getPointerTo(src->getType()->getPointerAddressSpace()));
+        Value *dstp = emit_bitcast(ctx, dst, chunkty->getPointerTo(dst->getType()->getPointerAddressSpace()));
+        for (uint64_t off = 0; off < sz; off += chunk) {
+            Value *srcel = ctx.builder.CreateConstInBoundsGEP1_64(chunkty, srcp, off / chunk);
+            Value *dstel = ctx.builder.CreateConstInBoundsGEP1_64(chunkty, dstp, off / chunk);
+            auto val = src_ai.decorateInst(ctx.builder.CreateAlignedLoad(chunkty, srcel, Align(chunk)));
+            dst_ai.decorateInst(ctx.builder.CreateAlignedStore(val, dstel, Align(chunk)));
+        }
+        ++SkippedMemcpys;
+        return;
+    }
     ++EmittedMemcpys;
 
     // the memcpy intrinsic does not allow to specify different alias tags
@@ -1361,6 +1382,85 @@ static void emit_type_error(jl_codectx_t &ctx, const jl_cgval_t &x, Value *type,
                        { msg_val, maybe_decay_untracked(ctx, type), mark_callee_rooted(ctx, boxed(ctx, x))});
 }
 
+// --- opt-in branch-bias instrumentation (JULIA_BRANCH_PROFILE) ---
+// Plants a counter update on dynamically decided isa / union-split
+// branches so that biased dispatch branches can be found without editing
+// Julia source. Each site owns 8 cache-line-padded stripes of
+// (taken, not-taken) pairs; the stripe is picked from the ptls address so
+// concurrent threads mostly update distinct cache lines. The table is
+// printed to stderr at process exit.
+
+typedef struct {
+    std::string func;
+    const char *kind;
+    uint64_t *counts; // 8 stripes of 64 bytes; [0] taken, [1] not taken
+} jl_branch_profile_site_t;
+
+static std::mutex branch_profile_lock;
+static std::vector<jl_branch_profile_site_t> branch_profile_sites;
+
+extern "C" JL_DLLEXPORT void jl_dump_branch_profile(void)
+{
+    std::lock_guard<std::mutex> lock(branch_profile_lock);
+    for (jl_branch_profile_site_t &site : branch_profile_sites) {
+        uint64_t taken = 0, nottaken = 0;
+        for (int s = 0; s < 8; s++) {
+            taken += site.counts[s * 8 + 0];
+            nottaken += site.counts[s * 8 + 1];
+        }
+        if (taken == 0 && nottaken == 0)
+            continue;
+        jl_safe_printf("branch-profile: %15llu taken %15llu not-taken  %-11s %s\n",
+                       (unsigned long long)taken, (unsigned long long)nottaken,
+                       site.kind, site.func.c_str());
+    }
+}
+
+static bool jl_branch_profile_enabled(void)
+{
+    static bool enabled = [] {
+        char *env = getenv("JULIA_BRANCH_PROFILE");
+        if (env && atoi(env) != 0) {
+            atexit(jl_dump_branch_profile);
+            return true;
+        }
+        return false;
+    }();
+    return enabled;
+}
+
+static void emit_branch_profile(jl_codectx_t &ctx, Value *cond, const char *kind)
+{
+    if (!jl_branch_profile_enabled())
+        return;
+    if (isa<Constant>(cond))
+        return; // statically decided; nothing to learn
+    uint64_t *counts = (uint64_t*)calloc(8, 64);
+    if (counts == NULL)
+        return;
+    {
+        std::lock_guard<std::mutex> lock(branch_profile_lock);
+        branch_profile_sites.push_back(jl_branch_profile_site_t{ctx.funcName, kind, counts});
+    }
+    Type *T_size = getSizeTy(ctx.builder.getContext());
+    Value *tls = ctx.builder.CreatePtrToInt(get_current_ptls(ctx), T_size);
+    Value *stripe = ctx.builder.CreateAnd(
+            ctx.builder.CreateLShr(tls, ConstantInt::get(T_size, 9)),
+            ConstantInt::get(T_size, 7));
+    // stripe * 64, then 0 for the taken slot and 8 for the not-taken one
+    Value *off = ctx.builder.CreateShl(stripe, ConstantInt::get(T_size, 6));
+    Value *istrue = ctx.builder.CreateZExt(cond, T_size);
+    off = ctx.builder.CreateAdd(off,
+            ctx.builder.CreateSub(ConstantInt::get(T_size, 8),
+                ctx.builder.CreateShl(istrue, ConstantInt::get(T_size, 3))));
+    Value *slot = ctx.builder.CreateAdd(ConstantInt::get(T_size, (uintptr_t)counts), off);
+    Type *T_pint64 = getInt64Ty(ctx.builder.getContext())->getPointerTo();
+    ctx.builder.CreateAtomicRMW(AtomicRMWInst::Add,
+            ctx.builder.CreateIntToPtr(slot, T_pint64),
+            ConstantInt::get(getInt64Ty(ctx.builder.getContext()), 1),
+            Align(8), AtomicOrdering::Monotonic);
+}
+
 // Should agree with `emit_isa` below
 static bool _can_optimize_isa(jl_value_t *type, int &counter)
 {
@@ -1402,6 +1502,7 @@ static Value *emit_exactly_isa(jl_codectx_t &ctx, const jl_cgval_t &arg, jl_valu
 
 static std::pair<Value*, bool> emit_isa(jl_codectx_t &ctx, const jl_cgval_t &x,
                                         jl_value_t *type, const std::string *msg);
+static void emit_write_barrier(jl_codectx_t&, Value*, Value*);
 
 static void emit_isa_union(jl_codectx_t &ctx, const jl_cgval_t &x, jl_value_t *type,
                            SmallVectorImpl<std::pair<std::pair<BasicBlock*,BasicBlock*>,Value*>> &bbs)
@@ -1420,6 +1521,8 @@ static void emit_isa_union(jl_codectx_t &ctx, const jl_cgval_t &x, jl_value_t *t
     ctx.builder.SetInsertPoint(isaBB);
 }
 
+static jl_value_t *jl_ensure_rooted(jl_codectx_t &ctx, jl_value_t *val);
+
 // Should agree with `_can_optimize_isa` above
 static std::pair<Value*, bool> emit_isa(jl_codectx_t &ctx, const jl_cgval_t &x, jl_value_t *type, const std::string *msg)
 {
@@ -1549,12 +1652,50 @@ static std::pair<Value*, bool> emit_isa(jl_codectx_t &ctx, const jl_cgval_t &x,
         ctx.builder.SetInsertPoint(currBB);
         return {res, false};
     }
-    // everything else can be handled via subtype tests
-    return std::make_pair(ctx.builder.CreateICmpNE(
+    // everything else can be handled via subtype tests; speculate that the
+    // value's type matches the last one to pass the test at this site before
+    // calling into the runtime, since many such sites (dynamic dispatch
+    // fallbacks in particular) only ever see a single concrete type. The
+    // cache cell is a WeakRef rooted with the code: the GC replaces a dead
+    // referent before its memory can be reused, so a stale entry can never
+    // alias a freshly allocated type. The store below still needs the write
+    // barrier: clearing dead referents relies on every wr->value mutation
+    // re-remembering an old cell, or an old cell holding a dying young type
+    // would never be re-scanned and would dangle.
+    jl_value_t *cell = (jl_value_t*)jl_gc_new_weakref(jl_nothing);
+    JL_GC_PUSH1(&cell);
+    cell = ctx.linfo ? jl_ensure_rooted(ctx, cell) : jl_as_global_root(cell);
+    JL_GC_POP();
+    Value *vt = emit_typeof_boxed(ctx, x);
+    Value *slot = emit_bitcast(ctx, decay_derived(ctx, literal_pointer_val(ctx, cell)),
+                               ctx.types().T_pprjlvalue);
+    jl_aliasinfo_t ai = jl_aliasinfo_t::fromTBAA(ctx, ctx.tbaa().tbaa_mutab);
+    LoadInst *cached = ctx.builder.CreateAlignedLoad(ctx.types().T_prjlvalue, slot, Align(sizeof(void*)));
+    cached->setOrdering(AtomicOrdering::Monotonic);
+    ai.decorateInst(cached);
+    BasicBlock *currBB = ctx.builder.GetInsertBlock();
+    BasicBlock *slowBB = BasicBlock::Create(ctx.builder.getContext(), "isa_slow", ctx.f);
+    BasicBlock *cacheBB = BasicBlock::Create(ctx.builder.getContext(), "isa_cache", ctx.f);
+    BasicBlock *postBB = BasicBlock::Create(ctx.builder.getContext(), "post_isa", ctx.f);
+    ctx.builder.CreateCondBr(ctx.builder.CreateICmpEQ(vt, cached), postBB, slowBB);
+    ctx.builder.SetInsertPoint(slowBB);
+    Value *issub = ctx.builder.CreateICmpNE(
             ctx.builder.CreateCall(prepare_call(jlsubtype_func),
-              { emit_typeof_boxed(ctx, x),
-                track_pjlvalue(ctx, literal_pointer_val(ctx, type)) }),
-            ConstantInt::get(getInt32Ty(ctx.builder.getContext()), 0)), false);
+              { vt, track_pjlvalue(ctx, literal_pointer_val(ctx, type)) }),
+            ConstantInt::get(getInt32Ty(ctx.builder.getContext()), 0));
+    ctx.builder.CreateCondBr(issub, cacheBB, postBB);
+    ctx.builder.SetInsertPoint(cacheBB);
+    StoreInst *updated = ctx.builder.CreateAlignedStore(vt, slot, Align(sizeof(void*)));
+    updated->setOrdering(AtomicOrdering::Monotonic);
+    ai.decorateInst(updated);
+    emit_write_barrier(ctx, track_pjlvalue(ctx, literal_pointer_val(ctx, cell)), vt);
+    ctx.builder.CreateBr(postBB);
+    ctx.builder.SetInsertPoint(postBB);
+    PHINode *res = ctx.builder.CreatePHI(getInt1Ty(ctx.builder.getContext()), 3);
+    res->addIncoming(ConstantInt::get(getInt1Ty(ctx.builder.getContext()), 1), currBB);
+    res->addIncoming(ConstantInt::get(getInt1Ty(ctx.builder.getContext()), 0), slowBB);
+    res->addIncoming(ConstantInt::get(getInt1Ty(ctx.builder.getContext()), 1), cacheBB);
+    return std::make_pair(res, false);
 }
 
 // If this might have been sourced from a PhiNode object, it is possible our
@@ -1578,6 +1719,7 @@ static void emit_typecheck(jl_codectx_t &ctx, const jl_cgval_t &x, jl_value_t *t
     std::tie(istype, handled_msg) = emit_isa(ctx, x, type, &msg);
     if (!handled_msg) {
         ++EmittedTypechecks;
+        emit_branch_profile(ctx, istype, "typecheck");
         BasicBlock *failBB = BasicBlock::Create(ctx.builder.getContext(), "fail", ctx.f);
         BasicBlock *passBB = BasicBlock::Create(ctx.builder.getContext(), "pass");
         ctx.builder.CreateCondBr(istype, passBB, failBB);
@@ -1634,7 +1776,12 @@ static Value *emit_bounds_check(jl_codectx_t &ctx, const jl_cgval_t &ainfo, jl_v
         Value *ok = ctx.builder.CreateICmpULT(im1, len);
         BasicBlock *failBB = BasicBlock::Create(ctx.builder.getContext(), "fail", ctx.f);
         BasicBlock *passBB = BasicBlock::Create(ctx.builder.getContext(), "pass");
-        ctx.builder.CreateCondBr(ok, passBB, failBB);
+        // mark the failure edge as essentially never taken, so that the
+        // loop passes (IRCE in particular) consider these checks worth
+        // hoisting into a single pre-loop trip-count guard
+        MDBuilder MDB(ctx.builder.getContext());
+        SmallVector<uint32_t, 2> Weights{1048575, 1};
+        ctx.builder.CreateCondBr(ok, passBB, failBB, MDB.createBranchWeights(Weights));
         ctx.builder.SetInsertPoint(failBB);
         if (!ty) { // jl_value_t** tuple (e.g. the vararg)
             ctx.builder.CreateCall(prepare_call(jlvboundserror_func), { ainfo.V, len, i });
@@ -2370,8 +2517,35 @@ static jl_cgval_t emit_unionload(jl_codectx_t &ctx, Value *addr, Value *ptindex,
         AllocaInst *lv = emit_static_alloca(ctx, AT);
         if (al > 1)
             lv->setAlignment(Align(al));
+        // The payload bytes of singleton members (e.g. Missing) are never
+        // read, so when the union has any, only copy the element data when
+        // the selector names a member that carries data. This keeps e.g.
+        // missing-heavy array scans from touching the element cache line at
+        // all; the runtime jl_arrayref path takes the same shortcut.
+        Value *hasdata = NULL;
+        unsigned nghost = 0;
+        for (unsigned i = 0; i < union_max; i++) {
+            jl_value_t *mty = jl_nth_union_component(jfty, i);
+            if (jl_is_datatype(mty) && jl_is_datatype_singleton((jl_datatype_t*)mty)) {
+                nghost++;
+                continue;
+            }
+            Value *isi = ctx.builder.CreateICmpEQ(tindex0, ConstantInt::get(getInt8Ty(ctx.builder.getContext()), i));
+            hasdata = hasdata ? ctx.builder.CreateOr(hasdata, isi) : isi;
+        }
         jl_aliasinfo_t ai = jl_aliasinfo_t::fromTBAA(ctx, tbaa);
-        emit_memcpy(ctx, lv, ai, addr, ai, fsz, al);
+        if (nghost == 0 || hasdata == NULL) {
+            emit_memcpy(ctx, lv, ai, addr, ai, fsz, al);
+        }
+        else {
+            BasicBlock *copyBB = BasicBlock::Create(ctx.builder.getContext(), "union_copy", ctx.f);
+            BasicBlock *postBB = BasicBlock::Create(ctx.builder.getContext(), "union_copied", ctx.f);
+            ctx.builder.CreateCondBr(hasdata, copyBB, postBB);
+            ctx.builder.SetInsertPoint(copyBB);
+            emit_memcpy(ctx, lv, ai, addr, ai, fsz, al);
+            ctx.builder.CreateBr(postBB);
+            ctx.builder.SetInsertPoint(postBB);
+        }
         addr = lv;
     }
     return mark_julia_slot(fsz > 0 ? addr : nullptr, jfty, tindex, tbaa);
@@ -2544,6 +2718,73 @@ static jl_cgval_t emit_getfield_knownidx(jl_codectx_t &ctx, const jl_cgval_t &st
     }
 }
 
+// getfield on a value held unboxed in a small union (TIndex set): if exactly
+// one union component has a field named `name`, switch on the selector byte
+// and load the field from that component's layout, instead of boxing the
+// object for the generic fallback. Every other component unconditionally
+// raises the error the runtime would, so no merge of the results is needed.
+static bool emit_getfield_unionsplit(jl_codectx_t &ctx, jl_cgval_t *ret,
+        const jl_cgval_t &strct, jl_sym_t *name, enum jl_memory_order order)
+{
+    if (!strct.TIndex || strct.Vboxed)
+        return false; // possibly-boxed components take the generic path
+    jl_datatype_t *fdt = NULL;
+    unsigned fidx = 0;
+    unsigned ftindex = 0;
+    bool split = true;
+    unsigned counter = 0;
+    bool allunbox = for_each_uniontype_small(
+            [&](unsigned tidx, jl_datatype_t *jt) {
+                if (!split || !jl_struct_try_layout(jt)) {
+                    split = false;
+                    return;
+                }
+                int i = jl_field_index(jt, name, 0);
+                if (i == -1)
+                    return; // always throws; gets its own error block below
+                if (fdt != NULL || jl_has_free_typevars(jl_field_type(jt, i))) {
+                    // several components have the field; the results would
+                    // need to be merged back into a union
+                    split = false;
+                    return;
+                }
+                fdt = jt;
+                fidx = (unsigned)i;
+                ftindex = tidx;
+            },
+            strct.typ, counter);
+    if (!split || !allunbox || fdt == NULL)
+        return false;
+    ++EmittedUnionGetfields;
+    BasicBlock *trapBB = BasicBlock::Create(ctx.builder.getContext(), "getfield_union_trap", ctx.f);
+    BasicBlock *loadBB = BasicBlock::Create(ctx.builder.getContext(), "getfield_union", ctx.f);
+    SwitchInst *switchInst = ctx.builder.CreateSwitch(strct.TIndex, trapBB);
+    switchInst->addCase(ConstantInt::get(getInt8Ty(ctx.builder.getContext()), ftindex), loadBB);
+    counter = 0;
+    for_each_uniontype_small(
+            [&](unsigned tidx, jl_datatype_t *jt) {
+                if (tidx == ftindex)
+                    return;
+                BasicBlock *errBB = BasicBlock::Create(ctx.builder.getContext(), "getfield_union_err", ctx.f);
+                switchInst->addCase(ConstantInt::get(getInt8Ty(ctx.builder.getContext()), tidx), errBB);
+                ctx.builder.SetInsertPoint(errBB);
+                std::string msg = std::string("type ") + jl_symbol_name(jt->name->name)
+                        + " has no field " + jl_symbol_name(name);
+                just_emit_error(ctx, prepare_call(jlerror_func), msg);
+                ctx.builder.CreateUnreachable();
+            },
+            strct.typ, counter);
+    ctx.builder.SetInsertPoint(trapBB);
+    // since !Vboxed, the selector byte is always a valid union tag
+    Function *trap_func = Intrinsic::getDeclaration(ctx.f->getParent(), Intrinsic::trap);
+    ctx.builder.CreateCall(trap_func);
+    ctx.builder.CreateUnreachable();
+    ctx.builder.SetInsertPoint(loadBB);
+    jl_cgval_t this_strct(strct, (jl_value_t*)fdt, NULL);
+    *ret = emit_getfield_knownidx(ctx, this_strct, fidx, fdt, order);
+    return true;
+}
+
 // emit length of vararg tuple
 static Value *emit_n_varargs(jl_codectx_t &ctx)
 {
@@ -2647,6 +2888,10 @@ static Value *emit_arraysize(jl_codectx_t &ctx, const jl_cgval_t &tinfo, Value *
     MDBuilder MDB(ctx.builder.getContext());
     auto rng = MDB.createRange(Constant::getNullValue(getSizeTy(ctx.builder.getContext())), ConstantInt::get(getSizeTy(ctx.builder.getContext()), arraytype_maxsize(tinfo.typ)));
     load->setMetadata(LLVMContext::MD_range, rng);
+    if (arraytype_constshape(tinfo.typ))
+        // sizes of an Array that cannot be resized are set at allocation and
+        // never change, so loops are free to hoist this load
+        load->setMetadata(LLVMContext::MD_invariant_load, MDNode::get(ctx.builder.getContext(), None));
     return load;
 }
 
@@ -2684,6 +2929,10 @@ static Value *emit_arraylen_prim(jl_codectx_t &ctx, const jl_cgval_t &tinfo)
     MDBuilder MDB(ctx.builder.getContext());
     auto rng = MDB.createRange(Constant::getNullValue(getSizeTy(ctx.builder.getContext())), ConstantInt::get(getSizeTy(ctx.builder.getContext()), arraytype_maxsize(tinfo.typ)));
     len->setMetadata(LLVMContext::MD_range, rng);
+    if (arraytype_constshape(ty))
+        // the length of an Array that cannot be resized is set at allocation
+        // and never changes, so loops are free to hoist this load
+        len->setMetadata(LLVMContext::MD_invariant_load, MDNode::get(ctx.builder.getContext(), None));
     jl_aliasinfo_t ai = jl_aliasinfo_t::fromTBAA(ctx, tbaa);
     return ai.decorateInst(len);
 }
@@ -173,8 +173,10 @@ STATISTIC(EmittedEgals, "Number of egals emitted");
 STATISTIC(EmittedOpfields, "Number of opfields emitted");
 STATISTIC(EmittedBuiltinCalls, "Number of builtin calls emitted");
 STATISTIC(EmittedJLCalls, "Number of jlcalls emitted");
+STATISTIC(EmittedCachedDispatch, "Number of cached dispatch sites emitted");
 STATISTIC(EmittedSpecfunCalls, "Number of specialized calls emitted");
 STATISTIC(EmittedInvokes, "Number of invokes emitted");
+STATISTIC(FoldedInvokes, "Number of invokes folded by concrete evaluation");
 STATISTIC(EmittedCalls, "Number of calls emitted");
 STATISTIC(EmittedUndefVarErrors, "Number of undef var errors emitted");
 STATISTIC(EmittedOpaqueClosureFunctions, "Number of opaque closures emitted");
@@ -808,6 +810,15 @@ static const auto jlinvoke_func = new JuliaFunction{
             {AttributeSet(),
              Attributes(C, {Attribute::ReadOnly, Attribute::NoCapture})}); },
 };
+static const auto jlapplygenericcached_func = new JuliaFunction{
+    XSTR(jl_apply_generic_cached),
+    get_func2_sig,
+    [](LLVMContext &C) { return AttributeList::get(C,
+            AttributeSet(),
+            Attributes(C, {Attribute::NonNull}),
+            {AttributeSet(),
+             Attributes(C, {Attribute::ReadOnly, Attribute::NoCapture})}); },
+};
 static const auto jlmethod_func = new JuliaFunction{
     XSTR(jl_method_def),
     [](LLVMContext &C) {
@@ -2144,6 +2155,7 @@ static jl_cgval_t convert_julia_type_union(jl_codectx_t &ctx, const jl_cgval_t &
                 ctx.builder.CreateBr(postBB);
                 ctx.builder.SetInsertPoint(currBB);
                 Value *wasunknown = ctx.builder.CreateICmpEQ(v.TIndex, ConstantInt::get(getInt8Ty(ctx.builder.getContext()), 0x80));
+                emit_branch_profile(ctx, wasunknown, "union_split");
                 ctx.builder.CreateCondBr(wasunknown, union_isaBB, postBB);
                 ctx.builder.SetInsertPoint(postBB);
                 PHINode *tindex_phi = ctx.builder.CreatePHI(getInt8Ty(ctx.builder.getContext()), 2);
@@ -2327,6 +2339,12 @@ static void jl_init_function(Function *F)
 #endif
 #ifdef JL_DISABLE_FPO
     attr.addAttribute("frame-pointer", "all");
+#else
+    // keep frame pointers in every emitted prologue when error-path
+    // frame-pointer backtraces are enabled, so the pointer chase sees all
+    // Julia frames even in builds that otherwise omit them
+    if (jl_error_fp_backtrace())
+        attr.addAttribute("frame-pointer", "all");
 #endif
 #if !defined(_COMPILER_ASAN_ENABLED_) && !defined(_OS_WINDOWS_)
     // ASAN won't like us accessing undefined memory causing spurious issues,
@@ -2406,7 +2424,7 @@ static std::pair<bool, bool> uses_specsig(jl_method_instance_t *lam, jl_value_t
 // Logging for code coverage and memory allocation
 
 JL_DLLEXPORT void jl_coverage_alloc_line(StringRef filename, int line);
-JL_DLLEXPORT uint64_t *jl_coverage_data_pointer(StringRef filename, int line);
+JL_DLLEXPORT size_t jl_coverage_line_slot(StringRef filename, int line);
 JL_DLLEXPORT uint64_t *jl_malloc_data_pointer(StringRef filename, int line);
 
 static void visitLine(jl_codectx_t &ctx, uint64_t *ptr, Value *addend, const char *name)
@@ -2428,7 +2446,28 @@ static void coverageVisitLine(jl_codectx_t &ctx, StringRef filename, int line)
         return; // TODO
     if (filename == "" || filename == "none" || filename == "no file" || filename == "<missing>" || line < 0)
         return;
-    visitLine(ctx, jl_coverage_data_pointer(filename, line), ConstantInt::get(getInt64Ty(ctx.builder.getContext()), 1), "lcnt");
+    // increment this thread's shard of the line's counter
+    // (ptls->coverage_pages); only the owning thread writes it, so a relaxed
+    // load/add/store is exact, unlike the old shared-counter increment
+    size_t idx = jl_coverage_line_slot(filename, line);
+    auto &C = ctx.builder.getContext();
+    Type *T_pint64 = getInt64PtrTy(C);
+    Type *T_ppint64 = PointerType::get(T_pint64, 0);
+    Value *ptls_cov = emit_bitcast(ctx, get_current_ptls(ctx), PointerType::get(T_ppint64, 0));
+    const int cov_offset = offsetof(jl_tls_states_t, coverage_pages);
+    Value *ptbl = ctx.builder.CreateInBoundsGEP(T_ppint64, ptls_cov,
+            ConstantInt::get(getSizeTy(C), cov_offset / sizeof(void*)));
+    LoadInst *tbl = ctx.builder.CreateAlignedLoad(T_ppint64, ptbl, Align(sizeof(void*)));
+    Value *ppage = ctx.builder.CreateInBoundsGEP(T_pint64, tbl,
+            ConstantInt::get(getSizeTy(C), idx >> JL_COVERAGE_PAGE_LG2));
+    LoadInst *page = ctx.builder.CreateAlignedLoad(T_pint64, ppage, Align(sizeof(void*)));
+    Value *pv = ctx.builder.CreateInBoundsGEP(getInt64Ty(C), page,
+            ConstantInt::get(getSizeTy(C), idx & (JL_COVERAGE_PAGE_SIZE - 1)));
+    LoadInst *v = ctx.builder.CreateAlignedLoad(getInt64Ty(C), pv, Align(sizeof(uint64_t)), "lcnt");
+    v->setOrdering(AtomicOrdering::Monotonic);
+    Value *v1 = ctx.builder.CreateAdd(v, ConstantInt::get(getInt64Ty(C), 1));
+    StoreInst *s = ctx.builder.CreateAlignedStore(v1, pv, Align(sizeof(uint64_t)));
+    s->setOrdering(AtomicOrdering::Monotonic);
 }
 
 // Memory allocation log (malloc_log)
@@ -2786,6 +2825,20 @@ static jl_cgval_t emit_globalref(jl_codectx_t &ctx, jl_module_t *mod, jl_sym_t *
         if (v != NULL) {
             if (bnd->constp)
                 return mark_julia_const(ctx, v);
+            jl_module_t *owner_mod = bnd->globalref ? bnd->globalref->mod : mod;
+            if (owner_mod->sealed && jl_is_method(ctx.linfo->def.method)) {
+                // the module promised this binding will not be reassigned, so
+                // embed its value like a constant. Record the dependency before
+                // re-reading the value so that a racing seal break invalidates
+                // this compilation instead of letting a stale value escape.
+                jl_record_sealed_dependency(owner_mod, ctx.linfo);
+                v = jl_atomic_load_acquire(&bnd->value);
+                if (owner_mod->sealed && v != NULL) {
+                    // root the value: it must stay valid for frames already
+                    // running this code when the seal is later broken
+                    return mark_julia_const(ctx, jl_ensure_rooted(ctx, v));
+                }
+            }
             LoadInst *v = ctx.builder.CreateAlignedLoad(ctx.types().T_prjlvalue, bp, Align(sizeof(void*)));
             v->setOrdering(order);
             jl_aliasinfo_t ai = jl_aliasinfo_t::fromTBAA(ctx, ctx.tbaa().tbaa_binding);
@@ -3294,6 +3347,7 @@ static bool emit_builtin_call(jl_codectx_t &ctx, jl_cgval_t *ret, jl_value_t *f,
         if (jl_is_type_type(ty.typ) && !jl_has_free_typevars(ty.typ)) {
             jl_value_t *tp0 = jl_tparam0(ty.typ);
             Value *isa_result = emit_isa(ctx, arg, tp0, NULL).first;
+            emit_branch_profile(ctx, isa_result, "isa");
             if (isa_result->getType() == getInt1Ty(ctx.builder.getContext()))
                 isa_result = ctx.builder.CreateZExt(isa_result, getInt8Ty(ctx.builder.getContext()));
             *ret = mark_julia_type(ctx, isa_result, false, jl_bool_type);
@@ -3639,6 +3693,10 @@ static bool emit_builtin_call(jl_codectx_t &ctx, jl_cgval_t *ret, jl_value_t *f,
                     return true;
                 }
             }
+            else if (jl_is_uniontype(obj.typ)) {
+                if (emit_getfield_unionsplit(ctx, ret, obj, name, order))
+                    return true;
+            }
         }
         else if (fld.typ == (jl_value_t*)jl_long_type) {
             if (ctx.vaSlot > 0) {
@@ -4061,6 +4119,140 @@ static CallInst *emit_jlcall(jl_codectx_t &ctx, JuliaFunction *theFptr, Value *t
     return emit_jlcall(ctx, prepare_call(theFptr), theF, argv, nargs, trampoline);
 }
 
+// Dynamic dispatch with a speculative per-call-site inline cache. The cache is
+// an svec rooted in the enclosing method, holding the argument type tags seen
+// at this site, the typemap entry dispatch resolved through, and the code
+// instance it resolved to. The emitted guard compares the current argument
+// tags against the cached ones, checks that both the entry and the instance
+// cover the current world age, and on a hit calls the instance's entry point
+// directly; on a miss it calls jl_apply_generic_cached, which performs regular
+// dispatch and fills the cache the first time (see gf.c). Method redefinition
+// is caught by the entry's world bounds, which `invalidate_mt_cache` truncates
+// when a more specific method is inserted; the instance's own bounds catch
+// backedge invalidation of the compiled code.
+static Value *emit_apply_generic_with_cache(jl_codectx_t &ctx, const jl_cgval_t *argv, size_t nargs)
+{
+    // the cache needs a stable root for the lifetime of the emitted code and
+    // cannot be serialized into an image, so only use it when emitting a
+    // method body for the JIT; also skip sites with so many arguments that
+    // the guard would outweigh the dispatch it saves
+    if (ctx.emission_context.imaging || ctx.params->generic_context != jl_nothing ||
+            ctx.linfo == NULL || !jl_is_method(ctx.linfo->def.method) || nargs > 6)
+        return emit_jlcall(ctx, jlapplygeneric_func, nullptr, argv, nargs, julia_call);
+    ++EmittedCachedDispatch;
+
+    // allocate the cache ([tag(f), tag(args)..., entry, codeinst], all
+    // initially `nothing`) and root it in the enclosing method
+    jl_svec_t *cache = NULL;
+    JL_GC_PUSH1(&cache);
+    cache = jl_alloc_svec(nargs + 2);
+    for (size_t i = 0; i < nargs + 2; i++)
+        jl_svecset(cache, i, jl_nothing);
+    jl_add_method_root(ctx.linfo->def.method, NULL, (jl_value_t*)cache);
+    JL_GC_POP();
+
+    auto &C = ctx.builder.getContext();
+    Type *T_size = getSizeTy(C);
+#ifdef JL_LLVM_OPAQUE_POINTERS
+    Type *TFptr = PointerType::get(C, 0);
+#else
+    Type *TFptr = get_func2_sig(C)->getPointerTo();
+#endif
+    // box the arguments once, up front, so that both paths share the boxing code
+    SmallVector<Value*, 8> boxedargs(nargs);
+    for (size_t i = 0; i < nargs; i++)
+        boxedargs[i] = boxed(ctx, argv[i]);
+
+    BasicBlock *checkBB = BasicBlock::Create(C, "guard_dispatch", ctx.f);
+    BasicBlock *hitBB = BasicBlock::Create(C, "cached_dispatch", ctx.f);
+    BasicBlock *missBB = BasicBlock::Create(C, "generic_dispatch", ctx.f);
+    BasicBlock *exitBB = BasicBlock::Create(C, "post_dispatch", ctx.f);
+
+    // acquire-load the cached code instance; the slow path publishes the tags
+    // and the typemap entry before release-storing the instance, so a
+    // non-`nothing` value here means the other slots are valid
+    Value *cislot = literal_static_pointer_val(&jl_svec_data(cache)[nargs + 1], ctx.types().T_pprjlvalue);
+    LoadInst *ci = ctx.builder.CreateAlignedLoad(ctx.types().T_prjlvalue, cislot, Align(sizeof(void*)), "cached_ci");
+    ci->setOrdering(AtomicOrdering::Acquire);
+    Value *filled = ctx.builder.CreateICmpNE(ci, track_pjlvalue(ctx, literal_pointer_val(ctx, jl_nothing)));
+    ctx.builder.CreateCondBr(filled, checkBB, missBB);
+
+    ctx.builder.SetInsertPoint(checkBB);
+    Value *match = ConstantInt::get(getInt1Ty(C), 1);
+    for (size_t i = 0; i < nargs; i++) {
+        Value *tagslot = literal_static_pointer_val(&jl_svec_data(cache)[i], ctx.types().T_pprjlvalue);
+        LoadInst *tag = ctx.builder.CreateAlignedLoad(ctx.types().T_prjlvalue, tagslot, Align(sizeof(void*)));
+        tag->setOrdering(AtomicOrdering::Unordered);
+        match = ctx.builder.CreateAnd(match, ctx.builder.CreateICmpEQ(tag, emit_typeof_boxed(ctx, argv[i])));
+    }
+    jl_aliasinfo_t ai = jl_aliasinfo_t::fromTBAA(ctx, ctx.tbaa().tbaa_gcframe);
+    Value *world = ai.decorateInst(ctx.builder.CreateAlignedLoad(
+            T_size, get_last_age_field(ctx), Align(sizeof(size_t)), "world_age"));
+    // the typemap entry must still cover this world: method insertion
+    // truncates the entry bounds, not the shadowed code instance's
+    Value *entryslot = literal_static_pointer_val(&jl_svec_data(cache)[nargs], ctx.types().T_pprjlvalue);
+    LoadInst *entry = ctx.builder.CreateAlignedLoad(ctx.types().T_prjlvalue, entryslot, Align(sizeof(void*)), "cached_entry");
+    entry->setOrdering(AtomicOrdering::Unordered);
+    Value *entry_psize = emit_bitcast(ctx, decay_derived(ctx, entry), getSizePtrTy(C));
+    Value *entry_minworld = ctx.builder.CreateAlignedLoad(T_size,
+            ctx.builder.CreateInBoundsGEP(T_size, entry_psize,
+                ConstantInt::get(T_size, offsetof(jl_typemap_entry_t, min_world) / sizeof(size_t))),
+            Align(sizeof(size_t)));
+    Value *entry_maxworld = ctx.builder.CreateAlignedLoad(T_size,
+            ctx.builder.CreateInBoundsGEP(T_size, entry_psize,
+                ConstantInt::get(T_size, offsetof(jl_typemap_entry_t, max_world) / sizeof(size_t))),
+            Align(sizeof(size_t)));
+    match = ctx.builder.CreateAnd(match, ctx.builder.CreateICmpULE(entry_minworld, world));
+    match = ctx.builder.CreateAnd(match, ctx.builder.CreateICmpULE(world, entry_maxworld));
+    // the instance must also still be valid: backedge invalidation truncates
+    // its bounds without touching the typemap entry
+    Value *ci_psize = emit_bitcast(ctx, decay_derived(ctx, ci), getSizePtrTy(C));
+    Value *minworld = ctx.builder.CreateAlignedLoad(T_size,
+            ctx.builder.CreateInBoundsGEP(T_size, ci_psize,
+                ConstantInt::get(T_size, offsetof(jl_code_instance_t, min_world) / sizeof(size_t))),
+            Align(sizeof(size_t)));
+    Value *maxworld = ctx.builder.CreateAlignedLoad(T_size,
+            ctx.builder.CreateInBoundsGEP(T_size, ci_psize,
+                ConstantInt::get(T_size, offsetof(jl_code_instance_t, max_world) / sizeof(size_t))),
+            Align(sizeof(size_t)));
+    match = ctx.builder.CreateAnd(match, ctx.builder.CreateICmpULE(minworld, world));
+    match = ctx.builder.CreateAnd(match, ctx.builder.CreateICmpULE(world, maxworld));
+    // the cached instance had a non-NULL entry point when it was stored, and
+    // `invoke` is only ever upgraded, so no null check is needed here
+    LoadInst *invoke = ctx.builder.CreateAlignedLoad(TFptr,
+            ctx.builder.CreateInBoundsGEP(TFptr,
+                emit_bitcast(ctx, decay_derived(ctx, ci), TFptr->getPointerTo()),
+                ConstantInt::get(T_size, offsetof(jl_code_instance_t, invoke) / sizeof(void*))),
+            Align(sizeof(void*)), "cached_invoke");
+    invoke->setOrdering(AtomicOrdering::Acquire);
+    ctx.builder.CreateCondBr(match, hitBB, missBB);
+
+    Function *TheTrampoline = prepare_call(julia_call2);
+    ctx.builder.SetInsertPoint(hitBB);
+    SmallVector<Value*, 8> hitargs;
+    hitargs.push_back(invoke);
+    hitargs.push_back(ci); // passed through as the trailing register argument
+    hitargs.append(boxedargs.begin(), boxedargs.end());
+    CallInst *fastres = ctx.builder.CreateCall(TheTrampoline, hitargs);
+    fastres->setAttributes(TheTrampoline->getAttributes());
+    ctx.builder.CreateBr(exitBB);
+
+    ctx.builder.SetInsertPoint(missBB);
+    SmallVector<Value*, 8> missargs;
+    missargs.push_back(prepare_call(jlapplygenericcached_func));
+    missargs.push_back(track_pjlvalue(ctx, literal_pointer_val(ctx, (jl_value_t*)cache)));
+    missargs.append(boxedargs.begin(), boxedargs.end());
+    CallInst *slowres = ctx.builder.CreateCall(TheTrampoline, missargs);
+    slowres->setAttributes(TheTrampoline->getAttributes());
+    ctx.builder.CreateBr(exitBB);
+
+    ctx.builder.SetInsertPoint(exitBB);
+    PHINode *res = ctx.builder.CreatePHI(ctx.types().T_prjlvalue, 2);
+    res->addIncoming(fastres, hitBB);
+    res->addIncoming(slowres, missBB);
+    return res;
+}
+
 
 static jl_cgval_t emit_call_specfun_other(jl_codectx_t &ctx, jl_method_instance_t *mi, jl_value_t *jlretty, StringRef specFunctionObject,
                                           const jl_cgval_t *argv, size_t nargs, jl_returninfo_t::CallingConv *cc, unsigned *return_roots, jl_value_t *inferred_retty)
@@ -4204,6 +4396,22 @@ static jl_cgval_t emit_invoke(jl_codectx_t &ctx, jl_expr_t *ex, jl_value_t *rt)
     return emit_invoke(ctx, lival, argv, nargs, rt);
 }
 
+// Whether the inferred effects of `codeinst` permit evaluating a call at
+// codegen time: the callee must be deterministic (:consistent), free of side
+// effects, guaranteed to terminate and not throw, independent of task state,
+// and not from an overlayed method table. Bit layout follows encode_effects
+// in base/compiler/effects.jl; 0 is ALWAYS_TRUE for the 2/3-bit fields.
+static bool invoke_foldable(jl_code_instance_t *codeinst)
+{
+    uint32_t purity = jl_atomic_load_relaxed(&codeinst->purity_bits);
+    return ((purity >> 0) & 0x07) == 0 && // :consistent
+           ((purity >> 3) & 0x03) == 0 && // :effect_free
+           ((purity >> 5) & 0x01) &&      // :nothrow
+           ((purity >> 6) & 0x01) &&      // :terminates
+           ((purity >> 7) & 0x01) &&      // :notaskstate
+           ((purity >> 10) & 0x01);       // :nonoverlayed
+}
+
 static jl_cgval_t emit_invoke(jl_codectx_t &ctx, const jl_cgval_t &lival, const jl_cgval_t *argv, size_t nargs, jl_value_t *rt)
 {
     ++EmittedInvokes;
@@ -4232,12 +4440,53 @@ static jl_cgval_t emit_invoke(jl_codectx_t &ctx, const jl_cgval_t &lival, const
             jl_code_instance_t *codeinst = (jl_code_instance_t*)ci;
             if (ci != jl_nothing) {
                 auto invoke = jl_atomic_load_relaxed(&codeinst->invoke);
+                // Concrete-evaluation fold: when the callee's effects say
+                // the call is total and every argument is a compile-time
+                // constant, run the already-compiled callee now and embed
+                // the result as a literal. Inference folds most of these
+                // itself but gives up on calls it considers too expensive
+                // to re-evaluate speculatively; here the cost is paid once,
+                // at the one call site being emitted. Restricted to callees
+                // with an entry point so this never re-enters codegen.
+                if (invoke != NULL && invoke != jl_fptr_const_return_addr &&
+                    invoke != jl_fptr_sparam_addr && invoke_foldable(codeinst)) {
+                    size_t i = 0;
+                    while (i < nargs && argv[i].constant)
+                        i++;
+                    if (i == nargs) {
+                        jl_value_t **cargs;
+                        JL_GC_PUSHARGS(cargs, nargs);
+                        for (i = 0; i < nargs; i++)
+                            cargs[i] = argv[i].constant;
+                        // pin the world we are emitting for, as inference's
+                        // concrete-eval does, and guard the execution:
+                        // :nothrow does not cover environment-dependent
+                        // errors (StackOverflowError, InterruptException),
+                        // which must not unwind through codegen
+                        size_t last_age = jl_current_task->world_age;
+                        jl_current_task->world_age = ctx.world;
+                        jl_value_t *res;
+                        JL_TRY {
+                            res = invoke(cargs[0], &cargs[1], nargs - 1, codeinst);
+                        }
+                        JL_CATCH {
+                            res = NULL; // fall back to emitting the invoke
+                        }
+                        jl_current_task->world_age = last_age;
+                        JL_GC_POP();
+                        if (res != NULL) {
+                            result = mark_julia_const(ctx, jl_ensure_rooted(ctx, res));
+                            handled = true;
+                            ++FoldedInvokes;
+                        }
+                    }
+                }
                  // check if we know how to handle this specptr
-                if (invoke == jl_fptr_const_return_addr) {
+                if (!handled && invoke == jl_fptr_const_return_addr) {
                     result = mark_julia_const(ctx, codeinst->rettype_const);
                     handled = true;
                 }
-                else if (invoke != jl_fptr_sparam_addr) {
+                else if (!handled && invoke != jl_fptr_sparam_addr) {
                     bool specsig, needsparams;
                     std::tie(specsig, needsparams) = uses_specsig(mi, codeinst->rettype, ctx.params->prefer_specsig);
                     std::string name;
@@ -4387,8 +4636,57 @@ static jl_cgval_t emit_call(jl_codectx_t &ctx, jl_expr_t *ex, jl_value_t *rt, bo
         }
     }
 
+    // Keyword-call devirtualization: when the keyword names are literal,
+    // the NamedTuple type (and often every other argument type) is already
+    // concrete here even if inference left the call dynamic. Resolve the
+    // kwsorter now and emit a direct invoke, so that a compiled
+    // kw-specialized code instance is called specsig with the NamedTuple in
+    // registers instead of boxing it for jl_apply_generic.
+    if (!context && f.constant == jl_kwcall_func && nargs >= 3 &&
+            jl_is_namedtuple_type(argv[1].typ)) {
+        size_t i;
+        for (i = 0; i < nargs; i++) {
+            if (!jl_is_concrete_type(argv[i].typ) || jl_is_kind(argv[i].typ))
+                break;
+        }
+        if (i == nargs) {
+            jl_value_t **argtypes = (jl_value_t**)alloca(sizeof(jl_value_t*) * nargs);
+            for (i = 0; i < nargs; i++)
+                argtypes[i] = argv[i].typ;
+            jl_value_t *tt = (jl_value_t*)jl_apply_tuple_type_v(argtypes, nargs);
+            JL_GC_PUSH1(&tt);
+            size_t min_valid = 1, max_valid = ~(size_t)0;
+            jl_method_instance_t *mi = jl_get_specialization1((jl_tupletype_t*)tt, ctx.world, &min_valid, &max_valid, 1);
+            // The emitted code can outlive ctx.world: its validity from here
+            // on is maintained only by the backedges recorded below, which
+            // cannot cover a method that was already defined when we looked.
+            // A truncated interval means the match at ctx.world is already
+            // shadowed by a newer kw method, so binding the call to it would
+            // leave the site permanently stale; take the dynamic path instead.
+            if (mi != NULL && min_valid <= ctx.world && max_valid == ~(size_t)0) {
+                // the resolved target is only valid until a new kw method
+                // intersects this signature or the target is deleted;
+                // record both dispatch edges inference would have: the mt
+                // backedge covers method additions, and the callee-MI
+                // backedge covers Base.delete_method, whose invalidation
+                // walks MI backedges but never scans mt backedges
+                if (jl_is_method(ctx.linfo->def.method)) {
+                    jl_methtable_t *mt = jl_method_table_for(tt);
+                    if ((jl_value_t*)mt != jl_nothing)
+                        jl_method_table_add_backedge(mt, tt, (jl_value_t*)ctx.linfo);
+                    jl_method_instance_add_backedge(mi, NULL, ctx.linfo);
+                }
+                jl_cgval_t lival = mark_julia_const(ctx, jl_ensure_rooted(ctx, (jl_value_t*)mi));
+                jl_cgval_t result = emit_invoke(ctx, lival, argv, nargs, rt);
+                JL_GC_POP();
+                return result;
+            }
+            JL_GC_POP();
+        }
+    }
+
     // emit function and arguments
-    Value *callval = emit_jlcall(ctx, jlapplygeneric_func, nullptr, generic_argv, n_generic_args, julia_call);
+    Value *callval = emit_apply_generic_with_cache(ctx, generic_argv, n_generic_args);
     return mark_julia_type(ctx, callval, true, rt);
 }
 
@@ -4739,6 +5037,33 @@ static void emit_vi_assignment_unboxed(jl_codectx_t &ctx, jl_varinfo_t &vi, Valu
     }
 }
 
+// Whether any phi in the run containing statement `idx` (including that phi
+// itself, for self-edges) reads ssavalue `idx`. Only then does the phi's
+// memory slot need the second buffer plus entry copy below: the predecessor
+// edge has to read the old value after the new one was stored. In the common
+// case the store buffer doubles as the value slot and the copy is skipped,
+// which leaves SROA a plain alloca it can usually promote to SSA values.
+static bool phinode_run_reads(jl_codectx_t &ctx, ssize_t idx)
+{
+    jl_array_t *stmts = ctx.source->code;
+    size_t len = jl_array_len(stmts);
+    ssize_t first = idx;
+    while (first > 0 && jl_is_phinode(jl_array_ptr_ref(stmts, first - 1)))
+        first--;
+    for (ssize_t i = first; i < (ssize_t)len; i++) {
+        jl_value_t *stmt = jl_array_ptr_ref(stmts, i);
+        if (!jl_is_phinode(stmt))
+            break;
+        jl_array_t *values = (jl_array_t*)jl_fieldref_noalloc(stmt, 1);
+        for (size_t j = 0; j < jl_array_len(values); j++) {
+            jl_value_t *v = jl_array_ptr_ref(values, j);
+            if (v != NULL && jl_is_ssavalue(v) && ((jl_ssavalue_t*)v)->id == idx + 1)
+                return true;
+        }
+    }
+    return false;
+}
+
 static void emit_phinode_assign(jl_codectx_t &ctx, ssize_t idx, jl_value_t *r)
 {
     jl_value_t *ssavalue_types = (jl_value_t*)ctx.source->ssavaluetypes;
@@ -4755,18 +5080,22 @@ static void emit_phinode_assign(jl_codectx_t &ctx, ssize_t idx, jl_value_t *r)
         return;
     }
     AllocaInst *dest = nullptr;
-    // N.B.: For any memory space, used as a phi,
-    // we need to emit space twice here. The reason for this is that
-    // phi nodes may be arguments of other phi nodes, so if we don't
-    // have two buffers, one may be overwritten before its value is
-    // used. Hopefully LLVM will be able to fold this back where legal.
+    // N.B.: For any memory space, used as a phi, we need to emit space twice
+    // when another phi of the same run reads this one. The reason for this is
+    // that the predecessor edge must then still see the old value after the
+    // new one was stored, so with one buffer it would be overwritten before
+    // its value is used. Otherwise the store buffer is the value slot.
+    bool needscopy = phinode_run_reads(ctx, idx);
     if (jl_is_uniontype(phiType)) {
         bool allunbox;
         size_t min_align, nbytes;
         dest = try_emit_union_alloca(ctx, ((jl_uniontype_t*)phiType), allunbox, min_align, nbytes);
         if (dest) {
-            Instruction *phi = dest->clone();
-            phi->insertAfter(dest);
+            Instruction *phi = dest;
+            if (needscopy) {
+                phi = dest->clone();
+                phi->insertAfter(dest);
+            }
             PHINode *Tindex_phi = PHINode::Create(getInt8Ty(ctx.builder.getContext()), jl_array_len(edges), "tindex_phi");
             BB->getInstList().insert(InsertPt, Tindex_phi);
             PHINode *ptr_phi = PHINode::Create(ctx.types().T_prjlvalue, jl_array_len(edges), "ptr_phi");
@@ -4774,8 +5103,10 @@ static void emit_phinode_assign(jl_codectx_t &ctx, ssize_t idx, jl_value_t *r)
             Value *isboxed = ctx.builder.CreateICmpNE(
                     ctx.builder.CreateAnd(Tindex_phi, ConstantInt::get(getInt8Ty(ctx.builder.getContext()), 0x80)),
                     ConstantInt::get(getInt8Ty(ctx.builder.getContext()), 0));
-            ctx.builder.CreateMemCpy(phi, MaybeAlign(min_align), dest, MaybeAlign(0), nbytes, false);
-            ctx.builder.CreateLifetimeEnd(dest);
+            if (needscopy) {
+                ctx.builder.CreateMemCpy(phi, MaybeAlign(min_align), dest, MaybeAlign(0), nbytes, false);
+                ctx.builder.CreateLifetimeEnd(dest);
+            }
             Value *ptr = ctx.builder.CreateSelect(isboxed,
                 maybe_bitcast(ctx, decay_derived(ctx, ptr_phi), getInt8PtrTy(ctx.builder.getContext())),
                 maybe_bitcast(ctx, decay_derived(ctx, phi), getInt8PtrTy(ctx.builder.getContext())));
@@ -4811,13 +5142,16 @@ static void emit_phinode_assign(jl_codectx_t &ctx, ssize_t idx, jl_value_t *r)
     PHINode *value_phi = NULL;
     if (vtype->isAggregateType() && CountTrackedPointers(vtype).count == 0) {
         // the value will be moved into dest in the predecessor critical block.
-        // here it's moved into phi in the successor (from dest)
+        // if another phi reads it, it's moved into phi in the successor (from dest)
         dest = emit_static_alloca(ctx, vtype);
-        Value *phi = emit_static_alloca(ctx, vtype);
-        ctx.builder.CreateMemCpy(phi, MaybeAlign(julia_alignment(phiType)),
-             dest, MaybeAlign(0),
-             jl_datatype_size(phiType), false);
-        ctx.builder.CreateLifetimeEnd(dest);
+        Value *phi = dest;
+        if (needscopy) {
+            phi = emit_static_alloca(ctx, vtype);
+            ctx.builder.CreateMemCpy(phi, MaybeAlign(julia_alignment(phiType)),
+                 dest, MaybeAlign(0),
+                 jl_datatype_size(phiType), false);
+            ctx.builder.CreateLifetimeEnd(dest);
+        }
         slot = mark_julia_slot(phi, phiType, NULL, ctx.tbaa().tbaa_stack);
     }
     else {
@@ -6432,10 +6766,10 @@ static jl_cgval_t emit_cfunction(jl_codectx_t &ctx, jl_value_t *output_type, con
             }
             fill = (jl_svec_t*)jl_ensure_rooted(ctx, (jl_value_t*)fill);
         }
-        Type *T_htable = ArrayType::get(getSizeTy(ctx.builder.getContext()), sizeof(htable_t) / sizeof(void*));
-        Value *cache = new GlobalVariable(*jl_Module, T_htable, false,
+        Type *T_cfunc_cache = ArrayType::get(getSizeTy(ctx.builder.getContext()), sizeof(jl_cfunc_cache_t) / sizeof(void*));
+        Value *cache = new GlobalVariable(*jl_Module, T_cfunc_cache, false,
                                GlobalVariable::PrivateLinkage,
-                               ConstantAggregateZero::get(T_htable));
+                               ConstantAggregateZero::get(T_cfunc_cache));
         F = ctx.builder.CreateCall(prepare_call(jlgetcfunctiontrampoline_func), {
                  fobj,
                  literal_pointer_val(ctx, output_type),
@@ -8684,6 +9018,7 @@ static void init_jit_functions(void)
     for (auto it : builtin_func_map())
         add_named_global(it.second, it.first);
     add_named_global(jlapplygeneric_func, &jl_apply_generic);
+    add_named_global(jlapplygenericcached_func, &jl_apply_generic_cached);
     add_named_global(jlinvoke_func, &jl_invoke);
     add_named_global(jltopeval_func, &jl_toplevel_eval);
     add_named_global(jlcopyast_func, &jl_copy_ast);
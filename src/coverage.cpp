@@ -3,6 +3,7 @@
 #include <string>
 #include <fstream>
 #include <map>
+#include <mutex>
 #include <vector>
 
 #include "llvm-version.h"
@@ -12,6 +13,7 @@
 
 #include "julia.h"
 #include "julia_internal.h"
+#include "threading.h"
 
 using namespace llvm;
 
@@ -43,7 +45,42 @@ static uint64_t *allocLine(std::vector<logdata_block*> &vec, int line)
 
 // Code coverage
 
+// Hit counts are not kept in coverageData itself: concurrent increments of
+// shared slots made coverage runs scale badly once several threads execute
+// the same code (false sharing within a logdata_block, plus lost updates).
+// Instead each instrumented line is assigned a slot index, every thread owns
+// its own pages of counters (ptls->coverage_pages), and the emitted increment
+// is a relaxed load/add/store on thread-private memory. The per-thread shards
+// are summed when the data is written out.
+//
+// Slot values in coverageData: 0 means not instrumented, 1 means instrumented
+// but no counter assigned yet (count 0), and v >= 2 means counter index v - 2.
+
 static logdata_t coverageData;
+static std::mutex coverage_lock;
+static size_t coverage_nlines = 0; // counter slots assigned so far
+
+static uint64_t *coverage_alloc_page(void)
+{
+    return (uint64_t*)calloc(JL_COVERAGE_PAGE_SIZE, sizeof(uint64_t));
+}
+
+// Give `ptls` its (fixed-size) page table and the pages that already have
+// assigned slots. Called once per thread, after the thread is visible in
+// jl_all_tls_states; holding coverage_lock makes this atomic with respect to
+// the page installation loop in jl_coverage_line_slot, so no thread can miss
+// a page.
+extern "C" void jl_coverage_init_thread(jl_ptls_t ptls)
+{
+    std::lock_guard<std::mutex> lock(coverage_lock);
+    if (ptls->coverage_pages != NULL)
+        return;
+    uint64_t **pages = (uint64_t**)calloc(JL_COVERAGE_MAX_PAGES, sizeof(uint64_t*));
+    size_t npages = (coverage_nlines + JL_COVERAGE_PAGE_SIZE - 1) >> JL_COVERAGE_PAGE_LG2;
+    for (size_t i = 0; i < npages; i++)
+        pages[i] = coverage_alloc_page();
+    ptls->coverage_pages = pages;
+}
 
 JL_DLLEXPORT void jl_coverage_alloc_line(StringRef filename, int line)
 {
@@ -53,9 +90,30 @@ JL_DLLEXPORT void jl_coverage_alloc_line(StringRef filename, int line)
     allocLine(coverageData[filename], line);
 }
 
-JL_DLLEXPORT uint64_t *jl_coverage_data_pointer(StringRef filename, int line)
+JL_DLLEXPORT size_t jl_coverage_line_slot(StringRef filename, int line)
 {
-    return allocLine(coverageData[filename], line);
+    std::lock_guard<std::mutex> lock(coverage_lock);
+    uint64_t *slot = allocLine(coverageData[filename], line);
+    if (*slot == 1) {
+        size_t idx = coverage_nlines++;
+        if (idx >= (size_t)JL_COVERAGE_MAX_PAGES << JL_COVERAGE_PAGE_LG2)
+            jl_error("code coverage: too many instrumented lines");
+        if ((idx & (JL_COVERAGE_PAGE_SIZE - 1)) == 0) {
+            // first slot in a new page: install the page in every live
+            // thread before any code that uses it can be emitted (threads
+            // spawned later allocate it in jl_coverage_init_thread)
+            size_t block = idx >> JL_COVERAGE_PAGE_LG2;
+            int nthreads = jl_atomic_load_acquire(&jl_n_threads);
+            jl_ptls_t *allstates = jl_atomic_load_relaxed(&jl_all_tls_states);
+            for (int t = 0; t < nthreads; t++) {
+                jl_ptls_t ptls2 = allstates[t];
+                if (ptls2 && ptls2->coverage_pages && ptls2->coverage_pages[block] == NULL)
+                    ptls2->coverage_pages[block] = coverage_alloc_page();
+            }
+        }
+        *slot = idx + 2;
+    }
+    return *slot - 2;
 }
 
 extern "C" JL_DLLEXPORT void jl_coverage_visit_line(const char *filename_, size_t len_filename, int line)
@@ -63,9 +121,54 @@ extern "C" JL_DLLEXPORT void jl_coverage_visit_line(const char *filename_, size_
     StringRef filename = StringRef(filename_, len_filename);
     if (codegen_imaging_mode() || filename == "" || filename == "none" || filename == "no file" || filename == "<missing>" || line < 0)
         return;
-    std::vector<logdata_block*> &vec = coverageData[filename];
-    uint64_t *ptr = allocLine(vec, line);
-    (*ptr)++;
+    size_t idx = jl_coverage_line_slot(filename, line);
+    jl_ptls_t ptls = jl_current_task->ptls;
+    if (ptls->coverage_pages == NULL) // thread started before coverage was enabled
+        jl_coverage_init_thread(ptls);
+    uint64_t *page = ptls->coverage_pages[idx >> JL_COVERAGE_PAGE_LG2];
+    page[idx & (JL_COVERAGE_PAGE_SIZE - 1)]++;
+}
+
+// Sum the per-thread shards for each assigned counter slot, producing a copy
+// of coverageData whose slots hold 1 + hit count, which is what the writers
+// below expect (they print value - 1, with 0 rendered as "not instrumented").
+static void coverage_merge_counts(logdata_t &merged)
+{
+    std::lock_guard<std::mutex> lock(coverage_lock);
+    std::vector<uint64_t> counts(coverage_nlines, 0);
+    int nthreads = jl_atomic_load_acquire(&jl_n_threads);
+    jl_ptls_t *allstates = jl_atomic_load_relaxed(&jl_all_tls_states);
+    for (int t = 0; t < nthreads; t++) {
+        jl_ptls_t ptls2 = allstates[t];
+        if (ptls2 == NULL || ptls2->coverage_pages == NULL)
+            continue;
+        for (size_t block = 0; (block << JL_COVERAGE_PAGE_LG2) < coverage_nlines; block++) {
+            uint64_t *page = ptls2->coverage_pages[block];
+            if (page == NULL)
+                continue;
+            size_t n = std::min(coverage_nlines - (block << JL_COVERAGE_PAGE_LG2),
+                                (size_t)JL_COVERAGE_PAGE_SIZE);
+            for (size_t i = 0; i < n; i++)
+                counts[(block << JL_COVERAGE_PAGE_LG2) + i] += page[i];
+        }
+    }
+    for (logdata_t::iterator it = coverageData.begin(); it != coverageData.end(); it++) {
+        const std::vector<logdata_block*> &values = it->second;
+        std::vector<logdata_block*> &mvalues = merged[it->first()];
+        mvalues.resize(values.size(), NULL);
+        for (size_t block = 0; block < values.size(); block++) {
+            if (values[block] == NULL)
+                continue;
+            mvalues[block] = (logdata_block*)calloc(1, sizeof(logdata_block));
+            logdata_block &data = *values[block];
+            logdata_block &mdata = *mvalues[block];
+            for (int i = 0; i < logdata_blocksize; i++) {
+                uint64_t v = data[i];
+                if (v != 0)
+                    mdata[i] = v == 1 ? 1 : 1 + counts[v - 2];
+            }
+        }
+    }
 }
 
 // Memory allocation log (malloc_log)
@@ -194,15 +297,17 @@ static void write_lcov_data(logdata_t &logData, const std::string &outfile)
 
 extern "C" JL_DLLEXPORT void jl_write_coverage_data(const char *output)
 {
+    logdata_t merged;
+    coverage_merge_counts(merged);
     if (output) {
         StringRef output_pattern(output);
         if (output_pattern.endswith(".info"))
-            write_lcov_data(coverageData, jl_format_filename(output_pattern.str().c_str()));
+            write_lcov_data(merged, jl_format_filename(output_pattern.str().c_str()));
     }
     else {
         std::string stm;
         raw_string_ostream(stm) << "." << uv_os_getpid() << ".cov";
-        write_log_data(coverageData, stm.c_str());
+        write_log_data(merged, stm.c_str());
     }
 }
 
@@ -432,6 +432,73 @@ JL_DLLEXPORT uint32_t jl_crc32c_sw(uint32_t crci, const char *buf, size_t len)
     return (uint32_t)crc ^ 0xffffffff;
 }
 
+/* Multiply a 32-bit vector by a 32x32 matrix over GF(2). */
+static uint32_t gf2_matrix_times(const uint32_t *mat, uint32_t vec)
+{
+    uint32_t sum = 0;
+    while (vec) {
+        if (vec & 1)
+            sum ^= *mat;
+        vec >>= 1;
+        mat++;
+    }
+    return sum;
+}
+
+/* Square a 32x32 matrix over GF(2). */
+static void gf2_matrix_square(uint32_t *square, const uint32_t *mat)
+{
+    int n;
+    for (n = 0; n < 32; n++)
+        square[n] = gf2_matrix_times(mat, mat[n]);
+}
+
+/* Return the CRC-32C of the concatenation of two blocks, given `crc1` of the
+   first block, `crc2` of the second, and the length in bytes of the second.
+   This is the standard matrix-squaring construction (as in zlib's
+   crc32_combine), specialized to the CRC-32C polynomial.  It lets callers
+   checksum a large buffer in independent chunks -- e.g. from several threads
+   -- and merge the per-chunk results in O(log len) time. */
+JL_DLLEXPORT uint32_t jl_crc32c_combine(uint32_t crc1, uint32_t crc2, size_t len2)
+{
+    int n;
+    uint32_t row;
+    uint32_t even[32]; /* even-power-of-two zeros operator */
+    uint32_t odd[32];  /* odd-power-of-two zeros operator */
+
+    if (len2 == 0)
+        return crc1;
+
+    /* put operator for one zero bit in odd */
+    odd[0] = POLY;
+    row = 1;
+    for (n = 1; n < 32; n++) {
+        odd[n] = row;
+        row <<= 1;
+    }
+
+    /* put operator for two zero bits in even, four zero bits back in odd */
+    gf2_matrix_square(even, odd);
+    gf2_matrix_square(odd, even);
+
+    /* apply len2 zeros to crc1 (first square puts operator for one zero
+       byte, eight zero bits, in even) */
+    do {
+        gf2_matrix_square(even, odd);
+        if (len2 & 1)
+            crc1 = gf2_matrix_times(even, crc1);
+        len2 >>= 1;
+        if (len2 == 0)
+            break;
+        gf2_matrix_square(odd, even);
+        if (len2 & 1)
+            crc1 = gf2_matrix_times(odd, crc1);
+        len2 >>= 1;
+    } while (len2);
+
+    return crc1 ^ crc2;
+}
+
 /*****************************************************************************/
 /*****************************************************************************/
 /*****************************************************************************/
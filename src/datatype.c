@@ -1287,7 +1287,10 @@ BOX_FUNC(float64, double, jl_box, 1)
 BOX_FUNC(float64, double, jl_box, 2)
 #endif
 
-#define NBOX_C 1024
+// number of permanently-boxed small values per integer type; covers
+// [-NBOX_C/2, NBOX_C/2) for signed types and [0, NBOX_C) for unsigned
+// ones, so that boxing in that range never allocates
+#define NBOX_C 4096
 
 #define SIBOX_FUNC(typ,c_type,nw)\
     static jl_value_t *boxed_##typ##_cache[NBOX_C];                     \
@@ -1552,16 +1555,17 @@ JL_DLLEXPORT jl_value_t *jl_get_nth_field(jl_value_t *v, size_t i)
     jl_datatype_t *st = (jl_datatype_t*)jl_typeof(v);
     if (i >= jl_datatype_nfields(st))
         jl_bounds_error_int(v, i + 1);
-    size_t offs = jl_field_offset(st, i);
-    if (jl_field_isptr(st, i)) {
+    uint32_t offs, fldsz;
+    int isptr;
+    jl_field_getdesc(st, i, &offs, &fldsz, &isptr);
+    if (isptr) {
         return jl_atomic_load_relaxed((_Atomic(jl_value_t*)*)((char*)v + offs));
     }
     jl_value_t *ty = jl_field_type_concrete(st, i);
     int isatomic = jl_field_isatomic(st, i);
     if (jl_is_uniontype(ty)) {
         assert(!isatomic);
-        size_t fsz = jl_field_size(st, i);
-        uint8_t sel = ((uint8_t*)v)[offs + fsz - 1];
+        uint8_t sel = ((uint8_t*)v)[offs + fldsz - 1];
         ty = jl_nth_union_component(ty, sel);
         if (jl_is_datatype_singleton((jl_datatype_t*)ty))
             return ((jl_datatype_t*)ty)->instance;
@@ -1602,6 +1606,37 @@ JL_DLLEXPORT jl_value_t *jl_get_nth_field_checked(jl_value_t *v, size_t i)
     return r;
 }
 
+// Like jl_get_nth_field_checked, but the load itself carries the requested
+// ordering, so no trailing fence is needed: a load-only access never has a
+// store side to order against. On TSO hardware every path below is a plain MOV.
+JL_DLLEXPORT jl_value_t *jl_get_nth_field_checked_ordered(jl_value_t *v, size_t i, enum jl_memory_order order)
+{
+    jl_datatype_t *st = (jl_datatype_t*)jl_typeof(v);
+    if (i >= jl_datatype_nfields(st))
+        jl_bounds_error_int(v, i + 1);
+    uint32_t offs, fldsz;
+    int isptr;
+    jl_field_getdesc(st, i, &offs, &fldsz, &isptr);
+    jl_value_t *r;
+    if (isptr) {
+        _Atomic(jl_value_t*) *fld = (_Atomic(jl_value_t*)*)((char*)v + offs);
+        if (order >= jl_memory_order_seq_cst)
+            r = jl_atomic_load(fld);
+        else if (order >= jl_memory_order_acquire)
+            r = jl_atomic_load_acquire(fld);
+        else
+            r = jl_atomic_load_relaxed(fld);
+    }
+    else {
+        // the inline paths of jl_get_nth_field are already at least as strong
+        // as any load ordering: atomic fields use a seq_cst load (or the lock)
+        r = jl_get_nth_field(v, i);
+    }
+    if (__unlikely(r == NULL))
+        jl_throw(jl_undefref_exception);
+    return r;
+}
+
 static inline void memassign_safe(int hasptr, jl_value_t *parent, char *dst, const jl_value_t *src, size_t nb) JL_NOTSAFEPOINT
 {
     if (hasptr) {
@@ -1627,12 +1662,14 @@ static inline void memassign_safe(int hasptr, jl_value_t *parent, char *dst, con
 
 void set_nth_field(jl_datatype_t *st, jl_value_t *v, size_t i, jl_value_t *rhs, int isatomic) JL_NOTSAFEPOINT
 {
-    size_t offs = jl_field_offset(st, i);
+    uint32_t offs, fldsz;
+    int isptr;
+    jl_field_getdesc(st, i, &offs, &fldsz, &isptr);
     if (rhs == NULL) { // TODO: this should be invalid, but it happens frequently in ircode.c
-        assert(jl_field_isptr(st, i) && *(jl_value_t**)((char*)v + offs) == NULL);
+        assert(isptr && *(jl_value_t**)((char*)v + offs) == NULL);
         return;
     }
-    if (jl_field_isptr(st, i)) {
+    if (isptr) {
         jl_atomic_store_release((_Atomic(jl_value_t*)*)((char*)v + offs), rhs);
         jl_gc_wb(v, rhs);
     }
@@ -1643,8 +1680,7 @@ void set_nth_field(jl_datatype_t *st, jl_value_t *v, size_t i, jl_value_t *rhs,
         int isunion = jl_is_uniontype(ty);
         if (isunion) {
             assert(!isatomic);
-            size_t fsz = jl_field_size(st, i);
-            uint8_t *psel = &((uint8_t*)v)[offs + fsz - 1];
+            uint8_t *psel = &((uint8_t*)v)[offs + fldsz - 1];
             unsigned nth = 0;
             if (!jl_find_union_component(ty, rty, &nth))
                 assert(0 && "invalid field assignment to isbits union");
@@ -1919,9 +1955,11 @@ jl_value_t *replace_nth_field(jl_datatype_t *st, jl_value_t *v, size_t i, jl_val
 JL_DLLEXPORT int jl_field_isdefined(jl_value_t *v, size_t i) JL_NOTSAFEPOINT
 {
     jl_datatype_t *st = (jl_datatype_t*)jl_typeof(v);
-    size_t offs = jl_field_offset(st, i);
+    uint32_t offs, fldsz;
+    int isptr;
+    jl_field_getdesc(st, i, &offs, &fldsz, &isptr);
     _Atomic(jl_value_t*) *fld = (_Atomic(jl_value_t*)*)((char*)v + offs);
-    if (!jl_field_isptr(st, i)) {
+    if (!isptr) {
         jl_datatype_t *ft = (jl_datatype_t*)jl_field_type_concrete(st, i);
         if (!jl_is_datatype(ft) || ft->layout->first_ptr < 0)
             return 2; // isbits are always defined
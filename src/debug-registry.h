@@ -5,6 +5,7 @@
 #include "julia.h"
 
 #include <map>
+#include <memory>
 #include <mutex>
 #include <type_traits>
 
@@ -106,10 +107,21 @@ private:
         llvm::DIContext *context = nullptr;
     };
 
+    // A registered object whose per-symbol scan has been deferred until a
+    // lookup first hits one of its text sections. The section load addresses
+    // are resolved eagerly, since the JIT's `getLoadAddress` callback is only
+    // valid for the duration of `registerJITObject`.
+    struct PendingObjInfo {
+        const llvm::object::ObjectFile *object = nullptr;
+        size_t SectionSize = 0;
+        std::shared_ptr<llvm::StringMap<uint64_t>> loadAddresses{};
+    };
+
     template<typename KeyT, typename ValT>
     using rev_map = std::map<KeyT, ValT, std::greater<KeyT>>;
 
     typedef rev_map<size_t, ObjectInfo> objectmap_t;
+    typedef rev_map<size_t, PendingObjInfo> pendingmap_t;
     typedef rev_map<uint64_t, objfileentry_t> objfilemap_t;
 
     objectmap_t objectmap{};
@@ -124,7 +136,12 @@ private:
 
     Locked<objfilemap_t> objfilemap{};
 
+    Locked<pendingmap_t> pendingobjs{};
+
     static std::string mangle(llvm::StringRef Name, const llvm::DataLayout &DL) JL_NOTSAFEPOINT;
+    void scanJITObject(const llvm::object::ObjectFile &Object,
+                    std::function<uint64_t(const llvm::StringRef &)> getLoadAddress,
+                    std::function<void*(void*)> lookupWriteAddress) JL_NOTSAFEPOINT;
 
 public:
 
@@ -138,6 +155,7 @@ public:
     void registerJITObject(const llvm::object::ObjectFile &Object,
                         std::function<uint64_t(const llvm::StringRef &)> getLoadAddress,
                         std::function<void*(void*)> lookupWriteAddress) JL_NOTSAFEPOINT;
+    void realizeJITObject(size_t pointer) JL_NOTSAFEPOINT;
     objectmap_t& getObjectMap() JL_NOTSAFEPOINT;
     void add_image_info(image_info_t info) JL_NOTSAFEPOINT;
     bool get_image_info(uint64_t base, image_info_t *info) const JL_NOTSAFEPOINT;
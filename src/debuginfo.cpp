@@ -30,11 +30,16 @@ using namespace llvm;
 #include "debuginfo.h"
 #if defined(_OS_LINUX_)
 #  include <link.h>
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
 #endif
 #include "processor.h"
 
 #include <string>
 #include <map>
+#include <memory>
 #include <vector>
 #include <set>
 #include <mutex>
@@ -95,6 +100,7 @@ void JITDebugInfoRegistry::add_code_in_flight(StringRef name, jl_code_instance_t
 
 jl_method_instance_t *JITDebugInfoRegistry::lookupLinfo(size_t pointer)
 {
+    realizeJITObject(pointer);
     jl_lock_profile();
     auto region = linfomap.lower_bound(pointer);
     jl_method_instance_t *linfo = NULL;
@@ -221,12 +227,234 @@ static void create_PRUNTIME_FUNCTION(uint8_t *Code, size_t Size, StringRef fnnam
 }
 #endif
 
+#if defined(_OS_LINUX_)
+// --- streaming perf support for jitted code ---
+//
+// With JULIA_PERF_MAP=1, every jitted function is appended to
+// /tmp/perf-<pid>.map so that `perf record` / `perf top` can attribute JIT
+// frames by name. With JULIA_PERF_JITDUMP=1, a jitdump file (jit-<pid>.dump
+// in the current directory) is additionally emitted for `perf inject -j`,
+// which also provides sizes and a copy of the machine code for annotation.
+// Records are queued at object registration and written by a background
+// thread, so the JIT emission path never waits on disk.
+
+typedef struct _jl_perf_jit_record_t {
+    struct _jl_perf_jit_record_t *next;
+    uint64_t addr;
+    uint64_t size;
+    uint32_t tid;
+    char *name;
+} jl_perf_jit_record_t;
+
+static uv_mutex_t perf_jit_lock;
+static uv_cond_t perf_jit_cond;
+static jl_perf_jit_record_t *perf_jit_pending; // LIFO stack of unwritten records
+static FILE *perf_map_fs;
+static FILE *perf_jitdump_fs;
+
+static uint64_t perf_jit_timestamp(void) JL_NOTSAFEPOINT
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// linux-perf jitdump file format, version 1
+typedef struct {
+    uint32_t magic;     // "JiTD"
+    uint32_t version;
+    uint32_t total_size;
+    uint32_t elf_mach;
+    uint32_t pad1;
+    uint32_t pid;
+    uint64_t timestamp;
+    uint64_t flags;
+} perf_jitdump_header_t;
+
+#define PERF_JIT_CODE_LOAD 0
+
+typedef struct {
+    uint32_t id;
+    uint32_t total_size;
+    uint64_t timestamp;
+    uint32_t pid;
+    uint32_t tid;
+    uint64_t vma;
+    uint64_t code_addr;
+    uint64_t code_size;
+    uint64_t code_index;
+} perf_jitdump_code_load_t;
+
+static void jl_perf_jit_writer(void *arg) JL_NOTSAFEPOINT
+{
+    (void)arg;
+    uint64_t code_index = 0;
+    uint32_t pid = (uint32_t)getpid();
+    for (;;) {
+        uv_mutex_lock(&perf_jit_lock);
+        while (perf_jit_pending == NULL)
+            uv_cond_wait(&perf_jit_cond, &perf_jit_lock);
+        jl_perf_jit_record_t *rec = perf_jit_pending;
+        perf_jit_pending = NULL;
+        uv_mutex_unlock(&perf_jit_lock);
+        // the stack is pushed most-recent-first; reverse it so the files
+        // grow in emission order
+        jl_perf_jit_record_t *prev = NULL;
+        while (rec) {
+            jl_perf_jit_record_t *next = rec->next;
+            rec->next = prev;
+            prev = rec;
+            rec = next;
+        }
+        rec = prev;
+        while (rec) {
+            if (perf_map_fs)
+                fprintf(perf_map_fs, "%llx %llx %s\n", (unsigned long long)rec->addr,
+                        (unsigned long long)rec->size, rec->name);
+            if (perf_jitdump_fs) {
+                perf_jitdump_code_load_t load;
+                size_t namelen = strlen(rec->name) + 1;
+                load.id = PERF_JIT_CODE_LOAD;
+                load.total_size = (uint32_t)(sizeof(load) + namelen + rec->size);
+                load.timestamp = perf_jit_timestamp();
+                load.pid = pid;
+                load.tid = rec->tid;
+                load.vma = rec->addr;
+                load.code_addr = rec->addr;
+                load.code_size = rec->size;
+                load.code_index = code_index++;
+                fwrite(&load, sizeof(load), 1, perf_jitdump_fs);
+                fwrite(rec->name, namelen, 1, perf_jitdump_fs);
+                // jitted code is never deallocated, so it can still be read
+                // here, after the emission path has moved on
+                fwrite((const void*)(uintptr_t)rec->addr, rec->size, 1, perf_jitdump_fs);
+            }
+            jl_perf_jit_record_t *next = rec->next;
+            free(rec->name);
+            free(rec);
+            rec = next;
+        }
+        if (perf_map_fs)
+            fflush(perf_map_fs);
+        if (perf_jitdump_fs)
+            fflush(perf_jitdump_fs);
+    }
+}
+
+static int jl_perf_jit_init(void) JL_NOTSAFEPOINT
+{
+    int mode = 0;
+    const char *map = getenv("JULIA_PERF_MAP");
+    if (map && atoi(map) != 0)
+        mode |= 1;
+    const char *dump = getenv("JULIA_PERF_JITDUMP");
+    if (dump && atoi(dump) != 0)
+        mode |= 2;
+    if (!mode)
+        return 0;
+    uint32_t pid = (uint32_t)getpid();
+    char path[64];
+    if (mode & 1) {
+        snprintf(path, sizeof(path), "/tmp/perf-%u.map", pid);
+        perf_map_fs = fopen(path, "w");
+    }
+    if (mode & 2) {
+        snprintf(path, sizeof(path), "jit-%u.dump", pid);
+        int fd = open(path, O_CREAT | O_TRUNC | O_RDWR, 0666);
+        if (fd != -1) {
+            perf_jitdump_header_t header;
+            memset(&header, 0, sizeof(header));
+            header.magic = 0x4A695444; // "JiTD"
+            header.version = 1;
+            header.total_size = sizeof(header);
+#if defined(_CPU_X86_64_)
+            header.elf_mach = 62;  // EM_X86_64
+#elif defined(_CPU_X86_)
+            header.elf_mach = 3;   // EM_386
+#elif defined(_CPU_AARCH64_)
+            header.elf_mach = 183; // EM_AARCH64
+#elif defined(_CPU_ARM_)
+            header.elf_mach = 40;  // EM_ARM
+#elif defined(_CPU_PPC64_)
+            header.elf_mach = 21;  // EM_PPC64
+#endif
+            header.pid = pid;
+            header.timestamp = perf_jit_timestamp();
+            // perf only associates the jitdump with this process if the file
+            // is mmapped executable into it, so map the header page
+            if (write(fd, &header, sizeof(header)) == (ssize_t)sizeof(header) &&
+                mmap(NULL, getpagesize(), PROT_READ | PROT_EXEC, MAP_PRIVATE, fd, 0) != MAP_FAILED)
+                perf_jitdump_fs = fdopen(fd, "a");
+            if (perf_jitdump_fs == NULL)
+                close(fd);
+        }
+    }
+    mode = (perf_map_fs ? 1 : 0) | (perf_jitdump_fs ? 2 : 0);
+    if (!mode)
+        return 0;
+    uv_mutex_init(&perf_jit_lock);
+    uv_cond_init(&perf_jit_cond);
+    uv_thread_t writer;
+    uv_thread_create(&writer, jl_perf_jit_writer, NULL);
+    return mode;
+}
+
+static int jl_perf_jit_mode(void) JL_NOTSAFEPOINT
+{
+    // the first registration initializes the output files and the writer
+    // thread exactly once
+    static int mode = jl_perf_jit_init();
+    return mode;
+}
+
+static void jl_perf_jit_stream_object(const object::ObjectFile &Object,
+                        std::function<uint64_t(const StringRef &)> &getLoadAddress) JL_NOTSAFEPOINT
+{
+    jl_perf_jit_record_t *head = NULL, *tail = NULL;
+    uint32_t tid = (uint32_t)syscall(SYS_gettid);
+    object::section_iterator EndSection = Object.section_end();
+    for (const auto &sym_size : object::computeSymbolSizes(Object)) {
+        const object::SymbolRef &sym_iter = sym_size.first;
+        if (cantFail(sym_iter.getType()) != object::SymbolRef::ST_Function)
+            continue;
+        auto Section = cantFail(sym_iter.getSection());
+        if (Section == EndSection || !Section->isText())
+            continue;
+        size_t Size = sym_size.second;
+        if (Size == 0)
+            continue;
+        uint64_t Addr = cantFail(sym_iter.getAddress());
+        Addr -= Section->getAddress() - getLoadAddress(cantFail(Section->getName()));
+        StringRef sName = cantFail(sym_iter.getName());
+        jl_perf_jit_record_t *rec = (jl_perf_jit_record_t*)malloc_s(sizeof(jl_perf_jit_record_t));
+        rec->addr = Addr;
+        rec->size = Size;
+        rec->tid = tid;
+        rec->name = (char*)malloc_s(sName.size() + 1);
+        memcpy(rec->name, sName.data(), sName.size());
+        rec->name[sName.size()] = '\0';
+        // build the object's chain in reverse, so that pushing it onto the
+        // LIFO stack leaves the records in emission order after the writer's
+        // reversal
+        rec->next = head;
+        head = rec;
+        if (tail == NULL)
+            tail = rec;
+    }
+    if (head == NULL)
+        return;
+    uv_mutex_lock(&perf_jit_lock);
+    tail->next = perf_jit_pending;
+    perf_jit_pending = head;
+    uv_mutex_unlock(&perf_jit_lock);
+    uv_cond_signal(&perf_jit_cond);
+}
+#endif
+
 void JITDebugInfoRegistry::registerJITObject(const object::ObjectFile &Object,
                         std::function<uint64_t(const StringRef &)> getLoadAddress,
                         std::function<void*(void*)> lookupWriteAddress)
 {
-    object::section_iterator EndSection = Object.section_end();
-
 #ifdef _CPU_ARM_
     // ARM does not have/use .eh_frame
     uint64_t arm_exidx_addr = 0;
@@ -277,6 +505,74 @@ void JITDebugInfoRegistry::registerJITObject(const object::ObjectFile &Object,
     }
 #endif
 
+#if defined(_OS_LINUX_)
+    // stream the new code records to the perf map / jitdump writer thread
+    if (jl_perf_jit_mode())
+        jl_perf_jit_stream_object(Object, getLoadAddress);
+#endif
+
+#if defined(_OS_WINDOWS_)
+    // Windows needs the unwind tables installed before any of this code can
+    // run, so the symbol scan cannot be deferred.
+    scanJITObject(Object, getLoadAddress, lookupWriteAddress);
+#else
+    // The per-symbol scan is the expensive part of registration, and it only
+    // serves backtrace lookups, most of which never happen. Record the text
+    // section ranges and defer the scan until an address in one of them is
+    // actually looked up. `getLoadAddress` is not valid past this call, so
+    // resolve the section load addresses now.
+    auto loadAddresses = std::make_shared<StringMap<uint64_t>>();
+    auto lock = *this->pendingobjs;
+    auto &pending = *lock;
+    for (const object::SectionRef &section : Object.sections()) {
+        if (!section.isText())
+            continue;
+        auto sName = section.getName();
+        if (!sName)
+            continue;
+        uint64_t SectionLoadAddr = getLoadAddress(sName.get());
+        if (!SectionLoadAddr)
+            continue;
+        (*loadAddresses)[sName.get()] = SectionLoadAddr;
+        pending[SectionLoadAddr] = {&Object, (size_t)section.getSize(), loadAddresses};
+    }
+#endif
+}
+
+void JITDebugInfoRegistry::realizeJITObject(size_t pointer)
+{
+    auto lock = *this->pendingobjs;
+    auto &pending = *lock;
+    auto it = pending.lower_bound(pointer);
+    if (it == pending.end() || pointer >= it->first + it->second.SectionSize)
+        return;
+    const object::ObjectFile *object = it->second.object;
+    auto loadAddresses = std::move(it->second.loadAddresses);
+    // the scan covers every section of the object, so drop all of its pending
+    // entries, not just the one we hit
+    for (auto pit = pending.begin(); pit != pending.end();) {
+        if (pit->second.object == object)
+            pit = pending.erase(pit);
+        else
+            ++pit;
+    }
+    // run the scan while still holding the pending-object lock, so that a
+    // concurrent lookup into the same object waits for the maps to be
+    // populated instead of missing it entirely
+    scanJITObject(*object, [&loadAddresses](const StringRef &sName) JL_NOTSAFEPOINT -> uint64_t {
+        auto search = loadAddresses->find(sName);
+        if (search == loadAddresses->end())
+            return 0;
+        return search->second;
+    }, nullptr);
+}
+
+void JITDebugInfoRegistry::scanJITObject(const object::ObjectFile &Object,
+                        std::function<uint64_t(const StringRef &)> getLoadAddress,
+                        std::function<void*(void*)> lookupWriteAddress)
+{
+    object::section_iterator EndSection = Object.section_end();
+
 #if defined(_OS_WINDOWS_)
     uint64_t SectionAddrCheck = 0;
     uint64_t SectionLoadCheck = 0; (void)SectionLoadCheck;
@@ -1133,6 +1429,21 @@ bool jl_dylib_DI_for_fptr(size_t pointer, object::SectionRef *Section, int64_t *
     return true;
 }
 
+// Load base and file path of the dynamic object containing `ip`, for the
+// compact backtrace serializer (stackwalk.c). On success `*fname` is a
+// malloc'd path owned by the caller. Returns 0 for pointers outside any
+// loaded object (JIT code).
+extern "C" int jl_object_for_ip(size_t ip, uint64_t *fbase, char **fname) JL_NOTSAFEPOINT
+{
+    object::SectionRef Section;
+    llvm::DIContext *context = NULL;
+    int64_t slide;
+    *fname = NULL;
+    if (!jl_dylib_DI_for_fptr(ip, &Section, &slide, &context, false, NULL, fbase, NULL, NULL, fname))
+        return 0;
+    return *fname != NULL;
+}
+
 // *name and *filename should be either NULL or malloc'd pointer
 static int jl_getDylibFunctionInfo(jl_frame_t **frames, size_t pointer, int skipC, int noInline) JL_NOTSAFEPOINT
 {
@@ -1194,6 +1505,7 @@ int jl_DI_for_fptr(uint64_t fptr, uint64_t *symsize, int64_t *slide,
         object::SectionRef *Section, llvm::DIContext **context) JL_NOTSAFEPOINT
 {
     int found = 0;
+    getJITDebugRegistry().realizeJITObject(fptr);
     assert(0 == jl_lock_profile_rd_held());
     jl_lock_profile_wr();
 
@@ -1217,7 +1529,38 @@ int jl_DI_for_fptr(uint64_t fptr, uint64_t *symsize, int64_t *slide,
 }
 
 // Set *name and *filename to either NULL or malloc'd string
-extern "C" JL_DLLEXPORT int jl_getFunctionInfo_impl(jl_frame_t **frames_out, size_t pointer, int skipC, int noInline) JL_NOTSAFEPOINT
+// Cache of decoded frame info keyed by instruction pointer. Printing or
+// collecting stack traces decodes the same return addresses over and over
+// (each one pays a DWARF line-table walk), so remember the most recent
+// decode per hash slot and hand out copies. Direct-mapped: a collision just
+// replaces the previous entry. Locking is try_lock only, so crash-time
+// printing can never deadlock on a lock left held by the crashed thread;
+// under contention the lookup simply decodes without the cache.
+static const size_t frame_cache_size = 512;
+struct frame_cache_entry_t {
+    uintptr_t ip;
+    int skipC;
+    int noInline;
+    int n;
+    jl_frame_t *frames;
+};
+static frame_cache_entry_t frame_cache[frame_cache_size];
+static std::mutex frame_cache_lock;
+
+static jl_frame_t *frame_cache_copy(const jl_frame_t *src, int n) JL_NOTSAFEPOINT
+{
+    jl_frame_t *dst = (jl_frame_t*)malloc_s(sizeof(jl_frame_t) * n);
+    memcpy(dst, src, sizeof(jl_frame_t) * n);
+    for (int i = 0; i < n; i++) {
+        if (src[i].func_name)
+            dst[i].func_name = strdup(src[i].func_name);
+        if (src[i].file_name)
+            dst[i].file_name = strdup(src[i].file_name);
+    }
+    return dst;
+}
+
+static int jl_getFunctionInfo_uncached(jl_frame_t **frames_out, size_t pointer, int skipC, int noInline) JL_NOTSAFEPOINT
 {
     // This function is not allowed to reference any TLS variables if noInline
     // since it can be called from an unmanaged thread on OSX.
@@ -1238,6 +1581,39 @@ extern "C" JL_DLLEXPORT int jl_getFunctionInfo_impl(jl_frame_t **frames_out, siz
     return jl_getDylibFunctionInfo(frames_out, pointer, skipC, noInline);
 }
 
+extern "C" JL_DLLEXPORT int jl_getFunctionInfo_impl(jl_frame_t **frames_out, size_t pointer, int skipC, int noInline) JL_NOTSAFEPOINT
+{
+    size_t slot = (pointer >> 2) % frame_cache_size;
+    if (frame_cache_lock.try_lock()) {
+        frame_cache_entry_t &e = frame_cache[slot];
+        if (e.frames != NULL && e.ip == pointer && e.skipC == skipC && e.noInline == noInline) {
+            int n = e.n;
+            *frames_out = frame_cache_copy(e.frames, n);
+            frame_cache_lock.unlock();
+            return n;
+        }
+        frame_cache_lock.unlock();
+    }
+    int nf = jl_getFunctionInfo_uncached(frames_out, pointer, skipC, noInline);
+    if (nf > 0 && frame_cache_lock.try_lock()) {
+        frame_cache_entry_t &e = frame_cache[slot];
+        if (e.frames != NULL) {
+            for (int i = 0; i < e.n; i++) {
+                free(e.frames[i].func_name);
+                free(e.frames[i].file_name);
+            }
+            free(e.frames);
+        }
+        e.ip = pointer;
+        e.skipC = skipC;
+        e.noInline = noInline;
+        e.n = nf;
+        e.frames = frame_cache_copy(*frames_out, nf);
+        frame_cache_lock.unlock();
+    }
+    return nf;
+}
+
 extern "C" jl_method_instance_t *jl_gdblookuplinfo(void *p) JL_NOTSAFEPOINT
 {
     return getJITDebugRegistry().lookupLinfo((size_t)p);
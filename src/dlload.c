@@ -421,6 +421,92 @@ JL_DLLEXPORT int jl_dlsym(void *handle, const char *symbol, void ** value, int t
     return symbol_found;
 }
 
+// Concurrent startup library preload. JULIA_PRELOAD_LIBS names a
+// comma-separated list of libraries to dlopen on a few helper threads while
+// the system image is being restored; the handles are published into the
+// ccall library map once the workers join, so the first ccall into each
+// library skips its serial dlopen. The workers call only jl_dlopen (no
+// DL_LOAD_PATH search, which would read Base state that is being
+// deserialized concurrently); names the loader cannot resolve directly are
+// simply skipped and load through the normal path later.
+#define JL_PRELOAD_MAX_THREADS 4
+
+typedef struct {
+    uv_thread_t tid;
+    int index;
+    int nthreads;
+} jl_preload_worker_t;
+
+static jl_preload_worker_t preload_workers[JL_PRELOAD_MAX_THREADS];
+static char *preload_buf = NULL;
+static char **preload_names = NULL;
+static void **preload_handles = NULL;
+static int preload_n = 0;
+static int preload_nthreads = 0;
+
+static void jl_preload_worker(void *varg)
+{
+    jl_preload_worker_t *worker = (jl_preload_worker_t*)varg;
+    for (int i = worker->index; i < preload_n; i += worker->nthreads)
+        preload_handles[i] = jl_dlopen(preload_names[i], JL_RTLD_DEFAULT);
+}
+
+void jl_preload_libraries_start(void)
+{
+    char *env = getenv("JULIA_PRELOAD_LIBS");
+    if (env == NULL || *env == '\0')
+        return;
+    preload_buf = strdup(env);
+    int n = 1;
+    for (char *p = preload_buf; *p; p++)
+        if (*p == ',')
+            n++;
+    preload_names = (char**)malloc_s(n * sizeof(char*));
+    preload_handles = (void**)malloc_s(n * sizeof(void*));
+    memset(preload_handles, 0, n * sizeof(void*));
+    preload_n = 0;
+    char *name = preload_buf;
+    for (char *p = preload_buf; ; p++) {
+        if (*p == ',' || *p == '\0') {
+            int last = (*p == '\0');
+            *p = '\0';
+            if (*name != '\0')
+                preload_names[preload_n++] = name;
+            if (last)
+                break;
+            name = p + 1;
+        }
+    }
+    if (preload_n == 0)
+        return;
+    preload_nthreads = preload_n < JL_PRELOAD_MAX_THREADS ? preload_n : JL_PRELOAD_MAX_THREADS;
+    for (int i = 0; i < preload_nthreads; i++) {
+        preload_workers[i].index = i;
+        preload_workers[i].nthreads = preload_nthreads;
+        uv_thread_create(&preload_workers[i].tid, jl_preload_worker, &preload_workers[i]);
+    }
+}
+
+void jl_preload_libraries_finish(void)
+{
+    if (preload_nthreads == 0)
+        return;
+    for (int i = 0; i < preload_nthreads; i++)
+        uv_thread_join(&preload_workers[i].tid);
+    for (int i = 0; i < preload_n; i++) {
+        if (preload_handles[i] != NULL)
+            jl_preload_register_library(preload_names[i], preload_handles[i]);
+    }
+    free(preload_buf);
+    free(preload_names);
+    free(preload_handles);
+    preload_buf = NULL;
+    preload_names = NULL;
+    preload_handles = NULL;
+    preload_n = 0;
+    preload_nthreads = 0;
+}
+
 #ifdef _OS_WINDOWS_
 //Look for symbols in win32 libraries
 JL_DLLEXPORT const char *jl_dlfind_win32(const char *f_name)
@@ -214,10 +214,14 @@ int fl_is_keyword_name(const char *str, size_t len)
 
 #define CHECK_ALIGN8(p) assert((((uintptr_t)(p))&0x7)==0 && "flisp requires malloc to return 8-aligned pointers")
 
-static symbol_t *mk_symbol(const char *str)
+static uint32_t symbol_hash(const char *str, size_t len)
+{
+    return memhash32(str, len)^0xAAAAAAAA;
+}
+
+static symbol_t *mk_symbol(const char *str, size_t len, uint32_t hash)
 {
     symbol_t *sym;
-    size_t len = strlen(str);
 
     sym = (symbol_t*)malloc((offsetof(symbol_t,name)+len+1+7)&-8);
     // TODO: if sym == NULL
@@ -234,16 +238,26 @@ static symbol_t *mk_symbol(const char *str)
     }
     sym->type = NULL;
     sym->dlcache = NULL;
-    sym->hash = memhash32(str, len)^0xAAAAAAAA;
-    strcpy(&sym->name[0], str);
+    sym->hash = hash;
+    memcpy(&sym->name[0], str, len+1);
     return sym;
 }
 
-static symbol_t **symtab_lookup(symbol_t **ptree, const char *str)
+// The tree is keyed on the hash first, so a lookup usually decides which way
+// to go with a single integer compare and the hash spreads the keys evenly
+// enough to keep the (unbalanced) tree shallow; strcmp only runs on the
+// handful of nodes whose hash collides with the query, which includes the
+// match itself.
+static symbol_t **symtab_lookup(symbol_t **ptree, const char *str, uint32_t hash)
 {
     int x;
 
     while (*ptree != NULL) {
+        uint32_t h = (*ptree)->hash;
+        if (hash != h) {
+            ptree = hash < h ? &(*ptree)->left : &(*ptree)->right;
+            continue;
+        }
         x = strcmp(str, (*ptree)->name);
         if (x == 0)
             return ptree;
@@ -257,9 +271,11 @@ static symbol_t **symtab_lookup(symbol_t **ptree, const char *str)
 
 value_t symbol(fl_context_t *fl_ctx, const char *str)
 {
-    symbol_t **pnode = symtab_lookup(&fl_ctx->symtab, str);
+    size_t len = strlen(str);
+    uint32_t hash = symbol_hash(str, len);
+    symbol_t **pnode = symtab_lookup(&fl_ctx->symtab, str, hash);
     if (*pnode == NULL)
-        *pnode = mk_symbol(str);
+        *pnode = mk_symbol(str, len, hash);
     return tagptr(*pnode, TAG_SYM);
 }
 
@@ -269,7 +285,8 @@ value_t fl_gensym(fl_context_t *fl_ctx, value_t *args, uint32_t nargs)
     fl_ctx->gsnameno = 1-fl_ctx->gsnameno;
     char *n = uint2str(fl_ctx->gsname[fl_ctx->gsnameno]+1, sizeof(fl_ctx->gsname[0])-1, fl_ctx->gensym_ctr++, 10);
     *(--n) = 'g';
-    return tagptr(mk_symbol(n), TAG_SYM);
+    size_t len = strlen(n);
+    return tagptr(mk_symbol(n, len, symbol_hash(n, len)), TAG_SYM);
 #else
     argcount(fl_ctx, "gensym", nargs, 0);
     (void)args;
@@ -1716,6 +1733,20 @@ JL_EXTENSION static value_t apply_cl(fl_context_t *fl_ctx, uint32_t nargs)
             fl_apply_v = fl_ctx->Stack[bp+i];
             PUSH(fl_ctx, fl_apply_v);
             NEXT_OP;
+        OP(OP_LOADA_CALL)
+            i = *ip++;
+            fl_apply_v = fl_ctx->Stack[bp+i];
+            PUSH(fl_ctx, fl_apply_v);
+            ip++;  // skip the fused OP_CALL opcode byte
+            n = *ip++;
+            goto do_call;
+        OP(OP_LOADA01)
+            fl_apply_v = fl_ctx->Stack[bp];
+            PUSH(fl_ctx, fl_apply_v);
+            ip++;  // skip the fused OP_LOADA1 opcode byte
+            fl_apply_v = fl_ctx->Stack[bp+1];
+            PUSH(fl_ctx, fl_apply_v);
+            NEXT_OP;
         OP(OP_SETA)
             fl_apply_v = fl_ctx->Stack[fl_ctx->SP-1];
             i = *ip++;
@@ -1852,6 +1883,13 @@ JL_EXTENSION static value_t apply_cl(fl_context_t *fl_ctx, uint32_t nargs)
 #endif
 }
 
+// Computes the maximum stack depth of a code string, and fuses the hot
+// opcode pairs (the last-argument load feeding a call, and the leading
+// two-argument load sequence) into superinstructions in place. Only the
+// first opcode byte of a pair is rewritten; the second instruction stays
+// in the stream, both so that branches into it keep working and so that
+// this scan (and any later rescan of serialized, already-fused code) can
+// keep decoding it as a normal instruction.
 static uint32_t compute_maxstack(uint8_t *code, size_t len, int bswap)
 {
     uint8_t *ip = code+4, *end = code+len;
@@ -1988,13 +2026,26 @@ static uint32_t compute_maxstack(uint8_t *code, size_t len, int bswap)
             sp -=2;
             break;
 
+        case OP_LOADA0:
+            if (ip < end && ip[0] == OP_LOADA1)
+                ip[-1] = OP_LOADA01;
+            sp++;
+            break;
+
         case OP_LOADT: case OP_LOADF: case OP_LOADNIL: case OP_LOAD0:
-        case OP_LOAD1: case OP_LOADA0: case OP_LOADA1: case OP_DUP:
-        case OP_LOADC0: case OP_LOADC1:
+        case OP_LOAD1: case OP_LOADA1: case OP_DUP:
+        case OP_LOADC0: case OP_LOADC1: case OP_LOADA01:
+            sp++;
+            break;
+
+        case OP_LOADA:
+            if (ip+1 < end && ip[1] == OP_CALL)
+                ip[-1] = OP_LOADA_CALL;
+            ip++;
             sp++;
             break;
 
-        case OP_LOADI8: case OP_LOADV: case OP_LOADG: case OP_LOADA:
+        case OP_LOADI8: case OP_LOADV: case OP_LOADG: case OP_LOADA_CALL:
             ip++;
             sp++;
             break;
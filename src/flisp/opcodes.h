@@ -31,6 +31,12 @@ enum {
 
     OP_BOOL_CONST_T, OP_BOOL_CONST_F, OP_THE_EMPTY_LIST, OP_EOF_OBJECT,
 
+    // superinstructions, fused in place by compute_maxstack for the opcode
+    // pairs that dominate parsing; never emitted by the compiler. The second
+    // opcode of each pair is left in the instruction stream (branches may
+    // target it), so these only replace the first opcode byte.
+    OP_LOADA_CALL, OP_LOADA01,
+
     N_OPCODES
 };
 
@@ -71,7 +77,11 @@ enum {
     &&L_OP_CALLL, &&L_OP_TCALLL, &&L_OP_BRNE, &&L_OP_BRNEL, &&L_OP_CADR,\
     &&L_OP_BRNN, &&L_OP_BRNNL, &&L_OP_BRN, &&L_OP_BRNL,                 \
     &&L_OP_OPTARGS, &&L_OP_BRBOUND, &&L_OP_KEYARGS,                     \
-    &&L_OP_BOX, &&L_OP_BOXL, &&L_OP_SHIFT                               \
+    &&L_OP_BOX, &&L_OP_BOXL, &&L_OP_SHIFT,                              \
+                                                                        \
+    NULL, NULL, NULL, NULL,                                             \
+                                                                        \
+    &&L_OP_LOADA_CALL, &&L_OP_LOADA01                                   \
     }
 
 #define VM_APPLY_LABELS                                                 \
@@ -28,10 +28,18 @@ struct jl_raw_alloc_t {
 // callbacks to store profile results. ==
 struct jl_per_thread_alloc_profile_t {
     vector<jl_raw_alloc_t> allocs;
+
+    // state for byte-interval sampling; only touched by the owning thread
+    size_t bytes_until_sample = 0;
+    uint64_t rngseed = 0;
 };
 
 struct jl_alloc_profile_t {
     double sample_rate;
+    // if nonzero, sample by allocated bytes (one capture per `sample_interval`
+    // bytes on average) instead of by allocation count
+    uint64_t sample_interval;
+    uint64_t sample_interval_unbias;
 
     vector<jl_per_thread_alloc_profile_t> per_thread_profiles;
 };
@@ -60,7 +68,12 @@ jl_raw_backtrace_t get_raw_backtrace() JL_NOTSAFEPOINT {
         ptls->profiling_bt_buffer = shared_bt_data_buffer;
     }
 
-    size_t bt_size = rec_backtrace(shared_bt_data_buffer, JL_MAX_BT_SIZE, 2);
+    // The frame-pointer walk is much cheaper than the table-driven unwinder
+    // and keeps low sample intervals usable in production; it shares the
+    // sampling profiler's opt-in (and its accuracy caveats).
+    size_t bt_size = jl_profile_use_fp_unwind() ?
+        rec_backtrace_fp(shared_bt_data_buffer, JL_MAX_BT_SIZE, 2) :
+        rec_backtrace(shared_bt_data_buffer, JL_MAX_BT_SIZE, 2);
 
     // Then we copy only the needed bytes out of the buffer into our profile.
     size_t bt_bytes = bt_size * sizeof(jl_bt_element_t);
@@ -78,14 +91,42 @@ jl_raw_backtrace_t get_raw_backtrace() JL_NOTSAFEPOINT {
 
 extern "C" {  // Needed since these functions doesn't take any arguments.
 
-JL_DLLEXPORT void jl_start_alloc_profile(double sample_rate) {
+static void alloc_profile_ensure_threads(void) {
     // We only need to do this once, the first time this is called.
     size_t nthreads = jl_atomic_load_acquire(&jl_n_threads);
     while (g_alloc_profile.per_thread_profiles.size() < nthreads) {
         g_alloc_profile.per_thread_profiles.push_back(jl_per_thread_alloc_profile_t{});
     }
+}
+
+JL_DLLEXPORT void jl_start_alloc_profile(double sample_rate) {
+    alloc_profile_ensure_threads();
 
     g_alloc_profile.sample_rate = sample_rate;
+    g_alloc_profile.sample_interval = 0;
+    g_alloc_profile_enabled = true;
+}
+
+// Sample by allocated bytes rather than per allocation: capture roughly one
+// allocation per `sample_interval` bytes, with the gap between captures
+// randomized to avoid locking onto allocation-size periodicity. This bounds
+// the profiling overhead by the allocation *volume*, the way heap profilers
+// do, so it stays cheap on workloads that make many small allocations. To
+// estimate total bytes from the samples, weight each one by
+// sample_interval / size.
+JL_DLLEXPORT void jl_start_alloc_profile_sampled(uint64_t sample_interval) {
+    alloc_profile_ensure_threads();
+
+    if (sample_interval == 0)
+        sample_interval = 1;
+    g_alloc_profile.sample_rate = 1.0;
+    g_alloc_profile.sample_interval = sample_interval;
+    unbias_cong(sample_interval, &g_alloc_profile.sample_interval_unbias);
+    for (auto& profile : g_alloc_profile.per_thread_profiles) {
+        profile.bytes_until_sample = 0;
+        if (profile.rngseed == 0)
+            profile.rngseed = jl_rand();
+    }
     g_alloc_profile_enabled = true;
 }
 
@@ -138,10 +179,24 @@ void _maybe_record_alloc_to_profile(jl_value_t *val, size_t size, jl_datatype_t
 
     auto& profile = global_profile.per_thread_profiles[thread_id];
 
-    auto sample_val = double(rand()) / double(RAND_MAX);
-    auto should_record = sample_val <= global_profile.sample_rate;
-    if (!should_record) {
-        return;
+    if (global_profile.sample_interval != 0) {
+        // byte-interval sampling: only the owning thread touches this state
+        if (size < profile.bytes_until_sample) {
+            profile.bytes_until_sample -= size;
+            return;
+        }
+        // pick the next gap uniformly in [interval/2, 3*interval/2) so the
+        // mean matches the requested interval without a fixed period
+        uint64_t interval = global_profile.sample_interval;
+        profile.bytes_until_sample = interval / 2 +
+            cong(interval, global_profile.sample_interval_unbias, &profile.rngseed);
+    }
+    else {
+        auto sample_val = double(rand()) / double(RAND_MAX);
+        auto should_record = sample_val <= global_profile.sample_rate;
+        if (!should_record) {
+            return;
+        }
     }
 
     profile.allocs.emplace_back(jl_raw_alloc_t{
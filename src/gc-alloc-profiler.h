@@ -23,6 +23,7 @@ typedef struct {
 } jl_profile_allocs_raw_results_t;
 
 JL_DLLEXPORT void jl_start_alloc_profile(double sample_rate);
+JL_DLLEXPORT void jl_start_alloc_profile_sampled(uint64_t sample_interval);
 JL_DLLEXPORT jl_profile_allocs_raw_results_t jl_fetch_alloc_profile(void);
 JL_DLLEXPORT void jl_stop_alloc_profile(void);
 JL_DLLEXPORT void jl_free_alloc_profile(void);
@@ -4,10 +4,12 @@
 
 #include "julia_internal.h"
 #include "gc.h"
+#include "dirpath.h"
 
 #include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/DenseMap.h"
 
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <sstream>
@@ -58,6 +60,15 @@ struct Edge {
     size_t to_node;
 };
 
+// An edge as spilled to the temporary file while the snapshot is being taken.
+// Edges dominate the size of the graph, so they are streamed to disk as they
+// are recorded instead of being accumulated in memory, and regrouped by
+// from-node (the order the snapshot format requires) during serialization.
+struct SerializedEdge {
+    size_t from_node;
+    Edge edge;
+};
+
 // Nodes
 // "node_fields":
 //   [ "type", "name", "id", "self_size", "edge_count", "trace_node_id", "detachedness" ]
@@ -73,7 +84,7 @@ struct Node {
     // whether the from_node is attached or dettached from the main application state
     // https://github.com/nodejs/node/blob/5fd7a72e1c4fbaf37d3723c4c81dce35c149dc84/deps/v8/include/v8-profiler.h#L739-L745
     int detachedness;  // 0 - unknown, 1 - attached, 2 - detached
-    vector<Edge> edges;
+    size_t edge_count; // number of outgoing edges; the edges themselves live in the spill file
 
     ~Node() JL_NOTSAFEPOINT = default;
 };
@@ -107,32 +118,61 @@ struct StringTable {
 
 struct HeapSnapshot {
     vector<Node> nodes;
-    // edges are stored on each from_node
+    // edges are spilled to a temporary file as they are recorded, so peak
+    // memory does not scale with the edge count (the dominant term on large
+    // heaps); see `serialize_edges_range` for how they are grouped back
 
     StringTable names;
     StringTable node_types;
     StringTable edge_types;
     DenseMap<void *, size_t> node_ptr_to_index_map;
 
-    size_t num_edges = 0; // For metadata, updated as you add each edge. Needed because edges owned by nodes.
+    size_t num_edges = 0; // For metadata, updated as you add each edge.
+    ios_t edges_file;
+    char edges_path[JL_PATH_MAX];
 };
 
 // global heap snapshot, mutated by garbage collector
 // when snapshotting is on.
 int gc_heap_snapshot_enabled = 0;
+int gc_heap_snapshot_incremental = 0;
 HeapSnapshot *g_snapshot = nullptr;
 extern jl_mutex_t heapsnapshot_lock;
 
 void serialize_heap_snapshot(ios_t *stream, HeapSnapshot &snapshot, char all_one);
 static inline void _record_gc_edge(const char *edge_type,
                                    jl_value_t *a, jl_value_t *b, size_t name_or_index) JL_NOTSAFEPOINT;
-void _record_gc_just_edge(const char *edge_type, Node &from_node, size_t to_idx, size_t name_or_idx) JL_NOTSAFEPOINT;
+void _record_gc_just_edge(const char *edge_type, size_t from_idx, size_t to_idx, size_t name_or_idx) JL_NOTSAFEPOINT;
 void _add_internal_root(HeapSnapshot *snapshot);
 
+// Create an unlinked-on-cleanup scratch file in the system temp directory
+// (following the fallbacks in cgmemmgr.cpp's get_anon_hdl).
+static void open_snapshot_tmpfile(ios_t *f, char *path)
+{
+    size_t len = JL_PATH_MAX;
+    if (uv_os_tmpdir(path, &len) != 0) {
+        // Unknown error; default to `/tmp`
+        snprintf(path, JL_PATH_MAX, "/tmp");
+        len = strlen(path);
+    }
+    snprintf(path + len, JL_PATH_MAX - len, "/julia-heap-snapshot-XXXXXX");
+    if (ios_mkstemp(f, path) == NULL)
+        jl_errorf("could not create temporary file for heap snapshot: %s", path);
+}
+
+static void close_snapshot_tmpfile(ios_t *f, char *path)
+{
+    ios_close(f);
+    uv_fs_t req;
+    uv_fs_unlink(NULL, &req, path, NULL);
+    uv_fs_req_cleanup(&req);
+}
+
 
 JL_DLLEXPORT void jl_gc_take_heap_snapshot(ios_t *stream, char all_one)
 {
     HeapSnapshot snapshot;
+    open_snapshot_tmpfile(&snapshot.edges_file, snapshot.edges_path);
     _add_internal_root(&snapshot);
 
     jl_mutex_lock(&heapsnapshot_lock);
@@ -153,6 +193,42 @@ JL_DLLEXPORT void jl_gc_take_heap_snapshot(ios_t *stream, char all_one)
     // When we return, the snapshot is full
     // Dump the snapshot
     serialize_heap_snapshot((ios_t*)stream, snapshot, all_one);
+    close_snapshot_tmpfile(&snapshot.edges_file, snapshot.edges_path);
+}
+
+// Incremental variant: piggybacks on a young (incremental) collection, so the
+// mark phase only visits objects allocated since the last collection plus the
+// old objects in the remembered sets, i.e. the subgraphs mutated through the
+// write barrier. Old, unmodified objects are skipped entirely; edges into
+// them still appear, pointing at otherwise-unexpanded nodes. The result is a
+// diff-style snapshot in the same node/edge format, with a pause proportional
+// to the young generation rather than the whole heap.
+JL_DLLEXPORT void jl_gc_take_incremental_heap_snapshot(ios_t *stream, char all_one)
+{
+    HeapSnapshot snapshot;
+    open_snapshot_tmpfile(&snapshot.edges_file, snapshot.edges_path);
+    _add_internal_root(&snapshot);
+
+    jl_mutex_lock(&heapsnapshot_lock);
+
+    // Enable snapshotting
+    g_snapshot = &snapshot;
+    gc_heap_snapshot_enabled = true;
+    gc_heap_snapshot_incremental = true;
+
+    // Do a quick GC mark, which will invoke our callbacks on `g_snapshot`
+    // for the write-barrier-reachable portion of the heap only
+    jl_gc_collect(JL_GC_INCREMENTAL);
+
+    // Disable snapshotting
+    gc_heap_snapshot_incremental = false;
+    gc_heap_snapshot_enabled = false;
+    g_snapshot = nullptr;
+
+    jl_mutex_unlock(&heapsnapshot_lock);
+
+    serialize_heap_snapshot((ios_t*)stream, snapshot, all_one);
+    close_snapshot_tmpfile(&snapshot.edges_file, snapshot.edges_path);
 }
 
 // adds a node at id 0 which is the "uber root":
@@ -166,7 +242,7 @@ void _add_internal_root(HeapSnapshot *snapshot)
         0, // size
         0, // size_t trace_node_id (unused)
         0, // int detachedness;  // 0 - unknown,  1 - attached;  2 - detached
-        vector<Edge>() // outgoing edges
+        0  // outgoing edge count
     };
     snapshot->nodes.push_back(internal_root);
 }
@@ -254,7 +330,7 @@ size_t record_node_to_gc_snapshot(jl_value_t *a) JL_NOTSAFEPOINT
         sizeof(void*) + self_size, // size_t self_size;
         0,             // size_t trace_node_id (unused)
         0,             // int detachedness;  // 0 - unknown,  1 - attached;  2 - detached
-        vector<Edge>() // outgoing edges
+        0              // outgoing edge count
     });
 
     if (ios_need_close)
@@ -277,7 +353,7 @@ static size_t record_pointer_to_gc_snapshot(void *a, size_t bytes, StringRef nam
         bytes,         // size_t self_size;
         0,             // size_t trace_node_id (unused)
         0,             // int detachedness;  // 0 - unknown,  1 - attached;  2 - detached
-        vector<Edge>() // outgoing edges
+        0              // outgoing edge count
     });
 
     return val.first->second;
@@ -319,11 +395,10 @@ void _gc_heap_snapshot_record_root(jl_value_t *root, char *name) JL_NOTSAFEPOINT
 {
     record_node_to_gc_snapshot(root);
 
-    auto &internal_root = g_snapshot->nodes.front();
     auto to_node_idx = g_snapshot->node_ptr_to_index_map[root];
     auto edge_label = g_snapshot->names.find_or_create_string_id(name);
 
-    _record_gc_just_edge("internal", internal_root, to_node_idx, edge_label);
+    _record_gc_just_edge("internal", 0 /*internal root*/, to_node_idx, edge_label);
 }
 
 // Add a node to the heap snapshot representing a Julia stack frame.
@@ -344,7 +419,7 @@ size_t _record_stack_frame_node(HeapSnapshot *snapshot, void *frame) JL_NOTSAFEP
         1, // size
         0, // size_t trace_node_id (unused)
         0, // int detachedness;  // 0 - unknown,  1 - attached;  2 - detached
-        vector<Edge>() // outgoing edges
+        0  // outgoing edge count
     });
 
     return val.first->second;
@@ -354,30 +429,27 @@ void _gc_heap_snapshot_record_frame_to_object_edge(void *from, jl_value_t *to) J
 {
     auto from_node_idx = _record_stack_frame_node(g_snapshot, (jl_gcframe_t*)from);
     auto to_idx = record_node_to_gc_snapshot(to);
-    Node &from_node = g_snapshot->nodes[from_node_idx];
 
     auto name_idx = g_snapshot->names.find_or_create_string_id("local var");
-    _record_gc_just_edge("internal", from_node, to_idx, name_idx);
+    _record_gc_just_edge("internal", from_node_idx, to_idx, name_idx);
 }
 
 void _gc_heap_snapshot_record_task_to_frame_edge(jl_task_t *from, void *to) JL_NOTSAFEPOINT
 {
     auto from_node_idx = record_node_to_gc_snapshot((jl_value_t*)from);
     auto to_node_idx = _record_stack_frame_node(g_snapshot, to);
-    Node &from_node = g_snapshot->nodes[from_node_idx];
 
     auto name_idx = g_snapshot->names.find_or_create_string_id("stack");
-    _record_gc_just_edge("internal", from_node, to_node_idx, name_idx);
+    _record_gc_just_edge("internal", from_node_idx, to_node_idx, name_idx);
 }
 
 void _gc_heap_snapshot_record_frame_to_frame_edge(jl_gcframe_t *from, jl_gcframe_t *to) JL_NOTSAFEPOINT
 {
     auto from_node_idx = _record_stack_frame_node(g_snapshot, from);
     auto to_node_idx = _record_stack_frame_node(g_snapshot, to);
-    Node &from_node = g_snapshot->nodes[from_node_idx];
 
     auto name_idx = g_snapshot->names.find_or_create_string_id("next frame");
-    _record_gc_just_edge("internal", from_node, to_node_idx, name_idx);
+    _record_gc_just_edge("internal", from_node_idx, to_node_idx, name_idx);
 }
 
 void _gc_heap_snapshot_record_array_edge(jl_value_t *from, jl_value_t *to, size_t index) JL_NOTSAFEPOINT
@@ -405,13 +477,10 @@ void _gc_heap_snapshot_record_module_to_binding(jl_module_t *module, jl_binding_
     auto ty_idx = ty ? record_node_to_gc_snapshot(ty) : 0;
     auto globalref_idx = record_node_to_gc_snapshot((jl_value_t*)globalref);
 
-    auto &from_node = g_snapshot->nodes[from_node_idx];
-    auto &to_node = g_snapshot->nodes[to_node_idx];
-
-    _record_gc_just_edge("property", from_node, to_node_idx, g_snapshot->names.find_or_create_string_id("<native>"));
-    if (value_idx)     _record_gc_just_edge("internal", to_node, value_idx, g_snapshot->names.find_or_create_string_id("value"));
-    if (ty_idx)        _record_gc_just_edge("internal", to_node, ty_idx, g_snapshot->names.find_or_create_string_id("ty"));
-    if (globalref_idx) _record_gc_just_edge("internal", to_node, globalref_idx, g_snapshot->names.find_or_create_string_id("globalref"));
+    _record_gc_just_edge("property", from_node_idx, to_node_idx, g_snapshot->names.find_or_create_string_id("<native>"));
+    if (value_idx)     _record_gc_just_edge("internal", to_node_idx, value_idx, g_snapshot->names.find_or_create_string_id("value"));
+    if (ty_idx)        _record_gc_just_edge("internal", to_node_idx, ty_idx, g_snapshot->names.find_or_create_string_id("ty"));
+    if (globalref_idx) _record_gc_just_edge("internal", to_node_idx, globalref_idx, g_snapshot->names.find_or_create_string_id("globalref"));
 }
 
 void _gc_heap_snapshot_record_internal_array_edge(jl_value_t *from, jl_value_t *to) JL_NOTSAFEPOINT
@@ -442,9 +511,8 @@ void _gc_heap_snapshot_record_hidden_edge(jl_value_t *from, void* to, size_t byt
         break;
     }
     auto to_node_idx = record_pointer_to_gc_snapshot(to, bytes, alloc_kind);
-    auto &from_node = g_snapshot->nodes[from_node_idx];
 
-    _record_gc_just_edge("hidden", from_node, to_node_idx, name_or_idx);
+    _record_gc_just_edge("hidden", from_node_idx, to_node_idx, name_or_idx);
 }
 
 static inline void _record_gc_edge(const char *edge_type, jl_value_t *a,
@@ -453,22 +521,128 @@ static inline void _record_gc_edge(const char *edge_type, jl_value_t *a,
     auto from_node_idx = record_node_to_gc_snapshot(a);
     auto to_node_idx = record_node_to_gc_snapshot(b);
 
-    auto &from_node = g_snapshot->nodes[from_node_idx];
-
-    _record_gc_just_edge(edge_type, from_node, to_node_idx, name_or_idx);
+    _record_gc_just_edge(edge_type, from_node_idx, to_node_idx, name_or_idx);
 }
 
-void _record_gc_just_edge(const char *edge_type, Node &from_node, size_t to_idx, size_t name_or_idx) JL_NOTSAFEPOINT
+void _record_gc_just_edge(const char *edge_type, size_t from_idx, size_t to_idx, size_t name_or_idx) JL_NOTSAFEPOINT
 {
-    from_node.edges.push_back(Edge{
-        g_snapshot->edge_types.find_or_create_string_id(edge_type),
-        name_or_idx, // edge label
-        to_idx // to
-    });
+    SerializedEdge rec{
+        from_idx,
+        Edge{
+            g_snapshot->edge_types.find_or_create_string_id(edge_type),
+            name_or_idx, // edge label
+            to_idx // to
+        }
+    };
+    ios_write(&g_snapshot->edges_file, (char*)&rec, sizeof(rec));
 
+    g_snapshot->nodes[from_idx].edge_count += 1;
     g_snapshot->num_edges += 1;
 }
 
+static void print_one_edge(ios_t *stream, const Edge &edge, bool *first_edge)
+{
+    if (*first_edge)
+        *first_edge = false;
+    else
+        ios_printf(stream, ",");
+    ios_printf(stream, "%zu,%zu,%zu\n",
+                        edge.type,
+                        edge.name_or_index,
+                        edge.to_node * k_node_number_of_fields);
+}
+
+// max number of spilled edges sorted in memory at once (32 MB of records)
+static const size_t edge_chunk_size = (size_t)1 << 20;
+
+// Emit the spilled edges in `edges` (all with from-node in [from_begin,
+// from_end)) grouped by from-node, which is the order the snapshot format
+// requires. Small enough batches are sorted in memory; larger ones are
+// partitioned into scratch files on from-node boundaries and recursed into,
+// so memory use stays bounded by `edge_chunk_size` regardless of how many
+// edges the snapshot has. A range of a single node needs neither: the order
+// of edges within one node does not matter, so it is streamed straight
+// through.
+static void serialize_edges_range(ios_t *stream, HeapSnapshot &snapshot, ios_t *edges,
+                                  size_t nedges, size_t from_begin, size_t from_end,
+                                  bool *first_edge)
+{
+    if (nedges == 0)
+        return;
+    ios_seek(edges, 0);
+    SerializedEdge rec;
+    if (from_end - from_begin <= 1) {
+        while (ios_read(edges, (char*)&rec, sizeof(rec)) == sizeof(rec))
+            print_one_edge(stream, rec.edge, first_edge);
+        return;
+    }
+    if (nedges <= edge_chunk_size) {
+        vector<SerializedEdge> buf;
+        buf.reserve(nedges);
+        while (ios_read(edges, (char*)&rec, sizeof(rec)) == sizeof(rec))
+            buf.push_back(rec);
+        std::sort(buf.begin(), buf.end(),
+                  [](const SerializedEdge &a, const SerializedEdge &b) {
+                      return a.from_node < b.from_node;
+                  });
+        for (const auto &e : buf)
+            print_one_edge(stream, e.edge, first_edge);
+        return;
+    }
+    // partition on from-node boundaries into sub-ranges of roughly equal
+    // edge counts
+    const int nparts = 16;
+    size_t part_begin[nparts + 1];
+    size_t target = (nedges + nparts - 1) / nparts;
+    int np = 0;
+    size_t acc = 0;
+    part_begin[0] = from_begin;
+    for (size_t i = from_begin; i < from_end; i++) {
+        size_t c = snapshot.nodes[i].edge_count;
+        if (np < nparts - 1 && acc > 0 && acc + c > target) {
+            part_begin[++np] = i;
+            acc = 0;
+        }
+        acc += c;
+    }
+    np++;
+    part_begin[np] = from_end;
+    if (np == 1) {
+        // one node owns nearly all of the edges; isolate it so the
+        // recursion makes progress
+        size_t heaviest = from_begin;
+        for (size_t i = from_begin + 1; i < from_end; i++) {
+            if (snapshot.nodes[i].edge_count > snapshot.nodes[heaviest].edge_count)
+                heaviest = i;
+        }
+        np = 0;
+        if (heaviest > from_begin)
+            part_begin[++np] = heaviest;
+        part_begin[++np] = heaviest + 1;
+        if (heaviest + 1 == from_end)
+            np--;
+        part_begin[np + 1] = from_end;
+        np++;
+    }
+    vector<ios_t> part_file(np);
+    vector<vector<char>> part_path(np, vector<char>(JL_PATH_MAX));
+    vector<size_t> part_edges(np, 0);
+    for (int p = 0; p < np; p++)
+        open_snapshot_tmpfile(&part_file[p], part_path[p].data());
+    while (ios_read(edges, (char*)&rec, sizeof(rec)) == sizeof(rec)) {
+        int p = np - 1;
+        while (rec.from_node < part_begin[p])
+            p--;
+        ios_write(&part_file[p], (char*)&rec, sizeof(rec));
+        part_edges[p]++;
+    }
+    for (int p = 0; p < np; p++) {
+        serialize_edges_range(stream, snapshot, &part_file[p], part_edges[p],
+                              part_begin[p], part_begin[p + 1], first_edge);
+        close_snapshot_tmpfile(&part_file[p], part_path[p].data());
+    }
+}
+
 void serialize_heap_snapshot(ios_t *stream, HeapSnapshot &snapshot, char all_one)
 {
     // mimicking https://github.com/nodejs/node/blob/5fd7a72e1c4fbaf37d3723c4c81dce35c149dc84/deps/v8/src/profiler/heap-snapshot-generator.cc#L2567-L2567
@@ -504,7 +678,7 @@ void serialize_heap_snapshot(ios_t *stream, HeapSnapshot &snapshot, char all_one
                             from_node.name,
                             from_node.id,
                             all_one ? (size_t)1 : from_node.self_size,
-                            from_node.edges.size(),
+                            from_node.edge_count,
                             from_node.trace_node_id,
                             from_node.detachedness);
     }
@@ -512,20 +686,8 @@ void serialize_heap_snapshot(ios_t *stream, HeapSnapshot &snapshot, char all_one
 
     ios_printf(stream, "\"edges\":[");
     bool first_edge = true;
-    for (const auto &from_node : snapshot.nodes) {
-        for (const auto &edge : from_node.edges) {
-            if (first_edge) {
-                first_edge = false;
-            }
-            else {
-                ios_printf(stream, ",");
-            }
-            ios_printf(stream, "%zu,%zu,%zu\n",
-                                edge.type,
-                                edge.name_or_index,
-                                edge.to_node * k_node_number_of_fields);
-        }
-    }
+    serialize_edges_range(stream, snapshot, &snapshot.edges_file, snapshot.num_edges,
+                          0, snapshot.nodes.size(), &first_edge);
     ios_printf(stream, "],\n"); // end "edges"
 
     ios_printf(stream, "\"strings\":");
@@ -31,6 +31,7 @@ void _gc_heap_snapshot_record_hidden_edge(jl_value_t *from, void* to, size_t byt
 
 
 extern int gc_heap_snapshot_enabled;
+extern int gc_heap_snapshot_incremental;
 extern int prev_sweep_full;
 
 int gc_slot_to_fieldidx(void *_obj, void *slot, jl_datatype_t *vt) JL_NOTSAFEPOINT;
@@ -38,58 +39,58 @@ int gc_slot_to_arrayidx(void *_obj, void *begin) JL_NOTSAFEPOINT;
 
 static inline void gc_heap_snapshot_record_frame_to_object_edge(void *from, jl_value_t *to) JL_NOTSAFEPOINT
 {
-    if (__unlikely(gc_heap_snapshot_enabled && prev_sweep_full)) {
+    if (__unlikely(gc_heap_snapshot_enabled && (prev_sweep_full || gc_heap_snapshot_incremental))) {
         _gc_heap_snapshot_record_frame_to_object_edge(from, to);
     }
 }
 static inline void gc_heap_snapshot_record_task_to_frame_edge(jl_task_t *from, void *to) JL_NOTSAFEPOINT
 {
-    if (__unlikely(gc_heap_snapshot_enabled && prev_sweep_full)) {
+    if (__unlikely(gc_heap_snapshot_enabled && (prev_sweep_full || gc_heap_snapshot_incremental))) {
         _gc_heap_snapshot_record_task_to_frame_edge(from, to);
     }
 }
 static inline void gc_heap_snapshot_record_frame_to_frame_edge(jl_gcframe_t *from, jl_gcframe_t *to) JL_NOTSAFEPOINT
 {
-    if (__unlikely(gc_heap_snapshot_enabled && prev_sweep_full)) {
+    if (__unlikely(gc_heap_snapshot_enabled && (prev_sweep_full || gc_heap_snapshot_incremental))) {
         _gc_heap_snapshot_record_frame_to_frame_edge(from, to);
     }
 }
 static inline void gc_heap_snapshot_record_root(jl_value_t *root, char *name) JL_NOTSAFEPOINT
 {
-    if (__unlikely(gc_heap_snapshot_enabled && prev_sweep_full)) {
+    if (__unlikely(gc_heap_snapshot_enabled && (prev_sweep_full || gc_heap_snapshot_incremental))) {
         _gc_heap_snapshot_record_root(root, name);
     }
 }
 static inline void gc_heap_snapshot_record_array_edge(jl_value_t *from, jl_value_t **to) JL_NOTSAFEPOINT
 {
-    if (__unlikely(gc_heap_snapshot_enabled && prev_sweep_full)) {
+    if (__unlikely(gc_heap_snapshot_enabled && (prev_sweep_full || gc_heap_snapshot_incremental))) {
         _gc_heap_snapshot_record_array_edge(from, *to, gc_slot_to_arrayidx(from, to));
     }
 }
 static inline void gc_heap_snapshot_record_object_edge(jl_value_t *from, jl_value_t **to) JL_NOTSAFEPOINT
 {
-    if (__unlikely(gc_heap_snapshot_enabled && prev_sweep_full)) {
+    if (__unlikely(gc_heap_snapshot_enabled && (prev_sweep_full || gc_heap_snapshot_incremental))) {
         _gc_heap_snapshot_record_object_edge(from, *to, to);
     }
 }
 
 static inline void gc_heap_snapshot_record_module_to_binding(jl_module_t* module, jl_binding_t* binding) JL_NOTSAFEPOINT
 {
-    if (__unlikely(gc_heap_snapshot_enabled && prev_sweep_full)) {
+    if (__unlikely(gc_heap_snapshot_enabled && (prev_sweep_full || gc_heap_snapshot_incremental))) {
         _gc_heap_snapshot_record_module_to_binding(module, binding);
     }
 }
 
 static inline void gc_heap_snapshot_record_internal_array_edge(jl_value_t *from, jl_value_t *to) JL_NOTSAFEPOINT
 {
-    if (__unlikely(gc_heap_snapshot_enabled && prev_sweep_full)) {
+    if (__unlikely(gc_heap_snapshot_enabled && (prev_sweep_full || gc_heap_snapshot_incremental))) {
         _gc_heap_snapshot_record_internal_array_edge(from, to);
     }
 }
 
 static inline void gc_heap_snapshot_record_hidden_edge(jl_value_t *from, void* to, size_t bytes, uint16_t alloc_type) JL_NOTSAFEPOINT
 {
-    if (__unlikely(gc_heap_snapshot_enabled && prev_sweep_full)) {
+    if (__unlikely(gc_heap_snapshot_enabled && (prev_sweep_full || gc_heap_snapshot_incremental))) {
         _gc_heap_snapshot_record_hidden_edge(from, to, bytes, alloc_type);
     }
 }
@@ -98,6 +99,7 @@ static inline void gc_heap_snapshot_record_hidden_edge(jl_value_t *from, void* t
 // Functions to call from Julia to take heap snapshot
 // ---------------------------------------------------------------------
 JL_DLLEXPORT void jl_gc_take_heap_snapshot(ios_t *stream, char all_one);
+JL_DLLEXPORT void jl_gc_take_incremental_heap_snapshot(ios_t *stream, char all_one);
 
 
 #ifdef __cplusplus
@@ -21,16 +21,38 @@ extern "C" {
 static int block_pg_cnt = DEFAULT_BLOCK_PG_ALLOC;
 static size_t current_pg_count = 0;
 
+// Chunks (of decommit granularity) released by the sweep wait here and are
+// returned to the OS after the pause by jl_gc_flush_page_returns, instead of
+// paying one syscall per page inside it. Guarded by gc_perm_lock.
+static arraylist_t gc_decommit_queue;
+
 void jl_gc_init_page(void)
 {
     if (GC_PAGE_SZ * block_pg_cnt < jl_page_size)
         block_pg_cnt = jl_page_size / GC_PAGE_SZ; // exact division
+    arraylist_new(&gc_decommit_queue, 0);
 }
 
 #ifndef MAP_NORESERVE // not defined in POSIX, FreeBSD, etc.
 #define MAP_NORESERVE (0)
 #endif
 
+#if defined(_OS_LINUX_) && defined(MADV_HUGEPAGE)
+// opt-in transparent hugepage backing for pool blocks; this reduces dTLB
+// pressure in pointer-chasing workloads, at the cost of coarser-grained
+// decommit (khugepaged will re-collapse ranges that jl_gc_free_page has
+// punched holes into, keeping the freed memory resident)
+static int gc_hugepages_enabled(void) JL_NOTSAFEPOINT
+{
+    static int enabled = -1;
+    if (enabled == -1) {
+        char *env = getenv("JULIA_GC_HUGEPAGES");
+        enabled = env ? atoi(env) : 0;
+    }
+    return enabled;
+}
+#endif
+
 // Try to allocate a memory block for multiple pages
 // Return `NULL` if allocation failed. Result is aligned to `GC_PAGE_SZ`.
 static char *jl_gc_try_alloc_pages(int pg_cnt) JL_NOTSAFEPOINT
@@ -48,6 +70,13 @@ static char *jl_gc_try_alloc_pages(int pg_cnt) JL_NOTSAFEPOINT
                             MAP_NORESERVE | MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
     if (mem == MAP_FAILED)
         return NULL;
+#if defined(_OS_LINUX_) && defined(MADV_HUGEPAGE)
+    // ask for transparent promotion to hugepages; the kernel promotes the
+    // 2 MB-aligned subranges, and page metadata lookup is unaffected since
+    // it is keyed purely by virtual address
+    if (pages_sz >= 2 * 1024 * 1024 && gc_hugepages_enabled())
+        madvise(mem, pages_sz, MADV_HUGEPAGE);
+#endif
 #endif
     if (GC_PAGE_SZ > jl_page_size)
         // round data pointer up to the nearest gc_page_data-aligned
@@ -133,6 +162,8 @@ static jl_gc_pagemeta_t *jl_gc_alloc_new_page(void) JL_NOTSAFEPOINT
             if (!info.pagetable0) {
                 info.pagetable0 = (pagetable0_t*)jl_gc_perm_alloc_nolock(sizeof(pagetable0_t), 1,
                                                                          sizeof(void*), 0);
+                if (info.pagetable0)
+                    info.pagetable0->prefix = REGION0_PREFIX(ptr);
                 *ppagetable0 = info.pagetable0;
                 if (!info.pagetable0)
                     break;
@@ -177,6 +208,28 @@ NOINLINE jl_gc_pagemeta_t *jl_gc_alloc_page(void) JL_NOTSAFEPOINT
 #ifdef _OS_WINDOWS_
     DWORD last_error = GetLastError();
 #endif
+    // Prefer a page this thread freed earlier: under first-touch placement
+    // its backing memory is on this thread's NUMA node, whereas the global
+    // scan below hands out the first free page anywhere in the address
+    // space. The hints are not authoritative -- another thread may have
+    // claimed the page through the global scan -- so revalidate against the
+    // free map before using one.
+    jl_task_t *ct = jl_current_task;
+    jl_ptls_t ptls = ct == NULL ? NULL : ct->ptls;
+    if (ptls != NULL) {
+        for (int i = 0; i < JL_GC_N_PAGE_HINT; i++) {
+            jl_gc_pagemeta_t *hint = ptls->heap.page_hint[i];
+            if (hint == NULL)
+                continue;
+            ptls->heap.page_hint[i] = NULL;
+            struct jl_gc_metadata_ext hinfo = page_metadata_ext(hint->data);
+            uint32_t hmsk = (uint32_t)(1u << hinfo.pagetable0_i);
+            if (hinfo.pagetable0->freemap[hinfo.pagetable0_i32] & hmsk) {
+                info = hinfo;
+                goto have_free_page;
+            }
+        }
+    }
     // scan over memory_map page-table for existing allocated but unused pages
     for (info.pagetable_i32 = memory_map.lb; info.pagetable_i32 < (REGION2_PG_COUNT + 31) / 32; info.pagetable_i32++) {
         uint32_t freemap1 = memory_map.freemap1[info.pagetable_i32];
@@ -262,6 +315,9 @@ have_free_page:
 // return a page to the freemap allocator
 void jl_gc_free_page(void *p) JL_NOTSAFEPOINT
 {
+    // take the lock so that parallel sweep workers can return pages
+    // concurrently; uncontended in a single-threaded sweep
+    uv_mutex_lock(&gc_perm_lock);
     // update the allocmap and freemap to indicate this contains a free entry
     struct jl_gc_metadata_ext info = page_metadata_ext(p);
     uint32_t msk;
@@ -284,12 +340,18 @@ void jl_gc_free_page(void *p) JL_NOTSAFEPOINT
     free(info.meta->ages);
     info.meta->ages = NULL;
 
+    // remember the page for the thread that owns it, so its next refill can
+    // take back memory it first touched instead of a page from another node
+    int t_n = info.meta->thread_n;
+    if (t_n < gc_n_threads && gc_all_tls_states != NULL && gc_all_tls_states[t_n] != NULL) {
+        jl_thread_heap_t *heap = &gc_all_tls_states[t_n]->heap;
+        heap->page_hint[heap->page_hint_top++ % JL_GC_N_PAGE_HINT] = info.meta;
+    }
+
     // tell the OS we don't need these pages right now
-    size_t decommit_size = GC_PAGE_SZ;
     if (GC_PAGE_SZ < jl_page_size) {
         // ensure so we don't release more memory than intended
         size_t n_pages = jl_page_size / GC_PAGE_SZ; // exact division
-        decommit_size = jl_page_size;
         void *otherp = (void*)((uintptr_t)p & ~(jl_page_size - 1)); // round down to the nearest physical page
         p = otherp;
         while (n_pages--) {
@@ -300,36 +362,134 @@ void jl_gc_free_page(void *p) JL_NOTSAFEPOINT
             otherp = (void*)((char*)otherp + GC_PAGE_SZ);
         }
     }
+#if defined(_OS_LINUX_) && defined(MADV_HUGEPAGE)
+    // releasing 16 KB holes would split the hugepages requested at block
+    // allocation; keep the memory resident so promoted ranges stay intact
+    if (gc_hugepages_enabled())
+        goto no_decommit;
+#endif
+    // defer the syscall to jl_gc_flush_page_returns, which runs off the
+    // pause; the entry is revalidated against the allocmap there, so a page
+    // that gets reused before the flush never pays for the decommit
+    arraylist_push(&gc_decommit_queue, p);
+
+no_decommit:
+    // new pages are now available starting at max of lb and pagetable_i32
+    if (memory_map.lb > info.pagetable_i32)
+        memory_map.lb = info.pagetable_i32;
+    if (info.pagetable1->lb > info.pagetable1_i32)
+        info.pagetable1->lb = info.pagetable1_i32;
+    if (info.pagetable0->lb > info.pagetable0_i32)
+        info.pagetable0->lb = info.pagetable0_i32;
+    current_pg_count--;
+    uv_mutex_unlock(&gc_perm_lock);
+}
+
+// decommit granularity: whole GC pages, or whole OS pages if those are larger
+STATIC_INLINE size_t gc_decommit_chunk_size(void) JL_NOTSAFEPOINT
+{
+    return GC_PAGE_SZ < jl_page_size ? jl_page_size : GC_PAGE_SZ;
+}
+
+// must hold gc_perm_lock: whether every GC page in the chunk is still
+// unallocated, i.e. nothing took it back since it was queued
+static int gc_decommit_chunk_is_free(char *p, size_t sz) JL_NOTSAFEPOINT
+{
+    for (size_t off = 0; off < sz; off += GC_PAGE_SZ) {
+        struct jl_gc_metadata_ext info = page_metadata_ext(p + off);
+        if (info.pagetable0->allocmap[info.pagetable0_i32] & (uint32_t)(1u << info.pagetable0_i))
+            return 0;
+    }
+    return 1;
+}
+
+static int gc_decommit_addr_cmp(const void *a, const void *b) JL_NOTSAFEPOINT
+{
+    char *pa = *(char *const *)a;
+    char *pb = *(char *const *)b;
+    return pa < pb ? -1 : (pa > pb ? 1 : 0);
+}
+
+static void gc_decommit_range(char *p, size_t sz) JL_NOTSAFEPOINT
+{
 #ifdef _OS_WINDOWS_
-    VirtualFree(p, decommit_size, MEM_DECOMMIT);
+    // neighboring chunks can belong to different reservations, and
+    // MEM_DECOMMIT must not cross them
+    size_t chunk = gc_decommit_chunk_size();
+    for (size_t off = 0; off < sz; off += chunk)
+        VirtualFree(p + off, chunk, MEM_DECOMMIT);
 #elif defined(MADV_FREE)
     static int supports_madv_free = 1;
     if (supports_madv_free) {
-        if (madvise(p, decommit_size, MADV_FREE) == -1) {
+        if (madvise(p, sz, MADV_FREE) == -1) {
             assert(errno == EINVAL);
             supports_madv_free = 0;
         }
     }
     if (!supports_madv_free) {
-        madvise(p, decommit_size, MADV_DONTNEED);
+        madvise(p, sz, MADV_DONTNEED);
     }
 #else
-    madvise(p, decommit_size, MADV_DONTNEED);
+    madvise(p, sz, MADV_DONTNEED);
 #endif
     /* TODO: Should we leave this poisoned and rather allow the GC to read poisoned pointers from
      *       the page when it sweeps pools?
      */
-    msan_unpoison(p, decommit_size);
+    msan_unpoison(p, sz);
+}
 
-no_decommit:
-    // new pages are now available starting at max of lb and pagetable_i32
-    if (memory_map.lb > info.pagetable_i32)
-        memory_map.lb = info.pagetable_i32;
-    if (info.pagetable1->lb > info.pagetable1_i32)
-        info.pagetable1->lb = info.pagetable1_i32;
-    if (info.pagetable0->lb > info.pagetable0_i32)
-        info.pagetable0->lb = info.pagetable0_i32;
-    current_pg_count--;
+size_t jl_gc_pending_page_returns(void) JL_NOTSAFEPOINT
+{
+    return gc_decommit_queue.len;
+}
+
+// Return the pages queued by jl_gc_free_page to the OS, one syscall per
+// contiguous run instead of one per page. Runs after the pause (usually on a
+// background thread), so it only holds gc_perm_lock in bounded batches to
+// keep page allocation responsive, and rechecks the allocmap under the lock
+// so that chunks reused since the sweep skip the syscall entirely.
+void jl_gc_flush_page_returns(void) JL_NOTSAFEPOINT
+{
+    size_t chunk = gc_decommit_chunk_size();
+    // steal the queued addresses so the lock isn't held while sorting
+    uv_mutex_lock(&gc_perm_lock);
+    size_t n = gc_decommit_queue.len;
+    if (n == 0) {
+        uv_mutex_unlock(&gc_perm_lock);
+        return;
+    }
+    void **addrs = (void**)malloc_s(n * sizeof(void*));
+    memcpy(addrs, gc_decommit_queue.items, n * sizeof(void*));
+    gc_decommit_queue.len = 0;
+    uv_mutex_unlock(&gc_perm_lock);
+    qsort(addrs, n, sizeof(void*), gc_decommit_addr_cmp);
+    size_t i = 0;
+    while (i < n) {
+        if (i > 0 && addrs[i] == addrs[i - 1]) {
+            // the same chunk can be queued once per GC page it covers when
+            // OS pages are larger than GC pages
+            i++;
+            continue;
+        }
+        // gather a contiguous run, bounded so the lock hold stays short
+        size_t j = i + 1;
+        while (j < n && j - i < 64 &&
+               (char*)addrs[j] == (char*)addrs[i] + (j - i) * chunk)
+            j++;
+        uv_mutex_lock(&gc_perm_lock);
+        size_t k = i;
+        while (k < j) {
+            size_t m = k;
+            while (m < j && gc_decommit_chunk_is_free((char*)addrs[m], chunk))
+                m++;
+            if (m > k)
+                gc_decommit_range((char*)addrs[k], (m - k) * chunk);
+            k = (m == k) ? k + 1 : m;
+        }
+        uv_mutex_unlock(&gc_perm_lock);
+        i = j;
+    }
+    free(addrs);
 }
 
 #ifdef __cplusplus
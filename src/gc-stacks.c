@@ -71,8 +71,32 @@ static void free_stack(void *stkbuf, size_t bufsz)
     munmap(stkbuf, bufsz);
     jl_atomic_fetch_add(&num_stack_mappings, -1);
 }
+
+// Hand the pages of a pooled stack back to the OS while keeping the mapping
+// (and its guard page) in place, so that reusing the stack is a soft fault
+// instead of a fresh mmap/mprotect pair.
+static void decommit_stack(void *stkbuf, size_t bufsz) JL_NOTSAFEPOINT
+{
+#if defined(MADV_FREE)
+    static int supports_madv_free = 1;
+    if (supports_madv_free) {
+        if (madvise(stkbuf, bufsz, MADV_FREE) == -1) {
+            assert(errno == EINVAL);
+            supports_madv_free = 0;
+        }
+    }
+    if (!supports_madv_free)
+        madvise(stkbuf, bufsz, MADV_DONTNEED);
+#else
+    madvise(stkbuf, bufsz, MADV_DONTNEED);
+#endif
+}
 #endif
 
+// stack allocations per pool since the last sweep, used to size the
+// retained pools to the observed task spawn rate
+static _Atomic(uint32_t) stack_demand[JL_N_STACK_POOLS];
+
 
 const unsigned pool_sizes[] = {
     128 * 1024,
@@ -156,6 +180,7 @@ JL_DLLEXPORT void *jl_malloc_stack(size_t *bufsz, jl_task_t *owner) JL_NOTSAFEPO
     if (ssize <= pool_sizes[JL_N_STACK_POOLS - 1]) {
         unsigned pool_id = select_pool(ssize);
         ssize = pool_sizes[pool_id];
+        jl_atomic_fetch_add_relaxed(&stack_demand[pool_id], 1);
         arraylist_t *pool = &ptls->heap.free_stacks[pool_id];
         if (pool->len > 0) {
             stk = arraylist_pop(pool);
@@ -210,10 +235,29 @@ void sweep_stack_pools(void)
             else {
                 n_to_free = 0;
             }
+#ifndef _OS_WINDOWS_
+            // under heavy task churn, keep enough stacks to cover the demand
+            // seen since the last sweep (split evenly across threads) instead
+            // of halving; the surplus is decommitted below, so retaining a
+            // mapping costs address space but no memory
+            size_t watermark = jl_atomic_load_relaxed(&stack_demand[p]) / gc_n_threads +
+                               MIN_STACK_MAPPINGS_PER_POOL;
+            if (al->len - n_to_free < watermark)
+                n_to_free = al->len > watermark ? al->len - watermark : 0;
+#endif
             for (int n = 0; n < n_to_free; n++) {
                 void *stk = arraylist_pop(al);
                 free_stack(stk, pool_sizes[p]);
             }
+#ifndef _OS_WINDOWS_
+            // return the pages of every retained stack except the few that
+            // will be reused first (pops take from the end of the list)
+            if (al->len > MIN_STACK_MAPPINGS_PER_POOL) {
+                size_t keep = al->len - MIN_STACK_MAPPINGS_PER_POOL;
+                for (size_t n = 0; n < keep; n++)
+                    decommit_stack(al->items[n], pool_sizes[p]);
+            }
+#endif
         }
 
         arraylist_t *live_tasks = &ptls2->heap.live_tasks;
@@ -255,6 +299,9 @@ void sweep_stack_pools(void)
         }
         live_tasks->len -= ndel;
     }
+    // start a fresh demand measurement for the next sweep interval
+    for (int p = 0; p < JL_N_STACK_POOLS; p++)
+        jl_atomic_store_relaxed(&stack_demand[p], 0);
 }
 
 JL_DLLEXPORT jl_array_t *jl_live_tasks(void)
@@ -112,6 +112,69 @@ JL_DLLEXPORT void jl_gc_set_cb_notify_external_free(jl_gc_cb_notify_external_fre
         jl_gc_deregister_callback(&gc_cblist_notify_external_free, (jl_gc_cb_func_t)cb);
 }
 
+// Large-allocation tracking. With JULIA_GC_ALLOC_TRACK=<bytes> set, every
+// big-object or managed-malloc allocation of at least that many bytes
+// records (size, thread, depth-limited fast backtrace) into a fixed ring,
+// printable with jl_gc_print_large_allocs(). An optional policy callback
+// can additionally veto such an allocation (e.g. to enforce a per-task
+// budget, via jl_current_task); a veto raises OutOfMemoryError at the
+// allocation point, exactly like a failed malloc. Slot writes are not
+// synchronized against concurrent writers or the printer: a torn event in
+// a diagnostic ring is acceptable, stalling the allocation path is not.
+#define GC_ALLOC_TRACK_EVENTS 256 // ring capacity (power of two)
+#define GC_ALLOC_TRACK_FRAMES 16  // backtrace elements kept per event
+typedef struct {
+    size_t sz;
+    int16_t tid;
+    int16_t bt_size;
+    jl_bt_element_t bt_data[GC_ALLOC_TRACK_FRAMES];
+} gc_alloc_track_event_t;
+static size_t gc_alloc_track_min = 0; // 0: disabled
+static gc_alloc_track_event_t gc_alloc_track_ring[GC_ALLOC_TRACK_EVENTS];
+static _Atomic(uint64_t) gc_alloc_track_head;
+static _Atomic(jl_gc_cb_large_alloc_policy_t) gc_large_alloc_policy;
+
+JL_DLLEXPORT void jl_gc_set_cb_large_alloc_policy(jl_gc_cb_large_alloc_policy_t cb, int enable)
+{
+    jl_atomic_store_relaxed(&gc_large_alloc_policy, enable ? cb : NULL);
+}
+
+static void gc_track_large_alloc(size_t sz)
+{
+    jl_gc_cb_large_alloc_policy_t policy = jl_atomic_load_relaxed(&gc_large_alloc_policy);
+    if (policy && !policy(sz))
+        jl_throw(jl_memory_exception);
+    uint64_t n = jl_atomic_fetch_add_relaxed(&gc_alloc_track_head, 1);
+    gc_alloc_track_event_t *ev = &gc_alloc_track_ring[n % GC_ALLOC_TRACK_EVENTS];
+    ev->sz = sz;
+    ev->tid = (int16_t)jl_atomic_load_relaxed(&jl_current_task->tid);
+    ev->bt_size = (int16_t)rec_backtrace_fp(ev->bt_data, GC_ALLOC_TRACK_FRAMES, 1);
+}
+
+STATIC_INLINE void gc_maybe_track_large_alloc(size_t sz)
+{
+    if (__unlikely(gc_alloc_track_min != 0 && sz >= gc_alloc_track_min))
+        gc_track_large_alloc(sz);
+}
+
+// Print the recorded ring, newest first.
+JL_DLLEXPORT void jl_gc_print_large_allocs(void) JL_NOTSAFEPOINT
+{
+    uint64_t head = jl_atomic_load_relaxed(&gc_alloc_track_head);
+    uint64_t n = head < GC_ALLOC_TRACK_EVENTS ? head : GC_ALLOC_TRACK_EVENTS;
+    jl_safe_printf("large allocations (>= %zu bytes): %llu recorded, newest first:\n",
+                   gc_alloc_track_min, (unsigned long long)head);
+    for (uint64_t k = 0; k < n; k++) {
+        gc_alloc_track_event_t *ev = &gc_alloc_track_ring[(head - 1 - k) % GC_ALLOC_TRACK_EVENTS];
+        jl_safe_printf("%zu bytes on thread %d:\n", ev->sz, (int)ev->tid);
+        size_t i = 0;
+        while (i < (size_t)ev->bt_size) {
+            jl_print_bt_entry_codeloc(ev->bt_data + i);
+            i += jl_bt_entry_size(ev->bt_data + i);
+        }
+    }
+}
+
 // Save/restore local mark stack to/from thread-local storage.
 
 STATIC_INLINE void export_gc_state(jl_ptls_t ptls, jl_gc_mark_sp_t *sp) {
@@ -180,6 +243,7 @@ JL_DLLEXPORT uintptr_t jl_get_buff_tag(void)
 }
 
 pagetable_t memory_map;
+_Atomic(pagetable0_t *) page_tlb[PAGE_TLB_COUNT];
 
 // List of marked big objects.  Not per-thread.  Accessed only by master thread.
 bigval_t *big_objects_marked = NULL;
@@ -206,6 +270,22 @@ void jl_gc_wait_for_the_world(jl_ptls_t* gc_all_tls_states, int gc_n_threads)
     assert(gc_n_threads);
     if (gc_n_threads > 1)
         jl_wake_libuv();
+    // Sweep over all the threads instead of spinning on each one in turn:
+    // most of them have already reached a safepoint (or are running unmanaged
+    // code with `gc_state` set, which needs no signaling at all), and the
+    // cheap relaxed check skips those without serializing the rendezvous
+    // behind whichever slow thread we happened to look at first.
+    int done = 0;
+    while (!done) {
+        done = 1;
+        for (int i = 0; i < gc_n_threads; i++) {
+            jl_ptls_t ptls2 = gc_all_tls_states[i];
+            if (ptls2 != NULL && !jl_atomic_load_relaxed(&ptls2->gc_state))
+                done = 0;
+        }
+        if (!done)
+            jl_cpu_pause(); // yield?
+    }
     for (int i = 0; i < gc_n_threads; i++) {
         jl_ptls_t ptls2 = gc_all_tls_states[i];
         if (ptls2 == NULL)
@@ -216,8 +296,8 @@ void jl_gc_wait_for_the_world(jl_ptls_t* gc_all_tls_states, int gc_n_threads)
         // We're currently also using atomic store release in mutator threads
         // (in jl_gc_state_set), but we may want to use signals to flush the
         // memory operations on those threads lazily instead.
-        while (!jl_atomic_load_relaxed(&ptls2->gc_state) || !jl_atomic_load_acquire(&ptls2->gc_state))
-            jl_cpu_pause(); // yield?
+        while (!jl_atomic_load_acquire(&ptls2->gc_state))
+            jl_cpu_pause();
     }
 }
 
@@ -275,6 +355,84 @@ STATIC_INLINE void jl_free_aligned(void *p) JL_NOTSAFEPOINT
 #define malloc_cache_align(sz) jl_malloc_aligned(sz, JL_CACHE_BYTE_ALIGNMENT)
 #define realloc_cache_align(p, sz, oldsz) jl_realloc_aligned(p, sz, oldsz, JL_CACHE_BYTE_ALIGNMENT)
 
+#ifdef _OS_LINUX_
+// Very large array buffers are allocated directly from the virtual memory
+// system so that growing them is a page-table operation (mremap) instead of a
+// copy of every byte appended past `maxsize`. A small registry records the
+// (base, size) pairs of live mappings; allocations this large are rare, so a
+// linear scan under the lock is cheap, and the free path skips the lookup
+// entirely while the registry is empty.
+#define GC_MMAP_ALLOC_THRESHOLD (64 * 1024 * 1024)
+static arraylist_t gc_mmap_allocs; // (base, allocsz) pairs
+static uv_mutex_t gc_mmap_allocs_lock;
+
+static void gc_mmap_alloc_register(void *base, size_t allocsz) JL_NOTSAFEPOINT
+{
+    uv_mutex_lock(&gc_mmap_allocs_lock);
+    arraylist_push(&gc_mmap_allocs, base);
+    arraylist_push(&gc_mmap_allocs, (void*)allocsz);
+    uv_mutex_unlock(&gc_mmap_allocs_lock);
+}
+
+// mapped size of `base`, or 0 if it is not one of our mappings
+static size_t gc_mmap_alloc_lookup(void *base) JL_NOTSAFEPOINT
+{
+    size_t allocsz = 0;
+    uv_mutex_lock(&gc_mmap_allocs_lock);
+    for (size_t i = 0; i < gc_mmap_allocs.len; i += 2) {
+        if (gc_mmap_allocs.items[i] == base) {
+            allocsz = (size_t)gc_mmap_allocs.items[i + 1];
+            break;
+        }
+    }
+    uv_mutex_unlock(&gc_mmap_allocs_lock);
+    return allocsz;
+}
+
+static void gc_mmap_alloc_update(void *base, void *newbase, size_t newsz) JL_NOTSAFEPOINT
+{
+    uv_mutex_lock(&gc_mmap_allocs_lock);
+    for (size_t i = 0; i < gc_mmap_allocs.len; i += 2) {
+        if (gc_mmap_allocs.items[i] == base) {
+            gc_mmap_allocs.items[i] = newbase;
+            gc_mmap_allocs.items[i + 1] = (void*)newsz;
+            break;
+        }
+    }
+    uv_mutex_unlock(&gc_mmap_allocs_lock);
+}
+
+// forgets the entry for `base` and returns its mapped size (0 if absent)
+static size_t gc_mmap_alloc_unregister(void *base) JL_NOTSAFEPOINT
+{
+    size_t allocsz = 0;
+    uv_mutex_lock(&gc_mmap_allocs_lock);
+    for (size_t i = 0; i < gc_mmap_allocs.len; i += 2) {
+        if (gc_mmap_allocs.items[i] == base) {
+            allocsz = (size_t)gc_mmap_allocs.items[i + 1];
+            gc_mmap_allocs.items[i] = gc_mmap_allocs.items[gc_mmap_allocs.len - 2];
+            gc_mmap_allocs.items[i + 1] = gc_mmap_allocs.items[gc_mmap_allocs.len - 1];
+            gc_mmap_allocs.len -= 2;
+            break;
+        }
+    }
+    uv_mutex_unlock(&gc_mmap_allocs_lock);
+    return allocsz;
+}
+
+static void *gc_mmap_alloc(size_t allocsz) JL_NOTSAFEPOINT
+{
+    allocsz = LLT_ALIGN(allocsz, jl_page_size);
+    void *base = mmap(NULL, allocsz, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED)
+        return NULL;
+    gc_mmap_alloc_register(base, allocsz);
+    return base;
+}
+#endif
+
+
 static void schedule_finalization(void *o, void *f) JL_NOTSAFEPOINT
 {
     arraylist_push(&to_finalize, o);
@@ -393,9 +551,49 @@ static void jl_gc_run_finalizers_in_list(jl_task_t *ct, arraylist_t *list) JL_NO
     ct->sticky = sticky;
 }
 
-static uint64_t finalizer_rngState[4];
+// Parallel execution of raw-pointer finalizers. Unlike Julia finalizers,
+// these are plain C callbacks that cannot allocate, throw, or observe task
+// state, so a large batch (typical when many native-resource objects die in
+// one collection) can be spread over helper threads, like the parallel
+// sweep. Opt-in via JULIA_GC_FINALIZER_THREADS since it runs the callbacks
+// off the Julia threads.
+#define GC_FINALIZER_PAR_MIN 512 // pairs per worker before helpers pay off
 
-void jl_rng_split(uint64_t to[4], uint64_t from[4]) JL_NOTSAFEPOINT;
+typedef struct {
+    uv_thread_t tid;
+    void **items;
+    size_t begin;
+    size_t end;
+    size_t step;
+} jl_gc_finalizer_worker_t;
+
+static void gc_run_ptr_finalizers_worker(void *vworker)
+{
+    jl_gc_finalizer_worker_t *worker = (jl_gc_finalizer_worker_t*)vworker;
+    for (size_t i = worker->begin; i < worker->end; i += worker->step) {
+        void *o = gc_ptr_clear_tag(worker->items[i], 3);
+        ((void (*)(void*))worker->items[i + 1])(o);
+    }
+}
+
+static int gc_finalizer_nworkers(size_t npairs) JL_NOTSAFEPOINT
+{
+    static int nworkers = -1;
+    if (nworkers == -1) {
+        char *env = getenv("JULIA_GC_FINALIZER_THREADS");
+        nworkers = env ? atoi(env) : 1;
+        if (nworkers < 1)
+            nworkers = 1;
+    }
+    int max_useful = (int)(npairs / GC_FINALIZER_PAR_MIN);
+    if (max_useful < 1)
+        max_useful = 1;
+    return nworkers < max_useful ? nworkers : max_useful;
+}
+
+static uint64_t finalizer_rngState[JL_RNG_SIZE];
+
+void jl_rng_split(uint64_t to[JL_RNG_SIZE], uint64_t from[JL_RNG_SIZE]) JL_NOTSAFEPOINT;
 
 JL_DLLEXPORT void jl_gc_init_finalizer_rng_state(void)
 {
@@ -424,14 +622,75 @@ static void run_finalizers(jl_task_t *ct)
     jl_atomic_store_relaxed(&jl_gc_have_pending_finalizers, 0);
     arraylist_new(&to_finalize, 0);
 
-    uint64_t save_rngState[4];
+    uint64_t save_rngState[JL_RNG_SIZE];
     memcpy(&save_rngState[0], &ct->rngState[0], sizeof(save_rngState));
     jl_rng_split(ct->rngState, finalizer_rngState);
 
-    // This releases the finalizers lock.
     int8_t was_in_finalizer = ct->ptls->in_finalizer;
     ct->ptls->in_finalizer = 1;
-    jl_gc_run_finalizers_in_list(ct, &copied_list);
+
+    // When enough raw-pointer finalizers are pending, pull them out of the
+    // list for parallel execution. They run after the Julia finalizers so
+    // that the usual ordering (higher-level finalizers before the lower-level
+    // resources they may depend on) is preserved; the extracted batch is
+    // rooted in its own GC frame for the whole Julia phase since another
+    // thread may trigger a collection meanwhile.
+    int nworkers = gc_finalizer_nworkers(copied_list.len / 2);
+    arraylist_t ptr_list;
+    size_t ptr_pairs_end = 0;
+    if (nworkers > 1) {
+        arraylist_new(&ptr_list, 0);
+        size_t len = copied_list.len, j = 0;
+        void **items = copied_list.items;
+        for (size_t i = 0; i < len; i += 2) {
+            if (gc_ptr_tag(items[i], 1)) {
+                arraylist_push(&ptr_list, items[i]);
+                arraylist_push(&ptr_list, items[i + 1]);
+            }
+            else {
+                items[j] = items[i];
+                items[j + 1] = items[i + 1];
+                j += 2;
+            }
+        }
+        copied_list.len = j;
+        if (ptr_list.len > 0) {
+            // same layout trick as jl_gc_run_finalizers_in_list: move the
+            // first pair to the tail to make room for the GC frame header
+            arraylist_push(&ptr_list, ptr_list.items[0]);
+            arraylist_push(&ptr_list, ptr_list.items[1]);
+            ptr_pairs_end = ptr_list.len;
+            jl_gc_push_arraylist(ct, &ptr_list);
+        }
+    }
+
+    // This releases the finalizers lock.
+    if (copied_list.len > 0)
+        jl_gc_run_finalizers_in_list(ct, &copied_list);
+    else
+        JL_UNLOCK_NOGC(&finalizers_lock);
+
+    if (nworkers > 1) {
+        if (ptr_pairs_end > 0) {
+            jl_gc_finalizer_worker_t *workers = (jl_gc_finalizer_worker_t*)malloc_s(nworkers * sizeof(jl_gc_finalizer_worker_t));
+            for (int i = 0; i < nworkers; i++) {
+                workers[i].items = ptr_list.items;
+                workers[i].begin = 2 + 2 * (size_t)i;
+                workers[i].end = ptr_pairs_end;
+                workers[i].step = 2 * (size_t)nworkers;
+            }
+            // this thread acts as worker 0
+            for (int i = 1; i < nworkers; i++)
+                uv_thread_create(&workers[i].tid, gc_run_ptr_finalizers_worker, &workers[i]);
+            gc_run_ptr_finalizers_worker(&workers[0]);
+            for (int i = 1; i < nworkers; i++)
+                uv_thread_join(&workers[i].tid);
+            free(workers);
+            JL_GC_POP(); // matches the jl_gc_push_arraylist over ptr_list
+        }
+        arraylist_free(&ptr_list);
+    }
+
     ct->ptls->in_finalizer = was_in_finalizer;
     arraylist_free(&copied_list);
 
@@ -703,7 +962,7 @@ static int mark_reset_age = 0;
 // A quick sweep is a sweep where `!sweep_full`
 // It means we won't touch GC_OLD_MARKED objects (old gen).
 
-// When a reachable object has survived more than PROMOTE_AGE+1 collections
+// When a reachable object has survived more than `gc_promote_age`+1 collections
 // it is tagged with GC_OLD during sweep and will be promoted on next mark
 // because at that point we can know easily if it references young objects.
 // Marked old objects that reference young ones are kept in the remset.
@@ -713,9 +972,13 @@ static int mark_reset_age = 0;
 
 
 #define PROMOTE_AGE 1
-// this cannot be increased as is without changing :
-// - sweep_page which is specialized for 1bit age
-// - the size of the age storage in jl_gc_pagemeta_t
+// Ages are 2 bit saturating counters, stored in the per-page age table for
+// pool objects (4 objects per byte) and in the header for bigvals, so the
+// promotion threshold cannot exceed 3.
+#define MAX_PROMOTE_AGE 3
+// number of collections an object must survive before it is promoted;
+// set from `--gc-promotion-age` in jl_gc_init
+static int gc_promote_age = PROMOTE_AGE;
 
 
 static int64_t scanned_bytes; // young bytes scanned while marking
@@ -725,6 +988,19 @@ int prev_sweep_full = 1;
 #define inc_sat(v,s) v = (v) >= s ? s : (v)+1
 
 // Full collection heuristics
+// target upper bound for a single stop-the-world pause, in nanoseconds;
+// 0 disables the budget (set from JULIA_GC_PAUSE_TARGET_MS)
+static uint64_t gc_pause_target_ns = 0;
+// adaptive trigger state: end time of the previous collection, OS footprint
+// at that point, and how many consecutive cycles RSS crept up while the live
+// set did not (see the scheduling feedback at the end of _jl_gc_collect)
+static uint64_t last_gc_end_time = 0;
+static size_t last_gc_rss = 0;
+static int rss_creep_cycles = 0;
+static int next_sweep_full = 0;
+// when set (JULIA_GC_RETIRE_SPARSE_PAGES), pages that survive a sweep with
+// only a few live cells are withheld from the allocator; see sweep_page
+static int gc_retire_sparse_pages = 0;
 static int64_t live_bytes = 0;
 static int64_t promoted_bytes = 0;
 static int64_t last_live_bytes = 0; // live_bytes at last collection
@@ -867,8 +1143,8 @@ STATIC_INLINE void gc_setmark_pool_(jl_ptls_t ptls, jl_taggedvalue_t *o,
             page->has_young = 1;
             char *page_begin = gc_page_data(o) + GC_PAGE_OFFSET;
             int obj_id = (((char*)o) - page_begin) / page->osize;
-            uint8_t *ages = page->ages + obj_id / 8;
-            jl_atomic_fetch_and_relaxed((_Atomic(uint8_t)*)ages, ~(1 << (obj_id % 8)));
+            uint8_t *ages = page->ages + obj_id / 4;
+            jl_atomic_fetch_and_relaxed((_Atomic(uint8_t)*)ages, ~(0x3 << (2 * (obj_id % 4))));
         }
     }
     objprofile_count(jl_typeof(jl_valueof(o)),
@@ -975,6 +1251,32 @@ JL_DLLEXPORT jl_weakref_t *jl_gc_new_weakref_th(jl_ptls_t ptls,
     return wr;
 }
 
+// Weak references are kept in two per-thread lists. `weak_refs` holds young
+// entries and is scanned every collection, exactly as before. Once a weakref
+// and its referent are both old they move to `weak_refs_old`, which quick
+// collections never touch: old objects only die in a full sweep, and only
+// the complete mark that follows a full sweep can demote them (directly, or
+// through the finalizer resurrection pass), so filtering the old list in
+// those two kinds of collections is sufficient.
+//
+// The one way an old-list entry can come to reference a dying young object
+// is mutation of `wr->value`. The store fires the generic write barrier, so
+// the weakref lands in the remset, and the mark loop re-pushes any old
+// weakref with a young referent into the next remset (the weak edge is not
+// traced, so the ordinary field scan would not keep it there). Quick
+// collections therefore find every such weakref by scanning the remset.
+
+static void clear_weak_refs_list(arraylist_t *list)
+{
+    size_t n, l = list->len;
+    void **lst = list->items;
+    for (n = 0; n < l; n++) {
+        jl_weakref_t *wr = (jl_weakref_t*)lst[n];
+        if (!gc_marked(jl_astaggedvalue(wr->value)->bits.gc))
+            wr->value = (jl_value_t*)jl_nothing;
+    }
+}
+
 static void clear_weak_refs(void)
 {
     assert(gc_n_threads);
@@ -982,48 +1284,97 @@ static void clear_weak_refs(void)
         jl_ptls_t ptls2 = gc_all_tls_states[i];
         if (ptls2 == NULL)
             continue;
-        size_t n, l = ptls2->heap.weak_refs.len;
-        void **lst = ptls2->heap.weak_refs.items;
-        for (n = 0; n < l; n++) {
-            jl_weakref_t *wr = (jl_weakref_t*)lst[n];
-            if (!gc_marked(jl_astaggedvalue(wr->value)->bits.gc))
-                wr->value = (jl_value_t*)jl_nothing;
+        clear_weak_refs_list(&ptls2->heap.weak_refs);
+        // old weakrefs with young referents were re-pushed into the remset
+        // by the mark loop precisely so that they can be cleared here
+        // without scanning the rest of the old list
+        for (jl_gc_remset_chunk_t *c = ptls2->heap.remset->head; c != NULL; c = c->next) {
+            for (size_t j = 0; j < c->len; j++) {
+                jl_value_t *item = c->items[j];
+                if (jl_typeof(item) == (jl_value_t*)jl_weakref_type) {
+                    jl_weakref_t *wr = (jl_weakref_t*)item;
+                    if (!gc_marked(jl_astaggedvalue(wr->value)->bits.gc))
+                        wr->value = (jl_value_t*)jl_nothing;
+                }
+            }
+        }
+        if (prev_sweep_full) {
+            // the complete mark following a full sweep re-examined the old
+            // generation, so old referents may now be unmarked
+            clear_weak_refs_list(&ptls2->heap.weak_refs_old);
         }
     }
 }
 
-static void sweep_weak_refs(void)
+static void sweep_weak_refs(int sweep_full)
 {
     assert(gc_n_threads);
     for (int i = 0; i < gc_n_threads; i++) {
         jl_ptls_t ptls2 = gc_all_tls_states[i];
         if (ptls2 == NULL)
             continue;
+        // young list: drop dead weakrefs and promote entries whose weakref
+        // and referent have both aged into the old generation
         size_t n = 0;
-        size_t ndel = 0;
         size_t l = ptls2->heap.weak_refs.len;
         void **lst = ptls2->heap.weak_refs.items;
-        if (l == 0)
+        for (size_t j = 0; j < l; j++) {
+            jl_weakref_t *wr = (jl_weakref_t*)lst[j];
+            jl_taggedvalue_t *tag = jl_astaggedvalue(wr);
+            if (!gc_marked(tag->bits.gc))
+                continue;
+            if (tag->bits.gc == GC_OLD_MARKED &&
+                jl_astaggedvalue(wr->value)->bits.gc == GC_OLD_MARKED) {
+                arraylist_push(&ptls2->heap.weak_refs_old, wr);
+                continue;
+            }
+            lst[n++] = wr;
+        }
+        ptls2->heap.weak_refs.len = n;
+        if (!sweep_full && !prev_sweep_full)
             continue;
-        while (1) {
-            jl_weakref_t *wr = (jl_weakref_t*)lst[n];
-            if (gc_marked(jl_astaggedvalue(wr)->bits.gc))
-                n++;
-            else
-                ndel++;
-            if (n >= l - ndel)
-                break;
-            void *tmp = lst[n];
-            lst[n] = lst[n + ndel];
-            lst[n + ndel] = tmp;
+        // old objects can only have died (full sweep) or been demoted (the
+        // complete mark after one) in this collection: filter the old list,
+        // dropping dead weakrefs and moving entries that are no longer
+        // old-to-old back to the young list. The referent check doubles as
+        // the clear for a full sweep that was decided only after a quick
+        // mark, where clear_weak_refs did not visit this list.
+        n = 0;
+        l = ptls2->heap.weak_refs_old.len;
+        lst = ptls2->heap.weak_refs_old.items;
+        for (size_t j = 0; j < l; j++) {
+            jl_weakref_t *wr = (jl_weakref_t*)lst[j];
+            jl_taggedvalue_t *tag = jl_astaggedvalue(wr);
+            if (!gc_marked(tag->bits.gc))
+                continue;
+            if (!gc_marked(jl_astaggedvalue(wr->value)->bits.gc))
+                wr->value = (jl_value_t*)jl_nothing;
+            if (tag->bits.gc == GC_OLD_MARKED &&
+                jl_astaggedvalue(wr->value)->bits.gc == GC_OLD_MARKED) {
+                lst[n++] = wr;
+                continue;
+            }
+            arraylist_push(&ptls2->heap.weak_refs, wr);
         }
-        ptls2->heap.weak_refs.len -= ndel;
+        ptls2->heap.weak_refs_old.len = n;
     }
 }
 
 
 // big value list
 
+// only cache blocks up to this size; anything larger goes straight back to
+// the allocator so a burst of huge allocations cannot pin memory
+#define GC_BIG_CACHE_MAX_SZ (1 << 20)
+
+// big-object blocks may only be cached while no external GC callbacks are
+// registered, since cached reuse would skip their alloc/free notifications
+STATIC_INLINE int gc_big_cache_usable(void) JL_NOTSAFEPOINT
+{
+    return gc_cblist_notify_external_alloc == NULL &&
+           gc_cblist_notify_external_free == NULL;
+}
+
 // Size includes the tag and the tag is not cleared!!
 static inline jl_value_t *jl_gc_big_alloc_inner(jl_ptls_t ptls, size_t sz)
 {
@@ -1035,11 +1386,26 @@ static inline jl_value_t *jl_gc_big_alloc_inner(jl_ptls_t ptls, size_t sz)
     size_t allocsz = LLT_ALIGN(sz + offs, JL_CACHE_BYTE_ALIGNMENT);
     if (allocsz < sz)  // overflow in adding offs, size was "negative"
         jl_throw(jl_memory_exception);
-    bigval_t *v = (bigval_t*)malloc_cache_align(allocsz);
-    if (v == NULL)
-        jl_throw(jl_memory_exception);
-    gc_invoke_callbacks(jl_gc_cb_notify_external_alloc_t,
-        gc_cblist_notify_external_alloc, (v, allocsz));
+    gc_maybe_track_large_alloc(allocsz);
+    bigval_t *v = NULL;
+    if (allocsz <= GC_BIG_CACHE_MAX_SZ && gc_big_cache_usable()) {
+        // look for a recently swept block of exactly this size
+        for (int i = 0; i < JL_GC_N_BIG_CACHE; i++) {
+            bigval_t *c = ptls->heap.big_cache[i];
+            if (c != NULL && (c->sz & ~3) == allocsz) {
+                ptls->heap.big_cache[i] = NULL;
+                v = c;
+                break;
+            }
+        }
+    }
+    if (v == NULL) {
+        v = (bigval_t*)malloc_cache_align(allocsz);
+        if (v == NULL)
+            jl_throw(jl_memory_exception);
+        gc_invoke_callbacks(jl_gc_cb_notify_external_alloc_t,
+            gc_cblist_notify_external_alloc, (v, allocsz));
+    }
     jl_atomic_store_relaxed(&ptls->gc_num.allocd,
         jl_atomic_load_relaxed(&ptls->gc_num.allocd) + allocsz);
     jl_atomic_store_relaxed(&ptls->gc_num.bigalloc,
@@ -1069,25 +1435,51 @@ jl_value_t *jl_gc_big_alloc_noinline(jl_ptls_t ptls, size_t sz) {
     return jl_gc_big_alloc_inner(ptls, sz);
 }
 
+// age out half of a thread's cached big-object blocks: anything still
+// sitting in the cache when a sweep comes around was not reused since the
+// previous sweep, so gradually hand the memory back to the allocator
+static void gc_decay_big_cache(bigval_t **cache) JL_NOTSAFEPOINT
+{
+    int keep = 0;
+    for (int i = 0; i < JL_GC_N_BIG_CACHE; i++) {
+        bigval_t *c = cache[i];
+        if (c == NULL)
+            continue;
+        if (keep < JL_GC_N_BIG_CACHE / 2) {
+            keep++;
+            continue;
+        }
+        cache[i] = NULL;
+        jl_free_aligned(c);
+    }
+}
+
 // Sweep list rooted at *pv, removing and freeing any unmarked objects.
+// Freed blocks may be parked in `cache` (the owning thread's big-object
+// cache, or NULL to always free) for reuse by jl_gc_big_alloc.
 // Return pointer to last `next` field in the culled list.
-static bigval_t **sweep_big_list(int sweep_full, bigval_t **pv) JL_NOTSAFEPOINT
+static bigval_t **sweep_big_list(int sweep_full, bigval_t **pv, int64_t *freed, bigval_t **cache) JL_NOTSAFEPOINT
 {
     bigval_t *v = *pv;
     while (v != NULL) {
         bigval_t *nxt = v->next;
+        // the sweep is pure pointer chasing through headers that have not
+        // been touched since allocation, so start pulling in the next one
+        // before we inspect this one
+        if (nxt)
+            __builtin_prefetch(nxt);
         int bits = v->bits.gc;
         int old_bits = bits;
         if (gc_marked(bits)) {
             pv = &v->next;
             int age = v->age;
-            if (age >= PROMOTE_AGE || bits == GC_OLD_MARKED) {
+            if (age >= gc_promote_age || bits == GC_OLD_MARKED) {
                 if (sweep_full || bits == GC_MARKED) {
                     bits = GC_OLD;
                 }
             }
             else {
-                inc_sat(age, PROMOTE_AGE);
+                inc_sat(age, gc_promote_age);
                 v->age = age;
                 bits = GC_CLEAN;
             }
@@ -1098,13 +1490,28 @@ static bigval_t **sweep_big_list(int sweep_full, bigval_t **pv) JL_NOTSAFEPOINT
             *pv = nxt;
             if (nxt)
                 nxt->prev = pv;
-            gc_num.freed += v->sz&~3;
+            size_t vsz = v->sz&~3;
+            *freed += vsz;
 #ifdef MEMDEBUG
-            memset(v, 0xbb, v->sz&~3);
+            memset(v, 0xbb, vsz);
 #endif
-            gc_invoke_callbacks(jl_gc_cb_notify_external_free_t,
-                gc_cblist_notify_external_free, (v));
-            jl_free_aligned(v);
+            int cached = 0;
+            if (cache != NULL && vsz <= GC_BIG_CACHE_MAX_SZ &&
+                gc_big_cache_usable()) {
+                for (int i = 0; i < JL_GC_N_BIG_CACHE; i++) {
+                    if (cache[i] == NULL) {
+                        v->sz = vsz; // the tag bits are dead; keep the size valid
+                        cache[i] = v;
+                        cached = 1;
+                        break;
+                    }
+                }
+            }
+            if (!cached) {
+                gc_invoke_callbacks(jl_gc_cb_notify_external_free_t,
+                    gc_cblist_notify_external_free, (v));
+                jl_free_aligned(v);
+            }
         }
         gc_time_count_big(old_bits, bits);
         v = nxt;
@@ -1112,18 +1519,73 @@ static bigval_t **sweep_big_list(int sweep_full, bigval_t **pv) JL_NOTSAFEPOINT
     return pv;
 }
 
-static void sweep_big(jl_ptls_t ptls, int sweep_full) JL_NOTSAFEPOINT
+// worker for the parallel big-object sweep: the per-thread lists are
+// independent of each other, so they can be culled concurrently as long as
+// the freed bytes are accumulated per worker
+typedef struct {
+    uv_thread_t tid;
+    int index;
+    int nworkers;
+    int sweep_full;
+    int64_t freed;
+} jl_gc_big_sweep_worker_t;
+
+static int gc_sweep_nworkers(int max_useful) JL_NOTSAFEPOINT;
+
+static void gc_sweep_big_worker(void *vworker)
 {
-    gc_time_big_start();
-    assert(gc_n_threads);
-    for (int i = 0; i < gc_n_threads; i++) {
+    jl_gc_big_sweep_worker_t *worker = (jl_gc_big_sweep_worker_t*)vworker;
+    for (int i = worker->index; i < gc_n_threads; i += worker->nworkers) {
         jl_ptls_t ptls2 = gc_all_tls_states[i];
         if (ptls2 == NULL)
             continue;
-        sweep_big_list(sweep_full, &ptls2->heap.big_objects);
+        gc_decay_big_cache(ptls2->heap.big_cache);
+        sweep_big_list(worker->sweep_full, &ptls2->heap.big_objects, &worker->freed,
+                       ptls2->heap.big_cache);
+    }
+}
+
+static void sweep_big(jl_ptls_t ptls, int sweep_full) JL_NOTSAFEPOINT
+{
+    gc_time_big_start();
+    assert(gc_n_threads);
+    int64_t freed = 0;
+    // the big-object lists are per-thread, so that is the finest partition
+    int nworkers = gc_sweep_nworkers(gc_n_threads);
+#ifdef GC_TIME
+    nworkers = 1; // the timing counters are not thread-safe
+#endif
+    if (gc_cblist_notify_external_free != NULL)
+        nworkers = 1; // external callbacks may not be reentrant
+    if (nworkers > 1) {
+        jl_gc_big_sweep_worker_t *workers = (jl_gc_big_sweep_worker_t*)alloca(nworkers * sizeof(jl_gc_big_sweep_worker_t));
+        for (int i = 0; i < nworkers; i++) {
+            workers[i].index = i;
+            workers[i].nworkers = nworkers;
+            workers[i].sweep_full = sweep_full;
+            workers[i].freed = 0;
+        }
+        // this thread acts as worker 0
+        for (int i = 1; i < nworkers; i++)
+            uv_thread_create(&workers[i].tid, gc_sweep_big_worker, &workers[i]);
+        gc_sweep_big_worker(&workers[0]);
+        for (int i = 1; i < nworkers; i++)
+            uv_thread_join(&workers[i].tid);
+        for (int i = 0; i < nworkers; i++)
+            freed += workers[i].freed;
+    }
+    else {
+        for (int i = 0; i < gc_n_threads; i++) {
+            jl_ptls_t ptls2 = gc_all_tls_states[i];
+            if (ptls2 == NULL)
+                continue;
+            gc_decay_big_cache(ptls2->heap.big_cache);
+            sweep_big_list(sweep_full, &ptls2->heap.big_objects, &freed,
+                           ptls2->heap.big_cache);
+        }
     }
     if (sweep_full) {
-        bigval_t **last_next = sweep_big_list(sweep_full, &big_objects_marked);
+        bigval_t **last_next = sweep_big_list(sweep_full, &big_objects_marked, &freed, NULL);
         // Move all survivors from big_objects_marked list to the big_objects list of this thread.
         if (ptls->heap.big_objects)
             ptls->heap.big_objects->prev = last_next;
@@ -1133,6 +1595,7 @@ static void sweep_big(jl_ptls_t ptls, int sweep_full) JL_NOTSAFEPOINT
             ptls->heap.big_objects->prev = &ptls->heap.big_objects;
         big_objects_marked = NULL;
     }
+    gc_num.freed += freed;
     gc_time_big_end();
 }
 
@@ -1190,8 +1653,16 @@ static void reset_thread_gc_counts(void) JL_NOTSAFEPOINT
     for (int i = 0; i < gc_n_threads; i++) {
         jl_ptls_t ptls = gc_all_tls_states[i];
         if (ptls) {
+            // flush the running task's in-progress allocation window into its
+            // per-task counter before the thread counter is rebased
+            jl_task_t *ct = jl_atomic_load_relaxed(&ptls->current_task);
+            if (ct)
+                jl_atomic_fetch_add_relaxed(&ct->alloc_bytes,
+                    jl_atomic_load_relaxed(&ptls->gc_num.allocd) - ct->alloc_base);
             memset(&ptls->gc_num, 0, sizeof(ptls->gc_num));
             jl_atomic_store_relaxed(&ptls->gc_num.allocd, -(int64_t)gc_num.interval);
+            if (ct)
+                ct->alloc_base = jl_atomic_load_relaxed(&ptls->gc_num.allocd);
         }
     }
 }
@@ -1223,8 +1694,15 @@ static void jl_gc_free_array(jl_array_t *a) JL_NOTSAFEPOINT
 {
     if (a->flags.how == 2) {
         char *d = (char*)a->data - a->offset*a->elsize;
-        if (a->flags.isaligned)
+        if (a->flags.isaligned) {
+#ifdef _OS_LINUX_
+            size_t mapsz = gc_mmap_allocs.len ? gc_mmap_alloc_unregister(d) : 0;
+            if (mapsz)
+                munmap(d, mapsz);
+            else
+#endif
             jl_free_aligned(d);
+        }
         else
             free(d);
         gc_num.freed += jl_array_nbytes(a);
@@ -1268,7 +1746,7 @@ static inline jl_taggedvalue_t *reset_page(jl_ptls_t ptls2, const jl_gc_pool_t *
     assert(GC_PAGE_OFFSET >= sizeof(void*));
     pg->nfree = (GC_PAGE_SZ - GC_PAGE_OFFSET) / p->osize;
     pg->pool_n = p - ptls2->heap.norm_pools;
-    memset(pg->ages, 0, GC_PAGE_SZ / 8 / p->osize + 1);
+    memset(pg->ages, 0, GC_PAGE_SZ / 4 / p->osize + 1);
     jl_taggedvalue_t *beg = (jl_taggedvalue_t*)(pg->data + GC_PAGE_OFFSET);
     jl_taggedvalue_t *next = (jl_taggedvalue_t*)pg->data;
     if (fl == NULL) {
@@ -1294,17 +1772,31 @@ static inline jl_taggedvalue_t *reset_page(jl_ptls_t ptls2, const jl_gc_pool_t *
     return beg;
 }
 
-// Add a new page to the pool. Discards any pages in `p->newpages` before.
+// log2 of the max number of pages handed to a pool in one refill (64 pages = 1 MB)
+#define GC_POOL_MAX_REFILL 6
+
+// Add a run of new pages to the pool, chained through their page headers so
+// that the bump allocator walks from one to the next without coming back
+// here. The run length doubles each time the pool refills between sweeps, so
+// hot allocation loops pay the page-allocator round trip less and less often;
+// the counter resets at the next sweep, which also reclaims any untouched
+// pages of the run. Discards any pages in `p->newpages` before.
 static NOINLINE jl_taggedvalue_t *add_page(jl_gc_pool_t *p) JL_NOTSAFEPOINT
 {
     // Do not pass in `ptls` as argument. This slows down the fast path
     // in pool_alloc significantly
     jl_ptls_t ptls = jl_current_task->ptls;
-    jl_gc_pagemeta_t *pg = jl_gc_alloc_page();
-    pg->osize = p->osize;
-    pg->ages = (uint8_t*)malloc_s(GC_PAGE_SZ / 8 / p->osize + 1);
-    pg->thread_n = ptls->tid;
-    jl_taggedvalue_t *fl = reset_page(ptls, p, pg, NULL);
+    unsigned npages = 1u << p->nrefill;
+    if (p->nrefill < GC_POOL_MAX_REFILL)
+        p->nrefill++;
+    jl_taggedvalue_t *fl = NULL;
+    for (unsigned i = 0; i < npages; i++) {
+        jl_gc_pagemeta_t *pg = jl_gc_alloc_page();
+        pg->osize = p->osize;
+        pg->ages = (uint8_t*)malloc_s(GC_PAGE_SZ / 4 / p->osize + 1);
+        pg->thread_n = ptls->tid;
+        fl = reset_page(ptls, p, pg, fl);
+    }
     p->newpages = fl;
     return fl;
 }
@@ -1326,6 +1818,7 @@ static inline jl_value_t *jl_gc_pool_alloc_inner(jl_ptls_t ptls, int pool_offset
         jl_atomic_load_relaxed(&ptls->gc_num.allocd) + osize);
     jl_atomic_store_relaxed(&ptls->gc_num.poolalloc,
         jl_atomic_load_relaxed(&ptls->gc_num.poolalloc) + 1);
+    ptls->heap.pool_allocd_count[p - ptls->heap.norm_pools]++;
     // first try to use the freelist
     jl_taggedvalue_t *v = p->freelist;
     if (v) {
@@ -1395,12 +1888,158 @@ int jl_gc_classify_pools(size_t sz, int *osize)
     return (int)(intptr_t)(&((jl_ptls_t)0)->heap.norm_pools[klass]);
 }
 
+// The allocator codegen emits against (see lowerGCAllocBytes in
+// llvm-final-gc-lowering.cpp). An alternate allocator swaps this definition
+// — classification plus entry-point symbols — without touching codegen.
+const jl_gc_allocator_t jl_gc_active_allocator = {
+    jl_gc_classify_pools,
+    "jl_gc_pool_alloc",
+    "jl_gc_big_alloc",
+};
+
 // sweep phase
 
 int64_t lazy_freed_pages = 0;
 
+// Per-worker sweep statistics. Parallel sweep workers each accumulate into
+// their own copy so that the shared counters are neither contended nor raced
+// for; the results are summed into the globals once the workers have joined.
+typedef struct {
+    int64_t freed;
+    int64_t lazy_freed_pages;
+    // per-size-class tallies over the pages retained by this sweep, for the
+    // jl_gc_sizeclass_stats snapshot below
+    uint64_t class_pages[JL_GC_N_POOLS];
+    uint64_t class_live[JL_GC_N_POOLS];
+    uint64_t class_fslots[JL_GC_N_POOLS];
+} jl_gc_sweep_stats_t;
+
+// Snapshot of the pool heap per size class, published at the end of each
+// pool sweep while the world is stopped: pages held, live objects, and free
+// slots on those pages. Together with the cumulative per-thread allocation
+// counters this shows which size classes hold pages well in excess of their
+// live data (i.e. drive fragmentation).
+static uint64_t gc_class_pages[JL_GC_N_POOLS];
+static uint64_t gc_class_live[JL_GC_N_POOLS];
+static uint64_t gc_class_fslots[JL_GC_N_POOLS];
+static uint64_t gc_class_epoch = 0; // number of sweeps that produced a snapshot
+
+// Sampling heap census. While enabled, each full sweep tallies the type tag
+// and size of every live cell on ~1% of the pool pages (those whose page
+// number hashes into the sample) into a small open-addressed table, giving a
+// cheap estimate of live bytes per type without a heap snapshot. The world is
+// stopped for the whole sweep and `jl_gc_census_read` only runs outside of
+// it, so the atomics below merely order the parallel sweep workers against
+// each other.
+#define GC_CENSUS_SLOTS 1024     // power of two
+#define GC_CENSUS_SAMPLE_LG2 7   // sample 1 page in 128
+typedef struct {
+    _Atomic(uintptr_t) tag;
+    _Atomic(uint64_t) count;
+    _Atomic(uint64_t) bytes;
+} gc_census_slot_t;
+static gc_census_slot_t gc_census[GC_CENSUS_SLOTS];
+static _Atomic(int) gc_census_enabled = 0;
+static int gc_census_this_sweep = 0; // latched at the start of each sweep
+static uint64_t gc_census_epoch = 0; // number of sweeps that filled the table
+
+STATIC_INLINE int gc_census_sample_page(jl_gc_pagemeta_t *pg) JL_NOTSAFEPOINT
+{
+    if (!gc_census_this_sweep)
+        return 0;
+    uintptr_t pageno = (uintptr_t)pg->data >> GC_PAGE_LG2;
+    return (inthash(pageno) & ((1 << GC_CENSUS_SAMPLE_LG2) - 1)) == 0;
+}
+
+static void gc_census_count(jl_taggedvalue_t *v, int osize) JL_NOTSAFEPOINT
+{
+    // like the snapshot code, record buffers under jl_buff_tag rather than
+    // trying to interpret their header as a type
+    uintptr_t tag = v->header & ~(uintptr_t)15;
+    uintptr_t idx = inthash(tag) & (GC_CENSUS_SLOTS - 1);
+    for (size_t i = 0; i < GC_CENSUS_SLOTS; i++, idx = (idx + 1) & (GC_CENSUS_SLOTS - 1)) {
+        uintptr_t seen = jl_atomic_load_relaxed(&gc_census[idx].tag);
+        if (seen == 0) {
+            if (!jl_atomic_cmpswap_relaxed(&gc_census[idx].tag, &seen, tag) && seen != tag)
+                continue; // another worker claimed the slot for a different tag
+        }
+        else if (seen != tag) {
+            continue;
+        }
+        jl_atomic_fetch_add_relaxed(&gc_census[idx].count, 1);
+        jl_atomic_fetch_add_relaxed(&gc_census[idx].bytes, (uint64_t)osize);
+        return;
+    }
+    // table full of other types; drop the sample
+}
+
+void jl_gc_census_enable(int enable)
+{
+    jl_atomic_store_relaxed(&gc_census_enabled, enable);
+}
+
+size_t jl_gc_census_read(jl_value_t **types, uint64_t *counts, uint64_t *bytes,
+                         size_t len, uint64_t *epoch)
+{
+    if (epoch)
+        *epoch = gc_census_epoch;
+    size_t n = 0;
+    for (size_t i = 0; i < GC_CENSUS_SLOTS; i++) {
+        uintptr_t tag = jl_atomic_load_relaxed(&gc_census[i].tag);
+        if (tag == 0)
+            continue;
+        if (n < len) {
+            types[n] = (jl_value_t*)tag;
+            // scale the samples back up to an estimate for the whole pool heap
+            counts[n] = jl_atomic_load_relaxed(&gc_census[i].count) << GC_CENSUS_SAMPLE_LG2;
+            bytes[n] = jl_atomic_load_relaxed(&gc_census[i].bytes) << GC_CENSUS_SAMPLE_LG2;
+        }
+        n++;
+    }
+    return n;
+}
+
+// Fill per-size-class statistics into caller-provided arrays of length `len`
+// (typically JL_GC_N_POOLS, the return value): object size, cumulative
+// allocation count summed over all threads, and the live-object/free-slot/
+// page snapshot taken by the last pool sweep. `epoch` distinguishes
+// successive snapshots. Any output pointer may be NULL to skip that column.
+JL_DLLEXPORT size_t jl_gc_sizeclass_stats(size_t len, uint32_t *osizes,
+                                          uint64_t *allocd, uint64_t *live,
+                                          uint64_t *free_slots, uint64_t *pages,
+                                          uint64_t *epoch)
+{
+    if (epoch)
+        *epoch = gc_class_epoch;
+    if (len > JL_GC_N_POOLS)
+        len = JL_GC_N_POOLS;
+    int nthreads = jl_atomic_load_acquire(&jl_n_threads);
+    jl_ptls_t *all_tls_states = jl_atomic_load_relaxed(&jl_all_tls_states);
+    for (size_t i = 0; i < len; i++) {
+        if (osizes)
+            osizes[i] = jl_gc_sizeclasses[i];
+        if (allocd) {
+            uint64_t a = 0;
+            for (int t_i = 0; t_i < nthreads; t_i++) {
+                jl_ptls_t ptls2 = all_tls_states[t_i];
+                if (ptls2)
+                    a += ptls2->heap.pool_allocd_count[i];
+            }
+            allocd[i] = a;
+        }
+        if (live)
+            live[i] = gc_class_live[i];
+        if (free_slots)
+            free_slots[i] = gc_class_fslots[i];
+        if (pages)
+            pages[i] = gc_class_pages[i];
+    }
+    return JL_GC_N_POOLS;
+}
+
 // Returns pointer to terminal pointer of list rooted at *pfl.
-static jl_taggedvalue_t **sweep_page(jl_gc_pool_t *p, jl_gc_pagemeta_t *pg, jl_taggedvalue_t **pfl, int sweep_full, int osize) JL_NOTSAFEPOINT
+static jl_taggedvalue_t **sweep_page(jl_gc_pool_t *p, jl_gc_pagemeta_t *pg, jl_taggedvalue_t **pfl, int sweep_full, int osize,
+                                     jl_gc_sweep_stats_t *stats) JL_NOTSAFEPOINT
 {
     char *data = pg->data;
     uint8_t *ages = pg->ages;
@@ -1408,24 +2047,27 @@ static jl_taggedvalue_t **sweep_page(jl_gc_pool_t *p, jl_gc_pagemeta_t *pg, jl_t
     char *lim = (char*)v + GC_PAGE_SZ - GC_PAGE_OFFSET - osize;
     size_t old_nfree = pg->nfree;
     size_t nfree;
+    jl_taggedvalue_t **pfl_in = pfl; // for unthreading a retired page's cells
 
     int freedall = 1;
     int pg_skpd = 1;
+    int retained = 1;
     if (!pg->has_marked) {
         // lazy version: (empty) if the whole page was already unused, free it (return it to the pool)
         // eager version: (freedall) free page as soon as possible
         // the eager one uses less memory.
         // FIXME - need to do accounting on a per-thread basis
         // on quick sweeps, keep a few pages empty but allocated for performance
-        if (!sweep_full && lazy_freed_pages <= default_collect_interval / GC_PAGE_SZ) {
+        if (!sweep_full && stats->lazy_freed_pages <= default_collect_interval / GC_PAGE_SZ) {
             jl_ptls_t ptls2 = gc_all_tls_states[pg->thread_n];
             jl_taggedvalue_t *begin = reset_page(ptls2, p, pg, p->newpages);
             p->newpages = begin;
             begin->next = (jl_taggedvalue_t*)0;
-            lazy_freed_pages++;
+            stats->lazy_freed_pages++;
         }
         else {
             jl_gc_free_page(data);
+            retained = 0;
         }
         nfree = (GC_PAGE_SZ - GC_PAGE_OFFSET) / osize;
         goto done;
@@ -1449,12 +2091,13 @@ static jl_taggedvalue_t **sweep_page(jl_gc_pool_t *p, jl_gc_pagemeta_t *pg, jl_t
 
     pg_skpd = 0;
     {  // scope to avoid clang goto errors
+        int census = gc_census_sample_page(pg);
         int has_marked = 0;
         int has_young = 0;
         int16_t prev_nold = 0;
         int pg_nfree = 0;
         jl_taggedvalue_t **pfl_begin = NULL;
-        uint8_t msk = 1; // mask for the age bit in the current age byte
+        int sh = 0; // shift of the 2 bit age in the current age byte
         while ((char*)v <= lim) {
             int bits = v->bits.gc;
             if (!gc_marked(bits)) {
@@ -1462,10 +2105,11 @@ static jl_taggedvalue_t **sweep_page(jl_gc_pool_t *p, jl_gc_pagemeta_t *pg, jl_t
                 pfl = &v->next;
                 pfl_begin = pfl_begin ? pfl_begin : pfl;
                 pg_nfree++;
-                *ages &= ~msk;
+                *ages &= ~(0x3 << sh);
             }
             else { // marked young or old
-                if (*ages & msk || bits == GC_OLD_MARKED) { // old enough
+                int age = (*ages >> sh) & 0x3;
+                if (age >= gc_promote_age || bits == GC_OLD_MARKED) { // old enough
                     // `!age && bits == GC_OLD_MARKED` is possible for
                     // non-first-class objects like array buffers
                     // (they may get promoted by jl_gc_wb_buf for example,
@@ -1481,13 +2125,19 @@ static jl_taggedvalue_t **sweep_page(jl_gc_pool_t *p, jl_gc_pagemeta_t *pg, jl_t
                     has_young = 1;
                 }
                 has_marked |= gc_marked(bits);
-                *ages |= msk;
+                // survivors must keep a non-zero age so that the conservative
+                // scan in jl_gc_internal_obj_base_ptr can tell them apart
+                // from freelist entries
+                inc_sat(age, gc_promote_age);
+                *ages = (*ages & ~(0x3 << sh)) | (age << sh);
                 freedall = 0;
+                if (census)
+                    gc_census_count(v, osize);
             }
             v = (jl_taggedvalue_t*)((char*)v + osize);
-            msk <<= 1;
-            if (!msk) {
-                msk = 1;
+            sh += 2;
+            if (sh == 8) {
+                sh = 0;
                 ages++;
             }
         }
@@ -1509,28 +2159,51 @@ static jl_taggedvalue_t **sweep_page(jl_gc_pool_t *p, jl_gc_pagemeta_t *pg, jl_t
             pg->nold = 0;
             pg->prev_nold = prev_nold;
         }
+        // Optional sparse-page retirement: a page that survived with only a
+        // handful of live cells would otherwise be refilled with fresh
+        // allocations, re-dirtying it and keeping it resident indefinitely.
+        // Withhold its free slots from the allocator instead, so the few
+        // survivors can drain (die or get promoted) and the page can be
+        // returned whole by a later sweep.
+        if (gc_retire_sparse_pages && pfl_begin) {
+            size_t cap = (GC_PAGE_SZ - GC_PAGE_OFFSET) / osize;
+            if (cap - (size_t)pg_nfree <= cap / 8) {
+                pfl = pfl_in;
+                pg->fl_begin_offset = -1;
+                pg->fl_end_offset = -1;
+            }
+        }
     }
     nfree = pg->nfree;
 
 done:
     gc_time_count_page(freedall, pg_skpd);
-    gc_num.freed += (nfree - old_nfree) * osize;
+    stats->freed += (nfree - old_nfree) * osize;
+    if (retained) {
+        int p_n = pg->pool_n;
+        size_t cap = (GC_PAGE_SZ - GC_PAGE_OFFSET) / osize;
+        stats->class_pages[p_n]++;
+        stats->class_live[p_n] += cap - nfree;
+        stats->class_fslots[p_n] += nfree;
+    }
     return pfl;
 }
 
 // the actual sweeping over all allocated pages in a memory pool
-static inline void sweep_pool_page(jl_taggedvalue_t ***pfl, jl_gc_pagemeta_t *pg, int sweep_full) JL_NOTSAFEPOINT
+static inline void sweep_pool_page(jl_taggedvalue_t ***pfl, jl_gc_pagemeta_t *pg, int sweep_full,
+                                   jl_gc_sweep_stats_t *stats) JL_NOTSAFEPOINT
 {
     int p_n = pg->pool_n;
     int t_n = pg->thread_n;
     jl_ptls_t ptls2 = gc_all_tls_states[t_n];
     jl_gc_pool_t *p = &ptls2->heap.norm_pools[p_n];
     int osize = pg->osize;
-    pfl[t_n * JL_GC_N_POOLS + p_n] = sweep_page(p, pg, pfl[t_n * JL_GC_N_POOLS + p_n], sweep_full, osize);
+    pfl[t_n * JL_GC_N_POOLS + p_n] = sweep_page(p, pg, pfl[t_n * JL_GC_N_POOLS + p_n], sweep_full, osize, stats);
 }
 
 // sweep over a pagetable0 for all allocated pages
-static inline int sweep_pool_pagetable0(jl_taggedvalue_t ***pfl, pagetable0_t *pagetable0, int sweep_full) JL_NOTSAFEPOINT
+static inline int sweep_pool_pagetable0(jl_taggedvalue_t ***pfl, pagetable0_t *pagetable0, int sweep_full,
+                                        jl_gc_sweep_stats_t *stats) JL_NOTSAFEPOINT
 {
     unsigned ub = 0;
     unsigned alloc = 0;
@@ -1546,7 +2219,7 @@ static inline int sweep_pool_pagetable0(jl_taggedvalue_t ***pfl, pagetable0_t *p
             j += next;
             line >>= next;
             jl_gc_pagemeta_t *pg = pagetable0->meta[pg_i * 32 + j];
-            sweep_pool_page(pfl, pg, sweep_full);
+            sweep_pool_page(pfl, pg, sweep_full, stats);
         }
     }
     pagetable0->ub = ub;
@@ -1554,7 +2227,8 @@ static inline int sweep_pool_pagetable0(jl_taggedvalue_t ***pfl, pagetable0_t *p
 }
 
 // sweep over pagetable1 for all pagetable0 that may contain allocated pages
-static inline int sweep_pool_pagetable1(jl_taggedvalue_t ***pfl, pagetable1_t *pagetable1, int sweep_full) JL_NOTSAFEPOINT
+static inline int sweep_pool_pagetable1(jl_taggedvalue_t ***pfl, pagetable1_t *pagetable1, int sweep_full,
+                                        jl_gc_sweep_stats_t *stats) JL_NOTSAFEPOINT
 {
     unsigned ub = 0;
     unsigned alloc = 0;
@@ -1566,7 +2240,7 @@ static inline int sweep_pool_pagetable1(jl_taggedvalue_t ***pfl, pagetable1_t *p
             j += next;
             line >>= next;
             pagetable0_t *pagetable0 = pagetable1->meta0[pg_i * 32 + j];
-            if (pagetable0 && !sweep_pool_pagetable0(pfl, pagetable0, sweep_full))
+            if (pagetable0 && !sweep_pool_pagetable0(pfl, pagetable0, sweep_full, stats))
                 pagetable1->allocmap0[pg_i] &= ~(1 << j); // no allocations found, remember that for next time
         }
         if (pagetable1->allocmap0[pg_i]) {
@@ -1579,12 +2253,13 @@ static inline int sweep_pool_pagetable1(jl_taggedvalue_t ***pfl, pagetable1_t *p
 }
 
 // sweep over all memory for all pagetable1 that may contain allocated pages
-static void sweep_pool_pagetable(jl_taggedvalue_t ***pfl, int sweep_full) JL_NOTSAFEPOINT
+static void sweep_pool_pagetable(jl_taggedvalue_t ***pfl, int sweep_full,
+                                 jl_gc_sweep_stats_t *stats) JL_NOTSAFEPOINT
 {
     if (REGION2_PG_COUNT == 1) { // compile-time optimization
         pagetable1_t *pagetable1 = memory_map.meta1[0];
         if (pagetable1)
-            sweep_pool_pagetable1(pfl, pagetable1, sweep_full);
+            sweep_pool_pagetable1(pfl, pagetable1, sweep_full, stats);
         return;
     }
     unsigned ub = 0;
@@ -1596,7 +2271,7 @@ static void sweep_pool_pagetable(jl_taggedvalue_t ***pfl, int sweep_full) JL_NOT
             j += next;
             line >>= next;
             pagetable1_t *pagetable1 = memory_map.meta1[pg_i * 32 + j];
-            if (pagetable1 && !sweep_pool_pagetable1(pfl, pagetable1, sweep_full))
+            if (pagetable1 && !sweep_pool_pagetable1(pfl, pagetable1, sweep_full, stats))
                 memory_map.allocmap1[pg_i] &= ~(1 << j); // no allocations found, remember that for next time
         }
         if (memory_map.allocmap1[pg_i]) {
@@ -1606,6 +2281,77 @@ static void sweep_pool_pagetable(jl_taggedvalue_t ***pfl, int sweep_full) JL_NOT
     memory_map.ub = ub;
 }
 
+// number of worker threads used by the parallel sweep phases, from
+// --gcthreads (JULIA_GC_SWEEP_THREADS overrides it); each caller clamps
+// this to the number of independent work units in its partition, so the
+// usable parallelism is not tied to the mutator thread count
+static int gc_sweep_nworkers(int max_useful) JL_NOTSAFEPOINT
+{
+    static int nworkers = -1;
+    if (nworkers == -1) {
+        char *env = getenv("JULIA_GC_SWEEP_THREADS");
+        nworkers = env ? atoi(env) : jl_n_gcthreads;
+        if (nworkers < 1)
+            nworkers = 1;
+    }
+    return nworkers < max_useful ? nworkers : max_useful;
+}
+
+// bin all allocated pages by their (owning thread, pool) pair, so that each
+// parallel sweep worker operates on a disjoint set of pool free lists
+static void gc_pool_collect_pages(arraylist_t *buckets, int nbuckets) JL_NOTSAFEPOINT
+{
+    for (unsigned pg2_i = 0; pg2_i <= memory_map.ub; pg2_i++) {
+        uint32_t line1 = memory_map.allocmap1[pg2_i];
+        for (unsigned i = 0; line1; i++, line1 >>= 1) {
+            unsigned next = ffs_u32(line1);
+            i += next;
+            line1 >>= next;
+            pagetable1_t *pagetable1 = memory_map.meta1[pg2_i * 32 + i];
+            if (!pagetable1)
+                continue;
+            for (unsigned pg1_i = 0; pg1_i <= pagetable1->ub; pg1_i++) {
+                uint32_t line0 = pagetable1->allocmap0[pg1_i];
+                for (unsigned j = 0; line0; j++, line0 >>= 1) {
+                    unsigned next = ffs_u32(line0);
+                    j += next;
+                    line0 >>= next;
+                    pagetable0_t *pagetable0 = pagetable1->meta0[pg1_i * 32 + j];
+                    if (!pagetable0)
+                        continue;
+                    for (unsigned pg0_i = 0; pg0_i <= pagetable0->ub; pg0_i++) {
+                        uint32_t line = pagetable0->allocmap[pg0_i];
+                        for (unsigned k = 0; line; k++, line >>= 1) {
+                            unsigned next = ffs_u32(line);
+                            k += next;
+                            line >>= next;
+                            jl_gc_pagemeta_t *pg = pagetable0->meta[pg0_i * 32 + k];
+                            arraylist_push(&buckets[(pg->thread_n * JL_GC_N_POOLS + pg->pool_n) % nbuckets], pg);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+typedef struct {
+    uv_thread_t tid;
+    jl_taggedvalue_t ***pfl;
+    arraylist_t pages;
+    int sweep_full;
+    jl_gc_sweep_stats_t stats;
+} jl_gc_sweep_worker_t;
+
+static void gc_sweep_pool_worker(void *vworker)
+{
+    jl_gc_sweep_worker_t *worker = (jl_gc_sweep_worker_t*)vworker;
+    for (size_t i = 0; i < worker->pages.len; i++) {
+        jl_gc_pagemeta_t *pg = (jl_gc_pagemeta_t*)worker->pages.items[i];
+        sweep_pool_page(worker->pfl, pg, worker->sweep_full, &worker->stats);
+    }
+}
+
 // sweep over all memory that is being used and not in a pool
 static void gc_sweep_other(jl_ptls_t ptls, int sweep_full) JL_NOTSAFEPOINT
 {
@@ -1629,11 +2375,50 @@ static void gc_pool_sync_nfree(jl_gc_pagemeta_t *pg, jl_taggedvalue_t *last) JL_
     pg->nfree = nfree;
 }
 
+// Retire the calling thread's current pool allocation pages: subsequent pool
+// allocations go to fresh pages. Bracketing a phase whose objects die
+// together (e.g. one server request) with calls to this keeps those objects
+// from sharing pages with longer-lived data, so once the phase's graph is
+// dead the next sweep releases its pages through the page-level
+// `has_marked` fast path instead of walking them cell by cell. Objects that
+// do escape the phase simply keep their page alive; nothing is unsafe. The
+// abandoned free slots are recovered at the next sweep, exactly as if a
+// collection had cut the allocation lists here.
+JL_DLLEXPORT void jl_gc_retire_alloc_pages(void)
+{
+    jl_ptls_t ptls = jl_current_task->ptls;
+    for (int i = 0; i < JL_GC_N_POOLS; i++) {
+        jl_gc_pool_t *p = &ptls->heap.norm_pools[i];
+        jl_taggedvalue_t *last = p->freelist;
+        if (last) {
+            jl_gc_pagemeta_t *pg = jl_assume(page_metadata(last));
+            gc_pool_sync_nfree(pg, last);
+            pg->has_young = 1;
+            p->freelist = NULL;
+        }
+        last = p->newpages;
+        if (last) {
+            char *last_p = (char*)last;
+            jl_gc_pagemeta_t *pg = jl_assume(page_metadata(last_p - 1));
+            pg->nfree = (GC_PAGE_SZ - (last_p - gc_page_data(last_p - 1))) / p->osize;
+            pg->has_young = 1;
+            p->newpages = NULL;
+            p->nrefill = 0;
+        }
+    }
+}
+
 // setup the data-structures for a sweep over all memory pools
 static void gc_sweep_pool(int sweep_full)
 {
     gc_time_pool_start();
-    lazy_freed_pages = 0;
+    jl_gc_sweep_stats_t stats = {0, 0};
+
+    // only full sweeps scan every live cell, so only they can produce an
+    // unbiased census
+    gc_census_this_sweep = sweep_full && jl_atomic_load_relaxed(&gc_census_enabled);
+    if (gc_census_this_sweep)
+        memset(gc_census, 0, sizeof(gc_census));
 
     // For the benefit of the analyzer, which doesn't know that gc_n_threads
     // doesn't change over the course of this function
@@ -1673,11 +2458,51 @@ static void gc_sweep_pool(int sweep_full)
                 pg->has_young = 1;
             }
             p->newpages = NULL;
+            p->nrefill = 0;
         }
     }
 
     // the actual sweeping
-    sweep_pool_pagetable(pfl, sweep_full);
+    int nworkers = gc_sweep_nworkers(n_threads * JL_GC_N_POOLS);
+    if (nworkers > 1) {
+        // partition the pages by (owning thread, pool) and sweep the
+        // partitions on worker threads; all mutators are stopped, so the
+        // workers only contend on the page allocator lock when returning
+        // empty pages
+        jl_gc_sweep_worker_t *workers = (jl_gc_sweep_worker_t*)malloc_s(nworkers * sizeof(jl_gc_sweep_worker_t));
+        arraylist_t *buckets = (arraylist_t*)alloca(nworkers * sizeof(arraylist_t));
+        for (int i = 0; i < nworkers; i++)
+            arraylist_new(&buckets[i], 32);
+        gc_pool_collect_pages(buckets, nworkers);
+        for (int i = 0; i < nworkers; i++) {
+            workers[i].pfl = pfl;
+            workers[i].pages = buckets[i];
+            workers[i].sweep_full = sweep_full;
+            memset(&workers[i].stats, 0, sizeof(jl_gc_sweep_stats_t));
+        }
+        // this thread acts as worker 0
+        for (int i = 1; i < nworkers; i++)
+            uv_thread_create(&workers[i].tid, gc_sweep_pool_worker, &workers[i]);
+        gc_sweep_pool_worker(&workers[0]);
+        for (int i = 1; i < nworkers; i++)
+            uv_thread_join(&workers[i].tid);
+        for (int i = 0; i < nworkers; i++) {
+            stats.freed += workers[i].stats.freed;
+            stats.lazy_freed_pages += workers[i].stats.lazy_freed_pages;
+            for (int p_n = 0; p_n < JL_GC_N_POOLS; p_n++) {
+                stats.class_pages[p_n] += workers[i].stats.class_pages[p_n];
+                stats.class_live[p_n] += workers[i].stats.class_live[p_n];
+                stats.class_fslots[p_n] += workers[i].stats.class_fslots[p_n];
+            }
+            arraylist_free(&buckets[i]);
+        }
+        free(workers);
+    }
+    else {
+        sweep_pool_pagetable(pfl, sweep_full, &stats);
+    }
+    gc_num.freed += stats.freed;
+    lazy_freed_pages = stats.lazy_freed_pages;
 
     // null out terminal pointers of free lists
     for (int t_i = 0; t_i < n_threads; t_i++) {
@@ -1689,6 +2514,17 @@ static void gc_sweep_pool(int sweep_full)
         }
     }
 
+    if (gc_census_this_sweep) {
+        gc_census_epoch++;
+        gc_census_this_sweep = 0;
+    }
+
+    // publish the per-size-class snapshot (world is still stopped)
+    memcpy(gc_class_pages, stats.class_pages, sizeof(gc_class_pages));
+    memcpy(gc_class_live, stats.class_live, sizeof(gc_class_live));
+    memcpy(gc_class_fslots, stats.class_fslots, sizeof(gc_class_fslots));
+    gc_class_epoch++;
+
     gc_time_pool_end(sweep_full);
 }
 
@@ -1701,6 +2537,50 @@ static void gc_sweep_perm_alloc(void)
 
 // mark phase
 
+// Remembered-set chunk management. Chunks never move once allocated and are
+// returned to the per-thread free list when a remset is consumed, so pushes
+// only hit malloc while the chain is still growing towards its steady-state
+// size; after that the write barrier is guaranteed allocation-free.
+static jl_gc_remset_chunk_t *gc_remset_new_chunk(jl_ptls_t ptls) JL_NOTSAFEPOINT
+{
+    jl_gc_remset_chunk_t *c = ptls->heap.remset_free;
+    if (c != NULL)
+        ptls->heap.remset_free = c->next;
+    else
+        c = (jl_gc_remset_chunk_t*)malloc_s(sizeof(jl_gc_remset_chunk_t));
+    c->next = NULL;
+    c->len = 0;
+    return c;
+}
+
+// return all chunks of `remset` to the free list, leaving it empty
+static void gc_remset_reset(jl_ptls_t ptls, jl_gc_remset_t *remset) JL_NOTSAFEPOINT
+{
+    if (remset->tail != NULL) {
+        remset->tail->next = ptls->heap.remset_free;
+        ptls->heap.remset_free = remset->head;
+    }
+    remset->head = NULL;
+    remset->tail = NULL;
+    remset->len = 0;
+}
+
+STATIC_INLINE void gc_remset_push(jl_ptls_t ptls, jl_gc_remset_t *remset,
+                                  jl_value_t *obj) JL_NOTSAFEPOINT
+{
+    jl_gc_remset_chunk_t *tail = remset->tail;
+    if (__unlikely(tail == NULL || tail->len == JL_GC_REMSET_CHUNK_LEN)) {
+        jl_gc_remset_chunk_t *c = gc_remset_new_chunk(ptls);
+        if (tail == NULL)
+            remset->head = c;
+        else
+            tail->next = c;
+        remset->tail = tail = c;
+    }
+    tail->items[tail->len++] = obj;
+    remset->len++;
+}
+
 JL_DLLEXPORT void jl_gc_queue_root(const jl_value_t *ptr)
 {
     jl_ptls_t ptls = jl_current_task->ptls;
@@ -1708,9 +2588,10 @@ JL_DLLEXPORT void jl_gc_queue_root(const jl_value_t *ptr)
     // The modification of the `gc_bits` is not atomic but it
     // should be safe here since GC is not allowed to run here and we only
     // write GC_OLD to the GC bits outside GC. This could cause
-    // duplicated objects in the remset but that shouldn't be a problem.
+    // duplicated objects in the remset but that shouldn't be a problem
+    // since they are deduplicated in `jl_gc_premark`.
     o->bits.gc = GC_MARKED;
-    arraylist_push(ptls->heap.remset, (jl_value_t*)ptr);
+    gc_remset_push(ptls, ptls->heap.remset, (jl_value_t*)ptr);
     ptls->heap.remset_nptr++; // conservative
 }
 
@@ -1925,15 +2806,7 @@ STATIC_INLINE void gc_mark_push_remset(jl_ptls_t ptls, jl_value_t *obj, uintptr_
 {
     if (__unlikely((nptr & 0x3) == 0x3)) {
         ptls->heap.remset_nptr += nptr >> 2;
-        arraylist_t *remset = ptls->heap.remset;
-        size_t len = remset->len;
-        if (__unlikely(len >= remset->max)) {
-            arraylist_push(remset, obj);
-        }
-        else {
-            remset->len = len + 1;
-            remset->items[len] = obj;
-        }
+        gc_remset_push(ptls, ptls->heap.remset, obj);
     }
 }
 
@@ -1945,6 +2818,12 @@ STATIC_INLINE int gc_mark_scan_objarray(jl_ptls_t ptls, jl_gc_mark_sp_t *sp,
 {
     (void)jl_assume(objary == (gc_mark_objarray_t*)sp->data);
     for (; begin < end; begin += objary->step) {
+        // the element pointers stream in order, but the headers they point
+        // at are scattered, so pull in the tag word of an element a few
+        // steps ahead before gc_try_setmark stalls on it
+        jl_value_t **ahead = begin + 8 * objary->step;
+        if (ahead < end && *ahead)
+            __builtin_prefetch(jl_astaggedvalue(*ahead));
         *pnew_obj = *begin;
         if (*pnew_obj) {
             verify_parent2("obj array", objary->parent, begin, "elem(%d)",
@@ -2832,10 +3711,18 @@ mark: {
                 gc_mark_stack_push(&ptls->gc_cache, &sp, gc_mark_laddr(stack),
                                    &stackdata, sizeof(stackdata), 1);
             }
+            if (ta->parent_task) {
+                // hidden rollup target for per-task allocation accounting;
+                // kept alive until the rollup happens at the task's last
+                // context switch (tasks are rescanned on every collection,
+                // so a young parent of an old task stays reachable)
+                gc_mark_queue_obj(&ptls->gc_cache, &sp, ta->parent_task);
+            }
             if (ta->excstack) {
                 gc_heap_snapshot_record_task_to_frame_edge(ta, ta->excstack);
-                gc_setmark_buf_(ptls, ta->excstack, bits, sizeof(jl_excstack_t) +
-                                sizeof(uintptr_t)*ta->excstack->reserved_size);
+                if (!ta->excstack->preallocated)
+                    gc_setmark_buf_(ptls, ta->excstack, bits, sizeof(jl_excstack_t) +
+                                    sizeof(uintptr_t)*ta->excstack->reserved_size);
                 gc_mark_excstack_t stackdata = {ta->excstack, ta->excstack->top, 0, 0};
                 gc_mark_stack_push(&ptls->gc_cache, &sp, gc_mark_laddr(excstack),
                                    &stackdata, sizeof(stackdata), 1);
@@ -2871,8 +3758,16 @@ mark: {
                 gc_setmark(ptls, o, bits, dtsz);
             else if (foreign_alloc)
                 objprofile_count(vt, bits == GC_OLD_MARKED, dtsz);
-            if (vt == jl_weakref_type)
+            if (vt == jl_weakref_type) {
+                // the weak edge is not traced, so an old weakref with a
+                // young referent would drop out of the remset after this
+                // scan; re-push it explicitly so that quick collections can
+                // still find it (see clear_weak_refs)
+                if (bits == GC_OLD_MARKED &&
+                    !gc_old(jl_astaggedvalue(((jl_weakref_t*)new_obj)->value)->bits.gc))
+                    gc_mark_push_remset(ptls, new_obj, 0x7);
                 goto pop;
+            }
             const jl_datatype_layout_t *layout = vt->layout;
             uint32_t npointers = layout->npointers;
             if (npointers == 0)
@@ -2955,10 +3850,40 @@ static void jl_gc_queue_thread_local(jl_gc_mark_cache_t *gc_cache, jl_gc_mark_sp
         gc_mark_queue_obj(gc_cache, sp, ptls2->previous_exception);
         gc_heap_snapshot_record_root((jl_value_t*)ptls2->previous_exception, "previous exception");
     }
+    // tasks waiting on this thread's timer wheel
+    jl_timer_wheel_t *wheel = ptls2->timer_wheel;
+    if (wheel != NULL && wheel->count > 0) {
+        for (int level = 0; level < JL_TIMER_WHEEL_LEVELS; level++) {
+            for (size_t i = 0; i < JL_TIMER_WHEEL_SLOTS; i++) {
+                for (jl_timer_node_t *node = wheel->slots[level][i]; node; node = node->next) {
+                    gc_mark_queue_obj(gc_cache, sp, node->task);
+                    gc_heap_snapshot_record_root((jl_value_t*)node->task, "timer wheel");
+                }
+            }
+        }
+    }
+    // thread-private dispatch cache
+    for (size_t i = 0; i < JL_TLS_CALL_CACHE_LEN; i++) {
+        jl_typemap_entry_t *v = (jl_typemap_entry_t*)ptls2->call_cache[i];
+        if (v != NULL)
+            gc_mark_queue_obj(gc_cache, sp, v);
+    }
+    // thread-private code instance lookup cache (the code instance keeps the
+    // method instance it belongs to alive through its `def` field)
+    for (size_t i = 0; i < JL_TLS_MI_CACHE_LEN; i++) {
+        jl_code_instance_t *ci = (jl_code_instance_t*)ptls2->mi_cache[i].ci;
+        if (ci != NULL)
+            gc_mark_queue_obj(gc_cache, sp, ci);
+    }
+    // thread-private interpreter statement-kind cache, keyed on the code
+    // array: the key must stay valid while the entry is resident
+    if (ptls2->interp_kind_code != NULL)
+        gc_mark_queue_obj(gc_cache, sp, ptls2->interp_kind_code);
 }
 
 extern jl_value_t *cmpswap_names JL_GLOBALLY_ROOTED;
 extern jl_task_t *wait_empty JL_GLOBALLY_ROOTED;
+extern jl_array_t *jl_lowering_cache JL_GLOBALLY_ROOTED;
 
 // mark the initial root set
 static void mark_roots(jl_gc_mark_cache_t *gc_cache, jl_gc_mark_sp_t *sp)
@@ -2985,6 +3910,47 @@ static void mark_roots(jl_gc_mark_cache_t *gc_cache, jl_gc_mark_sp_t *sp)
             gc_mark_queue_obj(gc_cache, sp, v);
         }
     }
+    // method instances recorded by the runtime-dispatch trace (gf.c)
+    for (size_t i = 0; i < N_DISPATCH_TRACE; i++) {
+        jl_method_instance_t *mi = jl_atomic_load_relaxed(&dispatch_trace_set[i]);
+        if (mi != NULL)
+            gc_mark_queue_obj(gc_cache, sp, mi);
+    }
+    // subtype and specificity memo caches: keys must stay valid while their
+    // entry is resident
+    for (size_t i = 0; i < N_SUBTYPE_CACHE; i++) {
+        jl_value_t *a = jl_atomic_load_relaxed(&jl_subtype_cache[i].a);
+        jl_value_t *b = jl_atomic_load_relaxed(&jl_subtype_cache[i].b);
+        if (a != NULL)
+            gc_mark_queue_obj(gc_cache, sp, a);
+        if (b != NULL)
+            gc_mark_queue_obj(gc_cache, sp, b);
+        a = jl_atomic_load_relaxed(&jl_morespecific_cache[i].a);
+        b = jl_atomic_load_relaxed(&jl_morespecific_cache[i].b);
+        if (a != NULL)
+            gc_mark_queue_obj(gc_cache, sp, a);
+        if (b != NULL)
+            gc_mark_queue_obj(gc_cache, sp, b);
+    }
+    // intersection memo cache: results and envs must survive alongside keys
+    for (size_t i = 0; i < N_INTERSECT_CACHE; i++) {
+        jl_value_t *vals[4] = {
+            jl_atomic_load_relaxed(&jl_intersect_cache[i].a),
+            jl_atomic_load_relaxed(&jl_intersect_cache[i].b),
+            jl_atomic_load_relaxed(&jl_intersect_cache[i].ti),
+            (jl_value_t*)jl_atomic_load_relaxed(&jl_intersect_cache[i].env),
+        };
+        for (int j = 0; j < 4; j++)
+            if (vals[j] != NULL)
+                gc_mark_queue_obj(gc_cache, sp, vals[j]);
+    }
+    // small-string cache: entries are handed out to user code, so they must
+    // stay alive while resident
+    for (size_t i = 0; i < N_SMALL_STRING_CACHE; i++) {
+        jl_value_t *s = jl_atomic_load_relaxed(&jl_small_string_cache[i]);
+        if (s != NULL)
+            gc_mark_queue_obj(gc_cache, sp, s);
+    }
     if (jl_all_methods != NULL) {
         gc_mark_queue_obj(gc_cache, sp, jl_all_methods);
     }
@@ -2999,6 +3965,8 @@ static void mark_roots(jl_gc_mark_cache_t *gc_cache, jl_gc_mark_sp_t *sp)
         gc_mark_queue_obj(gc_cache, sp, cmpswap_names);
     if (wait_empty != NULL)
         gc_mark_queue_obj(gc_cache, sp, wait_empty);
+    if (jl_lowering_cache != NULL)
+        gc_mark_queue_obj(gc_cache, sp, jl_lowering_cache);
     gc_mark_queue_obj(gc_cache, sp, jl_global_roots_table);
 }
 
@@ -3134,31 +4102,76 @@ JL_DLLEXPORT int64_t jl_gc_live_bytes(void)
     return live_bytes;
 }
 
+// Live-tunable pause budget: the same knob JULIA_GC_PAUSE_TARGET_MS sets at
+// startup, adjustable at runtime so a service can trade throughput for
+// latency without a restart. 0 disables the budget.
+JL_DLLEXPORT void jl_gc_set_pause_target_ms(uint64_t ms)
+{
+    gc_pause_target_ns = ms * 1000000;
+}
+
+JL_DLLEXPORT uint64_t jl_gc_get_pause_target_ms(void)
+{
+    return gc_pause_target_ns / 1000000;
+}
+
 static void jl_gc_premark(jl_ptls_t ptls2)
 {
-    arraylist_t *remset = ptls2->heap.remset;
+    jl_gc_remset_t *remset = ptls2->heap.remset;
     ptls2->heap.remset = ptls2->heap.last_remset;
     ptls2->heap.last_remset = remset;
-    ptls2->heap.remset->len = 0;
+    // the new current remset was consumed (and emptied) by the last collection
+    assert(ptls2->heap.remset->len == 0);
     ptls2->heap.remset_nptr = 0;
 
     // avoid counting remembered objects & bindings twice
     // in `perm_scanned_bytes`
-    size_t len = remset->len;
-    void **items = remset->items;
-    for (size_t i = 0; i < len; i++) {
-        jl_value_t *item = (jl_value_t*)items[i];
-        objprofile_count(jl_typeof(item), 2, 0);
-        jl_astaggedvalue(item)->bits.gc = GC_OLD_MARKED;
+    jl_gc_remset_chunk_t *wc = remset->head;
+    size_t wi = 0;
+    size_t nuniq = 0;
+    for (jl_gc_remset_chunk_t *c = remset->head; c != NULL; c = c->next) {
+        for (size_t i = 0; i < c->len; i++) {
+            jl_value_t *item = c->items[i];
+            jl_taggedvalue_t *tag = jl_astaggedvalue(item);
+            // racy write barriers (and several threads writing to the same
+            // object) can insert duplicates into the remsets; premark has
+            // already visited those, so drop them here to keep the remset
+            // scan proportional to the number of distinct remembered objects
+            if (tag->bits.gc == GC_OLD_MARKED)
+                continue;
+            objprofile_count(jl_typeof(item), 2, 0);
+            tag->bits.gc = GC_OLD_MARKED;
+            // compact the surviving entries towards the front of the chain
+            if (wi == JL_GC_REMSET_CHUNK_LEN) {
+                wc->len = wi;
+                wc = wc->next;
+                wi = 0;
+            }
+            wc->items[wi++] = item;
+            nuniq++;
+        }
+    }
+    if (nuniq == 0) {
+        gc_remset_reset(ptls2, remset);
+        return;
     }
+    wc->len = wi;
+    // recycle the chunks left empty by the compaction
+    if (wc->next != NULL) {
+        remset->tail->next = ptls2->heap.remset_free;
+        ptls2->heap.remset_free = wc->next;
+        wc->next = NULL;
+    }
+    remset->tail = wc;
+    remset->len = nuniq;
 }
 
 static void jl_gc_queue_remset(jl_gc_mark_cache_t *gc_cache, jl_gc_mark_sp_t *sp, jl_ptls_t ptls2)
 {
-    size_t len = ptls2->heap.last_remset->len;
-    void **items = ptls2->heap.last_remset->items;
-    for (size_t i = 0; i < len; i++)
-        gc_mark_queue_scan_obj(gc_cache, sp, (jl_value_t*)items[i]);
+    for (jl_gc_remset_chunk_t *c = ptls2->heap.last_remset->head; c != NULL; c = c->next) {
+        for (size_t i = 0; i < c->len; i++)
+            gc_mark_queue_scan_obj(gc_cache, sp, c->items[i]);
+    }
 }
 
 static void jl_gc_queue_bt_buf(jl_gc_mark_cache_t *gc_cache, jl_gc_mark_sp_t *sp, jl_ptls_t ptls2)
@@ -3175,6 +4188,55 @@ static void jl_gc_queue_bt_buf(jl_gc_mark_cache_t *gc_cache, jl_gc_mark_sp_t *sp
     }
 }
 
+// Parallel mark phase. Each worker drains a private mark stack seeded with a
+// disjoint subset of the per-thread root sets; the stack and mark cache of a
+// paused mutator thread are borrowed for the worker. gc_setmark_tag is
+// atomic and the big-object cache flush takes gc_cache_lock, so concurrent
+// gc_mark_loop instances only race on the mark bits, where the exchange
+// winner alone continues scanning the object.
+typedef struct {
+    uv_thread_t tid;
+    jl_ptls_t ptls;
+    int index;
+    int nworkers;
+} jl_gc_mark_worker_t;
+
+// number of worker threads used by the parallel mark, from --gcthreads
+// (JULIA_GC_MARK_THREADS overrides it); each worker borrows the mark stack
+// and cache of one paused mutator thread, so unlike the sweep this remains
+// clamped to the mutator thread count
+static int gc_mark_nworkers(void) JL_NOTSAFEPOINT
+{
+    static int nworkers = -1;
+    if (nworkers == -1) {
+        char *env = getenv("JULIA_GC_MARK_THREADS");
+        nworkers = env ? atoi(env) : jl_n_gcthreads;
+        if (nworkers < 1)
+            nworkers = 1;
+    }
+    return nworkers < gc_n_threads ? nworkers : gc_n_threads;
+}
+
+static void gc_mark_worker(void *vworker)
+{
+    jl_gc_mark_worker_t *worker = (jl_gc_mark_worker_t*)vworker;
+    jl_ptls_t ptls = worker->ptls;
+    jl_gc_mark_cache_t *gc_cache = &ptls->gc_cache;
+    jl_gc_mark_sp_t sp;
+    gc_mark_sp_init(gc_cache, &sp);
+    for (int t_i = worker->index; t_i < gc_n_threads; t_i += worker->nworkers) {
+        jl_ptls_t ptls2 = gc_all_tls_states[t_i];
+        if (ptls2 == NULL)
+            continue;
+        jl_gc_queue_remset(gc_cache, &sp, ptls2);
+        jl_gc_queue_thread_local(gc_cache, &sp, ptls2);
+        jl_gc_queue_bt_buf(gc_cache, &sp, ptls2);
+    }
+    if (worker->index == 0)
+        mark_roots(gc_cache, &sp);
+    gc_mark_loop(ptls, sp);
+}
+
 size_t jl_maxrss(void);
 
 // Only one thread should be running in this function
@@ -3199,22 +4261,54 @@ static int _jl_gc_collect(jl_ptls_t ptls, jl_gc_collection_t collection)
             jl_gc_premark(ptls2);
     }
 
-    assert(gc_n_threads);
-    for (int t_i = 0; t_i < gc_n_threads; t_i++) {
-        jl_ptls_t ptls2 = gc_all_tls_states[t_i];
-        if (ptls2 == NULL)
-            continue;
-        // 2.1. mark every object in the `last_remsets`
-        jl_gc_queue_remset(gc_cache, &sp, ptls2);
-        // 2.2. mark every thread local root
-        jl_gc_queue_thread_local(gc_cache, &sp, ptls2);
-        // 2.3. mark any managed objects in the backtrace buffer
-        // TODO: treat these as roots for gc_heap_snapshot_record
-        jl_gc_queue_bt_buf(gc_cache, &sp, ptls2);
+    int mark_nworkers = gc_mark_nworkers();
+#ifdef OBJPROFILE
+    // the object profile counters are not thread-safe
+    mark_nworkers = 1;
+#endif
+    if (gc_heap_snapshot_enabled)
+        // the snapshot serializer must observe the mark order of one thread
+        mark_nworkers = 1;
+    if (mark_nworkers > 1) {
+        // 2./3. mark the per-thread root sets and global roots on a pool of
+        // workers; each borrows the mark stack of a distinct paused thread
+        jl_gc_mark_worker_t *workers = (jl_gc_mark_worker_t*)alloca(mark_nworkers * sizeof(jl_gc_mark_worker_t));
+        int nworkers = 0;
+        workers[nworkers++].ptls = ptls;
+        for (int t_i = 0; t_i < gc_n_threads && nworkers < mark_nworkers; t_i++) {
+            jl_ptls_t ptls2 = gc_all_tls_states[t_i];
+            if (ptls2 == NULL || ptls2 == ptls)
+                continue;
+            workers[nworkers++].ptls = ptls2;
+        }
+        for (int i = 0; i < nworkers; i++) {
+            workers[i].index = i;
+            workers[i].nworkers = nworkers;
+        }
+        for (int i = 1; i < nworkers; i++)
+            uv_thread_create(&workers[i].tid, gc_mark_worker, &workers[i]);
+        gc_mark_worker(&workers[0]);
+        for (int i = 1; i < nworkers; i++)
+            uv_thread_join(&workers[i].tid);
     }
+    else {
+        assert(gc_n_threads);
+        for (int t_i = 0; t_i < gc_n_threads; t_i++) {
+            jl_ptls_t ptls2 = gc_all_tls_states[t_i];
+            if (ptls2 == NULL)
+                continue;
+            // 2.1. mark every object in the `last_remsets`
+            jl_gc_queue_remset(gc_cache, &sp, ptls2);
+            // 2.2. mark every thread local root
+            jl_gc_queue_thread_local(gc_cache, &sp, ptls2);
+            // 2.3. mark any managed objects in the backtrace buffer
+            // TODO: treat these as roots for gc_heap_snapshot_record
+            jl_gc_queue_bt_buf(gc_cache, &sp, ptls2);
+        }
 
-    // 3. walk roots
-    mark_roots(gc_cache, &sp);
+        // 3. walk roots
+        mark_roots(gc_cache, &sp);
+    }
     if (gc_cblist_root_scanner) {
         export_gc_state(ptls, &sp);
         gc_invoke_callbacks(jl_gc_cb_root_scanner_t,
@@ -3338,6 +4432,11 @@ static int _jl_gc_collect(jl_ptls_t ptls, jl_gc_collection_t collection)
     if (gc_sweep_always_full) {
         sweep_full = 1;
     }
+    if (next_sweep_full) {
+        // scheduled by the RSS-slope watchdog at the end of the previous cycle
+        sweep_full = 1;
+        next_sweep_full = 0;
+    }
     if (collection == JL_GC_FULL && !prev_sweep_full) {
         sweep_full = 1;
         recollect = 1;
@@ -3352,7 +4451,7 @@ static int _jl_gc_collect(jl_ptls_t ptls, jl_gc_collection_t collection)
     // 5. start sweeping
     uint64_t start_sweep_time = jl_hrtime();
     JL_PROBE_GC_SWEEP_BEGIN(sweep_full);
-    sweep_weak_refs();
+    sweep_weak_refs(sweep_full);
     sweep_stack_pools();
     gc_sweep_foreign_objs();
     gc_sweep_other(ptls, sweep_full);
@@ -3378,14 +4477,16 @@ static int _jl_gc_collect(jl_ptls_t ptls, jl_gc_collection_t collection)
         if (ptls2 == NULL)
             continue;
         if (!sweep_full) {
-            for (int i = 0; i < ptls2->heap.remset->len; i++) {
-                void *ptr = ptls2->heap.remset->items[i];
-                jl_astaggedvalue(ptr)->bits.gc = GC_MARKED;
+            for (jl_gc_remset_chunk_t *c = ptls2->heap.remset->head; c != NULL; c = c->next) {
+                for (size_t i = 0; i < c->len; i++)
+                    jl_astaggedvalue(c->items[i])->bits.gc = GC_MARKED;
             }
         }
         else {
-            ptls2->heap.remset->len = 0;
+            gc_remset_reset(ptls2, ptls2->heap.remset);
         }
+        // the remset consumed by this collection is spent; recycle its chunks
+        gc_remset_reset(ptls2, ptls2->heap.last_remset);
     }
 
 #ifdef __GLIBC__
@@ -3424,6 +4525,60 @@ static int _jl_gc_collect(jl_ptls_t ptls, jl_gc_collection_t collection)
       if (gc_num.interval < default_collect_interval) gc_num.interval = default_collect_interval;
     }
 
+    if (gc_pause_target_ns != 0 && collection == JL_GC_AUTO) {
+        // Feedback controller for the pause budget. The mutators cannot be
+        // resumed mid-mark, so the pause is bounded by bounding the work a
+        // collection can accumulate: when a pause overshoots the target,
+        // halve the allocation interval (young generations get smaller and
+        // the mark frontier with them), and while pauses stay comfortably
+        // under it, let the interval recover an eighth at a time. Full sweeps
+        // still run when the heuristics above demand one and may exceed the
+        // budget; the controller pulls the interval back down afterwards.
+        if (pause > gc_pause_target_ns) {
+            gc_num.interval = gc_num.interval / 2;
+            if (gc_num.interval < default_collect_interval / 8)
+                gc_num.interval = default_collect_interval / 8;
+        }
+        else if (pause < gc_pause_target_ns / 2) {
+            gc_num.interval += gc_num.interval / 8;
+        }
+    }
+
+    if (collection == JL_GC_AUTO) {
+        // Keep the pause-frequency product bounded. A fixed byte threshold
+        // collects at a rate proportional to the allocation rate, so an
+        // ingest burst can spend a large fraction of wall time paused even
+        // though each pause is short: when the mutator ran for less than
+        // ~8x the pause since the previous collection, grow the interval.
+        // After long quiet stretches decay it back, so a once-bursty process
+        // does not keep an oversized young generation forever.
+        if (last_gc_end_time != 0 && pause > 0) {
+            uint64_t mut_time = gc_start_time - last_gc_end_time;
+            if (mut_time < 8 * pause)
+                gc_num.interval += gc_num.interval / 4;
+            else if (mut_time > 64 * pause && gc_num.interval > default_collect_interval)
+                gc_num.interval -= gc_num.interval / 8;
+        }
+        // RSS-slope watchdog for fragmentation creep: if the OS footprint
+        // keeps growing across cycles while staying well above the live set,
+        // quick sweeps are not retiring pages as fast as they go sparse;
+        // schedule a full sweep instead of waiting for the byte heuristics
+        // to notice.
+        size_t rss = 0;
+        if (uv_resident_set_memory(&rss) == 0 && rss != 0) {
+            if (rss > (size_t)live_bytes + (size_t)live_bytes / 2 && rss > last_gc_rss)
+                rss_creep_cycles++;
+            else
+                rss_creep_cycles = 0;
+            last_gc_rss = rss;
+            if (rss_creep_cycles >= 8) {
+                next_sweep_full = 1;
+                rss_creep_cycles = 0;
+            }
+        }
+    }
+    last_gc_end_time = gc_end_time;
+
     if (gc_num.interval + live_bytes > max_total_memory) {
         if (live_bytes < max_total_memory) {
             gc_num.interval = max_total_memory - live_bytes;
@@ -3452,6 +4607,17 @@ static int _jl_gc_collect(jl_ptls_t ptls, jl_gc_collection_t collection)
     return recollect;
 }
 
+// Background worker returning swept pages to the OS (see gc-pages.c); at
+// most one is running, since it is joined before the next one is spawned.
+static uv_thread_t gc_page_return_thread;
+static int gc_page_return_thread_running = 0;
+
+static void gc_page_return_worker(void *arg)
+{
+    (void)arg;
+    jl_gc_flush_page_returns();
+}
+
 JL_DLLEXPORT void jl_gc_collect(jl_gc_collection_t collection)
 {
     JL_PROBE_GC_BEGIN(collection);
@@ -3460,7 +4626,11 @@ JL_DLLEXPORT void jl_gc_collect(jl_gc_collection_t collection)
     jl_ptls_t ptls = ct->ptls;
     if (jl_atomic_load_relaxed(&jl_gc_disable_counter)) {
         size_t localbytes = jl_atomic_load_relaxed(&ptls->gc_num.allocd) + gc_num.interval;
+        // keep the per-task window consistent across the counter rebase
+        jl_atomic_fetch_add_relaxed(&ct->alloc_bytes,
+            jl_atomic_load_relaxed(&ptls->gc_num.allocd) - ct->alloc_base);
         jl_atomic_store_relaxed(&ptls->gc_num.allocd, -(int64_t)gc_num.interval);
+        ct->alloc_base = jl_atomic_load_relaxed(&ptls->gc_num.allocd);
         static_assert(sizeof(_Atomic(uint64_t)) == sizeof(gc_num.deferred_alloc), "");
         jl_atomic_fetch_add((_Atomic(uint64_t)*)&gc_num.deferred_alloc, localbytes);
         return;
@@ -3525,6 +4695,19 @@ JL_DLLEXPORT void jl_gc_collect(jl_gc_collection_t collection)
     jl_gc_state_set(ptls, old_state, JL_GC_STATE_WAITING);
     JL_PROBE_GC_END();
 
+    // now that the world is running again, return the pages freed by the
+    // sweep to the OS on a background thread
+    if (gc_page_return_thread_running) {
+        uv_thread_join(&gc_page_return_thread);
+        gc_page_return_thread_running = 0;
+    }
+    if (jl_gc_pending_page_returns() != 0) {
+        if (uv_thread_create(&gc_page_return_thread, gc_page_return_worker, NULL) == 0)
+            gc_page_return_thread_running = 1;
+        else
+            jl_gc_flush_page_returns(); // no thread available; return them here
+    }
+
     // Only disable finalizers on current thread
     // Doing this on all threads is racy (it's impossible to check
     // or wait for finalizers on other threads without dead lock).
@@ -3569,16 +4752,21 @@ void jl_init_thread_heap(jl_ptls_t ptls)
         p[i].osize = jl_gc_sizeclasses[i];
         p[i].freelist = NULL;
         p[i].newpages = NULL;
+        p[i].nrefill = 0;
     }
     arraylist_new(&heap->weak_refs, 0);
+    arraylist_new(&heap->weak_refs_old, 0);
     arraylist_new(&heap->live_tasks, 0);
     heap->mallocarrays = NULL;
     heap->mafreelist = NULL;
     heap->big_objects = NULL;
+    memset(heap->big_cache, 0, sizeof(heap->big_cache));
+    memset(heap->page_hint, 0, sizeof(heap->page_hint));
+    heap->page_hint_top = 0;
+    memset(heap->_remset, 0, sizeof(heap->_remset));
     heap->remset = &heap->_remset[0];
     heap->last_remset = &heap->_remset[1];
-    arraylist_new(heap->remset, 0);
-    arraylist_new(heap->last_remset, 0);
+    heap->remset_free = NULL;
     arraylist_new(&ptls->finalizers, 0);
     arraylist_new(&ptls->sweep_objs, 0);
 
@@ -3600,11 +4788,20 @@ void jl_gc_init(void)
 {
     if (jl_options.heap_size_hint)
         jl_gc_set_max_memory(jl_options.heap_size_hint);
+    gc_promote_age = jl_options.gc_promotion_age;
+    if (gc_promote_age < PROMOTE_AGE)
+        gc_promote_age = PROMOTE_AGE;
+    else if (gc_promote_age > MAX_PROMOTE_AGE)
+        gc_promote_age = MAX_PROMOTE_AGE;
 
     JL_MUTEX_INIT(&heapsnapshot_lock);
     JL_MUTEX_INIT(&finalizers_lock);
     uv_mutex_init(&gc_cache_lock);
     uv_mutex_init(&gc_perm_lock);
+#ifdef _OS_LINUX_
+    uv_mutex_init(&gc_mmap_allocs_lock);
+    arraylist_new(&gc_mmap_allocs, 0);
+#endif
 
     jl_gc_init_page();
     jl_gc_debug_init();
@@ -3618,6 +4815,25 @@ void jl_gc_init(void)
     gc_num.max_pause = 0;
     gc_num.max_memory = 0;
 
+    // optional pause budget (fractional milliseconds accepted); see the
+    // feedback controller at the end of _jl_gc_collect
+    char *env = getenv("JULIA_GC_PAUSE_TARGET_MS");
+    if (env) {
+        double ms = strtod(env, NULL);
+        if (ms > 0)
+            gc_pause_target_ns = (uint64_t)(ms * 1e6);
+    }
+
+    // optional sparse-page retirement; see sweep_page
+    env = getenv("JULIA_GC_RETIRE_SPARSE_PAGES");
+    if (env && atoi(env) != 0)
+        gc_retire_sparse_pages = 1;
+
+    // optional large-allocation tracking; see gc_track_large_alloc
+    env = getenv("JULIA_GC_ALLOC_TRACK");
+    if (env)
+        gc_alloc_track_min = (size_t)strtoull(env, NULL, 10);
+
 #ifdef _P64
     total_mem = uv_get_total_memory();
     uint64_t constrained_mem = uv_get_constrained_memory();
@@ -3775,13 +4991,14 @@ JL_DLLEXPORT void *jl_realloc(void *p, size_t sz)
 
 // allocating blocks for Arrays and Strings
 
-JL_DLLEXPORT void *jl_gc_managed_malloc(size_t sz)
+static void *gc_managed_malloc_(size_t sz, int zeroinit)
 {
     jl_ptls_t ptls = jl_current_task->ptls;
     maybe_collect(ptls);
     size_t allocsz = LLT_ALIGN(sz, JL_CACHE_BYTE_ALIGNMENT);
     if (allocsz < sz)  // overflow in adding offs, size was "negative"
         jl_throw(jl_memory_exception);
+    gc_maybe_track_large_alloc(allocsz);
     jl_atomic_store_relaxed(&ptls->gc_num.allocd,
         jl_atomic_load_relaxed(&ptls->gc_num.allocd) + allocsz);
     jl_atomic_store_relaxed(&ptls->gc_num.malloc,
@@ -3790,18 +5007,43 @@ JL_DLLEXPORT void *jl_gc_managed_malloc(size_t sz)
 #ifdef _OS_WINDOWS_
     DWORD last_error = GetLastError();
 #endif
-    void *b = malloc_cache_align(allocsz);
+    void *b = NULL;
+#ifdef _OS_LINUX_
+    if (allocsz >= GC_MMAP_ALLOC_THRESHOLD) {
+        b = gc_mmap_alloc(allocsz);
+        // a fresh anonymous mapping is already zero-filled by the kernel
+        // (and stays lazily committed if we don't touch it here)
+        zeroinit = zeroinit && b == NULL;
+    }
+#endif
+    if (b == NULL)
+        b = malloc_cache_align(allocsz);
     if (b == NULL)
         jl_throw(jl_memory_exception);
 #ifdef _OS_WINDOWS_
     SetLastError(last_error);
 #endif
     errno = last_errno;
+    if (zeroinit)
+        memset(b, 0, allocsz);
     // jl_gc_managed_malloc is currently always used for allocating array buffers.
     maybe_record_alloc_to_profile((jl_value_t*)b, sz, (jl_datatype_t*)jl_buff_tag);
     return b;
 }
 
+JL_DLLEXPORT void *jl_gc_managed_malloc(size_t sz)
+{
+    return gc_managed_malloc_(sz, 0);
+}
+
+// Like `jl_gc_managed_malloc`, but the returned memory is zero-filled.
+// Large buffers come from fresh kernel mappings that are already zeroed,
+// so this can be much cheaper than malloc followed by memset.
+JL_DLLEXPORT void *jl_gc_managed_malloc_zeroed(size_t sz)
+{
+    return gc_managed_malloc_(sz, 1);
+}
+
 static void *gc_managed_realloc_(jl_ptls_t ptls, void *d, size_t sz, size_t oldsz,
                                  int isaligned, jl_value_t *owner, int8_t can_collect)
 {
@@ -3829,11 +5071,35 @@ static void *gc_managed_realloc_(jl_ptls_t ptls, void *d, size_t sz, size_t olds
 #ifdef _OS_WINDOWS_
     DWORD last_error = GetLastError();
 #endif
-    void *b;
-    if (isaligned)
-        b = realloc_cache_align(d, allocsz, oldsz);
-    else
-        b = realloc(d, allocsz);
+    void *b = NULL;
+#ifdef _OS_LINUX_
+    size_t oldmapsz = isaligned && gc_mmap_allocs.len ? gc_mmap_alloc_lookup(d) : 0;
+    if (oldmapsz) {
+        // buffer lives in its own mapping: grow (or shrink) it in place
+        size_t newmapsz = LLT_ALIGN(allocsz, jl_page_size);
+        b = mremap(d, oldmapsz, newmapsz, MREMAP_MAYMOVE);
+        if (b == MAP_FAILED)
+            jl_throw(jl_memory_exception); // old mapping is untouched and stays registered
+        gc_mmap_alloc_update(d, b, newmapsz);
+    }
+    else if (isaligned && allocsz >= GC_MMAP_ALLOC_THRESHOLD &&
+             owner != NULL && jl_is_array(owner)) {
+        // array buffer grew past the threshold: migrate it into its own
+        // mapping now so that subsequent growth is in-place
+        b = gc_mmap_alloc(allocsz);
+        if (b != NULL) {
+            jl_memcpy_nt(b, d, oldsz > allocsz ? allocsz : oldsz);
+            jl_free_aligned(d);
+        }
+    }
+    if (b == NULL)
+#endif
+    {
+        if (isaligned)
+            b = realloc_cache_align(d, allocsz, oldsz);
+        else
+            b = realloc(d, allocsz);
+    }
     if (b == NULL)
         jl_throw(jl_memory_exception);
 #ifdef _OS_WINDOWS_
@@ -4125,7 +5391,7 @@ JL_DLLEXPORT jl_value_t *jl_gc_internal_obj_base_ptr(void *p)
             goto valid_object;
         // We know now that the age bit reflects liveness status during
         // the last sweep and that the cell has not been reused since.
-        if (!(meta->ages[obj_id / 8] & (1 << (obj_id % 8)))) {
+        if (!((meta->ages[obj_id / 4] >> (2 * (obj_id % 4))) & 0x3)) {
             return NULL;
         }
         // Not a freelist entry, therefore a valid object.
@@ -274,7 +274,7 @@ typedef struct _mallocarray_t {
 } mallocarray_t;
 
 // pool page metadata
-typedef struct {
+typedef struct _jl_gc_pagemeta_t {
     // index of pool that owns this page
     uint8_t pool_n;
     // Whether any cell in the page is marked
@@ -306,7 +306,7 @@ typedef struct {
     uint16_t fl_end_offset;   // offset of last free object in this page
     uint16_t thread_n;        // thread id of the heap that owns this page
     char *data;
-    uint8_t *ages;
+    uint8_t *ages;            // 2 bit object ages, 4 objects per byte
 } jl_gc_pagemeta_t;
 
 // Page layout:
@@ -338,6 +338,7 @@ typedef struct {
 #define REGION0_INDEX(p) (((uintptr_t)(p) >> 14) & 0xFFFF) // shift by GC_PAGE_LG2
 #define REGION1_INDEX(p) (((uintptr_t)(p) >> 30) & 0xFFFF)
 #define REGION_INDEX(p)  (((uintptr_t)(p) >> 46) & 0x3FFFF)
+#define REGION0_PREFIX(p) ((uintptr_t)(p) >> 30) // the bits above REGION0_INDEX
 #else
 #define REGION0_PG_COUNT (1 << 8)
 #define REGION1_PG_COUNT (1 << 10)
@@ -345,6 +346,7 @@ typedef struct {
 #define REGION0_INDEX(p) (((uintptr_t)(p) >> 14) & 0xFF) // shift by GC_PAGE_LG2
 #define REGION1_INDEX(p) (((uintptr_t)(p) >> 22) & 0x3FF)
 #define REGION_INDEX(p)  (0)
+#define REGION0_PREFIX(p) ((uintptr_t)(p) >> 22) // the bits above REGION0_INDEX
 #endif
 
 // define the representation of the levels of the page-table (0 to 2)
@@ -356,6 +358,8 @@ typedef struct {
     int lb;
     // an upper bound of the last non-free page
     int ub;
+    // the REGION0_PREFIX of the addresses this leaf covers, for the lookup TLB
+    uintptr_t prefix;
 } pagetable0_t;
 
 typedef struct {
@@ -387,6 +391,15 @@ STATIC_INLINE unsigned ffs_u32(uint32_t bitvec)
 }
 #endif
 
+// Software TLB in front of the page table: maps the address bits above the
+// leaf level directly to the pagetable0_t covering them, so a hit resolves a
+// pointer in two dependent loads instead of the full multi-level walk.
+// Entries are only ever replaced, never removed, and the leaves are
+// permanently allocated, so a stale entry is always safe to inspect; the
+// prefix check rejects it.
+#define PAGE_TLB_COUNT 64 // power of two
+extern _Atomic(pagetable0_t *) page_tlb[PAGE_TLB_COUNT];
+
 extern jl_gc_num_t gc_num;
 extern pagetable_t memory_map;
 extern bigval_t *big_objects_marked;
@@ -447,15 +460,21 @@ NOINLINE uintptr_t gc_get_stack_ptr(void);
 STATIC_INLINE jl_gc_pagemeta_t *page_metadata(void *_data) JL_NOTSAFEPOINT
 {
     uintptr_t data = ((uintptr_t)_data);
+    uintptr_t prefix = REGION0_PREFIX(data);
+    _Atomic(pagetable0_t *) *tlb = &page_tlb[prefix & (PAGE_TLB_COUNT - 1)];
+    pagetable0_t *r0 = jl_atomic_load_relaxed(tlb);
+    if (r0 && r0->prefix == prefix)
+        return r0->meta[REGION0_INDEX(data)];
     unsigned i;
     i = REGION_INDEX(data);
     pagetable1_t *r1 = memory_map.meta1[i];
     if (!r1)
         return NULL;
     i = REGION1_INDEX(data);
-    pagetable0_t *r0 = r1->meta0[i];
+    r0 = r1->meta0[i];
     if (!r0)
         return NULL;
+    jl_atomic_store_relaxed(tlb, r0);
     i = REGION0_INDEX(data);
     return r0->meta[i];
 }
@@ -529,6 +548,8 @@ extern void *gc_mark_label_addrs[_GC_MARK_L_MAX];
 void jl_gc_init_page(void);
 NOINLINE jl_gc_pagemeta_t *jl_gc_alloc_page(void) JL_NOTSAFEPOINT;
 void jl_gc_free_page(void *p) JL_NOTSAFEPOINT;
+size_t jl_gc_pending_page_returns(void) JL_NOTSAFEPOINT;
+void jl_gc_flush_page_returns(void) JL_NOTSAFEPOINT;
 
 // GC debug
 
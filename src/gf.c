@@ -293,6 +293,21 @@ jl_code_info_t *jl_type_infer(jl_method_instance_t *mi, size_t world, int force)
     if (mi->inInference && !force)
         return NULL;
 
+    // Inference results are keyed by exactly (method instance, world), so if a
+    // covering CodeInstance still holds its inferred source, re-running
+    // inference would recompute the same graph: hand back a private copy of
+    // the cached result instead. Only the compressed representation is used
+    // here, since decompression already produces a fresh object that the
+    // caller is free to mutate.
+    if (!force) {
+        jl_value_t *ci = jl_rettype_inferred(mi, world, world);
+        if (ci != jl_nothing) {
+            jl_value_t *inf = jl_atomic_load_relaxed(&((jl_code_instance_t*)ci)->inferred);
+            if (inf != NULL && inf != jl_nothing && jl_is_array(inf) && jl_is_method(mi->def.method))
+                return jl_uncompress_ir(mi->def.method, (jl_code_instance_t*)ci, (jl_array_t*)inf);
+        }
+    }
+
     jl_value_t **fargs;
     JL_GC_PUSHARGS(fargs, 3);
     fargs[0] = (jl_value_t*)jl_typeinf_func;
@@ -661,6 +676,7 @@ static jl_value_t *inst_varargp_in_env(jl_value_t *decl, jl_svec_t *sparams)
 static jl_value_t *ml_matches(jl_methtable_t *mt,
                               jl_tupletype_t *type, int lim, int include_ambiguous,
                               int intersections, size_t world, int cache_result,
+                              int budgeted,
                               size_t *min_valid, size_t *max_valid, int *ambig);
 
 // get the compilation signature specialization for this method
@@ -1202,7 +1218,7 @@ static jl_method_instance_t *cache_method(
         // now examine what will happen if we chose to use this sig in the cache
         size_t min_valid2 = 1;
         size_t max_valid2 = ~(size_t)0;
-        temp = ml_matches(mt, compilationsig, MAX_UNSPECIALIZED_CONFLICTS, 1, 1, world, 0, &min_valid2, &max_valid2, NULL);
+        temp = ml_matches(mt, compilationsig, MAX_UNSPECIALIZED_CONFLICTS, 1, 1, world, 0, 1, &min_valid2, &max_valid2, NULL);
         int guards = 0;
         if (temp == jl_nothing) {
             cache_with_orig = 1;
@@ -1339,9 +1355,20 @@ static jl_method_instance_t *cache_method(
 
 static jl_method_match_t *_gf_invoke_lookup(jl_value_t *types JL_PROPAGATES_ROOT, jl_value_t *mt, size_t world, size_t *min_valid, size_t *max_valid);
 
+// Generation counter for method table mutations, bumped while still holding
+// the owning mt->writelock *after* the typemap mutation and its invalidation
+// scan complete. Unlike jl_world_counter (which a definition bumps before
+// taking the lock), observing an unchanged value with the lock held proves
+// that no mutation completed since the value was read.
+static _Atomic(size_t) method_table_gen;
+
 static jl_method_instance_t *jl_mt_assoc_by_type(jl_methtable_t *mt JL_PROPAGATES_ROOT, jl_datatype_t *tt, size_t world)
 {
-    // caller must hold the mt->writelock
+    // The caller must not hold mt->writelock: the method search runs
+    // lock-free against the typemap snapshot (just like jl_matching_methods
+    // does), so that concurrent cache misses don't serialize behind each
+    // other or behind method definitions. Only the cache insertion takes the
+    // lock, and cache_method re-checks the caches once it is held.
     assert(tt->isdispatchtuple || tt->hasfreetypevars);
     if (tt->isdispatchtuple) {
         jl_array_t *leafcache = jl_atomic_load_relaxed(&mt->leafcache);
@@ -1357,18 +1384,126 @@ static jl_method_instance_t *jl_mt_assoc_by_type(jl_methtable_t *mt JL_PROPAGATE
 
     size_t min_valid = 0;
     size_t max_valid = ~(size_t)0;
+    size_t gen = jl_atomic_load_acquire(&method_table_gen);
     jl_method_match_t *matc = _gf_invoke_lookup((jl_value_t*)tt, jl_nothing, world, &min_valid, &max_valid);
     jl_method_instance_t *nf = NULL;
     if (matc) {
         JL_GC_PUSH1(&matc);
-        jl_method_t *m = matc->method;
-        jl_svec_t *env = matc->sparams;
-        nf = cache_method(mt, &mt->cache, (jl_value_t*)mt, tt, m, world, min_valid, max_valid, env);
+        JL_LOCK(&mt->writelock);
+        if (jl_atomic_load_relaxed(&method_table_gen) != gen) {
+            // A method definition completed between our snapshot and taking
+            // the lock: its invalidation scan can only truncate cache
+            // entries it sees, so the validity bounds we computed may extend
+            // past it. Redo the search with the lock held, where the scan
+            // cannot run concurrently; the result for `world` itself cannot
+            // change. (The generation is bumped under the lock after the
+            // mutation, so an unchanged value cannot miss a racing insert
+            // the way a jl_world_counter snapshot could: the counter is
+            // bumped before the typemap is touched.)
+            min_valid = 0;
+            max_valid = ~(size_t)0;
+            matc = _gf_invoke_lookup((jl_value_t*)tt, jl_nothing, world, &min_valid, &max_valid);
+        }
+        if (matc) {
+            jl_method_t *m = matc->method;
+            jl_svec_t *env = matc->sparams;
+            nf = cache_method(mt, &mt->cache, (jl_value_t*)mt, tt, m, world, min_valid, max_valid, env);
+        }
+        JL_UNLOCK(&mt->writelock);
         JL_GC_POP();
     }
     return nf;
 }
 
+// Reinstall a dispatch cache mapping (call signature `tt` resolving to the
+// specialization `mi`) that was saved in a package image. The mapping was
+// valid when the image was saved, but methods loaded since then may have
+// changed the answer, so it is re-derived in `world` and stale entries are
+// dropped instead of being allowed to corrupt dispatch.
+JL_DLLEXPORT void jl_mt_cache_restore(jl_tupletype_t *tt, jl_method_instance_t *mi, size_t world)
+{
+    assert(jl_is_datatype(tt) && tt->isdispatchtuple);
+    jl_methtable_t *mt = jl_method_table_for((jl_value_t*)tt);
+    if ((jl_value_t*)mt == jl_nothing)
+        return;
+    jl_array_t *leafcache = jl_atomic_load_relaxed(&mt->leafcache);
+    if (lookup_leafcache(leafcache, (jl_value_t*)tt, world))
+        return;
+    size_t min_valid = 0;
+    size_t max_valid = ~(size_t)0;
+    size_t gen = jl_atomic_load_acquire(&method_table_gen);
+    jl_value_t *matc = jl_gf_invoke_lookup_worlds((jl_value_t*)tt, (jl_value_t*)mt, world, &min_valid, &max_valid);
+    if (matc == jl_nothing || ((jl_method_match_t*)matc)->method != mi->def.method || max_valid != ~(size_t)0)
+        return;
+    jl_typemap_entry_t *newentry = jl_typemap_alloc(tt, NULL, jl_emptysvec, (jl_value_t*)mi, min_valid, max_valid);
+    JL_GC_PUSH1(&newentry);
+    JL_LOCK(&mt->writelock);
+    if (jl_atomic_load_relaxed(&method_table_gen) != gen) {
+        // a method definition completed between the lookup above and taking
+        // the lock; its invalidation scan could not see our entry, so the
+        // validity bounds may extend past it (see jl_mt_assoc_by_type).
+        // Redo the lookup with the lock held before installing.
+        min_valid = 0;
+        max_valid = ~(size_t)0;
+        matc = jl_gf_invoke_lookup_worlds((jl_value_t*)tt, (jl_value_t*)mt, world, &min_valid, &max_valid);
+        if (matc == jl_nothing || ((jl_method_match_t*)matc)->method != mi->def.method || max_valid != ~(size_t)0) {
+            JL_UNLOCK(&mt->writelock);
+            JL_GC_POP();
+            return;
+        }
+        newentry->min_world = min_valid;
+        newentry->max_world = max_valid;
+    }
+    leafcache = jl_atomic_load_relaxed(&mt->leafcache);
+    if (lookup_leafcache(leafcache, (jl_value_t*)tt, world) == NULL) {
+        if (tt->hash && !tt->hasfreetypevars) {
+            // as in cache_method: make sure the signature type is cached so
+            // that the fast path can depend on it as a token
+            if (jl_lookup_cache_type_(tt) == NULL) {
+                JL_LOCK(&typecache_lock);
+                if (jl_lookup_cache_type_(tt) == NULL)
+                    jl_cache_type_(tt);
+                JL_UNLOCK(&typecache_lock); // Might GC
+            }
+            jl_typemap_entry_t *old = (jl_typemap_entry_t*)jl_eqtable_get(leafcache, (jl_value_t*)tt, jl_nothing);
+            jl_atomic_store_relaxed(&newentry->next, old);
+            jl_gc_wb(newentry, old);
+            jl_array_t *newcache = (jl_array_t*)jl_eqtable_put(leafcache, (jl_value_t*)tt, (jl_value_t*)newentry, NULL);
+            if (newcache != leafcache) {
+                jl_atomic_store_release(&mt->leafcache, newcache);
+                jl_gc_wb(mt, newcache);
+            }
+        }
+        else {
+            jl_typemap_insert(&mt->cache, (jl_value_t*)mt, newentry, jl_cachearg_offset(mt));
+        }
+    }
+    JL_UNLOCK(&mt->writelock);
+    JL_GC_POP();
+}
+
+// Cheap revalidation probe for saved call edges: for a concrete call
+// signature, a dispatch cache hit in `world` identifies the unique method
+// that jl_matching_methods would return, without running the method search.
+// Returns NULL when the caches have no answer (not a validity verdict).
+jl_method_t *jl_mt_dispatch_cached(jl_value_t *tt, size_t world)
+{
+    if (!jl_is_datatype(tt) || !((jl_datatype_t*)tt)->isdispatchtuple)
+        return NULL;
+    jl_methtable_t *mt = jl_method_table_for(tt);
+    if ((jl_value_t*)mt == jl_nothing)
+        return NULL;
+    jl_array_t *leafcache = jl_atomic_load_relaxed(&mt->leafcache);
+    jl_typemap_entry_t *entry = lookup_leafcache(leafcache, tt, world);
+    if (entry == NULL) {
+        struct jl_typemap_assoc search = {tt, world, NULL, 0, ~(size_t)0};
+        entry = jl_typemap_assoc_by_type(jl_atomic_load_relaxed(&mt->cache), &search, jl_cachearg_offset(mt), /*subtype*/1);
+    }
+    if (entry == NULL)
+        return NULL;
+    return entry->func.linfo->def.method;
+}
+
 
 struct matches_env {
     struct typemap_intersection_env match;
@@ -1528,47 +1663,77 @@ static void invalidate_external(jl_method_instance_t *mi, size_t max_world) {
 
 static void do_nothing_with_codeinst(jl_code_instance_t *ci) {}
 
-// recursively invalidate cached methods that had an edge to a replaced method
+// invalidate cached methods that had an edge to a replaced method, by
+// sweeping a worklist seeded with `replaced` over the transitive backedge
+// closure. Each method instance is consumed at most once per wave (its
+// backedge list is detached when first visited), so redefinitions that share
+// dependents do one linear sweep instead of re-walking shared subgraphs, and
+// only one method writelock is held at a time.
 static void invalidate_method_instance(void (*f)(jl_code_instance_t*), jl_method_instance_t *replaced, size_t max_world, int depth)
 {
-    if (_jl_debug_method_invalidation) {
-        jl_value_t *boxeddepth = NULL;
-        JL_GC_PUSH1(&boxeddepth);
-        jl_array_ptr_1d_push(_jl_debug_method_invalidation, (jl_value_t*)replaced);
-        boxeddepth = jl_box_int32(depth);
-        jl_array_ptr_1d_push(_jl_debug_method_invalidation, boxeddepth);
-        JL_GC_POP();
-    }
-    //jl_static_show(JL_STDERR, (jl_value_t*)replaced);
-    if (!jl_is_method(replaced->def.method))
-        return; // shouldn't happen, but better to be safe
-    JL_LOCK(&replaced->def.method->writelock);
-    jl_code_instance_t *codeinst = jl_atomic_load_relaxed(&replaced->cache);
-    while (codeinst) {
-        if (codeinst->max_world == ~(size_t)0) {
-            assert(codeinst->min_world - 1 <= max_world && "attempting to set illogical world constraints (probable race condition)");
-            codeinst->max_world = max_world;
+    jl_array_t *worklist = jl_alloc_vec_any(0);
+    jl_array_t *backedges = NULL;
+    arraylist_t depths;
+    arraylist_new(&depths, 0);
+    JL_GC_PUSH2(&worklist, &backedges);
+    jl_array_ptr_1d_push(worklist, (jl_value_t*)replaced);
+    arraylist_push(&depths, (void*)(uintptr_t)depth);
+    while (jl_array_len(worklist)) {
+        replaced = (jl_method_instance_t*)jl_array_ptr_ref(worklist, jl_array_len(worklist) - 1);
+        jl_array_del_end(worklist, 1);
+        depth = (int)(uintptr_t)arraylist_pop(&depths);
+        if (_jl_debug_method_invalidation) {
+            jl_value_t *boxeddepth = NULL;
+            JL_GC_PUSH1(&boxeddepth);
+            jl_array_ptr_1d_push(_jl_debug_method_invalidation, (jl_value_t*)replaced);
+            boxeddepth = jl_box_int32(depth);
+            jl_array_ptr_1d_push(_jl_debug_method_invalidation, boxeddepth);
+            JL_GC_POP();
         }
-        assert(codeinst->max_world <= max_world);
-        JL_GC_PUSH1(&codeinst);
-        (*f)(codeinst);
-        JL_GC_POP();
-        codeinst = jl_atomic_load_relaxed(&codeinst->next);
-    }
-    // recurse to all backedges to update their valid range also
-    jl_array_t *backedges = replaced->backedges;
-    if (backedges) {
-        JL_GC_PUSH1(&backedges);
-        replaced->backedges = NULL;
-        size_t i = 0, l = jl_array_len(backedges);
-        jl_method_instance_t *replaced;
-        while (i < l) {
-            i = get_next_edge(backedges, i, NULL, &replaced);
-            invalidate_method_instance(f, replaced, max_world, depth + 1);
+        //jl_static_show(JL_STDERR, (jl_value_t*)replaced);
+        if (!jl_is_method(replaced->def.method))
+            continue; // shouldn't happen, but better to be safe
+        JL_LOCK(&replaced->def.method->writelock);
+        jl_code_instance_t *codeinst = jl_atomic_load_relaxed(&replaced->cache);
+        while (codeinst) {
+            if (codeinst->max_world == ~(size_t)0) {
+                assert(codeinst->min_world - 1 <= max_world && "attempting to set illogical world constraints (probable race condition)");
+                codeinst->max_world = max_world;
+            }
+            assert(codeinst->max_world <= max_world);
+            JL_GC_PUSH1(&codeinst);
+            (*f)(codeinst);
+            JL_GC_POP();
+            codeinst = jl_atomic_load_relaxed(&codeinst->next);
         }
-        JL_GC_POP();
+        // enqueue all backedges to update their valid range also; the
+        // detached array is rooted above, since the worklist pushes below
+        // can allocate and nothing else refers to it anymore
+        backedges = replaced->backedges;
+        if (backedges) {
+            replaced->backedges = NULL;
+            size_t i = 0, l = jl_array_len(backedges);
+            size_t first = jl_array_len(worklist);
+            jl_method_instance_t *edge;
+            while (i < l) {
+                i = get_next_edge(backedges, i, NULL, &edge);
+                jl_array_ptr_1d_push(worklist, (jl_value_t*)edge);
+                arraylist_push(&depths, (void*)(uintptr_t)(depth + 1));
+            }
+            // the worklist pops from the end; reverse the edges just added so
+            // they are visited in the same depth-first order as before
+            size_t last = jl_array_len(worklist);
+            for (size_t j = 0; first + j + 1 < last - j; j++) {
+                jl_value_t *tmp = jl_array_ptr_ref(worklist, first + j);
+                jl_array_ptr_set(worklist, first + j, jl_array_ptr_ref(worklist, last - j - 1));
+                jl_array_ptr_set(worklist, last - j - 1, tmp);
+            }
+            backedges = NULL;
+        }
+        JL_UNLOCK(&replaced->def.method->writelock);
     }
-    JL_UNLOCK(&replaced->def.method->writelock);
+    JL_GC_POP();
+    arraylist_free(&depths);
 }
 
 // invalidate cached methods that overlap this definition
@@ -1599,6 +1764,58 @@ static void invalidate_backedges(void (*f)(jl_code_instance_t*), jl_method_insta
     }
 }
 
+// --- sealed module bindings ---
+
+// flat list of (module, caller) pairs recorded by codegen when it embeds the
+// value of a sealed module's binding as a constant (see emit_globalref)
+static arraylist_t sealed_dependents;
+static jl_mutex_t sealed_dependents_lock;
+
+JL_DLLEXPORT void jl_record_sealed_dependency(jl_module_t *m, jl_method_instance_t *caller)
+{
+    // no rooting needed: `m` and `caller` are kept alive by the module tree
+    // and by the defining method's specializations, respectively
+    JL_LOCK(&sealed_dependents_lock);
+    if (sealed_dependents.items == NULL)
+        arraylist_new(&sealed_dependents, 0);
+    size_t i, l = sealed_dependents.len;
+    for (i = 0; i < l; i += 2) {
+        if (sealed_dependents.items[i] == (void*)m && sealed_dependents.items[i + 1] == (void*)caller) {
+            JL_UNLOCK(&sealed_dependents_lock);
+            return;
+        }
+    }
+    arraylist_push(&sealed_dependents, (void*)m);
+    arraylist_push(&sealed_dependents, (void*)caller);
+    JL_UNLOCK(&sealed_dependents_lock);
+}
+
+// called when an assigned binding of a sealed module is reassigned: drop the
+// seal and invalidate everything compiled against the sealed values
+void jl_module_break_seal(jl_module_t *m)
+{
+    if (!m->sealed)
+        return;
+    m->sealed = 0;
+    JL_LOCK(&sealed_dependents_lock);
+    size_t i, l = sealed_dependents.len;
+    if (l) {
+        size_t nkept = 0;
+        size_t world = jl_atomic_fetch_add(&jl_world_counter, 1);
+        for (i = 0; i < l; i += 2) {
+            if (sealed_dependents.items[i] != (void*)m) {
+                sealed_dependents.items[nkept++] = sealed_dependents.items[i];
+                sealed_dependents.items[nkept++] = sealed_dependents.items[i + 1];
+                continue;
+            }
+            jl_method_instance_t *caller = (jl_method_instance_t*)sealed_dependents.items[i + 1];
+            invalidate_method_instance(&do_nothing_with_codeinst, caller, world, 1);
+        }
+        sealed_dependents.len = nkept;
+    }
+    JL_UNLOCK(&sealed_dependents_lock);
+}
+
 // add a backedge from callee to caller
 JL_DLLEXPORT void jl_method_instance_add_backedge(jl_method_instance_t *callee, jl_value_t *invokesig, jl_method_instance_t *caller)
 {
@@ -1782,6 +1999,7 @@ JL_DLLEXPORT void jl_method_table_disable(jl_methtable_t *mt, jl_method_t *metho
     // Narrow the world age on the method to make it uncallable
     size_t world = jl_atomic_fetch_add(&jl_world_counter, 1);
     jl_method_table_invalidate(mt, methodentry, method, world);
+    jl_atomic_fetch_add(&method_table_gen, 1); // see jl_mt_assoc_by_type
     JL_UNLOCK(&mt->writelock);
 }
 
@@ -2026,6 +2244,7 @@ JL_DLLEXPORT void jl_method_table_insert(jl_methtable_t *mt, jl_method_t *method
         }
         update_max_args(mt, type);
     }
+    jl_atomic_fetch_add(&method_table_gen, 1); // see jl_mt_assoc_by_type
     JL_UNLOCK(&mt->writelock);
     JL_GC_POP();
 }
@@ -2087,9 +2306,7 @@ jl_method_instance_t *jl_method_lookup(jl_value_t **args, size_t nargs, size_t w
     if (entry)
         return entry->func.linfo;
     JL_GC_PUSH1(&tt);
-    JL_LOCK(&mt->writelock);
     jl_method_instance_t *sf = jl_mt_assoc_by_type(mt, tt, world);
-    JL_UNLOCK(&mt->writelock);
     JL_GC_POP();
     return sf;
 }
@@ -2118,7 +2335,7 @@ JL_DLLEXPORT jl_value_t *jl_matching_methods(jl_tupletype_t *types, jl_value_t *
         mt = (jl_value_t*)jl_method_table_for(unw);
     if (mt == jl_nothing)
         mt = NULL;
-    return ml_matches((jl_methtable_t*)mt, types, lim, include_ambiguous, 1, world, 1, min_valid, max_valid, ambig);
+    return ml_matches((jl_methtable_t*)mt, types, lim, include_ambiguous, 1, world, 1, 1, min_valid, max_valid, ambig);
 }
 
 jl_method_instance_t *jl_get_unspecialized_from_mi(jl_method_instance_t *method JL_PROPAGATES_ROOT)
@@ -2155,11 +2372,28 @@ jl_method_instance_t *jl_get_unspecialized(jl_method_t *def JL_PROPAGATES_ROOT)
 
 jl_code_instance_t *jl_method_compiled(jl_method_instance_t *mi, size_t world)
 {
+    // probe the thread-private cache first: long-running sessions accumulate
+    // many world-bounded entries per method instance, and repeated lookups of
+    // the same one (the common case on the compilation slow path) need not
+    // walk past them every time
+    jl_mi_cache_slot_t *slot = &jl_current_task->ptls->mi_cache[
+        (((uintptr_t)mi) / sizeof(void*)) & (JL_TLS_MI_CACHE_LEN - 1)];
+    if (slot->mi == mi && slot->world == world) {
+        jl_code_instance_t *ci = slot->ci;
+        // revalidate: the entry may have been invalidated since it was cached
+        if (ci->min_world <= world && world <= ci->max_world &&
+            jl_atomic_load_relaxed(&ci->invoke) != NULL)
+            return ci;
+    }
     jl_code_instance_t *codeinst = jl_atomic_load_relaxed(&mi->cache);
     while (codeinst) {
         if (codeinst->min_world <= world && world <= codeinst->max_world) {
-            if (jl_atomic_load_relaxed(&codeinst->invoke) != NULL)
+            if (jl_atomic_load_relaxed(&codeinst->invoke) != NULL) {
+                slot->mi = mi;
+                slot->world = world;
+                slot->ci = codeinst;
                 return codeinst;
+            }
         }
         codeinst = jl_atomic_load_relaxed(&codeinst->next);
     }
@@ -2235,7 +2469,8 @@ jl_code_instance_t *jl_compile_method_internal(jl_method_instance_t *mi, size_t
     if (jl_is_method(def)) {
         int mod_setting = jl_get_module_compile(((jl_method_t*)def)->module);
         if (mod_setting == JL_OPTIONS_COMPILE_OFF ||
-            mod_setting == JL_OPTIONS_COMPILE_MIN)
+            mod_setting == JL_OPTIONS_COMPILE_MIN ||
+            mod_setting == JL_OPTIONS_COMPILE_LAZY)
             compile_option = ((jl_method_t*)def)->module->compile;
     }
 
@@ -2284,6 +2519,21 @@ jl_code_instance_t *jl_compile_method_internal(jl_method_instance_t *mi, size_t
         }
     }
 
+    // hybrid execution: run in the interpreter for now, compile once the
+    // method has been called often enough (see jl_fptr_interpret_lazy)
+    if (compile_option == JL_OPTIONS_COMPILE_LAZY) {
+        jl_code_info_t *src = jl_code_for_interpreter(mi);
+        if (!jl_code_requires_compiler(src, 0)) {
+            jl_code_instance_t *codeinst = jl_new_codeinst(mi,
+                (jl_value_t*)jl_any_type, NULL, NULL,
+                0, 1, ~(size_t)0, 0, 0, jl_nothing, 0);
+            jl_atomic_store_relaxed(&codeinst->invoke, jl_fptr_interpret_lazy);
+            jl_mi_cache_insert(mi, codeinst);
+            return codeinst;
+        }
+        // source demands native code; fall through and compile eagerly
+    }
+
     codeinst = jl_generate_fptr(mi, world);
     if (!codeinst) {
         jl_method_instance_t *unspec = jl_get_unspecialized_from_mi(mi);
@@ -2664,12 +2914,28 @@ STATIC_INLINE jl_value_t *verify_type(jl_value_t *v) JL_NOTSAFEPOINT
 
 STATIC_INLINE jl_value_t *_jl_invoke(jl_value_t *F, jl_value_t **args, uint32_t nargs, jl_method_instance_t *mfunc, size_t world)
 {
-    // manually inlined copy of jl_method_compiled
+    // manually inlined copy of jl_method_compiled, including its
+    // thread-private lookup cache
+    jl_mi_cache_slot_t *slot = &jl_current_task->ptls->mi_cache[
+        (((uintptr_t)mfunc) / sizeof(void*)) & (JL_TLS_MI_CACHE_LEN - 1)];
+    if (slot->mi == mfunc && slot->world == world) {
+        jl_code_instance_t *ci = slot->ci;
+        if (ci->min_world <= world && world <= ci->max_world) {
+            jl_callptr_t invoke = jl_atomic_load_relaxed(&ci->invoke);
+            if (invoke != NULL) {
+                jl_value_t *res = invoke(F, args, nargs, ci);
+                return verify_type(res);
+            }
+        }
+    }
     jl_code_instance_t *codeinst = jl_atomic_load_relaxed(&mfunc->cache);
     while (codeinst) {
         if (codeinst->min_world <= world && world <= codeinst->max_world) {
             jl_callptr_t invoke = jl_atomic_load_relaxed(&codeinst->invoke);
             if (invoke != NULL) {
+                slot->mi = mfunc;
+                slot->world = world;
+                slot->ci = codeinst;
                 jl_value_t *res = invoke(F, args, nargs, codeinst);
                 return verify_type(res);
             }
@@ -2771,9 +3037,19 @@ STATIC_INLINE jl_method_instance_t *jl_lookup_generic_(jl_value_t *F, jl_value_t
         (callsite >> 8) & (N_CALL_CACHE - 1),
         (callsite >> 16) & (N_CALL_CACHE - 1),
         (callsite >> 24 | callsite << 8) & (N_CALL_CACHE - 1)};
-    jl_typemap_entry_t *entry = NULL;
+    // first probe the thread-private cache: a callsite that keeps hitting the
+    // same leaf signature never touches the shared cache lines
+    jl_ptls_t ptls = jl_current_task->ptls;
+    uint32_t tls_idx = (callsite ^ (callsite >> 16)) & (JL_TLS_CALL_CACHE_LEN - 1);
+    jl_typemap_entry_t *entry = ptls->call_cache[tls_idx];
     jl_methtable_t *mt = NULL;
     int i;
+    if (entry && nargs == jl_svec_len(entry->sig->parameters) &&
+        sig_match_fast(FT, args, jl_svec_data(entry->sig->parameters), nargs) &&
+        world >= entry->min_world && world <= entry->max_world) {
+        goto have_entry;
+    }
+    entry = NULL;
     // check each cache entry to see if it matches
     //#pragma unroll
     //for (i = 0; i < 4; i++) {
@@ -2833,17 +3109,19 @@ STATIC_INLINE jl_method_instance_t *jl_lookup_generic_(jl_value_t *F, jl_value_t
 
     jl_method_instance_t *mfunc;
     if (entry) {
+        // promote the hit into the thread-private cache, under the same
+        // leaf-signature restrictions as the shared cache
+        if (entry->isleafsig && entry->simplesig == (void*)jl_nothing && entry->guardsigs == jl_emptysvec)
+            ptls->call_cache[tls_idx] = entry;
 have_entry:
         mfunc = entry->func.linfo;
     }
     else {
         JL_GC_PUSH1(&tt);
         assert(tt);
-        JL_LOCK(&mt->writelock);
         // cache miss case
         JL_TIMING(METHOD_LOOKUP_SLOW);
         mfunc = jl_mt_assoc_by_type(mt, tt, world);
-        JL_UNLOCK(&mt->writelock);
         JL_GC_POP();
         if (jl_options.malloc_log)
             jl_gc_sync_total_bytes(last_alloc); // discard allocation count from compilation
@@ -2864,6 +3142,135 @@ have_entry:
     return mfunc;
 }
 
+// --- speculative re-specialization from runtime type feedback ---
+
+// When JULIA_TYPE_FEEDBACK is set, generic calls that dispatch to a method
+// instance with an abstract signature (a `@nospecialize` method or a widened
+// compilation signature) profile the concrete argument types they see. Once a
+// profile slot observes the same call signature JL_TYPE_FEEDBACK_THRESHOLD
+// times in a row, the concrete specialization is compiled and installed in
+// the dispatch cache ahead of the widened entry, so subsequent calls run
+// type-stable code. Like the lazy-compile counters in the interpreter, the
+// slots are shared on hash collisions: a collision can only delay (or
+// spuriously trigger) a re-specialization, never change a call target.
+typedef struct {
+    _Atomic(uintptr_t) sig;
+    _Atomic(uint32_t) count;
+} jl_type_feedback_slot_t;
+static jl_type_feedback_slot_t type_feedback_slots[N_TYPE_FEEDBACK_SLOTS];
+
+static int jl_type_feedback_enabled(void) JL_NOTSAFEPOINT
+{
+    static int enabled = -1;
+    if (enabled == -1) {
+        char *env = getenv("JULIA_TYPE_FEEDBACK");
+        enabled = env && atoi(env) > 0;
+    }
+    return enabled;
+}
+
+// Runtime-dispatch trace: when JULIA_DISPATCH_TRACE is set to a file name (or
+// "stderr"), every distinct method instance reached through runtime dispatch
+// is recorded and written out at exit as `precompile(...)` statements, in the
+// same format `--trace-compile` emits. Replaying that file as a warmup script
+// primes the cache for exactly the dispatch mix the traced run saw, including
+// targets that were already compiled and so never show up in a compile trace.
+// Recording inserts into a fixed-size lock-free hash set with a relaxed-CAS
+// probe, so the dispatch fast path never takes a lock.
+_Atomic(jl_method_instance_t*) dispatch_trace_set[N_DISPATCH_TRACE] JL_GLOBALLY_ROOTED;
+
+static int jl_dispatch_trace_enabled(void) JL_NOTSAFEPOINT
+{
+    static int enabled = -1;
+    if (enabled == -1)
+        enabled = getenv("JULIA_DISPATCH_TRACE") != NULL;
+    return enabled;
+}
+
+static void record_dispatch_trace(jl_method_instance_t *mi) JL_NOTSAFEPOINT
+{
+    if (!jl_is_method(mi->def.value))
+        return;
+    size_t i = inthash((uintptr_t)mi) & (N_DISPATCH_TRACE - 1);
+    for (size_t probes = 0; probes < N_DISPATCH_TRACE; probes++) {
+        jl_method_instance_t *seen = jl_atomic_load_relaxed(&dispatch_trace_set[i]);
+        if (seen == NULL) {
+            if (jl_atomic_cmpswap_relaxed(&dispatch_trace_set[i], &seen, mi))
+                return;
+            // lost the race; `seen` now holds the winner, fall through
+        }
+        if (seen == mi)
+            return;
+        i = (i + 1) & (N_DISPATCH_TRACE - 1);
+    }
+    // the set is full: drop the record rather than slow down dispatch
+}
+
+void jl_write_dispatch_trace(void)
+{
+    const char *t = getenv("JULIA_DISPATCH_TRACE");
+    if (t == NULL)
+        return;
+    ios_t f;
+    JL_STREAM *s = JL_STDERR;
+    if (strcmp(t, "stderr") != 0) {
+        if (ios_file(&f, t, 1, 1, 1, 1) == NULL) {
+            jl_safe_printf("WARNING: could not open dispatch trace file \"%s\" for writing\n", t);
+            return;
+        }
+        s = (JL_STREAM*)&f;
+    }
+    for (size_t i = 0; i < N_DISPATCH_TRACE; i++) {
+        jl_method_instance_t *mi = jl_atomic_load_relaxed(&dispatch_trace_set[i]);
+        if (mi == NULL || jl_has_free_typevars(mi->specTypes))
+            continue;
+        jl_printf(s, "precompile(");
+        jl_static_show(s, mi->specTypes);
+        jl_printf(s, ")\n");
+    }
+    if (s != JL_STDERR)
+        ios_close(&f);
+}
+
+static jl_method_instance_t *jl_respecialize_from_feedback(jl_value_t *F, jl_value_t **args, uint32_t nargs,
+                                                           jl_method_instance_t *mfunc, size_t world)
+{
+    jl_method_t *def = mfunc->def.method;
+    uintptr_t h = inthash((uintptr_t)jl_typeof(F));
+    for (uint32_t i = 0; i < nargs; i++)
+        h = bitmix(h, (uintptr_t)jl_typeof(args[i]));
+    if (h == 0)
+        h = 1;
+    jl_type_feedback_slot_t *slot = &type_feedback_slots[inthash((uintptr_t)mfunc) & (N_TYPE_FEEDBACK_SLOTS - 1)];
+    if (jl_atomic_load_relaxed(&slot->sig) != h) {
+        // first sighting, or the call site went polymorphic: restart the count
+        jl_atomic_store_relaxed(&slot->sig, h);
+        jl_atomic_store_relaxed(&slot->count, 1);
+        return mfunc;
+    }
+    if (jl_atomic_fetch_add_relaxed(&slot->count, 1) + 1 < JL_TYPE_FEEDBACK_THRESHOLD)
+        return mfunc;
+    // if anything below fails, retry only after another full batch
+    jl_atomic_store_relaxed(&slot->count, 0);
+    jl_method_instance_t *smi = NULL;
+    jl_tupletype_t *tt = NULL;
+    jl_svec_t *env = jl_emptysvec;
+    JL_GC_PUSH2(&tt, &env);
+    tt = arg_type_tuple(F, args, nargs + 1); // nargs + 1 counts F itself
+    if (tt->isdispatchtuple && !jl_egal((jl_value_t*)tt, mfunc->specTypes)) {
+        jl_value_t *ti = jl_type_intersection_env((jl_value_t*)tt, (jl_value_t*)def->sig, &env);
+        if (ti != jl_bottom_type) {
+            smi = jl_specializations_get_linfo(def, (jl_value_t*)tt, env);
+            // compile the concrete specialization now and make future
+            // dispatch of this signature prefer it over the widened entry
+            jl_compile_method_internal(smi, world);
+            jl_mt_cache_restore(tt, smi, world);
+        }
+    }
+    JL_GC_POP();
+    return smi == NULL ? mfunc : smi;
+}
+
 JL_DLLEXPORT jl_value_t *jl_apply_generic(jl_value_t *F, jl_value_t **args, uint32_t nargs)
 {
     size_t world = jl_current_task->world_age;
@@ -2871,9 +3278,121 @@ JL_DLLEXPORT jl_value_t *jl_apply_generic(jl_value_t *F, jl_value_t **args, uint
                                                      jl_int32hash_fast(jl_return_address()),
                                                      world);
     JL_GC_PROMISE_ROOTED(mfunc);
+    if (__unlikely(jl_dispatch_trace_enabled()))
+        record_dispatch_trace(mfunc);
+    if (__unlikely(jl_type_feedback_enabled()) && jl_is_method(mfunc->def.value) &&
+        (!jl_is_datatype(mfunc->specTypes) ||
+         !((jl_datatype_t*)mfunc->specTypes)->isdispatchtuple)) {
+        mfunc = jl_respecialize_from_feedback(F, args, nargs, mfunc, world);
+        JL_GC_PROMISE_ROOTED(mfunc);
+    }
+    return _jl_invoke(F, args, nargs, mfunc, world);
+}
+
+// serializes the write-once fill of call-site inline caches; fills are rare
+// (at most one per emitted call site), so a single global lock is fine
+static jl_mutex_t dispatch_cache_lock;
+
+// Slow path for the call-site inline caches emitted by codegen (see
+// `emit_apply_generic_with_cache`). `cache` is an svec of length nargs + 3
+// holding the type tags of F and args[0..nargs-1], the dispatch typemap entry,
+// and the dispatched-to code instance; all slots are initially `nothing`.
+// Perform normal generic dispatch, and on the first successful lookup fill the
+// cache so that the emitted guard can dispatch directly on subsequent calls.
+// The tags and the entry are published before the code instance, which is
+// release-stored last; the emitted guard acquire-loads the code instance
+// first, so a guard that observes it also observes the matching tags and
+// entry. The cache is filled at most once: a site whose entry or instance is
+// later invalidated falls back to plain dispatch for good.
+JL_DLLEXPORT jl_value_t *jl_apply_generic_cached(jl_value_t *F, jl_value_t **args, uint32_t nargs, jl_svec_t *cache)
+{
+    size_t world = jl_current_task->world_age;
+    jl_method_instance_t *mfunc = jl_lookup_generic_(F, args, nargs,
+                                                     jl_int32hash_fast(jl_return_address()),
+                                                     world);
+    JL_GC_PROMISE_ROOTED(mfunc);
+    if (__unlikely(jl_dispatch_trace_enabled()))
+        record_dispatch_trace(mfunc);
+    size_t n = jl_svec_len(cache) - 2;
+    assert(n == nargs + 1);
+    if (jl_svecref(cache, n + 1) == jl_nothing) {
+        // The guard must be keyed on the typemap entry for this signature,
+        // not just the code instance: inserting a more specific method
+        // truncates the entry's world bounds (`invalidate_mt_cache`) but
+        // leaves the shadowed method's code instances at max_world == ~0, so
+        // the instance's interval alone would keep hitting the old target.
+        // Redo the exact cache lookup that dispatch just warmed to find the
+        // entry; if it is not there (or disagrees with the dispatch result,
+        // e.g. after a racing invalidation), leave the cache unfilled.
+        jl_methtable_t *mt = jl_gf_mtable(F);
+        jl_typemap_entry_t *entry = NULL;
+        jl_array_t *leafcache = jl_atomic_load_relaxed(&mt->leafcache);
+        if (leafcache != (jl_array_t*)jl_an_empty_vec_any) {
+            jl_tupletype_t *tt = lookup_arg_type_tuple(F, args, nargs + 1);
+            if (tt != NULL)
+                entry = lookup_leafcache(leafcache, (jl_value_t*)tt, world);
+        }
+        if (entry == NULL)
+            entry = jl_typemap_assoc_exact(jl_atomic_load_relaxed(&mt->cache), F, args, nargs + 1, jl_cachearg_offset(mt), world);
+        // find a code instance we could cache: it must already have an entry
+        // point and cover the current world
+        jl_code_instance_t *codeinst = jl_atomic_load_relaxed(&mfunc->cache);
+        while (codeinst) {
+            if (codeinst->min_world <= world && world <= codeinst->max_world &&
+                    jl_atomic_load_relaxed(&codeinst->invoke) != NULL)
+                break;
+            codeinst = jl_atomic_load_relaxed(&codeinst->next);
+        }
+        if (entry != NULL && entry->func.linfo == mfunc && codeinst) {
+            JL_LOCK(&dispatch_cache_lock);
+            if (jl_svecref(cache, n + 1) == jl_nothing) {
+                jl_svecset(cache, 0, jl_typeof(F));
+                for (size_t i = 0; i < nargs; i++)
+                    jl_svecset(cache, i + 1, jl_typeof(args[i]));
+                jl_svecset(cache, n, (jl_value_t*)entry);
+                jl_atomic_store_release((_Atomic(jl_value_t*)*)&jl_svec_data(cache)[n + 1],
+                                        (jl_value_t*)codeinst);
+                jl_gc_wb(cache, codeinst);
+            }
+            JL_UNLOCK(&dispatch_cache_lock);
+        }
+    }
     return _jl_invoke(F, args, nargs, mfunc, world);
 }
 
+// Dispatch `F` over a batch of argument rows. `args` holds `nbatch`
+// consecutive rows of `nargs` arguments each and the result of row i is
+// stored in `results[i]`. The caller must keep `args` and `results` rooted
+// (e.g. backed by rooted arrays), since earlier results stay live in
+// `results` while later rows run.
+//
+// Dispatch cost is amortized across the batch by reusing the previous row's
+// method instance whenever the next row has the same concrete argument
+// types: dispatch depends only on those types, so a batch clustered by type
+// pays one lookup per cluster instead of one per element.
+JL_DLLEXPORT void jl_apply_generic_batch(jl_value_t *F, jl_value_t **args, uint32_t nargs,
+                                         size_t nbatch, jl_value_t **results)
+{
+    size_t world = jl_current_task->world_age;
+    uint32_t callsite = jl_int32hash_fast(jl_return_address());
+    jl_method_instance_t *mfunc = NULL;
+    jl_value_t **prev = NULL;
+    for (size_t i = 0; i < nbatch; i++) {
+        jl_value_t **row = &args[i * nargs];
+        int same = mfunc != NULL;
+        for (uint32_t j = 0; same && j < nargs; j++)
+            same = jl_typeof(row[j]) == jl_typeof(prev[j]);
+        if (!same) {
+            mfunc = jl_lookup_generic_(F, row, nargs, callsite, world);
+            if (__unlikely(jl_dispatch_trace_enabled()))
+                record_dispatch_trace(mfunc);
+        }
+        JL_GC_PROMISE_ROOTED(mfunc);
+        prev = row;
+        results[i] = _jl_invoke(F, row, nargs, mfunc, world);
+    }
+}
+
 static jl_method_match_t *_gf_invoke_lookup(jl_value_t *types JL_PROPAGATES_ROOT, jl_value_t *mt, size_t world, size_t *min_valid, size_t *max_valid)
 {
     jl_value_t *unw = jl_unwrap_unionall((jl_value_t*)types);
@@ -2885,7 +3404,7 @@ static jl_method_match_t *_gf_invoke_lookup(jl_value_t *types JL_PROPAGATES_ROOT
         mt = (jl_value_t*)jl_method_table_for(unw);
     if (mt == jl_nothing)
         mt = NULL;
-    jl_value_t *matches = ml_matches((jl_methtable_t*)mt, (jl_tupletype_t*)types, 1, 0, 0, world, 1, min_valid, max_valid, NULL);
+    jl_value_t *matches = ml_matches((jl_methtable_t*)mt, (jl_tupletype_t*)types, 1, 0, 0, world, 1, 0, min_valid, max_valid, NULL);
     if (matches == jl_nothing || jl_array_len(matches) != 1)
         return NULL;
     jl_method_match_t *matc = (jl_method_match_t*)jl_array_ptr_ref(matches, 0);
@@ -3091,6 +3610,67 @@ static int ml_mtable_visitor(jl_methtable_t *mt, void *env)
     return jl_typemap_intersection_visitor(jl_atomic_load_relaxed(&mt->defs), 0, (struct typemap_intersection_env*)env);
 }
 
+// Pack, for up to the first 8 non-vararg slots of a signature, one hash
+// byte of the slot's concrete type (0 when the slot is not concrete).
+// `*nfixed` gets the number of packed slots, with the high bit set when
+// the signature has a vararg or more slots than we track, i.e. when the
+// recorded arity is a lower bound rather than exact.
+static uint64_t sig_fingerprint(jl_value_t *sig, uint8_t *nfixed) JL_NOTSAFEPOINT
+{
+    sig = jl_unwrap_unionall(sig);
+    size_t np = jl_nparams(sig), k;
+    uint64_t fp = 0;
+    uint8_t nf = 0;
+    for (k = 0; k < np; k++) {
+        jl_value_t *elt = jl_tparam(sig, k);
+        if (jl_is_vararg(elt) || k >= 8) {
+            nf |= 0x80;
+            break;
+        }
+        nf++;
+        // kinds and Type{...} must stay unfingerprinted: Type{Int} and
+        // DataType are both concrete yet intersect, so the distinct-
+        // concrete-types-are-disjoint rule does not hold for them
+        if (jl_is_concrete_type(elt) && !jl_is_kind(elt) && !jl_is_type_type(elt))
+            fp |= (uint64_t)(uint8_t)((jl_datatype_t*)elt)->hash << (8 * k);
+    }
+    *nfixed = nf;
+    return fp;
+}
+
+// Returns 1 if the fingerprints prove the two signatures cannot intersect:
+// either both arities are exact and differ, or some common slot names two
+// distinct concrete types. Hash collisions and non-concrete slots only ever
+// cause a pair to be kept, never dropped.
+static int sig_fingerprint_disjoint(uint64_t fpa, uint8_t na, uint64_t fpb, uint8_t nb) JL_NOTSAFEPOINT
+{
+    uint8_t fixa = na & 0x7f, fixb = nb & 0x7f;
+    if (!(na & 0x80) && !(nb & 0x80) && fixa != fixb)
+        return 1;
+    size_t n = fixa < fixb ? fixa : fixb, k;
+    for (k = 0; k < n; k++) {
+        uint8_t a = (uint8_t)(fpa >> (8 * k));
+        uint8_t b = (uint8_t)(fpb >> (8 * k));
+        if (a && b && a != b)
+            return 1;
+    }
+    return 0;
+}
+
+// Optional bound on the work a single match query may spend scanning
+// typemaps, from JULIA_DISPATCH_BUDGET (typemap entries intersected per
+// query; unset or 0 means unlimited). Racing initializations all write the
+// same value, so no synchronization is needed.
+static size_t dispatch_budget(void)
+{
+    static volatile size_t budget = (size_t)-1; // (size_t)-1: not read yet
+    if (budget == (size_t)-1) {
+        char *cp = getenv("JULIA_DISPATCH_BUDGET");
+        budget = cp ? (size_t)strtoull(cp, NULL, 10) : 0;
+    }
+    return budget;
+}
+
 // This is the collect form of calling jl_typemap_intersection_visitor
 // with optimizations to skip fully shadowed methods.
 //
@@ -3104,6 +3684,7 @@ static int ml_mtable_visitor(jl_methtable_t *mt, void *env)
 static jl_value_t *ml_matches(jl_methtable_t *mt,
                               jl_tupletype_t *type, int lim, int include_ambiguous,
                               int intersections, size_t world, int cache_result,
+                              int budgeted,
                               size_t *min_valid, size_t *max_valid, int *ambig)
 {
     int has_ambiguity = 0;
@@ -3122,6 +3703,13 @@ static jl_value_t *ml_matches(jl_methtable_t *mt,
             /* .ti = */ NULL, /* .env = */ jl_emptysvec, /* .issubty = */ 0},
         intersections, world, lim, /* .t = */ jl_an_empty_vec_any,
         /* .min_valid = */ *min_valid, /* .max_valid = */ *max_valid, /* .matc = */ NULL};
+    // only budget-limit queries whose caller tolerates overflow (`budgeted`,
+    // which implies `lim >= 0`): reflection (`lim == -1`) must stay exact,
+    // and the runtime dispatch lookup (_gf_invoke_lookup) turns an empty
+    // result into a MethodError, so a blown budget there would raise a
+    // spurious error for a call that has a valid method
+    if (budgeted && lim >= 0)
+        env.match.budget = dispatch_budget();
     struct jl_typemap_assoc search = {(jl_value_t*)type, world, jl_emptysvec, 1, ~(size_t)0};
     jl_value_t *isect2 = NULL;
     JL_GC_PUSH6(&env.t, &env.matc, &env.match.env, &search.env, &env.match.ti, &isect2);
@@ -3345,6 +3933,15 @@ static jl_value_t *ml_matches(jl_methtable_t *mt,
             uint32_t *ambig_groupid = (uint32_t*)alloca(len * sizeof(uint32_t));
             for (i = 0; i < len; i++)
                 ambig_groupid[i] = i;
+            // precompute a per-signature dispatch fingerprint so that
+            // provably disjoint pairs skip the expensive specificity and
+            // intersection queries in the quadratic loop below
+            uint64_t *sigfp = (uint64_t*)alloca(len * sizeof(uint64_t));
+            uint8_t *signfixed = (uint8_t*)alloca(len);
+            for (i = 0; i < len; i++) {
+                jl_method_match_t *matc = (jl_method_match_t*)jl_array_ptr_ref(env.t, i);
+                sigfp[i] = sig_fingerprint((jl_value_t*)matc->method->sig, &signfixed[i]);
+            }
             // as we go, keep a rough count of how many methods are disjoint, which
             // gives us a lower bound on how many methods we will be returning
             // and lets us stop early if we reach our limit
@@ -3371,6 +3968,8 @@ static jl_value_t *ml_matches(jl_methtable_t *mt,
                     jl_method_match_t *matc2 = (jl_method_match_t*)jl_array_ptr_ref(env.t, j - 1);
                     // can't use skip[j - 1] here, since we still need to make sure the minmax dominates
                     jl_method_t *m2 = matc2->method;
+                    if (sig_fingerprint_disjoint(sigfp[i], signfixed[i], sigfp[j - 1], signfixed[j - 1]))
+                        continue; // provably disjoint: no ambiguity and nothing to group
                     int subt2 = matc2->fully_covers == FULLY_COVERS; // jl_subtype((jl_value_t*)type, (jl_value_t*)m2->sig)
                     int rsubt2 = jl_egal((jl_value_t*)matc2->spec_types, m2->sig);
                     jl_value_t *ti;
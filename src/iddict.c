@@ -192,5 +192,195 @@ size_t jl_eqtable_nextind(jl_array_t *t, size_t i)
     return i;
 }
 
+// Compact eq-table: a dense, insertion-ordered vector of key/value pairs plus
+// a separate int32 index table mapping hash slots to 1-based pair indices
+// (0 = empty, -1 = deleted). Iterating one of these touches `2 * count` slots
+// instead of the whole hash capacity, which matters for tables that are
+// walked much more often than they are probed, e.g. invalidation sweeps over
+// session caches. The wrapper array `t` holds [indices, pairs] and is never
+// reallocated, so callers only need to keep `t` itself rooted. As with
+// `jl_eqtable_put`, `key` and `val` must be rooted across insertion.
+
+#define DENSEIDTABLE_DELETED (-1)
+
+// shift live pairs down over deleted ones; no write barrier is needed since
+// the values only move within the same array
+static void dense_idtable_compact(jl_array_t *pairs) JL_NOTSAFEPOINT
+{
+    size_t i, j = 0, n = jl_array_len(pairs);
+    jl_value_t **d = (jl_value_t**)pairs->data;
+    for (i = 0; i < n; i += 2) {
+        if (d[i + 1] == NULL)
+            continue;
+        if (i != j) {
+            d[j] = d[i];
+            d[j + 1] = d[i + 1];
+        }
+        j += 2;
+    }
+    if (j < n)
+        jl_array_del_end(pairs, n - j);
+}
+
+static void dense_idtable_rehash(jl_array_t *t, size_t newsz)
+{
+    jl_array_t *pairs = (jl_array_t*)jl_array_ptr_ref(t, 1);
+    dense_idtable_compact(pairs);
+    jl_array_t *idxs = jl_alloc_array_1d(jl_array_int32_type, newsz);
+    memset(idxs->data, 0, newsz * sizeof(int32_t));
+    jl_array_ptr_set(t, 0, (jl_value_t*)idxs);
+    int32_t *tab = (int32_t*)idxs->data;
+    size_t maxprobe = max_probe(newsz);
+    size_t i, n = jl_array_len(pairs);
+    for (i = 0; i < n; i += 2) {
+        uint_t hv = keyhash(((jl_value_t**)pairs->data)[i]);
+        size_t index = hv & (newsz - 1);
+        size_t iter = 0;
+        while (tab[index] != 0) {
+            index = (index + 1) & (newsz - 1);
+            if (++iter > maxprobe) {
+                // ran out of probe distance; grow again and start over
+                dense_idtable_rehash(t, newsz * 2);
+                return;
+            }
+        }
+        tab[index] = (int32_t)(i / 2 + 1);
+    }
+}
+
+JL_DLLEXPORT jl_array_t *jl_denseidtable_new(size_t sz)
+{
+    sz = sz <= HT_N_INLINE ? HT_N_INLINE : next_power_of_two(sz);
+    jl_array_t *t = jl_alloc_vec_any(2);
+    JL_GC_PUSH1(&t);
+    jl_array_t *idxs = jl_alloc_array_1d(jl_array_int32_type, sz);
+    memset(idxs->data, 0, sz * sizeof(int32_t));
+    jl_array_ptr_set(t, 0, (jl_value_t*)idxs);
+    jl_array_ptr_set(t, 1, (jl_value_t*)jl_alloc_vec_any(0));
+    JL_GC_POP();
+    return t;
+}
+
+JL_DLLEXPORT void jl_denseidtable_put(jl_array_t *t, jl_value_t *key, jl_value_t *val, int *p_inserted)
+{
+    jl_array_t *idxs = (jl_array_t*)jl_array_ptr_ref(t, 0);
+    jl_array_t *pairs = (jl_array_t*)jl_array_ptr_ref(t, 1);
+    size_t sz = jl_array_len(idxs);
+    size_t maxprobe = max_probe(sz);
+    int32_t *tab = (int32_t*)idxs->data;
+    uint_t hv = keyhash(key);
+    size_t index = hv & (sz - 1);
+    size_t iter = 0;
+    size_t free_slot = (size_t)-1;
+    while (1) {
+        int32_t v = tab[index];
+        if (v == 0) {
+            if (free_slot == (size_t)-1)
+                free_slot = index;
+            break;
+        }
+        if (v == DENSEIDTABLE_DELETED) {
+            // remember the slot, but keep looking in case the key is further on
+            if (free_slot == (size_t)-1)
+                free_slot = index;
+        }
+        else if (jl_egal(key, ((jl_value_t**)pairs->data)[2 * (size_t)(v - 1)])) {
+            jl_array_ptr_set(pairs, 2 * (size_t)(v - 1) + 1, val);
+            if (p_inserted)
+                *p_inserted = 0;
+            return;
+        }
+        index = (index + 1) & (sz - 1);
+        if (++iter > maxprobe)
+            break;
+    }
+    if (free_slot == (size_t)-1) {
+        dense_idtable_rehash(t, sz * 2);
+        jl_denseidtable_put(t, key, val, p_inserted);
+        return;
+    }
+    jl_array_ptr_1d_push(pairs, key);
+    jl_array_ptr_1d_push(pairs, val);
+    tab[free_slot] = (int32_t)(jl_array_len(pairs) / 2);
+    if (p_inserted)
+        *p_inserted = 1;
+}
+
+static jl_value_t **dense_idtable_peek_bp(jl_array_t *t, jl_value_t *key) JL_NOTSAFEPOINT
+{
+    jl_array_t *idxs = (jl_array_t*)jl_array_ptr_ref(t, 0);
+    jl_array_t *pairs = (jl_array_t*)jl_array_ptr_ref(t, 1);
+    size_t sz = jl_array_len(idxs);
+    size_t maxprobe = max_probe(sz);
+    int32_t *tab = (int32_t*)idxs->data;
+    uint_t hv = keyhash(key);
+    size_t index = hv & (sz - 1);
+    size_t iter = 0;
+    do {
+        int32_t v = tab[index];
+        if (v == 0)
+            return NULL;
+        if (v != DENSEIDTABLE_DELETED &&
+            jl_egal(key, ((jl_value_t**)pairs->data)[2 * (size_t)(v - 1)]))
+            return &((jl_value_t**)pairs->data)[2 * (size_t)(v - 1) + 1];
+        index = (index + 1) & (sz - 1);
+    } while (++iter <= maxprobe);
+    return NULL;
+}
+
+JL_DLLEXPORT jl_value_t *jl_denseidtable_get(jl_array_t *t, jl_value_t *key, jl_value_t *deflt) JL_NOTSAFEPOINT
+{
+    jl_value_t **bp = dense_idtable_peek_bp(t, key);
+    return (bp == NULL) ? deflt : *bp;
+}
+
+JL_DLLEXPORT jl_value_t *jl_denseidtable_pop(jl_array_t *t, jl_value_t *key, jl_value_t *deflt, int *found)
+{
+    jl_array_t *idxs = (jl_array_t*)jl_array_ptr_ref(t, 0);
+    jl_array_t *pairs = (jl_array_t*)jl_array_ptr_ref(t, 1);
+    size_t sz = jl_array_len(idxs);
+    size_t maxprobe = max_probe(sz);
+    int32_t *tab = (int32_t*)idxs->data;
+    uint_t hv = keyhash(key);
+    size_t index = hv & (sz - 1);
+    size_t iter = 0;
+    do {
+        int32_t v = tab[index];
+        if (v == 0)
+            break;
+        if (v != DENSEIDTABLE_DELETED) {
+            jl_value_t **d = &((jl_value_t**)pairs->data)[2 * (size_t)(v - 1)];
+            if (jl_egal(key, d[0])) {
+                jl_value_t *val = d[1];
+                d[0] = jl_nothing; // globally rooted, no write barrier needed
+                d[1] = NULL;
+                tab[index] = DENSEIDTABLE_DELETED;
+                if (found)
+                    *found = 1;
+                return val;
+            }
+        }
+        index = (index + 1) & (sz - 1);
+    } while (++iter <= maxprobe);
+    if (found)
+        *found = 0;
+    return deflt;
+}
+
+// iterate over the dense pair vector, skipping deleted entries
+JL_DLLEXPORT size_t jl_denseidtable_nextind(jl_array_t *t, size_t i)
+{
+    jl_array_t *pairs = (jl_array_t*)jl_array_ptr_ref(t, 1);
+    if (i & 1)
+        i++;
+    size_t alen = jl_array_dim0(pairs);
+    while (i < alen && ((void**)pairs->data)[i + 1] == NULL)
+        i += 2;
+    if (i >= alen)
+        return (size_t)-1;
+    return i;
+}
+
+#undef DENSEIDTABLE_DELETED
 #undef hash_size
 #undef max_probe
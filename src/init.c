@@ -265,6 +265,7 @@ JL_DLLEXPORT void jl_atexit_hook(int exitcode) JL_NOTSAFEPOINT_ENTER
         jl_write_coverage_data(jl_options.output_code_coverage);
     if (jl_options.malloc_log)
         jl_write_malloc_log();
+    jl_write_dispatch_trace();
 
     if (jl_base_module) {
         jl_value_t *f = jl_get_global(jl_base_module, jl_symbol("_atexit"));
@@ -793,6 +794,7 @@ JL_DLLEXPORT void julia_init(JL_IMAGE_SEARCH rel)
     }
 
     jl_init_rand();
+    jl_memops_init();
     jl_init_runtime_ccall();
     jl_init_tasks();
     jl_init_threading();
@@ -828,6 +830,9 @@ static NOINLINE void _finish_julia_init(JL_IMAGE_SEARCH rel, jl_ptls_t ptls, jl_
     jl_init_codegen();
 
     if (jl_options.image_file) {
+        // worker OS threads only park until jl_release_threads below, so
+        // their creation can overlap the sysimage restore
+        jl_spawn_threads();
         jl_restore_system_image(jl_options.image_file);
     } else {
         jl_init_types();
@@ -851,10 +856,11 @@ static NOINLINE void _finish_julia_init(JL_IMAGE_SEARCH rel, jl_ptls_t ptls, jl_
     }
 
     if (jl_base_module == NULL) {
-        // nthreads > 1 requires code in Base
+        // nthreads > 1 requires code in Base; workers spawned above notice
+        // the reduced count when released and exit without initializing
         jl_atomic_store_relaxed(&jl_n_threads, 1);
     }
-    jl_start_threads();
+    jl_release_threads();
 
     jl_gc_enable(1);
 
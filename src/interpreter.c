@@ -2,6 +2,7 @@
 
 #include <stdlib.h>
 #include <setjmp.h>
+#include <signal.h>
 #ifdef _OS_WINDOWS_
 #include <malloc.h>
 #endif
@@ -23,6 +24,7 @@ typedef struct {
     size_t ip; // Leak the currently-evaluating statement index to backtrace capture
     int preevaluation; // use special rules for pre-evaluating expressions (deprecated--only for ccall handling)
     int continue_at; // statement index to jump to after leaving exception handler (0 if none)
+    uint8_t *stmt_kinds; // statement kinds (`enum eval_stmt_kinds`), classified lazily, or NULL
 } interpreter_state;
 
 
@@ -426,11 +428,121 @@ static size_t eval_phi(jl_array_t *stmts, interpreter_state *s, size_t ns, size_
     return ip;
 }
 
+// Statement kinds for the dispatch in `eval_body`. Classifying a statement
+// means running the type tests (and, for exprs, the head comparisons) that the
+// statement loop used to redo on every visit; the result is one byte per
+// statement, cached in the frame so statements revisited by loops dispatch on
+// the cached byte alone. ISTMT_UNKNOWN is zero so a zero-filled cache means
+// "not classified yet".
+enum eval_stmt_kinds {
+    ISTMT_UNKNOWN = 0,
+    ISTMT_GOTO,
+    ISTMT_GOTOIFNOT,
+    ISTMT_RETURN,
+    ISTMT_UPSILON,
+    ISTMT_ASSIGN,
+    ISTMT_ENTER,
+    ISTMT_LEAVE,
+    ISTMT_POP_EXCEPTION,
+    ISTMT_EXPR_OTHER, // non-control-flow exprs, incl. the toplevel-only forms
+    ISTMT_NEWVAR,
+    ISTMT_LINE,
+    ISTMT_OTHER, // a plain value, evaluated for its ssavalue slot
+};
+
+static uint8_t eval_stmt_kind(jl_value_t *stmt) JL_NOTSAFEPOINT
+{
+    if (jl_is_gotonode(stmt))
+        return ISTMT_GOTO;
+    if (jl_is_gotoifnot(stmt))
+        return ISTMT_GOTOIFNOT;
+    if (jl_is_returnnode(stmt))
+        return ISTMT_RETURN;
+    if (jl_is_upsilonnode(stmt))
+        return ISTMT_UPSILON;
+    if (jl_is_expr(stmt)) {
+        jl_sym_t *head = ((jl_expr_t*)stmt)->head;
+        if (head == jl_assign_sym)
+            return ISTMT_ASSIGN;
+        if (head == jl_enter_sym)
+            return ISTMT_ENTER;
+        if (head == jl_leave_sym)
+            return ISTMT_LEAVE;
+        if (head == jl_pop_exception_sym)
+            return ISTMT_POP_EXCEPTION;
+        return ISTMT_EXPR_OTHER;
+    }
+    if (jl_is_newvarnode(stmt))
+        return ISTMT_NEWVAR;
+    if (jl_is_linenode(stmt))
+        return ISTMT_LINE;
+    return ISTMT_OTHER;
+}
+
+// Classifying every statement again on each call makes an interpreted call
+// pay O(nstmts) of frame setup before executing anything, which is what
+// dominates deeply recursive interpreted code. Keep the most recent
+// classification on the thread (rooted by jl_gc_queue_thread_local) and seed
+// new frames from it, so recursion over the same body costs a memcpy instead
+// of re-deriving each kind. One entry suffices: interpreted call stacks are
+// dominated by a few hot bodies, and a miss costs exactly what the uncached
+// path did.
+static void seed_stmt_kinds(uint8_t *kinds, jl_array_t *stmts) JL_NOTSAFEPOINT
+{
+    jl_ptls_t ptls = jl_current_task->ptls;
+    if (ptls->interp_kind_code == (jl_value_t*)stmts) {
+        memcpy(kinds, ptls->interp_kinds, jl_array_len(stmts));
+        return;
+    }
+    memset(kinds, ISTMT_UNKNOWN, jl_array_len(stmts));
+}
+
+static void save_stmt_kinds(uint8_t *kinds, jl_array_t *stmts) JL_NOTSAFEPOINT
+{
+    jl_ptls_t ptls = jl_current_task->ptls;
+    size_t ns = jl_array_len(stmts);
+    if (ptls->interp_kinds_len < ns) {
+        free(ptls->interp_kinds);
+        ptls->interp_kinds = (uint8_t*)malloc_s(ns);
+        ptls->interp_kinds_len = ns;
+    }
+    // a frame seeded from a matching entry only adds classifications, so a
+    // plain copy never loses information for the hot (recursive) case
+    ptls->interp_kind_code = (jl_value_t*)stmts;
+    memcpy(ptls->interp_kinds, kinds, ns);
+}
+
+// With gcc/clang, dispatch over the cached statement kinds with a computed
+// goto so each kind gets a direct jump instead of going through the compare
+// chain; everywhere else (including the GC analyzer, which does not explore
+// indirect gotos) fall back to a plain switch over the same kinds.
+#if (defined(_COMPILER_GCC_) || defined(_COMPILER_CLANG_)) && !defined(__clang_gcanalyzer__)
+#define STMT_SWITCH(kind)  goto *stmt_labels[kind];
+#define STMT_CASE(name)    eval_##name
+#define STMT_NEXT()        goto next_stmt
+#define STMT_SWITCH_END()  next_stmt:;
+#else
+#define STMT_SWITCH(kind)  switch (kind)
+#define STMT_CASE(name)    case ISTMT_##name
+#define STMT_NEXT()        break
+#define STMT_SWITCH_END()
+#endif
+
 static jl_value_t *eval_body(jl_array_t *stmts, interpreter_state *s, size_t ip, int toplevel)
 {
     jl_handler_t __eh;
     size_t ns = jl_array_len(stmts);
     jl_task_t *ct = jl_current_task;
+    uint8_t *kinds = s->stmt_kinds;
+#if (defined(_COMPILER_GCC_) || defined(_COMPILER_CLANG_)) && !defined(__clang_gcanalyzer__)
+    // one entry per `enum eval_stmt_kinds`, in order
+    static const void *const stmt_labels[] = {
+        &&eval_UNKNOWN, &&eval_GOTO, &&eval_GOTOIFNOT, &&eval_RETURN,
+        &&eval_UPSILON, &&eval_ASSIGN, &&eval_ENTER, &&eval_LEAVE,
+        &&eval_POP_EXCEPTION, &&eval_EXPR_OTHER, &&eval_NEWVAR, &&eval_LINE,
+        &&eval_OTHER,
+    };
+#endif
 
     while (1) {
         s->ip = ip;
@@ -439,13 +551,20 @@ static jl_value_t *eval_body(jl_array_t *stmts, interpreter_state *s, size_t ip,
         if (toplevel)
             ct->world_age = jl_atomic_load_acquire(&jl_world_counter);
         jl_value_t *stmt = jl_array_ptr_ref(stmts, ip);
-        assert(!jl_is_phinode(stmt));
-        size_t next_ip = ip + 1;
         assert(!jl_is_phinode(stmt) && !jl_is_phicnode(stmt) && "malformed IR");
-        if (jl_is_gotonode(stmt)) {
+        size_t next_ip = ip + 1;
+        uint8_t kind = kinds ? kinds[ip] : ISTMT_UNKNOWN;
+        if (kind == ISTMT_UNKNOWN) {
+            kind = eval_stmt_kind(stmt);
+            if (kinds)
+                kinds[ip] = kind;
+        }
+        STMT_SWITCH (kind) {
+        STMT_CASE(GOTO): {
             next_ip = jl_gotonode_label(stmt) - 1;
+            STMT_NEXT();
         }
-        else if (jl_is_gotoifnot(stmt)) {
+        STMT_CASE(GOTOIFNOT): {
             jl_value_t *cond = eval_value(jl_gotoifnot_cond(stmt), s);
             if (cond == jl_false) {
                 next_ip = jl_gotoifnot_label(stmt) - 1;
@@ -453,11 +572,12 @@ static jl_value_t *eval_body(jl_array_t *stmts, interpreter_state *s, size_t ip,
             else if (cond != jl_true) {
                 jl_type_error("if", (jl_value_t*)jl_bool_type, cond);
             }
+            STMT_NEXT();
         }
-        else if (jl_is_returnnode(stmt)) {
+        STMT_CASE(RETURN): {
             return eval_value(jl_returnnode_value(stmt), s);
         }
-        else if (jl_is_upsilonnode(stmt)) {
+        STMT_CASE(UPSILON): {
             jl_value_t *val = jl_fieldref_noalloc(stmt, 0);
             if (val)
                 val = eval_value(val, s);
@@ -465,98 +585,113 @@ static jl_value_t *eval_body(jl_array_t *stmts, interpreter_state *s, size_t ip,
             assert(jl_is_ssavalue(phic));
             ssize_t id = ((jl_ssavalue_t*)phic)->id - 1;
             s->locals[jl_source_nslots(s->src) + id] = val;
+            STMT_NEXT();
         }
-        else if (jl_is_expr(stmt)) {
-            // Most exprs are allowed to end a BB by fall through
-            jl_sym_t *head = ((jl_expr_t*)stmt)->head;
-            if (head == jl_assign_sym) {
-                jl_value_t *lhs = jl_exprarg(stmt, 0);
-                jl_value_t *rhs = eval_value(jl_exprarg(stmt, 1), s);
-                if (jl_is_slot(lhs)) {
-                    ssize_t n = jl_slot_number(lhs);
-                    assert(n <= jl_source_nslots(s->src) && n > 0);
-                    s->locals[n - 1] = rhs;
+        // Most exprs are allowed to end a BB by fall through
+        STMT_CASE(ASSIGN): {
+            jl_value_t *lhs = jl_exprarg(stmt, 0);
+            jl_value_t *rhs = eval_value(jl_exprarg(stmt, 1), s);
+            if (jl_is_slot(lhs)) {
+                ssize_t n = jl_slot_number(lhs);
+                assert(n <= jl_source_nslots(s->src) && n > 0);
+                s->locals[n - 1] = rhs;
+            }
+            else {
+                jl_module_t *modu;
+                jl_sym_t *sym;
+                if (jl_is_globalref(lhs)) {
+                    modu = jl_globalref_mod(lhs);
+                    sym = jl_globalref_name(lhs);
                 }
                 else {
-                    jl_module_t *modu;
-                    jl_sym_t *sym;
-                    if (jl_is_globalref(lhs)) {
-                        modu = jl_globalref_mod(lhs);
-                        sym = jl_globalref_name(lhs);
-                    }
-                    else {
-                        assert(jl_is_symbol(lhs));
-                        modu = s->module;
-                        sym = (jl_sym_t*)lhs;
-                    }
-                    JL_GC_PUSH1(&rhs);
-                    jl_binding_t *b = jl_get_binding_wr(modu, sym);
-                    jl_checked_assignment(b, modu, sym, rhs);
-                    JL_GC_POP();
+                    assert(jl_is_symbol(lhs));
+                    modu = s->module;
+                    sym = (jl_sym_t*)lhs;
                 }
+                JL_GC_PUSH1(&rhs);
+                jl_binding_t *b = jl_get_binding_wr(modu, sym);
+                jl_checked_assignment(b, modu, sym, rhs);
+                JL_GC_POP();
             }
-            else if (head == jl_enter_sym) {
-                jl_enter_handler(&__eh);
-                // This is a bit tricky, but supports the implementation of PhiC nodes.
-                // They are conceptually slots, but the slot to store to doesn't get explicitly
-                // mentioned in the store (aka the "UpsilonNode") (this makes them integrate more
-                // nicely with the rest of the SSA representation). In a compiler, we would figure
-                // out which slot to store to at compile time when we encounter the statement. We
-                // can't quite do that here, but we do something similar: We scan the catch entry
-                // block (the only place where PhiC nodes may occur) to find all the Upsilons we
-                // can possibly encounter. Then, we remember which slot they store to (we abuse the
-                // SSA value result array for this purpose). TODO: We could do this only the first
-                // time we encounter a given enter.
-                size_t catch_ip = jl_unbox_long(jl_exprarg(stmt, 0)) - 1;
-                while (catch_ip < ns) {
-                    jl_value_t *phicnode = jl_array_ptr_ref(stmts, catch_ip);
-                    if (!jl_is_phicnode(phicnode))
-                        break;
-                    jl_array_t *values = (jl_array_t*)jl_fieldref_noalloc(phicnode, 0);
-                    for (size_t i = 0; i < jl_array_len(values); ++i) {
-                        jl_value_t *val = jl_array_ptr_ref(values, i);
-                        assert(jl_is_ssavalue(val));
-                        size_t upsilon = ((jl_ssavalue_t*)val)->id - 1;
-                        assert(jl_is_upsilonnode(jl_array_ptr_ref(stmts, upsilon)));
-                        s->locals[jl_source_nslots(s->src) + upsilon] = jl_box_ssavalue(catch_ip + 1);
-                    }
-                    s->locals[jl_source_nslots(s->src) + catch_ip] = NULL;
-                    catch_ip += 1;
-                }
-                // store current top of exception stack for restore in pop_exception.
-                s->locals[jl_source_nslots(s->src) + ip] = jl_box_ulong(jl_excstack_state());
-                if (!jl_setjmp(__eh.eh_ctx, 1)) {
-                    return eval_body(stmts, s, next_ip, toplevel);
-                }
-                else if (s->continue_at) { // means we reached a :leave expression
-                    ip = s->continue_at;
-                    s->continue_at = 0;
-                    continue;
-                }
-                else { // a real exception
-                    ip = catch_ip;
-                    continue;
+            STMT_NEXT();
+        }
+        STMT_CASE(ENTER): {
+            jl_enter_handler(&__eh);
+            // This is a bit tricky, but supports the implementation of PhiC nodes.
+            // They are conceptually slots, but the slot to store to doesn't get explicitly
+            // mentioned in the store (aka the "UpsilonNode") (this makes them integrate more
+            // nicely with the rest of the SSA representation). In a compiler, we would figure
+            // out which slot to store to at compile time when we encounter the statement. We
+            // can't quite do that here, but we do something similar: We scan the catch entry
+            // block (the only place where PhiC nodes may occur) to find all the Upsilons we
+            // can possibly encounter. Then, we remember which slot they store to (we abuse the
+            // SSA value result array for this purpose). TODO: We could do this only the first
+            // time we encounter a given enter.
+            size_t catch_ip = jl_unbox_long(jl_exprarg(stmt, 0)) - 1;
+            while (catch_ip < ns) {
+                jl_value_t *phicnode = jl_array_ptr_ref(stmts, catch_ip);
+                if (!jl_is_phicnode(phicnode))
+                    break;
+                jl_array_t *values = (jl_array_t*)jl_fieldref_noalloc(phicnode, 0);
+                for (size_t i = 0; i < jl_array_len(values); ++i) {
+                    jl_value_t *val = jl_array_ptr_ref(values, i);
+                    assert(jl_is_ssavalue(val));
+                    size_t upsilon = ((jl_ssavalue_t*)val)->id - 1;
+                    assert(jl_is_upsilonnode(jl_array_ptr_ref(stmts, upsilon)));
+                    s->locals[jl_source_nslots(s->src) + upsilon] = jl_box_ssavalue(catch_ip + 1);
                 }
+                s->locals[jl_source_nslots(s->src) + catch_ip] = NULL;
+                catch_ip += 1;
             }
-            else if (head == jl_leave_sym) {
-                int hand_n_leave = jl_unbox_long(jl_exprarg(stmt, 0));
-                assert(hand_n_leave > 0);
-                // equivalent to jl_pop_handler(hand_n_leave), but retaining eh for longjmp:
-                jl_handler_t *eh = ct->eh;
-                while (--hand_n_leave > 0)
-                    eh = eh->prev;
-                jl_eh_restore_state(eh);
-                // leave happens during normal control flow, but we must
-                // longjmp to pop the eval_body call for each enter.
-                s->continue_at = next_ip;
-                asan_unpoison_task_stack(ct, &eh->eh_ctx);
-                jl_longjmp(eh->eh_ctx, 1);
+            // store current top of exception stack for restore in pop_exception.
+            s->locals[jl_source_nslots(s->src) + ip] = jl_box_ulong(jl_excstack_state());
+#ifdef JL_SETJMP_IGNORES_SAVEMASK
+            // jl_fast_setjmp drops the save-mask semantics this site got
+            // from sigsetjmp(buf, 1): a signal handler can longjmp here
+            // with its signal still blocked, so reproduce them by saving
+            // the mask now and restoring it on the nonlocal returns below
+            // (both always arrive via jl_longjmp, never by falling through)
+            sigset_t savedmask;
+            pthread_sigmask(SIG_SETMASK, NULL, &savedmask);
+#endif
+            if (!jl_setjmp(__eh.eh_ctx, 1)) {
+                return eval_body(stmts, s, next_ip, toplevel);
+            }
+#ifdef JL_SETJMP_IGNORES_SAVEMASK
+            pthread_sigmask(SIG_SETMASK, &savedmask, NULL);
+#endif
+            if (s->continue_at) { // means we reached a :leave expression
+                ip = s->continue_at;
+                s->continue_at = 0;
+                continue;
             }
-            else if (head == jl_pop_exception_sym) {
-                size_t prev_state = jl_unbox_ulong(eval_value(jl_exprarg(stmt, 0), s));
-                jl_restore_excstack(prev_state);
+            else { // a real exception
+                ip = catch_ip;
+                continue;
             }
-            else if (toplevel) {
+        }
+        STMT_CASE(LEAVE): {
+            int hand_n_leave = jl_unbox_long(jl_exprarg(stmt, 0));
+            assert(hand_n_leave > 0);
+            // equivalent to jl_pop_handler(hand_n_leave), but retaining eh for longjmp:
+            jl_handler_t *eh = ct->eh;
+            while (--hand_n_leave > 0)
+                eh = eh->prev;
+            jl_eh_restore_state(eh);
+            // leave happens during normal control flow, but we must
+            // longjmp to pop the eval_body call for each enter.
+            s->continue_at = next_ip;
+            asan_unpoison_task_stack(ct, &eh->eh_ctx);
+            jl_longjmp(eh->eh_ctx, 1);
+        }
+        STMT_CASE(POP_EXCEPTION): {
+            size_t prev_state = jl_unbox_ulong(eval_value(jl_exprarg(stmt, 0), s));
+            jl_restore_excstack(prev_state);
+            STMT_NEXT();
+        }
+        STMT_CASE(EXPR_OTHER): {
+            if (toplevel) {
+                jl_sym_t *head = ((jl_expr_t*)stmt)->head;
                 if (head == jl_method_sym && jl_expr_nargs(stmt) > 1) {
                     eval_methoddef((jl_expr_t*)stmt, s);
                 }
@@ -605,20 +740,30 @@ static jl_value_t *eval_body(jl_array_t *stmts, interpreter_state *s, size_t ip,
             else {
                 eval_stmt_value(stmt, s);
             }
+            STMT_NEXT();
         }
-        else if (jl_is_newvarnode(stmt)) {
+        STMT_CASE(NEWVAR): {
             jl_value_t *var = jl_fieldref(stmt, 0);
             assert(jl_is_slot(var));
             ssize_t n = jl_slot_number(var);
             assert(n <= jl_source_nslots(s->src) && n > 0);
             s->locals[n - 1] = NULL;
+            STMT_NEXT();
         }
-        else if (toplevel && jl_is_linenode(stmt)) {
-            jl_lineno = jl_linenode_line(stmt);
+        STMT_CASE(LINE): {
+            if (toplevel)
+                jl_lineno = jl_linenode_line(stmt);
+            else
+                eval_stmt_value(stmt, s);
+            STMT_NEXT();
         }
-        else {
+        STMT_CASE(UNKNOWN):
+        STMT_CASE(OTHER): {
             eval_stmt_value(stmt, s);
+            STMT_NEXT();
+        }
         }
+        STMT_SWITCH_END()
         ip = eval_phi(stmts, s, ns, next_ip);
     }
     abort();
@@ -690,18 +835,57 @@ jl_value_t *NOINLINE jl_fptr_interpret_call(jl_value_t *f, jl_value_t **args, ui
     s->preevaluation = 0;
     s->continue_at = 0;
     s->mi = mi;
+    JL_CPPALLOCA(s->stmt_kinds, jl_array_len(stmts));
+    seed_stmt_kinds(s->stmt_kinds, stmts);
     JL_GC_ENABLEFRAME(s);
     jl_value_t *r = eval_body(stmts, s, 0, 0);
+    save_stmt_kinds(s->stmt_kinds, stmts);
     JL_GC_POP();
     return r;
 }
 
 JL_DLLEXPORT jl_callptr_t jl_fptr_interpret_call_addr = &jl_fptr_interpret_call;
 
+// `compile=lazy` modules run through the interpreter until a method has been
+// called often enough to justify native compilation, then tier up. The call
+// counts are approximate: slots are shared on hash collisions, which can only
+// shift when a method crosses the threshold.
+static _Atomic(uint32_t) lazy_call_counts[N_LAZY_COMPILE_COUNTS];
+
+jl_value_t *jl_fptr_interpret_lazy(jl_value_t *f, jl_value_t **args, uint32_t nargs, jl_code_instance_t *m)
+{
+    _Atomic(uint32_t) *count = &lazy_call_counts[inthash((uintptr_t)m->def) & (N_LAZY_COMPILE_COUNTS - 1)];
+    if (jl_atomic_fetch_add_relaxed(count, 1) + 1 >= JL_LAZY_COMPILE_THRESHOLD) {
+        jl_code_instance_t *codeinst = jl_generate_fptr(m->def, jl_current_task->world_age);
+        if (codeinst) {
+            jl_callptr_t invoke = jl_atomic_load_acquire(&codeinst->invoke);
+            if (invoke && invoke != jl_fptr_interpret_lazy)
+                return invoke(f, args, nargs, codeinst);
+        }
+        // compilation is not possible; retry only after another full batch
+        jl_atomic_store_relaxed(count, 0);
+    }
+    return jl_fptr_interpret_call(f, args, nargs, m);
+}
+
+JL_DLLEXPORT jl_callptr_t jl_fptr_interpret_lazy_addr = &jl_fptr_interpret_lazy;
+
 jl_value_t *jl_interpret_opaque_closure(jl_opaque_closure_t *oc, jl_value_t **args, size_t nargs)
 {
     jl_method_t *source = oc->source;
-    jl_code_info_t *code = jl_uncompress_ir(source, NULL, (jl_array_t*)source->source);
+    // cache the uncompressed source on the shared unspecialized method
+    // instance, like `jl_code_for_interpreter` does, so that repeated calls
+    // of an interpreted opaque closure decompress it only once
+    jl_method_instance_t *unspec = jl_get_unspecialized(source);
+    jl_code_info_t *code = unspec == NULL ? NULL :
+        (jl_code_info_t*)jl_atomic_load_relaxed(&unspec->uninferred);
+    if (code == NULL || !jl_is_code_info(code)) {
+        code = jl_uncompress_ir(source, NULL, (jl_array_t*)source->source);
+        if (unspec != NULL) {
+            jl_atomic_store_release(&unspec->uninferred, (jl_value_t*)code);
+            jl_gc_wb(unspec, code);
+        }
+    }
     interpreter_state *s;
     unsigned nroots = jl_source_nslots(code) + jl_source_nssavalues(code) + 2;
     jl_task_t *ct = jl_current_task;
@@ -721,6 +905,8 @@ jl_value_t *jl_interpret_opaque_closure(jl_opaque_closure_t *oc, jl_value_t **ar
     s->preevaluation = 0;
     s->continue_at = 0;
     s->mi = NULL;
+    JL_CPPALLOCA(s->stmt_kinds, jl_array_len(code->code));
+    memset(s->stmt_kinds, ISTMT_UNKNOWN, jl_array_len(code->code));
     size_t defargs = source->nargs;
     int isva = source->isva;
     assert(isva ? nargs + 2 >= defargs : nargs + 1 == defargs);
@@ -740,10 +926,126 @@ jl_value_t *jl_interpret_opaque_closure(jl_opaque_closure_t *oc, jl_value_t **ar
     return r;
 }
 
+// operands the trivial-thunk tier can evaluate without a frame: quoted
+// values and self-quoting literals. This is a whitelist: any IR node type
+// that is not on it (ssavalues, slots, globals, goto/gotoifnot and friends)
+// must be rejected rather than treated as a literal, since evaluating one as
+// a no-op would silently drop its semantics.
+static int trivial_operand(jl_value_t *e) JL_NOTSAFEPOINT
+{
+    if (jl_is_quotenode(e))
+        return 1;
+    jl_value_t *t = jl_typeof(e);
+    return e == jl_nothing || jl_is_primitivetype(t) || t == (jl_value_t*)jl_string_type;
+}
+
+static jl_value_t *trivial_operand_value(jl_value_t *e) JL_NOTSAFEPOINT
+{
+    return jl_is_quotenode(e) ? jl_quotenode_value(e) : e;
+}
+
+// Recognize thunks that are straight-line sequences of constant global
+// assignments, const/global declarations, and a return of a constant.
+// Definition-heavy code produces vast numbers of these, and they need none of
+// the interpreter frame machinery (no slots, no ssavalue reads, no exception
+// regions), so they can be executed directly without the frame push and the
+// eval_body dispatch loop.
+static int toplevel_thunk_is_trivial(jl_array_t *stmts, size_t ns) JL_NOTSAFEPOINT
+{
+    if (ns == 0 || !jl_is_returnnode(jl_array_ptr_ref(stmts, ns - 1)))
+        return 0;
+    for (size_t i = 0; i < ns; i++) {
+        jl_value_t *stmt = jl_array_ptr_ref(stmts, i);
+        if (jl_is_linenode(stmt))
+            continue;
+        if (jl_is_returnnode(stmt)) {
+            if (!trivial_operand(jl_returnnode_value(stmt)))
+                return 0;
+            continue;
+        }
+        if (jl_is_expr(stmt)) {
+            jl_expr_t *ex = (jl_expr_t*)stmt;
+            if (ex->head == jl_assign_sym) {
+                jl_value_t *lhs = jl_exprarg(ex, 0);
+                if ((jl_is_symbol(lhs) || jl_is_globalref(lhs)) &&
+                    trivial_operand(jl_exprarg(ex, 1)))
+                    continue;
+            }
+            else if (ex->head == jl_const_sym || ex->head == jl_global_sym) {
+                size_t j, nargs = jl_expr_nargs(ex);
+                for (j = 0; j < nargs; j++) {
+                    jl_value_t *a = jl_exprarg(ex, j);
+                    if (!jl_is_symbol(a) && !jl_is_globalref(a))
+                        break;
+                }
+                if (nargs > 0 && j == nargs)
+                    continue;
+            }
+            return 0;
+        }
+        if (!trivial_operand(stmt)) // an unused literal statement is a no-op
+            return 0;
+    }
+    return 1;
+}
+
+static jl_value_t *eval_trivial_thunk(jl_module_t *m, jl_array_t *stmts, size_t ns)
+{
+    jl_task_t *ct = jl_current_task;
+    for (size_t ip = 0; ip < ns; ip++) {
+        ct->world_age = jl_atomic_load_acquire(&jl_world_counter);
+        jl_value_t *stmt = jl_array_ptr_ref(stmts, ip);
+        if (jl_is_linenode(stmt)) {
+            jl_lineno = jl_linenode_line(stmt);
+        }
+        else if (jl_is_returnnode(stmt)) {
+            return trivial_operand_value(jl_returnnode_value(stmt));
+        }
+        else if (jl_is_expr(stmt)) {
+            jl_expr_t *ex = (jl_expr_t*)stmt;
+            if (ex->head == jl_assign_sym) {
+                jl_value_t *lhs = jl_exprarg(ex, 0);
+                jl_value_t *rhs = trivial_operand_value(jl_exprarg(ex, 1));
+                jl_module_t *modu;
+                jl_sym_t *sym;
+                if (jl_is_globalref(lhs)) {
+                    modu = jl_globalref_mod(lhs);
+                    sym = jl_globalref_name(lhs);
+                }
+                else {
+                    modu = m;
+                    sym = (jl_sym_t*)lhs;
+                }
+                JL_GC_PUSH1(&rhs);
+                jl_binding_t *b = jl_get_binding_wr(modu, sym);
+                jl_checked_assignment(b, modu, sym, rhs);
+                JL_GC_POP();
+            }
+            else {
+                // const/global declarations, same as eval_body
+                assert(jl_is_toplevel_only_expr(stmt));
+                jl_toplevel_eval(m, stmt);
+            }
+        }
+        // remaining case: an unused literal statement, no effect
+    }
+    abort(); // validated thunks terminate in `return`
+}
+
 jl_value_t *NOINLINE jl_interpret_toplevel_thunk(jl_module_t *m, jl_code_info_t *src)
 {
     interpreter_state *s;
     unsigned nroots = jl_source_nslots(src) + jl_source_nssavalues(src);
+    jl_array_t *stmts0 = src->code;
+    assert(jl_typeis(stmts0, jl_array_any_type));
+    size_t ns = jl_array_len(stmts0);
+    if (toplevel_thunk_is_trivial(stmts0, ns)) {
+        jl_task_t *ct = jl_current_task;
+        size_t last_age = ct->world_age;
+        jl_value_t *r = eval_trivial_thunk(m, stmts0, ns);
+        ct->world_age = last_age;
+        return r;
+    }
     JL_GC_PUSHFRAME(s, s->locals, nroots);
     jl_array_t *stmts = src->code;
     assert(jl_typeis(stmts, jl_array_any_type));
@@ -752,6 +1054,8 @@ jl_value_t *NOINLINE jl_interpret_toplevel_thunk(jl_module_t *m, jl_code_info_t
     s->sparam_vals = jl_emptysvec;
     s->continue_at = 0;
     s->mi = NULL;
+    JL_CPPALLOCA(s->stmt_kinds, ns);
+    memset(s->stmt_kinds, ISTMT_UNKNOWN, ns);
     JL_GC_ENABLEFRAME(s);
     jl_task_t *ct = jl_current_task;
     size_t last_age = ct->world_age;
@@ -776,6 +1080,7 @@ jl_value_t *NOINLINE jl_interpret_toplevel_expr_in(jl_module_t *m, jl_value_t *e
     s->preevaluation = (sparam_vals != NULL);
     s->continue_at = 0;
     s->mi = NULL;
+    s->stmt_kinds = NULL;
     JL_GC_ENABLEFRAME(s);
     jl_value_t *v = eval_value(e, s);
     assert(v);
@@ -26,6 +26,10 @@ typedef struct {
     // method we're compressing for
     jl_method_t *method;
     jl_ptls_t ptls;
+    // during compression, maps identity-compared roots (symbols and concrete
+    // types) to root index + 2, so repeated literals don't rescan the whole
+    // roots array; NULL during decompression
+    htable_t *roots_map;
     uint8_t relocatability;
 } jl_ircode_state;
 
@@ -72,18 +76,19 @@ static void literal_val_id(rle_reference *rr, jl_ircode_state *s, jl_value_t *v)
     jl_array_t *rs = s->method->roots;
     int i, l = jl_array_len(rs);
     if (jl_is_symbol(v) || jl_is_concrete_type(v)) {
-        for (i = 0; i < l; i++) {
-            if (jl_array_ptr_ref(rs, i) == v)
-                return tagged_root(rr, s, i);
-        }
+        void *idx = ptrhash_get(s->roots_map, v);
+        if (idx != HT_NOTFOUND)
+            return tagged_root(rr, s, (int)(intptr_t)idx - 2);
+        jl_add_method_root(s->method, jl_precompile_toplevel_module, v);
+        ptrhash_put(s->roots_map, v, (void*)(intptr_t)(jl_array_len(rs) - 1 + 2));
     }
     else {
         for (i = 0; i < l; i++) {
             if (jl_egal(jl_array_ptr_ref(rs, i), v))
                 return tagged_root(rr, s, i);
         }
+        jl_add_method_root(s->method, jl_precompile_toplevel_module, v);
     }
-    jl_add_method_root(s->method, jl_precompile_toplevel_module, v);
     return tagged_root(rr, s, jl_array_len(rs) - 1);
 }
 
@@ -774,10 +779,21 @@ JL_DLLEXPORT jl_array_t *jl_compress_ir(jl_method_t *m, jl_code_info_t *code)
         m->roots = jl_alloc_vec_any(0);
         jl_gc_wb(m, m->roots);
     }
+    // seed the root-lookup map with the identity-compared roots accumulated
+    // by earlier compressions for this method
+    htable_t roots_map;
+    htable_new(&roots_map, 0);
+    for (i = 0; i < jl_array_len(m->roots); i++) {
+        jl_value_t *r = jl_array_ptr_ref(m->roots, i);
+        if ((jl_is_symbol(r) || jl_is_concrete_type(r)) &&
+            ptrhash_get(&roots_map, r) == HT_NOTFOUND)
+            ptrhash_put(&roots_map, r, (void*)(intptr_t)(i + 2));
+    }
     jl_ircode_state s = {
         &dest,
         m,
         jl_current_task->ptls,
+        &roots_map,
         1
     };
 
@@ -839,6 +855,7 @@ JL_DLLEXPORT jl_array_t *jl_compress_ir(jl_method_t *m, jl_code_info_t *code)
     write_uint8(s.s, s.relocatability);
 
     ios_flush(s.s);
+    htable_free(&roots_map);
     jl_array_t *v = jl_take_buffer(&dest);
     ios_close(s.s);
     if (jl_array_len(m->roots) == 0) {
@@ -870,6 +887,7 @@ JL_DLLEXPORT jl_code_info_t *jl_uncompress_ir(jl_method_t *m, jl_code_instance_t
         &src,
         m,
         jl_current_task->ptls,
+        NULL,
         1
     };
 
@@ -938,6 +956,85 @@ JL_DLLEXPORT jl_code_info_t *jl_uncompress_ir(jl_method_t *m, jl_code_instance_t
     return code;
 }
 
+// Field-selective variant of jl_uncompress_ir for consumers that only read
+// the statements and their types. The encoding writes `code`,
+// `ssavaluetypes` and `ssaflags` ahead of the debug fields, so decoding can
+// simply stop before `slotnames`, `codelocs` and the linetable — for large
+// methods those are most of the decode cost and of the materialized memory.
+// The skipped fields get cheap placeholders (slotnames from the method,
+// zeroed codelocs, an empty linetable), keeping the CodeInfo well-formed
+// for analysis but useless for backtrace display.
+JL_DLLEXPORT jl_code_info_t *jl_uncompress_ir_stmts(jl_method_t *m, jl_code_instance_t *metadata, jl_array_t *data)
+{
+    if (jl_is_code_info(data))
+        return (jl_code_info_t*)data;
+    if (m->is_for_opaque_closure)
+        return jl_uncompress_ir(m, metadata, data); // slottypes trail the debug fields
+    JL_TIMING(AST_UNCOMPRESS);
+    JL_LOCK(&m->writelock); // protect the roots array (Might GC)
+    assert(jl_is_method(m));
+    assert(jl_typeis(data, jl_array_uint8_type));
+    size_t i;
+    ios_t src;
+    ios_mem(&src, 0);
+    ios_setbuf(&src, (char*)data->data, jl_array_len(data), 0);
+    src.size = jl_array_len(data);
+    int en = jl_gc_enable(0); // Might GC
+    jl_ircode_state s = {
+        &src,
+        m,
+        jl_current_task->ptls,
+        NULL,
+        1
+    };
+
+    jl_code_info_t *code = jl_new_code_info_uninit();
+    jl_code_info_flags_t flags;
+    flags.packed = read_uint8(s.s);
+    code->inlining = flags.bits.inlining;
+    code->constprop = flags.bits.constprop;
+    code->inferred = flags.bits.inferred;
+    code->propagate_inbounds = flags.bits.propagate_inbounds;
+    code->pure = flags.bits.pure;
+    code->has_fcall = flags.bits.has_fcall;
+    code->purity.bits = read_uint8(s.s);
+    code->inlining_cost = read_uint16(s.s);
+
+    size_t nslots = read_int32(&src);
+    code->slotflags = jl_alloc_array_1d(jl_array_uint8_type, nslots);
+    ios_readall(s.s, (char*)jl_array_data(code->slotflags), nslots);
+
+    // fields 0 (code), 2 (ssavaluetypes) and 3 (ssaflags); stop before the
+    // limit-heuristics method and the linetable
+    for (i = 0; i < 4; i++) {
+        if (i == 1)  // skip codelocs
+            continue;
+        assert(jl_field_isptr(jl_code_info_type, i));
+        jl_value_t **fld = (jl_value_t**)((char*)jl_data_ptr(code) + jl_field_offset(jl_code_info_type, i));
+        *fld = jl_decode_value(&s);
+    }
+    code->slotnames = jl_uncompress_argnames(m->slot_syms);
+
+    size_t nstmt = jl_array_len(code->code);
+    code->codelocs = (jl_value_t*)jl_alloc_array_1d(jl_array_int32_type, nstmt);
+    memset(jl_array_data(code->codelocs), 0, nstmt * sizeof(int32_t));
+    code->linetable = (jl_value_t*)jl_alloc_vec_any(0);
+
+    ios_close(s.s);
+    JL_GC_PUSH1(&code);
+    jl_gc_enable(en);
+    JL_UNLOCK(&m->writelock); // Might GC
+    JL_GC_POP();
+    if (metadata) {
+        code->min_world = metadata->min_world;
+        code->max_world = metadata->max_world;
+        code->rettype = metadata->rettype;
+        code->parent = metadata->def;
+    }
+
+    return code;
+}
+
 JL_DLLEXPORT uint8_t jl_ir_flag_inferred(jl_array_t *data)
 {
     if (jl_is_code_info(data))
@@ -15,6 +15,9 @@
 #if JL_LLVM_VERSION >= 130000
 #include <llvm/ExecutionEngine/Orc/ExecutorProcessControl.h>
 #endif
+#if JL_LLVM_VERSION >= 140000
+#include <llvm/ExecutionEngine/Orc/TaskDispatch.h>
+#endif
 #include <llvm/IR/Verifier.h>
 #include <llvm/Support/DynamicLibrary.h>
 #include <llvm/Support/FormattedStream.h>
@@ -23,6 +26,8 @@
 #include <llvm/Transforms/Utils/Cloning.h>
 #include <llvm/Transforms/Utils/ModuleUtils.h>
 #include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/Support/xxhash.h>
 
 // target machine computation
 #include <llvm/CodeGen/TargetSubtargetInfo.h>
@@ -141,7 +146,8 @@ static int jl_add_to_ee(
         orc::ThreadSafeModule &M,
         const StringMap<orc::ThreadSafeModule*> &NewExports,
         DenseMap<orc::ThreadSafeModule*, int> &Queued,
-        std::vector<orc::ThreadSafeModule*> &Stack) JL_NOTSAFEPOINT;
+        std::vector<orc::ThreadSafeModule*> &Stack,
+        std::vector<orc::ThreadSafeModule> &ToAdd) JL_NOTSAFEPOINT;
 static void jl_decorate_module(Module &M) JL_NOTSAFEPOINT;
 static uint64_t getAddressForFunction(StringRef fname) JL_NOTSAFEPOINT;
 
@@ -170,6 +176,20 @@ void jl_jit_globals(std::map<void *, GlobalVariable*> &globals) JL_NOTSAFEPOINT
     }
 }
 
+// Tiered compilation: when JULIA_TIERED_COMPILATION is set, methods are first
+// emitted through the -O0 pipeline so that time-to-first-call is dominated by
+// instruction selection rather than the optimizer. jl_reoptimize_codeinst can
+// then be used to recompile a hot method through the full pipeline and patch
+// its entry pointers in place.
+static bool jl_tiered_compilation(void) JL_NOTSAFEPOINT
+{
+    static bool enabled = [] {
+        char *env = getenv("JULIA_TIERED_COMPILATION");
+        return env && atoi(env) > 0;
+    }();
+    return enabled;
+}
+
 // this generates llvm code for the lambda info
 // and adds the result to the jitlayers
 // (and the shadow module),
@@ -178,7 +198,8 @@ static jl_callptr_t _jl_compile_codeinst(
         jl_code_instance_t *codeinst,
         jl_code_info_t *src,
         size_t world,
-        orc::ThreadSafeContext context)
+        orc::ThreadSafeContext context,
+        bool reoptimize=false)
 {
     // caller must hold codegen_lock
     // and have disabled finalizers
@@ -220,6 +241,8 @@ static jl_callptr_t _jl_compile_codeinst(
             orc::ThreadSafeModule &TSM = std::get<0>(def.second);
             //The underlying context object is still locked because params is not destroyed yet
             auto M = TSM.getModuleUnlocked();
+            if (reoptimize)
+                M->addModuleFlag(Module::Error, "julia.reoptimized", 1);
             for (auto &F : M->global_objects()) {
                 if (!F.isDeclaration() && F.getLinkage() == GlobalValue::ExternalLinkage) {
                     NewExports[F.getName()] = &TSM;
@@ -235,12 +258,16 @@ static jl_callptr_t _jl_compile_codeinst(
         }
         DenseMap<orc::ThreadSafeModule*, int> Queued;
         std::vector<orc::ThreadSafeModule*> Stack;
+        std::vector<orc::ThreadSafeModule> ToAdd;
         for (auto &def : emitted) {
             // Add the results to the execution engine now
             orc::ThreadSafeModule &M = std::get<0>(def.second);
-            jl_add_to_ee(M, NewExports, Queued, Stack);
+            jl_add_to_ee(M, NewExports, Queued, Stack, ToAdd);
             assert(Queued.empty() && Stack.empty() && !M);
         }
+        // Submit all roots as one batch so that the session's dispatcher can
+        // materialize independent modules on its worker threads concurrently.
+        jl_ExecutionEngine->addModules(std::move(ToAdd));
         ++CompiledCodeinsts;
         MaxWorkqueueSize.updateMax(emitted.size());
         IndirectCodeinsts += emitted.size() - 1;
@@ -262,7 +289,17 @@ static jl_callptr_t _jl_compile_codeinst(
             addr = (jl_callptr_t)getAddressForFunction(decls.functionObject);
             isspecsig = true;
         }
-        if (jl_atomic_load_relaxed(&this_code->invoke) == NULL) {
+        if (reoptimize && this_code == codeinst) {
+            // tier-up: unconditionally install the newly optimized entry
+            // points. The tier-0 code stays mapped by the JIT, so a racing
+            // caller always observes a valid target.
+            if (!decls.specFunctionObject.empty()) {
+                jl_atomic_store_release(&this_code->specptr.fptr, (void*)getAddressForFunction(decls.specFunctionObject));
+                this_code->isspecsig = isspecsig;
+            }
+            jl_atomic_store_release(&this_code->invoke, addr);
+        }
+        else if (jl_atomic_load_relaxed(&this_code->invoke) == NULL) {
             // once set, don't change invoke-ptr, as that leads to race conditions
             // with the (not) simultaneous updates to invoke and specptr
             if (!decls.specFunctionObject.empty()) {
@@ -511,6 +548,43 @@ void jl_generate_fptr_for_unspecialized_impl(jl_code_instance_t *unspec)
 }
 
 
+// recompile a (tier-0) code instance through the full optimization pipeline
+// and patch its entry pointers; no-op unless tiered compilation is enabled
+extern "C" JL_DLLEXPORT
+void jl_reoptimize_codeinst_impl(jl_code_instance_t *codeinst)
+{
+    if (!jl_tiered_compilation())
+        return;
+    jl_method_instance_t *mi = codeinst->def;
+    if (!jl_is_method(mi->def.method))
+        return;
+    auto ct = jl_current_task;
+    ct->reentrant_timing++;
+    uint64_t compiler_start_time = 0;
+    uint8_t measure_compile_time_enabled = jl_atomic_load_relaxed(&jl_measure_compile_time_enabled);
+    if (measure_compile_time_enabled)
+        compiler_start_time = jl_hrtime();
+    jl_code_info_t *src = NULL;
+    JL_GC_PUSH1(&src);
+    JL_LOCK(&jl_codegen_lock);
+    src = (jl_code_info_t*)jl_atomic_load_relaxed(&codeinst->inferred);
+    if ((jl_value_t*)src == jl_nothing)
+        src = NULL;
+    else if (src)
+        src = jl_uncompress_ir(mi->def.method, codeinst, (jl_array_t*)src);
+    if (src == NULL)
+        src = jl_type_infer(mi, codeinst->min_world, 0);
+    if (src && jl_is_code_info(src))
+        _jl_compile_codeinst(codeinst, src, codeinst->min_world, *jl_ExecutionEngine->getContext(), /*reoptimize*/true);
+    JL_UNLOCK(&jl_codegen_lock);
+    if (!--ct->reentrant_timing && measure_compile_time_enabled) {
+        uint64_t t_comp = jl_hrtime() - compiler_start_time;
+        jl_atomic_fetch_add_relaxed(&jl_cumulative_recompile_time, t_comp);
+        jl_atomic_fetch_add_relaxed(&jl_cumulative_compile_time, t_comp);
+    }
+    JL_GC_POP();
+}
+
 // get a native disassembly for a compiled method
 extern "C" JL_DLLEXPORT
 jl_value_t *jl_dump_method_asm_impl(jl_method_instance_t *mi, size_t world,
@@ -598,6 +672,11 @@ void JuliaOJIT::OptSelLayerT::emit(std::unique_ptr<orc::MaterializationResponsib
         if (jl_generating_output()) {
             optlevel = 0;
         }
+        else if (jl_tiered_compilation() && !M.getModuleFlag("julia.reoptimized")) {
+            // tier 0: emit as fast as possible; the full pipeline runs later
+            // when the method is re-optimized.
+            optlevel = 0;
+        }
         else {
             optlevel = std::max(static_cast<int>(jl_options.opt_level), 0);
             size_t optlevel_min = std::max(static_cast<int>(jl_options.opt_level_min), 0);
@@ -1189,16 +1268,74 @@ namespace {
         JuliaOJIT::ResourcePool<std::unique_ptr<PassManager>> PMs;
     };
 
+    // Content-addressed cache of compiled object code, consulted by
+    // SimpleCompiler before instruction selection. The key is a hash of the
+    // module's optimized bitcode, which covers the runtime addresses codegen
+    // embeds in the IR as integer constants -- and since those differ on
+    // every process start, the cache lives in memory rather than on disk,
+    // where cross-process entries could never hit anyway. In-session hits
+    // come from invalidation storms recompiling methods whose optimized IR
+    // comes out unchanged. Opt-in via JULIA_JIT_CACHE, since misses still
+    // pay for serializing the bitcode to compute the key.
+    class JITObjectCache : public ObjectCache {
+        std::mutex mutex;
+        StringMap<std::unique_ptr<MemoryBuffer>> objects;
+        DenseMap<const Module *, std::string> pending;
+
+        static std::string key(const Module &M) JL_NOTSAFEPOINT {
+            SmallVector<char, 0> bitcode;
+            raw_svector_ostream OS(bitcode);
+            WriteBitcodeToFile(M, OS);
+            uint64_t hash = xxHash64(StringRef(bitcode.data(), bitcode.size()));
+            return std::string((const char*)&hash, sizeof(hash));
+        }
+
+    public:
+        static std::unique_ptr<JITObjectCache> create() JL_NOTSAFEPOINT {
+            char *env = getenv("JULIA_JIT_CACHE");
+            if (!env || !*env || !strcmp(env, "0"))
+                return nullptr;
+            return std::make_unique<JITObjectCache>();
+        }
+
+        std::unique_ptr<MemoryBuffer> getObject(const Module *M) override {
+            std::string k = key(*M);
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = objects.find(k);
+            if (it == objects.end()) {
+                // remember the key so notifyObjectCompiled doesn't hash again
+                pending[M] = std::move(k);
+                return nullptr;
+            }
+            return MemoryBuffer::getMemBufferCopy(it->second->getBuffer(),
+                                                  it->second->getBufferIdentifier());
+        }
+
+        void notifyObjectCompiled(const Module *M, MemoryBufferRef Obj) override {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = pending.find(M);
+            if (it == pending.end())
+                return;
+            objects[it->second] = MemoryBuffer::getMemBufferCopy(Obj.getBuffer(),
+                                                                 Obj.getBufferIdentifier());
+            pending.erase(it);
+        }
+    };
+
     struct CompilerT : orc::IRCompileLayer::IRCompiler {
 
         CompilerT(orc::IRSymbolMapper::ManglingOptions MO, TargetMachine &TM, int optlevel) JL_NOTSAFEPOINT
-            : orc::IRCompileLayer::IRCompiler(MO), TMs(TMCreator(TM, optlevel)) {}
+            : orc::IRCompileLayer::IRCompiler(MO), TMs(TMCreator(TM, optlevel)),
+              // one cache per pipeline, so the implicit part of the key
+              // (target machine settings) is constant within each cache
+              ObjCache(JITObjectCache::create()) {}
 
         Expected<std::unique_ptr<MemoryBuffer>> operator()(Module &M) override {
-            return orc::SimpleCompiler(***TMs)(M);
+            return orc::SimpleCompiler(***TMs, ObjCache.get())(M);
         }
 
         JuliaOJIT::ResourcePool<std::unique_ptr<TargetMachine>> TMs;
+        std::unique_ptr<JITObjectCache> ObjCache;
     };
 }
 
@@ -1215,10 +1352,29 @@ JuliaOJIT::PipelineT::PipelineT(orc::ObjectLayer &BaseLayer, TargetMachine &TM,
     OptimizeLayer(CompileLayer.getExecutionSession(), CompileLayer,
             llvm::orc::IRTransformLayer::TransformFunction(OptimizerT(TM, optlevel))) {}
 
+#if JL_LLVM_VERSION >= 140000 && LLVM_ENABLE_THREADS
+// Materialization (optimization + instruction selection) of independent
+// modules can proceed concurrently; only the final object emission is
+// serialized behind the LockLayer. Spawning a worker pool here lets a
+// batched addModules call scale with the host core count. Disabled unless
+// explicitly requested, since single-module latency is unaffected.
+static std::unique_ptr<orc::TaskDispatcher> createTaskDispatcher() JL_NOTSAFEPOINT
+{
+    int nthreads = 0;
+    if (char *env = getenv("JULIA_LLVM_THREADS"))
+        nthreads = atoi(env);
+    if (nthreads <= 1)
+        return std::make_unique<orc::InPlaceTaskDispatcher>();
+    return std::make_unique<orc::DynamicThreadPoolTaskDispatcher>();
+}
+#endif
+
 JuliaOJIT::JuliaOJIT()
   : TM(createTargetMachine()),
     DL(jl_create_datalayout(*TM)),
-#if JL_LLVM_VERSION >= 130000
+#if JL_LLVM_VERSION >= 140000 && LLVM_ENABLE_THREADS
+    ES(cantFail(orc::SelfExecutorProcessControl::Create(nullptr, createTaskDispatcher()))),
+#elif JL_LLVM_VERSION >= 130000
     ES(cantFail(orc::SelfExecutorProcessControl::Create())),
 #else
     ES(),
@@ -1359,45 +1515,56 @@ void JuliaOJIT::addGlobalMapping(StringRef Name, uint64_t Addr)
 }
 
 void JuliaOJIT::addModule(orc::ThreadSafeModule TSM)
+{
+    std::vector<orc::ThreadSafeModule> TSMs;
+    TSMs.push_back(std::move(TSM));
+    addModules(std::move(TSMs));
+}
+
+void JuliaOJIT::addModules(std::vector<orc::ThreadSafeModule> TSMs)
 {
     JL_TIMING(LLVM_MODULE_FINISH);
-    ++ModulesAdded;
     orc::SymbolLookupSet NewExports;
-    TSM.withModuleDo([&](Module &M) JL_NOTSAFEPOINT {
-        jl_decorate_module(M);
-        shareStrings(M);
-        for (auto &F : M.global_values()) {
-            if (!F.isDeclaration() && F.getLinkage() == GlobalValue::ExternalLinkage) {
-                auto Name = ES.intern(getMangledName(F.getName()));
-                NewExports.add(std::move(Name));
+    for (auto &TSM : TSMs) {
+        ++ModulesAdded;
+        TSM.withModuleDo([&](Module &M) JL_NOTSAFEPOINT {
+            jl_decorate_module(M);
+            shareStrings(M);
+            for (auto &F : M.global_values()) {
+                if (!F.isDeclaration() && F.getLinkage() == GlobalValue::ExternalLinkage) {
+                    auto Name = ES.intern(getMangledName(F.getName()));
+                    NewExports.add(std::move(Name));
+                }
             }
-        }
 #if !defined(JL_NDEBUG) && !defined(JL_USE_JITLINK)
-        // validate the relocations for M (not implemented for the JITLink memory manager yet)
-        for (Module::global_object_iterator I = M.global_objects().begin(), E = M.global_objects().end(); I != E; ) {
-            GlobalObject *F = &*I;
-            ++I;
-            if (F->isDeclaration()) {
-                if (F->use_empty())
-                    F->eraseFromParent();
-                else if (!((isa<Function>(F) && isIntrinsicFunction(cast<Function>(F))) ||
-                        findUnmangledSymbol(F->getName()) ||
-                        SectionMemoryManager::getSymbolAddressInProcess(
-                            getMangledName(F->getName())))) {
-                    llvm::errs() << "FATAL ERROR: "
-                                << "Symbol \"" << F->getName().str() << "\""
-                                << "not found";
-                    abort();
+            // validate the relocations for M (not implemented for the JITLink memory manager yet)
+            for (Module::global_object_iterator I = M.global_objects().begin(), E = M.global_objects().end(); I != E; ) {
+                GlobalObject *F = &*I;
+                ++I;
+                if (F->isDeclaration()) {
+                    if (F->use_empty())
+                        F->eraseFromParent();
+                    else if (!((isa<Function>(F) && isIntrinsicFunction(cast<Function>(F))) ||
+                            findUnmangledSymbol(F->getName()) ||
+                            SectionMemoryManager::getSymbolAddressInProcess(
+                                getMangledName(F->getName())))) {
+                        llvm::errs() << "FATAL ERROR: "
+                                    << "Symbol \"" << F->getName().str() << "\""
+                                    << "not found";
+                        abort();
+                    }
                 }
             }
-        }
 #endif
-    });
+        });
 
-    // TODO: what is the performance characteristics of this?
-    cantFail(OptSelLayer.add(JD, std::move(TSM)));
+        // TODO: what is the performance characteristics of this?
+        cantFail(OptSelLayer.add(JD, std::move(TSM)));
+    }
     // force eager compilation (for now), due to memory management specifics
-    // (can't handle compilation recursion)
+    // (can't handle compilation recursion). Doing this as a single batched
+    // lookup lets the session's task dispatcher materialize independent
+    // modules concurrently when a worker pool is configured.
     for (auto &sym : cantFail(ES.lookup({{&JD, orc::JITDylibLookupFlags::MatchExportedSymbolsOnly}}, NewExports))) {
         assert(sym.second);
         (void) sym;
@@ -1738,7 +1905,8 @@ static int jl_add_to_ee(
         orc::ThreadSafeModule &M,
         const StringMap<orc::ThreadSafeModule*> &NewExports,
         DenseMap<orc::ThreadSafeModule*, int> &Queued,
-        std::vector<orc::ThreadSafeModule*> &Stack)
+        std::vector<orc::ThreadSafeModule*> &Stack,
+        std::vector<orc::ThreadSafeModule> &ToAdd)
 {
     // First check if the TSM is empty (already compiled)
     if (!M)
@@ -1774,7 +1942,7 @@ static int jl_add_to_ee(
     });
     assert(MergeUp > 0);
     for (auto *CM : Children) {
-        int Down = jl_add_to_ee(*CM, NewExports, Queued, Stack);
+        int Down = jl_add_to_ee(*CM, NewExports, Queued, Stack, ToAdd);
         assert(Down <= (int)Stack.size());
         if (Down)
             MergeUp = std::min(MergeUp, Down);
@@ -1795,7 +1963,7 @@ static int jl_add_to_ee(
         }
         jl_merge_module(M, std::move(*CM));
     }
-    jl_ExecutionEngine->addModule(std::move(M));
+    ToAdd.push_back(std::move(M));
     return 0;
 }
 
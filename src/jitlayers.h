@@ -460,6 +460,10 @@ public:
     orc::SymbolStringPtr mangle(StringRef Name) JL_NOTSAFEPOINT;
     void addGlobalMapping(StringRef Name, uint64_t Addr) JL_NOTSAFEPOINT;
     void addModule(orc::ThreadSafeModule M) JL_NOTSAFEPOINT;
+    // Batched form of addModule: all modules are handed to the pipeline before
+    // the (single) eager lookup, so independent modules may be materialized
+    // concurrently by the session's task dispatcher.
+    void addModules(std::vector<orc::ThreadSafeModule> Ms) JL_NOTSAFEPOINT;
 
     JL_JITSymbol findSymbol(StringRef Name, bool ExportedSymbolsOnly) JL_NOTSAFEPOINT;
     JL_JITSymbol findUnmangledSymbol(StringRef Name) JL_NOTSAFEPOINT;
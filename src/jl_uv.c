@@ -525,6 +525,73 @@ JL_DLLEXPORT int jl_fs_read_byte(uv_os_fd_t handle)
     }
 }
 
+// Positional scatter/gather I/O: one preadv/pwritev-backed syscall filling
+// (or draining) all of `bufs` from a contiguous range at `offset`, instead
+// of one call per buffer. Pass offset == -1 for the current file position.
+JL_DLLEXPORT int jl_fs_readv(uv_os_fd_t handle, const uv_buf_t *bufs,
+                             unsigned int nbufs, int64_t offset)
+{
+    uv_fs_t req;
+    int ret = uv_fs_read(unused_uv_loop_arg, &req, handle, bufs, nbufs, offset, NULL);
+    uv_fs_req_cleanup(&req);
+    return ret;
+}
+
+JL_DLLEXPORT int jl_fs_writev(uv_os_fd_t handle, const uv_buf_t *bufs,
+                              unsigned int nbufs, int64_t offset)
+{
+    uv_fs_t req;
+    JL_SIGATOMIC_BEGIN();
+    int ret = uv_fs_write(unused_uv_loop_arg, &req, handle, bufs, nbufs, offset, NULL);
+    uv_fs_req_cleanup(&req);
+    JL_SIGATOMIC_END();
+    return ret;
+}
+
+// Issue a batch of positional reads (bufs[i] at offsets[i]) in one call,
+// saving the per-operation ccall round trip. Returns the total bytes read;
+// a short operation ends the batch (the caller can tell from the total how
+// far it got) and an error on the first operation is returned as such.
+JL_DLLEXPORT int64_t jl_fs_read_batch(uv_os_fd_t handle, const uv_buf_t *bufs,
+                                      const int64_t *offsets, unsigned int nops)
+{
+    int64_t total = 0;
+    for (unsigned int i = 0; i < nops; i++) {
+        uv_fs_t req;
+        int ret = uv_fs_read(unused_uv_loop_arg, &req, handle, &bufs[i], 1,
+                             offsets[i], NULL);
+        uv_fs_req_cleanup(&req);
+        if (ret < 0)
+            return total == 0 ? ret : total;
+        total += ret;
+        if ((size_t)ret < bufs[i].len)
+            break;
+    }
+    return total;
+}
+
+JL_DLLEXPORT int64_t jl_fs_write_batch(uv_os_fd_t handle, const uv_buf_t *bufs,
+                                       const int64_t *offsets, unsigned int nops)
+{
+    int64_t total = 0;
+    JL_SIGATOMIC_BEGIN();
+    for (unsigned int i = 0; i < nops; i++) {
+        uv_fs_t req;
+        int ret = uv_fs_write(unused_uv_loop_arg, &req, handle, &bufs[i], 1,
+                              offsets[i], NULL);
+        uv_fs_req_cleanup(&req);
+        if (ret < 0) {
+            JL_SIGATOMIC_END();
+            return total == 0 ? ret : total;
+        }
+        total += ret;
+        if ((size_t)ret < bufs[i].len)
+            break;
+    }
+    JL_SIGATOMIC_END();
+    return total;
+}
+
 JL_DLLEXPORT int jl_fs_close(uv_os_fd_t handle)
 {
     uv_fs_t req;
@@ -547,6 +614,60 @@ JL_DLLEXPORT int jl_uv_write(uv_stream_t *stream, const char *data, size_t n,
     return err;
 }
 
+// Synchronous fast path for stream writes: attempt the write immediately with
+// uv_try_write, so data the OS accepts right away never allocates a request,
+// never wakes the event loop, and never suspends the writing task. Returns
+// the number of bytes written, or zero if nothing could be written
+// synchronously (the stream would block, the handle type has no try_write,
+// or the stream errored); the caller queues a normal write request for
+// whatever remains, which also reports any error the usual way.
+JL_DLLEXPORT ssize_t jl_uv_try_write(uv_stream_t *stream, const char *data, size_t n)
+{
+    uv_buf_t buf[1];
+    buf[0].base = (char*)data;
+    buf[0].len = n;
+    JL_UV_LOCK();
+    int err = uv_try_write(stream, buf, 1);
+    JL_UV_UNLOCK();
+    if (err < 0)
+        return 0;
+    return err;
+}
+
+// Submit several buffers as a single write request, so callers with scattered
+// data can coalesce many small writes into one syscall instead of one
+// uv_write (and one req allocation) per fragment. The caller owns `uvw` and
+// must keep every buffer alive until `writecb` fires, same as jl_uv_write.
+JL_DLLEXPORT int jl_uv_writev(uv_stream_t *stream, const uv_buf_t *bufs,
+                              unsigned nbufs, uv_write_t *uvw, uv_write_cb writecb)
+{
+    JL_UV_LOCK();
+    JL_SIGATOMIC_BEGIN();
+    int err = uv_write(uvw, stream, (uv_buf_t*)bufs, nbufs, writecb);
+    JL_UV_UNLOCK();
+    JL_SIGATOMIC_END();
+    return err;
+}
+
+// Split a contiguous write into `maxchunk`-sized buffers submitted as a
+// single writev-style request, so callers that must respect an OS chunk
+// limit get one request and one callback instead of a request per chunk.
+JL_DLLEXPORT int jl_uv_write_chunked(uv_stream_t *stream, const char *data, size_t n,
+                                     size_t maxchunk, uv_write_t *uvw, uv_write_cb writecb)
+{
+    unsigned nbufs = 1;
+    if (maxchunk > 0 && n > maxchunk)
+        nbufs = (unsigned)((n + maxchunk - 1) / maxchunk);
+    uv_buf_t *bufs = (uv_buf_t*)alloca(nbufs * sizeof(uv_buf_t));
+    for (unsigned i = 0; i < nbufs; i++) {
+        bufs[i].base = (char*)data;
+        bufs[i].len = n < maxchunk ? n : maxchunk;
+        data += bufs[i].len;
+        n -= bufs[i].len;
+    }
+    return jl_uv_writev(stream, bufs, nbufs, uvw, writecb);
+}
+
 static void jl_uv_writecb(uv_write_t *req, int status) JL_NOTSAFEPOINT
 {
     free(req);
@@ -556,6 +677,59 @@ static void jl_uv_writecb(uv_write_t *req, int status) JL_NOTSAFEPOINT
     }
 }
 
+// Recycled write requests for the fire-and-forget copying path (jl_uv_puts).
+// Logging-heavy workloads issue millions of small writes, so instead of a
+// malloc/free pair per write we keep a bounded free list of requests with an
+// inline copy buffer. The pool is protected by jl_uv_mutex, which the submit
+// path and the loop callbacks (uv_run is only entered with the lock held)
+// already hold.
+#define JL_UV_WRITE_INLINE_SZ 1024
+#define JL_UV_WRITE_POOL_MAX 64
+
+typedef struct jl_uv_write_req_t {
+    uv_write_t req;
+    struct jl_uv_write_req_t *next; // pool free list
+    char buf[JL_UV_WRITE_INLINE_SZ];
+} jl_uv_write_req_t;
+
+static jl_uv_write_req_t *jl_uv_write_pool = NULL;
+static int jl_uv_write_pool_sz = 0;
+
+static jl_uv_write_req_t *jl_uv_write_req_alloc(void) JL_NOTSAFEPOINT // jl_uv_mutex must be held
+{
+    jl_uv_write_req_t *req = jl_uv_write_pool;
+    if (req) {
+        jl_uv_write_pool = req->next;
+        jl_uv_write_pool_sz--;
+    }
+    else {
+        req = (jl_uv_write_req_t*)malloc_s(sizeof(jl_uv_write_req_t));
+    }
+    req->next = NULL;
+    return req;
+}
+
+static void jl_uv_write_req_free(jl_uv_write_req_t *req) JL_NOTSAFEPOINT // jl_uv_mutex must be held
+{
+    if (jl_uv_write_pool_sz < JL_UV_WRITE_POOL_MAX) {
+        req->next = jl_uv_write_pool;
+        jl_uv_write_pool = req;
+        jl_uv_write_pool_sz++;
+    }
+    else {
+        free(req);
+    }
+}
+
+static void jl_uv_writecb_pooled(uv_write_t *req, int status) JL_NOTSAFEPOINT
+{
+    jl_uv_write_req_free((jl_uv_write_req_t*)req);
+    if (status < 0) {
+        jl_safe_printf("jl_uv_writecb() ERROR: %s %s\n",
+                       uv_strerror(status), uv_err_name(status));
+    }
+}
+
 JL_DLLEXPORT void jl_uv_puts(uv_stream_t *stream, const char *str, size_t n)
 {
     assert(stream);
@@ -600,21 +774,36 @@ JL_DLLEXPORT void jl_uv_puts(uv_stream_t *stream, const char *str, size_t n)
     }
     else {
         // Write to libuv stream...
-        uv_write_t *req = (uv_write_t*)malloc_s(sizeof(uv_write_t) + n);
-        char *data = (char*)(req + 1);
+        JL_UV_LOCK();
+        JL_SIGATOMIC_BEGIN();
+        uv_write_t *req;
+        char *data;
+        uv_write_cb writecb;
+        if (n <= JL_UV_WRITE_INLINE_SZ) {
+            // small write: recycle a pooled request, keeping this path allocation-free
+            jl_uv_write_req_t *pooled = jl_uv_write_req_alloc();
+            req = &pooled->req;
+            data = pooled->buf;
+            writecb = (uv_write_cb)jl_uv_writecb_pooled;
+        }
+        else {
+            req = (uv_write_t*)malloc_s(sizeof(uv_write_t) + n);
+            data = (char*)(req + 1);
+            writecb = (uv_write_cb)jl_uv_writecb;
+        }
         memcpy(data, str, n);
         uv_buf_t buf[1];
         buf[0].base = data;
         buf[0].len = n;
         req->data = NULL;
-        JL_UV_LOCK();
-        JL_SIGATOMIC_BEGIN();
-        int status = uv_write(req, stream, buf, 1, (uv_write_cb)jl_uv_writecb);
-        JL_UV_UNLOCK();
-        JL_SIGATOMIC_END();
+        int status = uv_write(req, stream, buf, 1, writecb);
         if (status < 0) {
-            jl_uv_writecb(req, status);
+            // uv will not run the callback; release the request while we
+            // still hold the lock (the pool requires it)
+            writecb(req, status);
         }
+        JL_UV_UNLOCK();
+        JL_SIGATOMIC_END();
     }
 }
 
@@ -298,6 +298,19 @@ JL_DLLEXPORT void jl_yield(void)
         jl_call0(yieldfunc);
 }
 
+// Bytes of GC-managed memory allocated by `t`, including completed child
+// tasks rolled up at their last context switch. For the calling task the
+// in-progress allocation window is included; for a task running concurrently
+// on another thread the value is a (slightly stale) snapshot.
+JL_DLLEXPORT int64_t jl_task_allocated_bytes(jl_task_t *t)
+{
+    int64_t n = jl_atomic_load_relaxed(&t->alloc_bytes);
+    jl_task_t *ct = jl_current_task;
+    if (t == ct)
+        n += jl_atomic_load_relaxed(&ct->ptls->gc_num.allocd) - ct->alloc_base;
+    return n;
+}
+
 JL_DLLEXPORT jl_value_t *jl_get_field(jl_value_t *o, const char *fld)
 {
     jl_value_t *v;
@@ -468,6 +481,26 @@ JL_DLLEXPORT void jl_gc_safepoint(void)
     jl_gc_safepoint_(ct->ptls);
 }
 
+// While enabled, each full collection samples ~1% of the pool pages during
+// the sweep and tallies live object counts and bytes per type.
+JL_DLLEXPORT void jl_gc_heap_census_enable(int enable)
+{
+    jl_gc_census_enable(enable);
+}
+
+// Copy the most recent census into the caller's arrays (each `len` long) and
+// return the number of distinct types seen; entries past `len` are dropped.
+// Counts and bytes are scaled estimates for the whole pool heap. `epoch`, if
+// non-NULL, receives a counter of how many collections have filled the census,
+// so pollers can tell whether the data has been refreshed. The type pointers
+// are borrowed and should not be dereferenced after the next collection;
+// buffers show up under the tag returned by `jl_get_buff_tag`.
+JL_DLLEXPORT size_t jl_gc_heap_census(jl_value_t **types, uint64_t *counts,
+                                      uint64_t *bytes, size_t len, uint64_t *epoch)
+{
+    return jl_gc_census_read(types, counts, bytes, len, epoch);
+}
+
 JL_DLLEXPORT void (jl_cpu_pause)(void)
 {
     jl_cpu_pause();
@@ -500,6 +533,36 @@ JL_DLLEXPORT uint64_t jl_cumulative_recompile_time_ns(void)
     return jl_atomic_load_relaxed(&jl_cumulative_recompile_time);
 }
 
+// Lock contention profiling (see threading.c). While enabled, every
+// contended runtime lock acquisition is counted and its wait time recorded
+// in a per-lock log2-microsecond histogram.
+JL_DLLEXPORT void jl_lock_profile_enable(int enable)
+{
+    jl_atomic_store_relaxed(&jl_lock_profile_enabled, enable != 0);
+}
+
+JL_DLLEXPORT void jl_lock_profile_clear(void)
+{
+    jl_lock_profile_reset();
+}
+
+JL_DLLEXPORT int jl_lock_profile_nbuckets(void)
+{
+    return JL_LOCK_PROFILE_NBUCKETS;
+}
+
+// Read slot `i` of the profile table. Returns 1 and fills the outputs if the
+// slot records a lock (`name` may be NULL for locks that were never
+// registered by name), 0 if the slot is empty, and -1 once `i` is past the
+// end of the table. `hist` must have room for jl_lock_profile_nbuckets()
+// entries; bucket `b` counts waits in [2^b, 2^(b+1)) microseconds.
+JL_DLLEXPORT int jl_lock_profile_peek(int i, const char **name, void **lock,
+                                      uint64_t *ncontended, uint64_t *total_wait_ns,
+                                      uint64_t *hist)
+{
+    return jl_lock_profile_read(i, name, lock, ncontended, total_wait_ns, hist);
+}
+
 JL_DLLEXPORT void jl_get_fenv_consts(int *ret)
 {
     ret[0] = FE_INEXACT;
@@ -41,6 +41,7 @@ JL_DLLEXPORT void jl_init_options(void)
                         0,    // nthreadpools
                         0,    // nthreads
                         NULL, // nthreads_per_pool
+                        0,    // ngcthreads
                         0,    // nprocs
                         NULL, // machine_file
                         NULL, // project
@@ -87,6 +88,8 @@ JL_DLLEXPORT void jl_init_options(void)
                         0, // strip-metadata
                         0, // strip-ir
                         0, // heap-size-hint
+                        0, // task-sleep-threshold
+                        1, // gc-promotion-age
     };
     jl_options_initialized = 1;
 }
@@ -128,6 +131,8 @@ static const char opts[]  =
     "                           interface if supported (Linux and Windows) or to the number of CPU\n"
     "                           threads if not supported (MacOS) or if process affinity is not\n"
     "                           configured, and sets M to 1.\n"
+    " --gcthreads=N             Use N threads for the garbage collector's parallel phases\n"
+    "                           (default: 1; \"auto\" currently means the same as -t auto)\n"
     " -p, --procs {N|auto}      Integer value N launches N additional local worker processes\n"
     "                           \"auto\" launches as many workers as the number of local CPU threads (logical cores)\n"
     " --machine-file <file>     Run processes on hosts listed in <file>\n\n"
@@ -183,7 +188,9 @@ static const char opts[]  =
     "                            --bug-report=help.\n\n"
 
     " --heap-size-hint=<size>    Forces garbage collection if memory usage is higher than that value.\n"
-    "                            The memory hint might be specified in megabytes(500M) or gigabytes(1G)\n\n"
+    "                            The memory hint might be specified in megabytes(500M) or gigabytes(1G)\n"
+    " --gc-promotion-age=<n>     Number of collections an object must survive before it is promoted\n"
+    "                            to the old generation (n must be between 1 and 3, default 1)\n\n"
 ;
 
 static const char opts_hidden[]  =
@@ -207,6 +214,10 @@ static const char opts_hidden[]  =
     " --trace-compile={stderr,name}\n"
     "                          Print precompile statements for methods compiled during execution or save to a path\n"
     " --image-codegen          Force generate code in imaging mode\n"
+
+    // task scheduler options
+    " --task-sleep-threshold={infinite|<ns>}\n"
+    "                          Minimum time an idle thread spins on the task queues before sleeping\n"
 ;
 
 JL_DLLEXPORT void jl_parse_opts(int *argcp, char ***argvp)
@@ -251,6 +262,9 @@ JL_DLLEXPORT void jl_parse_opts(int *argcp, char ***argvp)
            opt_strip_metadata,
            opt_strip_ir,
            opt_heap_size_hint,
+           opt_task_sleep_threshold,
+           opt_gc_promotion_age,
+           opt_gc_threads,
     };
     static const char* const shortopts = "+vhqH:e:E:L:J:C:it:p:O:g:";
     static const struct option longopts[] = {
@@ -275,6 +289,7 @@ JL_DLLEXPORT void jl_parse_opts(int *argcp, char ***argvp)
         { "cpu-target",      required_argument, 0, 'C' },
         { "procs",           required_argument, 0, 'p' },
         { "threads",         required_argument, 0, 't' },
+        { "gcthreads",       required_argument, 0, opt_gc_threads },
         { "machine-file",    required_argument, 0, opt_machine_file },
         { "project",         optional_argument, 0, opt_project },
         { "color",           required_argument, 0, opt_color },
@@ -310,6 +325,8 @@ JL_DLLEXPORT void jl_parse_opts(int *argcp, char ***argvp)
         { "strip-metadata",  no_argument,       0, opt_strip_metadata },
         { "strip-ir",        no_argument,       0, opt_strip_ir },
         { "heap-size-hint",  required_argument, 0, opt_heap_size_hint },
+        { "task-sleep-threshold", required_argument, 0, opt_task_sleep_threshold },
+        { "gc-promotion-age", required_argument, 0, opt_gc_promotion_age },
         { 0, 0, 0, 0 }
     };
 
@@ -813,6 +830,40 @@ restart_switch:
                 jl_errorf("julia: invalid argument to --heap-size-hint without memory size specified");
 
             break;
+        case opt_gc_threads:
+            if (!strcmp(optarg, "auto")) {
+                jl_options.ngcthreads = -1;
+            }
+            else {
+                char *endptr;
+                errno = 0;
+                long ngcthreads = strtol(optarg, &endptr, 10);
+                if (errno != 0 || endptr == optarg || *endptr != '\0' || ngcthreads < 1 || ngcthreads >= INT16_MAX)
+                    jl_errorf("julia: --gcthreads={auto|<n>}; n must be an integer >= 1");
+                jl_options.ngcthreads = (int16_t)ngcthreads;
+            }
+            break;
+        case opt_task_sleep_threshold:
+            if (!strcmp(optarg, "infinite")) {
+                jl_options.task_sleep_threshold = UINT64_MAX;
+            }
+            else {
+                char *endptr;
+                unsigned long long ns = strtoull(optarg, &endptr, 10);
+                if (endptr == optarg || *endptr != '\0' || ns == 0)
+                    jl_errorf("julia: --task-sleep-threshold={infinite|<ns>}; nanoseconds must be a positive integer");
+                jl_options.task_sleep_threshold = (uint64_t)ns;
+            }
+            break;
+        case opt_gc_promotion_age: {
+            char *endptr;
+            errno = 0;
+            long age = strtol(optarg, &endptr, 10);
+            if (errno != 0 || endptr == optarg || *endptr != '\0' || age < 1 || age > 3)
+                jl_errorf("julia: --gc-promotion-age=<n>; n must be between 1 and 3");
+            jl_options.gc_promotion_age = (int8_t)age;
+            break;
+        }
         default:
             jl_errorf("julia: unhandled option -- %c\n"
                       "This is a bug, please report it.", c);
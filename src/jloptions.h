@@ -16,6 +16,7 @@ typedef struct {
     int8_t nthreadpools;
     int16_t nthreads;
     const int16_t *nthreads_per_pool;
+    int16_t ngcthreads;
     int32_t nprocs;
     const char *machine_file;
     const char *project;
@@ -58,6 +59,8 @@ typedef struct {
     int8_t strip_metadata;
     int8_t strip_ir;
     uint64_t heap_size_hint;
+    uint64_t task_sleep_threshold;
+    int8_t gc_promotion_age;
 } jl_options_t;
 
 #endif
@@ -856,7 +856,11 @@ static void cache_insert_type_linear(jl_datatype_t *type, ssize_t insert_at)
         n = jl_svec_len(nc);
     }
     assert(jl_svecref(cache, insert_at) == jl_nothing);
-    jl_svecset(cache, insert_at, (jl_value_t*)type); // todo: make this an atomic-store
+    // release-publish the fully initialized type: lookup_type_idx_linear scans
+    // this svec without holding typecache_lock, so the entry must not become
+    // visible before the datatype's fields are
+    jl_atomic_store_release((_Atomic(jl_value_t*)*)jl_svec_data(cache) + insert_at, (jl_value_t*)type);
+    jl_gc_wb(cache, type);
 }
 
 #ifndef NDEBUG
@@ -2692,7 +2696,7 @@ void jl_init_types(void) JL_GC_DISABLED
                         NULL,
                         jl_any_type,
                         jl_emptysvec,
-                        jl_perm_symsvec(15,
+                        jl_perm_symsvec(16,
                                         "next",
                                         "queue",
                                         "storage",
@@ -2704,11 +2708,12 @@ void jl_init_types(void) JL_GC_DISABLED
                                         "rngState1",
                                         "rngState2",
                                         "rngState3",
+                                        "rngState4",
                                         "_state",
                                         "sticky",
                                         "_isexception",
                                         "priority"),
-                        jl_svec(15,
+                        jl_svec(16,
                                 jl_any_type,
                                 jl_any_type,
                                 jl_any_type,
@@ -2720,6 +2725,7 @@ void jl_init_types(void) JL_GC_DISABLED
                                 jl_uint64_type,
                                 jl_uint64_type,
                                 jl_uint64_type,
+                                jl_uint64_type,
                                 jl_uint8_type,
                                 jl_bool_type,
                                 jl_bool_type,
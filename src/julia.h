@@ -229,6 +229,9 @@ typedef jl_value_t *(*jl_fptr_sparam_t)(jl_value_t*, jl_value_t**, uint32_t, jl_
 extern jl_call_t jl_fptr_interpret_call;
 JL_DLLEXPORT extern jl_callptr_t jl_fptr_interpret_call_addr;
 
+extern jl_call_t jl_fptr_interpret_lazy;
+JL_DLLEXPORT extern jl_callptr_t jl_fptr_interpret_lazy_addr;
+
 typedef struct _jl_line_info_node_t {
     struct _jl_module_t *module;
     jl_value_t *method;
@@ -590,6 +593,7 @@ typedef struct _jl_module_t {
     _Atomic(jl_svec_t*) bindings;
     _Atomic(jl_array_t*) bindingkeyset; // index lookup by name into bindings
     // hidden fields:
+    _Atomic(jl_binding_t*) last_binding; // most recently looked-up binding (always also in bindings)
     arraylist_t usings;  // modules with all bindings potentially imported
     jl_uuid_t build_id;
     jl_uuid_t uuid;
@@ -600,6 +604,7 @@ typedef struct _jl_module_t {
     int8_t compile;
     int8_t infer;
     uint8_t istopmod;
+    uint8_t sealed; // assigned bindings promised immutable; codegen may embed their values
     int8_t max_methods;
     jl_mutex_t lock;
     intptr_t hash;
@@ -842,6 +847,7 @@ extern void JL_GC_PUSH4(void *, void *, void *, void *)  JL_NOTSAFEPOINT;
 extern void JL_GC_PUSH5(void *, void *, void *, void *, void *)  JL_NOTSAFEPOINT;
 extern void JL_GC_PUSH7(void *, void *, void *, void *, void *, void *, void *)  JL_NOTSAFEPOINT;
 extern void JL_GC_PUSH8(void *, void *, void *, void *, void *, void *, void *, void *)  JL_NOTSAFEPOINT;
+extern void JL_GC_PUSH9(void *, void *, void *, void *, void *, void *, void *, void *, void *)  JL_NOTSAFEPOINT;
 extern void _JL_GC_PUSHARGS(jl_value_t **, size_t) JL_NOTSAFEPOINT;
 // This is necessary, because otherwise the analyzer considers this undefined
 // behavior and terminates the exploration
@@ -884,6 +890,9 @@ extern void JL_GC_POP() JL_NOTSAFEPOINT;
 #define JL_GC_PUSH8(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8)                                     \
   void *__gc_stkf[] = {(void*)JL_GC_ENCODE_PUSH(8), jl_pgcstack, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8}; \
   jl_pgcstack = (jl_gcframe_t*)__gc_stkf;
+#define JL_GC_PUSH9(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9)                               \
+  void *__gc_stkf[] = {(void*)JL_GC_ENCODE_PUSH(9), jl_pgcstack, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9}; \
+  jl_pgcstack = (jl_gcframe_t*)__gc_stkf;
 
 
 #define JL_GC_PUSHARGS(rts_var,n)                                                                       \
@@ -907,6 +916,10 @@ typedef enum {
 } jl_gc_collection_t;
 
 JL_DLLEXPORT void jl_gc_collect(jl_gc_collection_t);
+// runtime-adjustable stop-the-world pause budget (0 disables it); also
+// settable at startup via JULIA_GC_PAUSE_TARGET_MS
+JL_DLLEXPORT void jl_gc_set_pause_target_ms(uint64_t ms);
+JL_DLLEXPORT uint64_t jl_gc_get_pause_target_ms(void);
 
 JL_DLLEXPORT void jl_gc_add_finalizer(jl_value_t *v, jl_function_t *f) JL_NOTSAFEPOINT;
 JL_DLLEXPORT void jl_gc_add_ptr_finalizer(jl_ptls_t ptls, jl_value_t *v, void *f) JL_NOTSAFEPOINT;
@@ -923,6 +936,10 @@ JL_DLLEXPORT void jl_free_stack(void *stkbuf, size_t bufsz);
 JL_DLLEXPORT void jl_gc_use(jl_value_t *a);
 // Set GC memory trigger in bytes for greedy memory collecting
 JL_DLLEXPORT void jl_gc_set_max_memory(uint64_t max_mem);
+// Start allocating from fresh pool pages, segregating objects allocated
+// before and after the call; bracket phases whose objects die together so
+// the sweep can release their pages wholesale
+JL_DLLEXPORT void jl_gc_retire_alloc_pages(void);
 
 JL_DLLEXPORT void jl_clear_malloc_data(void);
 
@@ -960,6 +977,7 @@ STATIC_INLINE void jl_gc_multi_wb(const void *parent, const jl_value_t *ptr) JL_
 }
 
 JL_DLLEXPORT void *jl_gc_managed_malloc(size_t sz);
+JL_DLLEXPORT void *jl_gc_managed_malloc_zeroed(size_t sz);
 JL_DLLEXPORT void *jl_gc_managed_realloc(void *d, size_t sz, size_t oldsz,
                                          int isaligned, jl_value_t *owner);
 JL_DLLEXPORT void jl_gc_safepoint(void);
@@ -1169,6 +1187,34 @@ static inline int jl_field_isptr(jl_datatype_t *st, int i) JL_NOTSAFEPOINT
     return ((const jl_fielddesc8_t*)(jl_dt_layout_fields(ly) + jl_fielddesc_size(ly->fielddesc_type) * i))->isptr;
 }
 
+// decode offset, size and isptr of field i with a single dispatch on the
+// fielddesc width, for runtime paths that need more than one of them
+static inline void jl_field_getdesc(jl_datatype_t *st, int i, uint32_t *offset,
+                                    uint32_t *size, int *isptr) JL_NOTSAFEPOINT
+{
+    const jl_datatype_layout_t *ly = st->layout;
+    assert(i >= 0 && (size_t)i < ly->nfields);
+    if (ly->fielddesc_type == 0) {
+        const jl_fielddesc8_t *d = (const jl_fielddesc8_t*)jl_dt_layout_fields(ly) + i;
+        *offset = d->offset;
+        *size = d->size;
+        *isptr = d->isptr;
+    }
+    else if (ly->fielddesc_type == 1) {
+        const jl_fielddesc16_t *d = (const jl_fielddesc16_t*)jl_dt_layout_fields(ly) + i;
+        *offset = d->offset;
+        *size = d->size;
+        *isptr = d->isptr;
+    }
+    else {
+        assert(ly->fielddesc_type == 2);
+        const jl_fielddesc32_t *d = (const jl_fielddesc32_t*)jl_dt_layout_fields(ly) + i;
+        *offset = d->offset;
+        *size = d->size;
+        *isptr = d->isptr;
+    }
+}
+
 static inline uint32_t jl_ptr_offset(jl_datatype_t *st, int i) JL_NOTSAFEPOINT
 {
     const jl_datatype_layout_t *ly = st->layout;
@@ -1422,6 +1468,7 @@ JL_DLLEXPORT int jl_has_typevar_from_unionall(jl_value_t *t, jl_unionall_t *ua);
 JL_DLLEXPORT int jl_subtype_env_size(jl_value_t *t) JL_NOTSAFEPOINT;
 JL_DLLEXPORT int jl_subtype_env(jl_value_t *x, jl_value_t *y, jl_value_t **env, int envsz);
 JL_DLLEXPORT int jl_isa(jl_value_t *a, jl_value_t *t);
+JL_DLLEXPORT size_t jl_isa_many(jl_value_t **values, size_t n, jl_value_t *t);
 JL_DLLEXPORT int jl_types_equal(jl_value_t *a, jl_value_t *b);
 JL_DLLEXPORT int jl_is_not_broken_subtype(jl_value_t *a, jl_value_t *b);
 JL_DLLEXPORT jl_value_t *jl_type_union(jl_value_t **ts, size_t n);
@@ -1561,6 +1608,8 @@ JL_DLLEXPORT jl_value_t *jl_get_nth_field(jl_value_t *v, size_t i);
 // Like jl_get_nth_field above, but asserts if it needs to allocate
 JL_DLLEXPORT jl_value_t *jl_get_nth_field_noalloc(jl_value_t *v JL_PROPAGATES_ROOT, size_t i) JL_NOTSAFEPOINT;
 JL_DLLEXPORT jl_value_t *jl_get_nth_field_checked(jl_value_t *v, size_t i);
+// Like jl_get_nth_field_checked, but the load carries the given atomic ordering
+JL_DLLEXPORT jl_value_t *jl_get_nth_field_checked_ordered(jl_value_t *v, size_t i, enum jl_memory_order order);
 JL_DLLEXPORT void        jl_set_nth_field(jl_value_t *v, size_t i, jl_value_t *rhs);
 JL_DLLEXPORT int         jl_field_isdefined(jl_value_t *v, size_t i) JL_NOTSAFEPOINT;
 JL_DLLEXPORT int         jl_field_isdefined_checked(jl_value_t *v, size_t i);
@@ -1577,6 +1626,8 @@ JL_DLLEXPORT jl_array_t *jl_ptr_to_array_1d(jl_value_t *atype, void *data,
                                             size_t nel, int own_buffer);
 JL_DLLEXPORT jl_array_t *jl_ptr_to_array(jl_value_t *atype, void *data,
                                          jl_value_t *dims, int own_buffer);
+JL_DLLEXPORT void jl_array_dump_file(jl_array_t *a, const char *fname);
+JL_DLLEXPORT jl_array_t *jl_array_restore_mmap(jl_value_t *atype, const char *fname);
 
 JL_DLLEXPORT jl_array_t *jl_alloc_array_1d(jl_value_t *atype, size_t nr);
 JL_DLLEXPORT jl_array_t *jl_alloc_array_2d(jl_value_t *atype, size_t nr,
@@ -1648,6 +1699,8 @@ JL_DLLEXPORT void jl_set_global(jl_module_t *m JL_ROOTING_ARGUMENT, jl_sym_t *va
 JL_DLLEXPORT void jl_set_const(jl_module_t *m JL_ROOTING_ARGUMENT, jl_sym_t *var, jl_value_t *val JL_ROOTED_ARGUMENT);
 JL_DLLEXPORT void jl_checked_assignment(jl_binding_t *b, jl_module_t *mod, jl_sym_t *var, jl_value_t *rhs JL_MAYBE_UNROOTED);
 JL_DLLEXPORT void jl_declare_constant(jl_binding_t *b, jl_module_t *mod, jl_sym_t *var);
+JL_DLLEXPORT void jl_module_seal(jl_module_t *m);
+JL_DLLEXPORT int jl_module_sealed(jl_module_t *m);
 JL_DLLEXPORT void jl_module_using(jl_module_t *to, jl_module_t *from);
 JL_DLLEXPORT void jl_module_use(jl_module_t *to, jl_module_t *from, jl_sym_t *s);
 JL_DLLEXPORT void jl_module_use_as(jl_module_t *to, jl_module_t *from, jl_sym_t *s, jl_sym_t *asname);
@@ -1668,6 +1721,14 @@ JL_DLLEXPORT jl_value_t *jl_eqtable_get(jl_array_t *h JL_PROPAGATES_ROOT, jl_val
 JL_DLLEXPORT jl_value_t *jl_eqtable_pop(jl_array_t *h, jl_value_t *key, jl_value_t *deflt, int *found);
 jl_value_t *jl_eqtable_getkey(jl_array_t *h JL_PROPAGATES_ROOT, jl_value_t *key, jl_value_t *deflt) JL_NOTSAFEPOINT;
 
+// compact eq-table: dense insertion-ordered pair vector + int32 index table,
+// for tables iterated more often than probed (see iddict.c)
+JL_DLLEXPORT jl_array_t *jl_denseidtable_new(size_t sz);
+JL_DLLEXPORT void jl_denseidtable_put(jl_array_t *t, jl_value_t *key JL_ROOTED_ARGUMENT, jl_value_t *val JL_ROOTED_ARGUMENT, int *inserted);
+JL_DLLEXPORT jl_value_t *jl_denseidtable_get(jl_array_t *t JL_PROPAGATES_ROOT, jl_value_t *key, jl_value_t *deflt) JL_NOTSAFEPOINT;
+JL_DLLEXPORT jl_value_t *jl_denseidtable_pop(jl_array_t *t, jl_value_t *key, jl_value_t *deflt, int *found);
+JL_DLLEXPORT size_t jl_denseidtable_nextind(jl_array_t *t, size_t i);
+
 // system information
 JL_DLLEXPORT int jl_errno(void) JL_NOTSAFEPOINT;
 JL_DLLEXPORT void jl_set_errno(int e) JL_NOTSAFEPOINT;
@@ -1841,6 +1902,7 @@ JL_DLLEXPORT jl_value_t *jl_copy_ast(jl_value_t *expr JL_MAYBE_UNROOTED);
 // IR representation
 JL_DLLEXPORT jl_array_t *jl_compress_ir(jl_method_t *m, jl_code_info_t *code);
 JL_DLLEXPORT jl_code_info_t *jl_uncompress_ir(jl_method_t *m, jl_code_instance_t *metadata, jl_array_t *data);
+JL_DLLEXPORT jl_code_info_t *jl_uncompress_ir_stmts(jl_method_t *m, jl_code_instance_t *metadata, jl_array_t *data);
 JL_DLLEXPORT uint8_t jl_ir_flag_inferred(jl_array_t *data) JL_NOTSAFEPOINT;
 JL_DLLEXPORT uint8_t jl_ir_flag_inlining(jl_array_t *data) JL_NOTSAFEPOINT;
 JL_DLLEXPORT uint8_t jl_ir_flag_pure(jl_array_t *data) JL_NOTSAFEPOINT;
@@ -1872,6 +1934,8 @@ STATIC_INLINE int jl_vinfo_usedundef(uint8_t vi)
 // calling into julia ---------------------------------------------------------
 
 JL_DLLEXPORT jl_value_t *jl_apply_generic(jl_value_t *F, jl_value_t **args, uint32_t nargs);
+JL_DLLEXPORT void jl_apply_generic_batch(jl_value_t *F, jl_value_t **args, uint32_t nargs,
+                                         size_t nbatch, jl_value_t **results);
 JL_DLLEXPORT jl_value_t *jl_invoke(jl_value_t *F, jl_value_t **args, uint32_t nargs, jl_method_instance_t *meth);
 JL_DLLEXPORT int32_t jl_invoke_api(jl_code_instance_t *linfo);
 
@@ -1913,6 +1977,8 @@ typedef struct _jl_handler_t {
     size_t world_age;
 } jl_handler_t;
 
+#define JL_RNG_SIZE 5 // xoshiro 4 + splitmix 1
+
 typedef struct _jl_task_t {
     JL_DATA_TYPE
     jl_value_t *next; // invasive linked list for scheduler
@@ -1922,7 +1988,9 @@ typedef struct _jl_task_t {
     jl_value_t *result;
     jl_value_t *logstate;
     jl_function_t *start;
-    uint64_t rngState[4];
+    // four xoshiro256 words, plus one internal splitmix word that seeds the
+    // states of child tasks without perturbing the visible random stream
+    uint64_t rngState[JL_RNG_SIZE];
     _Atomic(uint8_t) _state;
     uint8_t sticky; // record whether this Task can be migrated to a new thread
     _Atomic(uint8_t) _isexception; // set if `result` is an exception to throw or that we exited with
@@ -1950,6 +2018,17 @@ typedef struct _jl_task_t {
     uint64_t inference_start_time; // time when inference started
     uint16_t reentrant_inference; // How many times we've reentered inference
     uint16_t reentrant_timing; // How many times we've reentered timing
+    // bytes of GC-managed memory allocated while this task was scheduled,
+    // plus the totals of completed child tasks (rolled up at their final
+    // context switch), for per-task memory attribution
+    _Atomic(int64_t) alloc_bytes;
+    // snapshot of the owning thread's `gc_num.allocd` when this task was
+    // switched in; only meaningful while the task is running
+    int64_t alloc_base;
+    // the task that created this one (the rollup target for alloc_bytes);
+    // cleared once the rollup has happened. Kept alive by the task scan
+    // in the GC, which rescans tasks on every collection.
+    struct _jl_task_t *parent_task;
     unsigned int copy_stack:31; // sizeof stack for copybuf
     unsigned int started:1;
 } jl_task_t;
@@ -1962,6 +2041,7 @@ JL_DLLEXPORT jl_task_t *jl_new_task(jl_function_t*, jl_value_t*, size_t);
 JL_DLLEXPORT void jl_switchto(jl_task_t **pt);
 JL_DLLEXPORT int jl_set_task_tid(jl_task_t *task, int16_t tid) JL_NOTSAFEPOINT;
 JL_DLLEXPORT int jl_set_task_threadpoolid(jl_task_t *task, int8_t tpid) JL_NOTSAFEPOINT;
+JL_DLLEXPORT int64_t jl_task_allocated_bytes(jl_task_t *task) JL_NOTSAFEPOINT;
 JL_DLLEXPORT void JL_NORETURN jl_throw(jl_value_t *e JL_MAYBE_UNROOTED);
 JL_DLLEXPORT void JL_NORETURN jl_rethrow(void);
 JL_DLLEXPORT void JL_NORETURN jl_sig_throw(void);
@@ -2006,6 +2086,26 @@ void (ijl_longjmp)(jmp_buf _Buf, int _Value);
 #define jl_longjmp(a,b) longjmp(a,b)
 #define jl_setjmp_f    setjmp
 #define jl_setjmp_name "setjmp"
+#elif (defined(_OS_LINUX_) || defined(_OS_FREEBSD_)) && defined(_CPU_X86_64_) && \
+      !defined(_COMPILER_ASAN_ENABLED_) && !defined(_COMPILER_TSAN_ENABLED_) && \
+      !defined(_COMPILER_MSAN_ENABLED_)
+// Lightweight handler registration: entering a try block only has to record
+// the callee-saved register file (including sp and ip). glibc's sigsetjmp
+// additionally goes through signal-mask plumbing, pointer mangling and
+// unwind checking on every entry, which dominates the cost of a try block
+// that never throws. This pair (defined in rtutils.c) stores just the eight
+// SysV callee-saved slots into the start of the much larger sigjmp_buf and
+// ignores the savemask argument; the rare site that needs sigsetjmp's
+// save-mask semantics must test JL_SETJMP_IGNORES_SAVEMASK and save and
+// restore the mask itself (see the interpreter's ENTER). Sanitizer builds
+// keep sigsetjmp, whose interceptors know how to unpoison the stack.
+JL_DLLEXPORT int __attribute__ ((__nothrow__,__returns_twice__)) jl_fast_setjmp(jl_jmp_buf _Buf, int _Savemask);
+JL_DLLEXPORT void __attribute__ ((__nothrow__,__noreturn__)) jl_fast_longjmp(jl_jmp_buf _Buf, int _Value);
+#define JL_SETJMP_IGNORES_SAVEMASK
+#define jl_setjmp_f    jl_fast_setjmp
+#define jl_setjmp_name "jl_fast_setjmp"
+#define jl_setjmp(a,b) jl_fast_setjmp(a,b)
+#define jl_longjmp(a,b) jl_fast_longjmp(a,b)
 #else
 // determine actual entry point name
 #if defined(sigsetjmp)
@@ -2071,6 +2171,7 @@ JL_DLLEXPORT struct uv_loop_s *jl_global_event_loop(void) JL_NOTSAFEPOINT;
 JL_DLLEXPORT void jl_close_uv(struct uv_handle_s *handle);
 
 JL_DLLEXPORT jl_array_t *jl_take_buffer(ios_t *s);
+JL_DLLEXPORT void jl_give_buffer(ios_t *s, jl_array_t *a);
 
 typedef struct {
     void *data;
@@ -2149,6 +2250,7 @@ JL_DLLEXPORT int jl_generating_output(void) JL_NOTSAFEPOINT;
 #define JL_OPTIONS_COMPILE_ON  1
 #define JL_OPTIONS_COMPILE_ALL 2
 #define JL_OPTIONS_COMPILE_MIN 3
+#define JL_OPTIONS_COMPILE_LAZY 4
 
 #define JL_OPTIONS_COLOR_AUTO 0
 #define JL_OPTIONS_COLOR_ON 1
@@ -34,6 +34,14 @@ JL_DLLEXPORT void jl_gc_set_cb_notify_external_alloc(jl_gc_cb_notify_external_al
 JL_DLLEXPORT void jl_gc_set_cb_notify_external_free(jl_gc_cb_notify_external_free_t cb,
         int enable);
 
+// Policy callback consulted for allocations at or above the
+// JULIA_GC_ALLOC_TRACK threshold. Return 0 to deny the allocation (it then
+// fails with OutOfMemoryError, like a failed malloc), nonzero to allow it.
+typedef int (*jl_gc_cb_large_alloc_policy_t)(size_t size);
+
+JL_DLLEXPORT void jl_gc_set_cb_large_alloc_policy(jl_gc_cb_large_alloc_policy_t cb,
+        int enable);
+
 // Types for custom mark and sweep functions.
 typedef uintptr_t (*jl_markfunc_t)(jl_ptls_t, jl_value_t *obj);
 typedef void (*jl_sweepfunc_t)(jl_value_t *obj);
@@ -321,6 +321,32 @@ extern JL_DLLEXPORT size_t jl_page_size;
 extern jl_function_t *jl_typeinf_func JL_GLOBALLY_ROOTED;
 extern JL_DLLEXPORT size_t jl_typeinf_world;
 extern _Atomic(jl_typemap_entry_t*) call_cache[N_CALL_CACHE] JL_GLOBALLY_ROOTED;
+// distinct runtime-dispatch targets seen while JULIA_DISPATCH_TRACE is set (gf.c)
+extern _Atomic(jl_method_instance_t*) dispatch_trace_set[N_DISPATCH_TRACE] JL_GLOBALLY_ROOTED;
+// memo table for env-free subtype queries on closed types (subtype.c); the
+// seqlock counter is odd while a writer owns the slot
+typedef struct {
+    _Atomic(uint32_t) ver;
+    _Atomic(jl_value_t*) a;
+    _Atomic(jl_value_t*) b;
+    _Atomic(uint8_t) result;
+} jl_subtype_cache_entry_t;
+extern jl_subtype_cache_entry_t jl_subtype_cache[N_SUBTYPE_CACHE] JL_GLOBALLY_ROOTED;
+extern jl_subtype_cache_entry_t jl_morespecific_cache[N_SUBTYPE_CACHE] JL_GLOBALLY_ROOTED;
+// memo table for whole-query type-intersection results on closed types
+// (subtype.c); same seqlock discipline as jl_subtype_cache_entry_t
+typedef struct {
+    _Atomic(uint32_t) ver;
+    _Atomic(uint8_t) issubty;
+    _Atomic(uint8_t) has_env; // the env slot was computed for this entry
+    _Atomic(jl_value_t*) a;
+    _Atomic(jl_value_t*) b;
+    _Atomic(jl_value_t*) ti;
+    _Atomic(jl_svec_t*) env;
+} jl_intersect_cache_entry_t;
+extern jl_intersect_cache_entry_t jl_intersect_cache[N_INTERSECT_CACHE] JL_GLOBALLY_ROOTED;
+// content-addressed cache of recently created small strings (array.c)
+extern _Atomic(jl_value_t*) jl_small_string_cache[N_SMALL_STRING_CACHE] JL_GLOBALLY_ROOTED;
 extern jl_array_t *jl_all_methods JL_GLOBALLY_ROOTED;
 
 JL_DLLEXPORT extern int jl_lineno;
@@ -330,6 +356,27 @@ jl_value_t *jl_gc_pool_alloc_noinline(jl_ptls_t ptls, int pool_offset,
                                    int osize);
 jl_value_t *jl_gc_big_alloc_noinline(jl_ptls_t ptls, size_t allocsz);
 JL_DLLEXPORT int jl_gc_classify_pools(size_t sz, int *osize) JL_NOTSAFEPOINT;
+
+// Allocator descriptor consumed by the final GC lowering pass: the strategy
+// an inline allocation sequence depends on, gathered in one place so that an
+// alternate allocator (a bump TLAB, a scoped heap) is swapped in here instead
+// of being patched into codegen at every emission site.
+typedef struct {
+    // classify `sz` (tag included) for the fast path: return the byte offset
+    // into jl_tls_states_t of the per-size-class allocator state and store
+    // the padded object size in `*osize`, or return -1 to route the
+    // allocation to `alloc_big`
+    int (*classify)(size_t sz, int *osize);
+    // runtime entry points the lowered code calls: `alloc_small(ptls, offset,
+    // osize)` for classified sizes, `alloc_big(ptls, sz + sizeof(void*))` for
+    // everything else; both must follow the GC allocation calling convention
+    // (sticky exceptions, returns a tagged value) and resolve in
+    // libjulia-internal
+    const char *alloc_small;
+    const char *alloc_big;
+} jl_gc_allocator_t;
+extern const jl_gc_allocator_t jl_gc_active_allocator; // defined in gc.c
+
 extern uv_mutex_t gc_perm_lock;
 void *jl_gc_perm_alloc_nolock(size_t sz, int zero,
     unsigned align, unsigned offset) JL_NOTSAFEPOINT;
@@ -580,6 +627,13 @@ void jl_gc_debug_print_status(void);
 JL_DLLEXPORT void jl_gc_debug_critical_error(void);
 void jl_print_gc_stats(JL_STREAM *s);
 void jl_gc_reset_alloc_count(void);
+void jl_gc_census_enable(int enable);
+JL_DLLEXPORT size_t jl_gc_sizeclass_stats(size_t len, uint32_t *osizes,
+                                          uint64_t *allocd, uint64_t *live,
+                                          uint64_t *free_slots, uint64_t *pages,
+                                          uint64_t *epoch);
+size_t jl_gc_census_read(jl_value_t **types, uint64_t *counts, uint64_t *bytes,
+                         size_t len, uint64_t *epoch);
 uint32_t jl_get_gs_ctr(void);
 void jl_set_gs_ctr(uint32_t ctr);
 
@@ -615,6 +669,7 @@ JL_DLLEXPORT jl_code_info_t *jl_type_infer(jl_method_instance_t *li, size_t worl
 JL_DLLEXPORT jl_code_instance_t *jl_compile_method_internal(jl_method_instance_t *meth JL_PROPAGATES_ROOT, size_t world);
 jl_code_instance_t *jl_generate_fptr(jl_method_instance_t *mi JL_PROPAGATES_ROOT, size_t world);
 void jl_generate_fptr_for_unspecialized(jl_code_instance_t *unspec);
+JL_DLLEXPORT void jl_reoptimize_codeinst(jl_code_instance_t *codeinst);
 JL_DLLEXPORT jl_code_instance_t *jl_get_method_inferred(
         jl_method_instance_t *mi JL_PROPAGATES_ROOT, jl_value_t *rettype,
         size_t min_world, size_t max_world);
@@ -739,6 +794,7 @@ jl_value_t *jl_call_scm_on_ast(const char *funcname, jl_value_t *expr, jl_module
 
 jl_method_instance_t *jl_method_lookup(jl_value_t **args, size_t nargs, size_t world);
 
+JL_DLLEXPORT jl_value_t *jl_apply_generic_cached(jl_value_t *F, jl_value_t **args, uint32_t nargs, jl_svec_t *cache);
 jl_value_t *jl_gf_invoke_by_method(jl_method_t *method, jl_value_t *gf, jl_value_t **args, size_t nargs);
 jl_value_t *jl_gf_invoke(jl_value_t *types, jl_value_t *f, jl_value_t **args, size_t nargs);
 JL_DLLEXPORT jl_value_t *jl_gf_invoke_lookup_worlds(jl_value_t *types, jl_value_t *mt, size_t world, size_t *min_world, size_t *max_world);
@@ -755,6 +811,10 @@ jl_methtable_t *jl_kwmethod_table_for(
     jl_value_t *argtypes JL_PROPAGATES_ROOT) JL_NOTSAFEPOINT;
 JL_DLLEXPORT jl_methtable_t *jl_method_get_table(
     jl_method_t *method JL_PROPAGATES_ROOT) JL_NOTSAFEPOINT;
+JL_DLLEXPORT void jl_mt_cache_restore(jl_tupletype_t *tt, jl_method_instance_t *mi, size_t world);
+jl_method_t *jl_mt_dispatch_cached(jl_value_t *tt, size_t world);
+JL_DLLEXPORT void jl_record_sealed_dependency(jl_module_t *m, jl_method_instance_t *caller);
+void jl_module_break_seal(jl_module_t *m);
 jl_methtable_t *jl_argument_method_table(jl_value_t *argt JL_PROPAGATES_ROOT);
 
 JL_DLLEXPORT int jl_pointer_egal(jl_value_t *t);
@@ -859,6 +919,13 @@ void jl_init_runtime_ccall(void);
 void jl_init_intrinsic_functions(void);
 void jl_init_intrinsic_properties(void);
 void jl_init_tasks(void) JL_GC_DISABLED;
+void jl_memops_init(void);
+// runtime-internal memcpy/memset with CPU-selected strategies (memops.c);
+// the _nt variant is for destinations known to be cold, e.g. freshly
+// allocated buffers, and prefers non-temporal stores
+JL_DLLEXPORT void *jl_memcpy(void *dst, const void *src, size_t n) JL_NOTSAFEPOINT;
+JL_DLLEXPORT void *jl_memset(void *dst, int c, size_t n) JL_NOTSAFEPOINT;
+JL_DLLEXPORT void *jl_memcpy_nt(void *dst, const void *src, size_t n) JL_NOTSAFEPOINT;
 void jl_init_stack_limits(int ismaster, void **stack_hi, void **stack_lo) JL_NOTSAFEPOINT;
 jl_task_t *jl_init_root_task(jl_ptls_t ptls, void *stack_lo, void *stack_hi);
 void jl_init_serializer(void);
@@ -876,7 +943,13 @@ extern JL_DLLEXPORT ssize_t jl_tls_offset;
 extern JL_DLLEXPORT const int jl_tls_elf_support;
 void jl_init_threading(void);
 void jl_start_threads(void);
+// two-phase variant of jl_start_threads: spawn the worker OS threads early
+// (they park until released), then let them initialize once the runtime is up
+void jl_spawn_threads(void);
+void jl_release_threads(void);
 int jl_effective_threads(void);
+// number of threads requested for the GC's parallel phases (--gcthreads)
+extern int jl_n_gcthreads;
 
 // Whether the GC is running
 extern char *jl_safepoint_pages;
@@ -886,6 +959,9 @@ STATIC_INLINE int jl_addr_is_safepoint(uintptr_t addr)
     return addr >= safepoint_addr && addr < safepoint_addr + jl_page_size * 3;
 }
 extern _Atomic(uint32_t) jl_gc_running;
+// nonzero when the membarrier-based rendezvous replaces page protection for
+// stopping threads (JULIA_SAFEPOINT_MEMBARRIER, see safepoint.c)
+extern JL_DLLEXPORT int jl_safepoint_membarrier_enabled;
 // All the functions are safe to be called from within a signal handler
 // provided that the thread will not be interrupted by another asynchronous
 // signal.
@@ -1181,10 +1257,19 @@ typedef int bt_context_t;
 typedef int bt_cursor_t;
 #endif
 size_t rec_backtrace(jl_bt_element_t *bt_data, size_t maxsize, int skip) JL_NOTSAFEPOINT;
+// Frame-pointer-based fast unwind of the current stack; falls back to
+// `rec_backtrace` where frame-pointer walking is unsupported.
+size_t rec_backtrace_fp(jl_bt_element_t *bt_data, size_t maxsize, int skip) JL_NOTSAFEPOINT;
 // Record backtrace from a signal handler. `ctx` is the context of the code
 // which was asynchronously interrupted.
 size_t rec_backtrace_ctx(jl_bt_element_t *bt_data, size_t maxsize, bt_context_t *ctx,
                          jl_gcframe_t *pgcstack) JL_NOTSAFEPOINT;
+// Frame-pointer-based fast unwind for the sampling profiler; falls back to
+// `rec_backtrace_ctx` where frame-pointer walking is unsupported.
+size_t rec_backtrace_ctx_fp(jl_bt_element_t *bt_data, size_t maxsize, bt_context_t *ctx,
+                            jl_gcframe_t *pgcstack) JL_NOTSAFEPOINT;
+int jl_profile_use_fp_unwind(void) JL_NOTSAFEPOINT;
+int jl_error_fp_backtrace(void) JL_NOTSAFEPOINT;
 #ifdef LLVMLIBUNWIND
 size_t rec_backtrace_ctx_dwarf(jl_bt_element_t *bt_data, size_t maxsize, bt_context_t *ctx, jl_gcframe_t *pgcstack) JL_NOTSAFEPOINT;
 #endif
@@ -1192,9 +1277,13 @@ JL_DLLEXPORT jl_value_t *jl_get_backtrace(void);
 void jl_critical_error(int sig, int si_code, bt_context_t *context, jl_task_t *ct);
 JL_DLLEXPORT void jl_raise_debugger(void);
 int jl_getFunctionInfo(jl_frame_t **frames, uintptr_t pointer, int skipC, int noInline) JL_NOTSAFEPOINT;
+int jl_object_for_ip(size_t ip, uint64_t *fbase, char **fname) JL_NOTSAFEPOINT;
 JL_DLLEXPORT void jl_gdblookup(void* ip) JL_NOTSAFEPOINT;
 void jl_print_native_codeloc(uintptr_t ip) JL_NOTSAFEPOINT;
 void jl_print_bt_entry_codeloc(jl_bt_element_t *bt_data) JL_NOTSAFEPOINT;
+// compact relocatable serialization of a backtrace buffer (stackwalk.c)
+JL_DLLEXPORT jl_array_t *jl_serialize_backtrace(jl_bt_element_t *bt_data, size_t bt_size);
+JL_DLLEXPORT jl_array_t *jl_serialize_current_backtrace(void);
 #ifdef _OS_WINDOWS_
 JL_DLLEXPORT void jl_refresh_dbg_module_list(void);
 #endif
@@ -1223,12 +1312,22 @@ JL_DLLEXPORT size_t jl_capture_interp_frame(jl_bt_element_t *bt_data,
 struct _jl_excstack_t { // typedef in julia.h
     size_t top;
     size_t reserved_size;
+    // nonzero when this is a pre-committed emergency arena rather than a
+    // GC-managed buffer (see jl_push_excstack): 1 for a single-use malloc'd
+    // overflow arena (freed once released), otherwise the jl_ptls_t owning
+    // this per-thread arena. Such a stack must not be gc_setmark_buf'd, and
+    // regular pushes migrate off of it.
+    size_t preallocated;
     // Pack all stack entries into a growable buffer to amortize allocation
     // across repeated exception handling.
     // Layout: [bt_data1... bt_size1 exc1  bt_data2... bt_size2 exc2  ..]
     // jl_bt_element_t data[]; // Access with jl_excstack_raw
 };
 
+// entries of the per-thread emergency exception stack; deep backtraces are
+// truncated to fit rather than allocating while out of memory
+#define JL_EMERGENCY_EXCSTACK_SIZE 4096
+
 STATIC_INLINE jl_bt_element_t *jl_excstack_raw(jl_excstack_t *stack) JL_NOTSAFEPOINT
 {
     return (jl_bt_element_t*)(stack + 1);
@@ -1258,6 +1357,37 @@ void jl_push_excstack(jl_excstack_t **stack JL_REQUIRE_ROOTED_SLOT JL_ROOTING_AR
                       jl_value_t *exception JL_ROOTED_ARGUMENT,
                       jl_bt_element_t *bt_data, size_t bt_size);
 
+//--------------------------------------------------
+// Per-thread hierarchical timer wheel for task wakeup deadlines (partr.c).
+// Level k turns once every JL_TIMER_WHEEL_SLOTS^k ticks, so the wheel spans
+// SLOTS^LEVELS ticks; later deadlines park in the furthest slots and cascade
+// closer as the wheel advances. `add`/`cancel` are O(1), touch only the
+// calling thread's wheel and take no locks; expired entries are rescheduled
+// from `jl_task_get_next`.
+#define JL_TIMER_WHEEL_BITS 6
+#define JL_TIMER_WHEEL_SLOTS (1 << JL_TIMER_WHEEL_BITS)
+#define JL_TIMER_WHEEL_LEVELS 4
+#define JL_TIMER_WHEEL_TICK_NS 1000000 // 1ms granularity
+
+typedef struct _jl_timer_node_t {
+    struct _jl_timer_node_t *next;
+    struct _jl_timer_node_t **pprev; // address of the link pointing at this node
+    struct _jl_task_t *task; // kept alive by jl_gc_queue_thread_local
+    uint64_t deadline_ns; // absolute, in jl_hrtime time
+} jl_timer_node_t;
+
+typedef struct _jl_timer_wheel_t {
+    jl_timer_node_t *slots[JL_TIMER_WHEEL_LEVELS][JL_TIMER_WHEEL_SLOTS];
+    uint64_t last_tick; // tick up to which expiry has run
+    size_t count;
+} jl_timer_wheel_t;
+
+// Register a wakeup for `task` at `deadline_ns` on the calling thread's
+// wheel; returns a handle for jl_timer_wheel_cancel. Both may only be
+// called from the thread that owns the wheel.
+JL_DLLEXPORT void *jl_timer_wheel_add(jl_task_t *task, uint64_t deadline_ns);
+JL_DLLEXPORT void jl_timer_wheel_cancel(void *handle);
+
 //--------------------------------------------------
 // congruential random number generator
 // for a small amount of thread-local randomness
@@ -1290,10 +1420,22 @@ void win32_formatmessage(DWORD code, char *reason, int len) JL_NOTSAFEPOINT;
 
 JL_DLLEXPORT void *jl_get_library_(const char *f_lib, int throw_err);
 #define jl_get_library(f_lib) jl_get_library_(f_lib, 1)
+// concurrent startup library preload (dlload.c / runtime_ccall.cpp)
+void jl_preload_libraries_start(void);
+void jl_preload_libraries_finish(void);
+void jl_preload_register_library(const char *name, void *hnd);
 JL_DLLEXPORT void *jl_load_and_lookup(const char *f_lib, const char *f_name, _Atomic(void*) *hnd);
 JL_DLLEXPORT void *jl_lazy_load_and_lookup(jl_value_t *lib_val, const char *f_name);
+// per-call-site cfunction trampoline cache: a write-once inline cache of the
+// first permanent (immortal) resolution, read without the trampoline lock, in
+// front of the locked hash table keyed by (fobj, vals)
+typedef struct {
+    _Atomic(jl_value_t*) ic_fobj;
+    _Atomic(jl_value_t*) ic_result;
+    htable_t tab;
+} jl_cfunc_cache_t;
 JL_DLLEXPORT jl_value_t *jl_get_cfunction_trampoline(
-    jl_value_t *fobj, jl_datatype_t *result, htable_t *cache, jl_svec_t *fill,
+    jl_value_t *fobj, jl_datatype_t *result, jl_cfunc_cache_t *cache, jl_svec_t *fill,
     void *(*init_trampoline)(void *tramp, void **nval),
     jl_unionall_t *env, jl_value_t **vals);
 
@@ -1411,6 +1553,11 @@ JL_DLLEXPORT int jl_stored_inline(jl_value_t *el_type);
 JL_DLLEXPORT jl_value_t *(jl_array_data_owner)(jl_array_t *a);
 JL_DLLEXPORT int jl_array_isassigned(jl_array_t *a, size_t i);
 JL_DLLEXPORT jl_array_t *jl_array_copy(jl_array_t *ary);
+JL_DLLEXPORT int jl_array_isequal_bits(jl_array_t *a, jl_array_t *b);
+JL_DLLEXPORT jl_array_t *jl_array_gather_field(jl_array_t *a, size_t fld);
+JL_DLLEXPORT void jl_array_scatter_field(jl_array_t *a, size_t fld, jl_array_t *vals);
+JL_DLLEXPORT void jl_array_copyto_strided(jl_array_t *dest, size_t doffs, size_t ds,
+                                          jl_array_t *src, size_t soffs, size_t ss, size_t n);
 
 JL_DLLEXPORT uintptr_t jl_object_id_(jl_value_t *tv, jl_value_t *v) JL_NOTSAFEPOINT;
 JL_DLLEXPORT void jl_set_next_task(jl_task_t *task) JL_NOTSAFEPOINT;
@@ -1420,6 +1567,15 @@ JL_DLLEXPORT void jl_set_next_task(jl_task_t *task) JL_NOTSAFEPOINT;
 extern jl_mutex_t typecache_lock;
 extern JL_DLLEXPORT jl_mutex_t jl_codegen_lock;
 
+// lock contention profiling (threading.c); queried through jlapi.c
+#define JL_LOCK_PROFILE_NBUCKETS 16
+extern _Atomic(int) jl_lock_profile_enabled;
+void jl_lock_profile_name(jl_mutex_t *lock, const char *name) JL_NOTSAFEPOINT;
+int jl_lock_profile_read(int i, const char **name, void **lock,
+                         uint64_t *ncontended, uint64_t *total_wait_ns,
+                         uint64_t *hist) JL_NOTSAFEPOINT;
+void jl_lock_profile_reset(void) JL_NOTSAFEPOINT;
+
 #if defined(__APPLE__)
 void jl_mach_gc_end(void);
 #endif
@@ -1485,6 +1641,11 @@ struct typemap_intersection_env {
     jl_value_t *ti; // intersection type
     jl_svec_t *env; // intersection env (initialize to null to perform intersection without an environment)
     int issubty;    // if `a <: b` is true in `intersect(a,b)`
+    // cooperative cancellation: remaining entry-visit budget for this query,
+    // decremented once per typemap entry intersected; 0 means unlimited. When
+    // it runs out the traversal aborts (as if the visitor returned 0), so a
+    // caller that sets it must treat an abort as "analysis too expensive".
+    size_t budget;
 };
 int jl_typemap_intersection_visitor(jl_typemap_t *a, int offs, struct typemap_intersection_env *closure);
 
@@ -1627,6 +1788,16 @@ void jl_register_fptrs(uint64_t image_base, const struct _jl_image_fptrs_t *fptr
                        jl_method_instance_t **linfos, size_t n);
 void jl_write_coverage_data(const char*);
 void jl_write_malloc_log(void);
+void jl_write_dispatch_trace(void);
+
+// Per-thread code coverage counter pages (coverage.cpp). Each thread owns a
+// fixed-size table of lazily allocated pages indexed by the counter slot that
+// codegen assigns to each instrumented line, so the emitted increment touches
+// only thread-private memory; the shards are summed at write-out.
+#define JL_COVERAGE_PAGE_LG2 14 // log2 of the number of counters per page
+#define JL_COVERAGE_PAGE_SIZE (1 << JL_COVERAGE_PAGE_LG2)
+#define JL_COVERAGE_MAX_PAGES 4096
+void jl_coverage_init_thread(jl_ptls_t ptls);
 
 #if jl_has_builtin(__builtin_unreachable) || defined(_COMPILER_GCC_) || defined(_COMPILER_INTEL_)
 #  define jl_unreachable() __builtin_unreachable()
@@ -1680,6 +1851,7 @@ JL_DLLEXPORT uint16_t julia__truncdfhf2(double param) JL_NOTSAFEPOINT;
 //JL_DLLEXPORT uint16_t julia__floatundihf(uint64_t n) JL_NOTSAFEPOINT;
 
 JL_DLLEXPORT uint32_t jl_crc32c(uint32_t crc, const char *buf, size_t len);
+JL_DLLEXPORT uint32_t jl_crc32c_combine(uint32_t crc1, uint32_t crc2, size_t len2);
 
 #ifdef __cplusplus
 }
@@ -18,6 +18,15 @@ extern "C" {
 JL_DLLEXPORT int16_t jl_threadid(void);
 JL_DLLEXPORT int8_t jl_threadpoolid(int16_t tid) JL_NOTSAFEPOINT;
 
+// Alignment attribute for thread-local fields that other threads write, so
+// they get a cache line of their own instead of bouncing the line holding
+// the state the owning thread reads on every allocation and safepoint.
+#if defined(_COMPILER_MICROSOFT_)
+#define JL_CACHELINE_ALIGNED __declspec(align(64))
+#else
+#define JL_CACHELINE_ALIGNED __attribute__((aligned(64)))
+#endif
+
 // JULIA_ENABLE_THREADING may be controlled by altering JULIA_THREADS in Make.user
 
 // When running into scheduler issues, this may help provide information on the
@@ -123,6 +132,7 @@ typedef struct {
     jl_taggedvalue_t *freelist;   // root of list of free objects
     jl_taggedvalue_t *newpages;   // root of list of chunks of free objects
     uint16_t osize;      // size of objects in this pool
+    uint16_t nrefill;    // refills since the last sweep; sizes the next page run
 } jl_gc_pool_t;
 
 typedef struct {
@@ -135,9 +145,32 @@ typedef struct {
     _Atomic(uint64_t) freecall;
 } jl_thread_gc_num_t;
 
+// Remembered-set storage: a singly-linked chain of fixed-size chunks. Chunks
+// never move once allocated and spent chunks are recycled through a per-thread
+// free list, so the write barrier (`jl_gc_queue_root`) can append without
+// taking malloc in steady state. Each chain is only ever appended to by one
+// thread at a time (the owning mutator, or the GC thread scanning on its
+// behalf while the world is stopped), so no synchronization is needed.
+#define JL_GC_REMSET_CHUNK_LEN 510 // sizes a chunk at one 4kB page on 64-bit
+typedef struct _jl_gc_remset_chunk_t {
+    struct _jl_gc_remset_chunk_t *next;
+    size_t len;
+    struct _jl_value_t *items[JL_GC_REMSET_CHUNK_LEN];
+} jl_gc_remset_chunk_t;
+
+typedef struct {
+    jl_gc_remset_chunk_t *head; // oldest chunk; scans start here
+    jl_gc_remset_chunk_t *tail; // newest chunk; the barrier appends here
+    size_t len;                 // total number of entries over all chunks
+} jl_gc_remset_t;
+
 typedef struct {
-    // variable for tracking weak references
+    // variables for tracking weak references; weak_refs holds young
+    // weakrefs and is scanned every collection, weak_refs_old holds entries
+    // whose weakref and referent are both old and is only touched when the
+    // old generation is (see sweep_weak_refs)
     arraylist_t weak_refs;
+    arraylist_t weak_refs_old;
     // live tasks started on this thread
     // that are holding onto a stack from the pool
     arraylist_t live_tasks;
@@ -149,12 +182,28 @@ typedef struct {
     // variables for tracking big objects
     struct _bigval_t *big_objects;
 
+    // cache of recently swept big-object blocks kept for reuse,
+    // so same-sized churn skips malloc/free entirely
+#define JL_GC_N_BIG_CACHE 16
+    struct _bigval_t *big_cache[JL_GC_N_BIG_CACHE];
+
+    // ring of pool pages this thread freed recently; page refills check these
+    // before scanning the global free map, so a thread prefers reusing pages
+    // whose memory it first touched (node-local under first-touch NUMA
+    // placement). Entries are hints only and are revalidated against the
+    // free map on use. Guarded by gc_perm_lock.
+#define JL_GC_N_PAGE_HINT 32
+    struct _jl_gc_pagemeta_t *page_hint[JL_GC_N_PAGE_HINT];
+    int page_hint_top;
+
     // variables for tracking "remembered set"
-    arraylist_t _remset[2]; // contains jl_value_t*
+    jl_gc_remset_t _remset[2]; // contains jl_value_t*
     // lower bound of the number of pointers inside remembered values
     int remset_nptr;
-    arraylist_t *remset;
-    arraylist_t *last_remset;
+    jl_gc_remset_t *remset;
+    jl_gc_remset_t *last_remset;
+    // empty chunks kept for reuse by `remset` and `last_remset`
+    jl_gc_remset_chunk_t *remset_free;
 
     // variables for allocating objects from pools
 #ifdef _P64
@@ -165,6 +214,9 @@ typedef struct {
 #  define JL_GC_N_POOLS 51
 #endif
     jl_gc_pool_t norm_pools[JL_GC_N_POOLS];
+    // cumulative pool allocation count per size class, for
+    // jl_gc_sizeclass_stats (monotonic, never reset)
+    uint64_t pool_allocd_count[JL_GC_N_POOLS];
 
 #define JL_N_STACK_POOLS 16
     arraylist_t free_stacks[JL_N_STACK_POOLS];
@@ -203,16 +255,32 @@ typedef struct {
 } jl_gc_mark_cache_t;
 
 struct _jl_bt_element_t;
+struct _jl_typemap_entry_t;
+struct _jl_method_instance_t;
+struct _jl_code_instance_t;
+
+// Size of the thread-private monomorphic dispatch cache (see gf.c)
+#define JL_TLS_CALL_CACHE_LEN 256
+
+// Size of the thread-private code instance lookup cache (see jl_method_compiled)
+#define JL_TLS_MI_CACHE_LEN 256
+typedef struct {
+    struct _jl_method_instance_t *mi;
+    size_t world;
+    struct _jl_code_instance_t *ci;
+} jl_mi_cache_slot_t;
 
 // This includes all the thread local states we care about for a thread.
 // Changes to TLS field types must be reflected in codegen.
 #define JL_MAX_BT_SIZE 80000
 typedef struct _jl_tls_states_t {
+    // The first cache line is reserved for the fields the owning thread
+    // reads on every allocation and safepoint check; fields that foreign
+    // threads write live on their own lines further down.
     int16_t tid;
     int8_t threadpoolid;
     uint64_t rngseed;
     volatile size_t *safepoint;
-    _Atomic(int8_t) sleep_check_state; // read/write from foreign threads
     // Whether it is safe to execute GC at the same time.
 #define JL_GC_STATE_WAITING 1
     // gc_state = 1 means the thread is doing GC or is waiting for the GC to
@@ -230,6 +298,10 @@ typedef struct _jl_tls_states_t {
     int8_t disable_gc;
     // Counter to disable finalizer **on the current thread**
     int finalizers_inhibited;
+    // written by foreign threads on every wake-up (jl_wakeup_thread), so it
+    // must not share a line with the allocation/safepoint fields above
+    JL_CACHELINE_ALIGNED _Atomic(int8_t) sleep_check_state; // read/write from foreign threads
+    JL_CACHELINE_ALIGNED
     jl_thread_heap_t heap; // this is very large, and the offset is baked into codegen
     jl_thread_gc_num_t gc_num;
     volatile sig_atomic_t defer_signal;
@@ -237,7 +309,16 @@ typedef struct _jl_tls_states_t {
     struct _jl_task_t *next_task;
     struct _jl_task_t *previous_task;
     struct _jl_task_t *root_task;
+    // Timer wheel holding task wakeup deadlines registered by this thread
+    // (NULL until first use); only mutated by this thread, tasks in it are
+    // kept alive by jl_gc_queue_thread_local. See partr.c.
+    struct _jl_timer_wheel_t *timer_wheel;
     struct _jl_timing_block_t *timing_stack;
+    // Ring of JL_TIMING_EVENT_RING_SIZE completed timing zones (NULL unless
+    // built with ENABLE_TIMINGS). Written only by this thread; other threads
+    // scrape it via jl_timing_read_events using the published head.
+    struct _jl_timing_event_t *timing_events;
+    _Atomic(uint64_t) timing_events_head;
     void *stackbase;
     size_t stacksize;
     union {
@@ -250,8 +331,20 @@ typedef struct _jl_tls_states_t {
     // Temporary backtrace buffer. Scanned for gc roots when bt_size > 0.
     struct _jl_bt_element_t *bt_data; // JL_MAX_BT_SIZE + 1 elements long
     size_t bt_size;    // Size for backtrace in transit in bt_data
+    // Pre-committed exception-stack arena, so that throwing the preallocated
+    // out-of-memory/stack-overflow exceptions never allocates from the GC
+    // (see jl_push_excstack). Not itself a GC-managed buffer. A task can
+    // keep the arena across a catch block (and a yield inside it), so it is
+    // claimed via the flag below and handed back when the holding task
+    // migrates off of it or fully unwinds.
+    struct _jl_excstack_t *emergency_excstack;
+    _Atomic(uint8_t) emergency_excstack_inuse;
     // Temporary backtrace buffer used only for allocations profiler.
     struct _jl_bt_element_t *profiling_bt_buffer;
+    // This thread's code coverage counter pages, or NULL when coverage is
+    // off. A fixed table of JL_COVERAGE_MAX_PAGES page pointers; written
+    // only by this thread, summed by jl_write_coverage_data.
+    uint64_t **coverage_pages;
     // Atomically set by the sender, reset by the handler.
     volatile _Atomic(sig_atomic_t) signal_request; // TODO: no actual reason for this to be _Atomic
     // Allow the sigint to be raised asynchronously
@@ -275,6 +368,29 @@ typedef struct _jl_tls_states_t {
     // currently-held locks, to be released when an exception is thrown
     small_arraylist_t locks;
 
+    // Thread-private monomorphic dispatch cache, keyed on callsite hash.
+    // Entries are validated against the current world age on every lookup
+    // and are treated as roots by jl_gc_queue_thread_local.
+    struct _jl_typemap_entry_t *call_cache[JL_TLS_CALL_CACHE_LEN];
+
+    // Thread-private cache of the last compiled code instance found for a
+    // method instance, so that repeated lookups at the same world age skip
+    // the list walk over `mi->cache`. Hits are revalidated against the world
+    // bounds, so invalidation (which truncates `max_world` in place) is
+    // handled naturally. Rooted by jl_gc_queue_thread_local.
+    jl_mi_cache_slot_t mi_cache[JL_TLS_MI_CACHE_LEN];
+
+    // Thread-private cache of the statement-kind classification for the most
+    // recently interpreted method body (see `eval_body` in interpreter.c).
+    // New frames seed their stack-allocated kind table from here with a
+    // memcpy instead of re-deriving each kind, which is what dominates frame
+    // setup for deeply recursive interpreted code. The keyed code array is
+    // rooted by jl_gc_queue_thread_local so the pointer cannot be recycled
+    // while the entry is resident.
+    struct _jl_value_t *interp_kind_code;
+    uint8_t *interp_kinds;
+    size_t interp_kinds_len;
+
     JULIA_DEBUG_SLEEPWAKE(
         uint64_t uv_run_enter;
         uint64_t uv_run_leave;
@@ -321,21 +437,29 @@ JL_DLLEXPORT void (jl_cpu_wake)(void);
 void jl_gc_safepoint_(jl_ptls_t tls);
 void jl_sigint_safepoint(jl_ptls_t tls);
 #else
+// slow path of the safepoint poll, taken when the poll word is set instead
+// of the page being protected (the membarrier rendezvous mode)
+JL_DLLEXPORT void jl_safepoint_hit(void);
 // gc safepoint and gc states
 // This triggers a SegFault when we are in GC
 // Assign it to a variable to make sure the compiler emit the load
 // and to avoid Clang warning for -Wunused-volatile-lvalue
+// The loaded word is 0 whenever the page is readable, so the branch is
+// never taken unless the membarrier rendezvous mode stored a flag there
+// (see safepoint.c).
 #define jl_gc_safepoint_(ptls) do {                     \
         jl_signal_fence();                              \
         size_t safepoint_load = *ptls->safepoint;       \
         jl_signal_fence();                              \
-        (void)safepoint_load;                           \
+        if (safepoint_load != 0)                        \
+            jl_safepoint_hit();                         \
     } while (0)
 #define jl_sigint_safepoint(ptls) do {                  \
         jl_signal_fence();                              \
         size_t safepoint_load = ptls->safepoint[-1];    \
         jl_signal_fence();                              \
-        (void)safepoint_load;                           \
+        if (safepoint_load != 0)                        \
+            jl_safepoint_hit();                         \
     } while (0)
 #endif
 STATIC_INLINE int8_t jl_gc_state_set(jl_ptls_t ptls, int8_t state,
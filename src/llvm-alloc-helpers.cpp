@@ -6,6 +6,7 @@
 #include "julia_assert.h"
 
 #include <llvm/IR/IntrinsicInst.h>
+#include <llvm/IR/Operator.h>
 
 using namespace llvm;
 using namespace jl_alloc;
@@ -114,6 +115,7 @@ JL_USED_FUNC void AllocUseInfo::dump()
 {
     jl_safe_printf("escaped: %d\n", escaped);
     jl_safe_printf("addrescaped: %d\n", addrescaped);
+    jl_safe_printf("hasidentitycall: %d\n", hasidentitycall);
     jl_safe_printf("returned: %d\n", returned);
     jl_safe_printf("haserror: %d\n", haserror);
     jl_safe_printf("hasload: %d\n", hasload);
@@ -125,6 +127,12 @@ JL_USED_FUNC void AllocUseInfo::dump()
     jl_safe_printf("Uses: %d\n", (unsigned)uses.size());
     for (auto inst: uses)
         llvm_dump(inst);
+    if (!stored_into.empty()) {
+        jl_safe_printf("Stored into: %d\n", (unsigned)stored_into.size());
+        for (auto inst: stored_into) {
+            llvm_dump(inst);
+        }
+    }
     if (!preserves.empty()) {
         jl_safe_printf("Preserves: %d\n", (unsigned)preserves.size());
         for (auto inst: preserves) {
@@ -219,10 +227,28 @@ void jl_alloc::runEscapeAnalysis(llvm::Instruction *I, EscapeAnalysisRequiredArg
             // Uses in `jl_roots` operand bundle are not counted as escaping, everything else is.
             if (!call->isBundleOperand(opno) ||
                 call->getOperandBundleForOperand(opno).getTagName() != "jl_roots") {
-                if (isa<UnreachableInst>(call->getParent()->getTerminator())) {
+                // The callee must also never return: rematerializing the
+                // object for a callee that comes back would let mutations made
+                // through the escaped copy diverge from the split slots the
+                // rest of the function keeps using.
+                if (call->doesNotReturn() &&
+                    isa<UnreachableInst>(call->getParent()->getTerminator())) {
                     required.use_info.haserror = true;
                     return true;
                 }
+                // A callee that promises not to capture the pointer and not to
+                // access memory through it can only compare the pointer for
+                // identity, which stack allocation preserves. Consumers that
+                // move the object must still keep it valid for the GC in case
+                // a rooted copy of the address gets scanned (see the
+                // `hasidentitycall` handling in the alloc-opt pass).
+                if (opno < call->arg_size() &&
+                    call->paramHasAttr(opno, Attribute::NoCapture) &&
+                    call->paramHasAttr(opno, Attribute::ReadNone)) {
+                    required.use_info.addrescaped = true;
+                    required.use_info.hasidentitycall = true;
+                    return true;
+                }
                 required.use_info.escaped = true;
                 return false;
             }
@@ -232,6 +258,24 @@ void jl_alloc::runEscapeAnalysis(llvm::Instruction *I, EscapeAnalysisRequiredArg
         if (auto store = dyn_cast<StoreInst>(inst)) {
             // Only store value count
             if (use->getOperandNo() != StoreInst::getPointerOperandIndex()) {
+                // The object itself is being stored somewhere. If the
+                // destination is another object allocated in this function,
+                // record the destination instead of giving up: the object
+                // then escapes only if the destination object does.
+                auto base = store->getPointerOperand();
+                while (true) {
+                    if (auto gep = dyn_cast<GEPOperator>(base))
+                        base = gep->getPointerOperand();
+                    else if (isa<BitCastOperator>(base) || isa<AddrSpaceCastOperator>(base))
+                        base = cast<Operator>(base)->getOperand(0);
+                    else
+                        break;
+                }
+                auto dest = dyn_cast<CallInst>(base);
+                if (dest && dest->getCalledOperand() == required.pass.alloc_obj_func) {
+                    required.use_info.stored_into.insert(dest);
+                    return true;
+                }
                 required.use_info.escaped = true;
                 return false;
             }
@@ -61,11 +61,23 @@ namespace jl_alloc {
     struct AllocUseInfo {
         llvm::SmallSet<llvm::Instruction*,16> uses;
         llvm::SmallSet<llvm::CallInst*,4> preserves;
+        // Other allocations in the function that the object is stored into.
+        // Such a store is not an escape by itself: the object only escapes
+        // if the destination object does (see the region handling in the
+        // alloc-opt pass). Consumers that don't track the destination
+        // objects must treat a non-empty set like `escaped`.
+        llvm::SmallSet<llvm::CallInst*,4> stored_into;
         std::map<uint32_t,Field> memops;
         // Completely unknown use
         bool escaped:1;
         // Address is leaked to functions that doesn't care where the object is allocated.
+        // This includes calls whose parameter attributes guarantee the callee can
+        // neither capture the pointer nor access memory through it (`hasidentitycall`).
         bool addrescaped:1;
+        // The object is passed to a callee that can only observe the pointer's
+        // identity (the matching parameter is `nocapture` and `readnone`).
+        // Always set together with `addrescaped`.
+        bool hasidentitycall:1;
         // There are reader of the memory
         bool hasload:1;
         // There are uses in gc_preserve intrinsics or ccall roots
@@ -96,6 +108,7 @@ namespace jl_alloc {
         {
             escaped = false;
             addrescaped = false;
+            hasidentitycall = false;
             hasload = false;
             haspreserve = false;
             refload = false;
@@ -108,6 +121,7 @@ namespace jl_alloc {
             has_unknown_objrefaggr = false;
             uses.clear();
             preserves.clear();
+            stored_into.clear();
             memops.clear();
         }
         void dump();
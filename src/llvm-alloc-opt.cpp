@@ -45,8 +45,11 @@ using namespace jl_alloc;
 
 STATISTIC(RemovedAllocs, "Total number of heap allocations elided");
 STATISTIC(DeletedAllocs, "Total number of heap allocations fully deleted");
+STATISTIC(RegionAllocs, "Total number of allocations deleted as part of escape-free regions");
 STATISTIC(SplitAllocs, "Total number of allocations split into registers");
+STATISTIC(RematerializedAllocs, "Total number of split allocations rematerialized on error paths");
 STATISTIC(StackAllocs, "Total number of allocations moved to the stack");
+STATISTIC(StackAllocArrays, "Total number of array allocations moved to the stack");
 STATISTIC(RemovedTypeofs, "Total number of typeofs removed");
 STATISTIC(RemovedWriteBarriers, "Total number of write barriers removed");
 STATISTIC(RemovedGCPreserve, "Total number of GC preserve instructions removed");
@@ -83,6 +86,10 @@ static void removeGCPreserve(CallInst *call, Instruction *val)
  * * gc preserve intrinsics
  * * `ccall` gcroot array (`jl_roots` operand bundle)
  * * store (as address)
+ * * store as value into another allocation that does not escape itself
+ * * call argument at a `nocapture readnone` parameter (the callee can only
+ *   observe the pointer's identity; the object gets a valid type tag on the
+ *   stack so that rooted copies of the address stay inert for the GC)
  * * addrspacecast, bitcast, getelementptr
  *
  *     The results of these cast instructions will be scanned recursively.
@@ -104,6 +111,9 @@ struct AllocOpt : public JuliaPassContext {
 
     Function *lifetime_start;
     Function *lifetime_end;
+    // `jl_alloc_array_1d` is an ordinary runtime ccall, not one of the julia
+    // intrinsics tracked by the pass context
+    Function *alloc_array_1d_func;
 
     bool doInitialization(Module &m);
     bool runOnFunction(Function &F, function_ref<DominatorTree&()> GetDT);
@@ -118,11 +128,23 @@ struct Optimizer {
 
     void initialize();
     void optimizeAll();
+    void optimizeRegions();
+    void optimizeArrays();
     bool finalize();
 private:
+    // A 1d array allocation with constant element type and length whose
+    // header and data both fit on the stack.
+    struct ArrayAllocInfo {
+        size_t nel;
+        size_t elsz;
+        size_t doffs; // offset of the inline data from the start of the header
+        size_t tsz; // total size, header + alignment padding + data
+        bool zeroinit;
+    };
     bool isSafepoint(Instruction *inst);
     Instruction *getFirstSafepoint(BasicBlock *bb);
     ssize_t getGCAllocSize(Instruction *I);
+    bool getArrayAllocInfo(Instruction *I, ArrayAllocInfo *info);
     void pushInstruction(Instruction *I);
 
     void insertLifetimeEnd(Value *ptr, Constant *sz, Instruction *insert);
@@ -135,11 +157,15 @@ private:
                                  Instruction *orig_i, Instruction *new_i);
     void removeAlloc(CallInst *orig_inst);
     void moveToStack(CallInst *orig_inst, size_t sz, bool has_ref);
+    void moveArrayToStack(CallInst *orig_inst, const ArrayAllocInfo &info);
+    void replaceWithStack(CallInst *orig_inst, Instruction *new_inst, AllocaInst *buff,
+                          Value *tag, bool has_ref);
     void splitOnStack(CallInst *orig_inst);
     void optimizeTag(CallInst *orig_inst);
 
     Function &F;
     AllocOpt &pass;
+    bool has_except_enter = false;
     DominatorTree *_DT = nullptr;
     function_ref<DominatorTree &()> GetDT;
 
@@ -182,6 +208,9 @@ private:
     };
 
     SetVector<std::pair<CallInst*,size_t>> worklist;
+    SmallVector<std::pair<CallInst*,ArrayAllocInfo>,6> array_worklist;
+    SmallPtrSet<CallInst*,6> array_queued;
+    SmallVector<std::pair<CallInst*,size_t>,6> region_queue;
     SmallVector<CallInst*,6> removed;
     AllocUseInfo use_info;
     CheckInst::Stack check_stack;
@@ -195,6 +224,12 @@ void Optimizer::pushInstruction(Instruction *I)
     ssize_t sz = getGCAllocSize(I);
     if (sz != -1) {
         worklist.insert(std::make_pair(cast<CallInst>(I), sz));
+        return;
+    }
+    ArrayAllocInfo info;
+    if (getArrayAllocInfo(I, &info)) {
+        if (array_queued.insert(cast<CallInst>(I)).second)
+            array_worklist.push_back(std::make_pair(cast<CallInst>(I), info));
     }
 }
 
@@ -202,6 +237,11 @@ void Optimizer::initialize()
 {
     for (auto &bb: F) {
         for (auto &I: bb) {
+            if (auto call = dyn_cast<CallInst>(&I)) {
+                auto callee = call->getCalledFunction();
+                if (callee && callee->getName() == "julia.except_enter")
+                    has_except_enter = true;
+            }
             pushInstruction(&I);
         }
     }
@@ -209,7 +249,12 @@ void Optimizer::initialize()
 
 void Optimizer::optimizeAll()
 {
-    while (!worklist.empty()) {
+    while (!worklist.empty() || !region_queue.empty()) {
+        if (worklist.empty()) {
+            // may both remove deferred allocations and refill the worklist
+            optimizeRegions();
+            continue;
+        }
         auto item = worklist.pop_back_val();
         auto orig = item.first;
         size_t sz = item.second;
@@ -219,12 +264,20 @@ void Optimizer::optimizeAll()
                 optimizeTag(orig);
             continue;
         }
-        if (use_info.haserror || use_info.returned) {
+        if (!use_info.stored_into.empty()) {
+            // The object is stored into other objects allocated in this
+            // function, so whether it escapes depends on what happens to
+            // those. Defer it until everything else has been processed.
+            region_queue.push_back(item);
+            continue;
+        }
+        if (use_info.returned) {
             if (use_info.hastypeof)
                 optimizeTag(orig);
             continue;
         }
-        if (!use_info.addrescaped && !use_info.hasload && (!use_info.haspreserve ||
+        if (!use_info.haserror &&
+            !use_info.addrescaped && !use_info.hasload && (!use_info.haspreserve ||
                                                            !use_info.refstore)) {
             // No one took the address, no one reads anything and there's no meaningful
             // preserve of fields (either no preserve/ccall or no object reference fields)
@@ -246,19 +299,169 @@ void Optimizer::optimizeAll()
                 }
             }
         }
-        if (!use_info.hasunknownmem && !use_info.addrescaped && !has_refaggr) {
+        // An object whose only escapes sit on error paths (noreturn calls in
+        // blocks ending in `unreachable`) can still be split: the throw
+        // happens at most once and nothing downstream of it can observe the
+        // object, so it is rematerialized there from the split slots and the
+        // non-throwing path pays nothing. A memset initializes
+        // bytes that have no corresponding slot to rebuild them from, so
+        // such objects stay on the heap. The function must also contain no
+        // exception handler: a local catch of the throw resumes this same
+        // invocation, and the catch block could observe and mutate the
+        // rematerialized copy while subsequent code keeps using the split
+        // slots, letting the two diverge.
+        bool can_remat_error = !has_except_enter;
+        if (use_info.haserror && can_remat_error) {
+            for (auto *user: use_info.uses) {
+                if (auto *II = dyn_cast<IntrinsicInst>(user)) {
+                    if (II->getIntrinsicID() == Intrinsic::memset) {
+                        can_remat_error = false;
+                        break;
+                    }
+                }
+            }
+        }
+        if (!use_info.hasunknownmem && !use_info.addrescaped && !has_refaggr &&
+            can_remat_error) {
             // No one actually care about the memory layout of this object, split it.
             splitOnStack(orig);
             continue;
         }
-        if (has_refaggr) {
+        if (use_info.haserror || has_refaggr) {
             if (use_info.hastypeof)
                 optimizeTag(orig);
             continue;
         }
+        if (use_info.hasidentitycall) {
+            // The callee's parameter attributes let the pointer itself leak,
+            // so the stack object needs a valid type tag in case the GC scans
+            // a rooted copy of the address (see moveToStack). That needs a
+            // constant tag that survives `ptrtoint` (i.e. is not behind a
+            // non-integral pointer), and the tag's GC bits make the object
+            // invisible to the collector, so it must not have reference
+            // fields either.
+            bool inert_tag = false;
+            if (auto tag = dyn_cast<Constant>(orig->getArgOperand(2))) {
+                tag = cast<Constant>(tag->stripPointerCasts());
+                inert_tag = cast<PointerType>(tag->getType())->getAddressSpace() == 0;
+            }
+            if (has_ref || !inert_tag) {
+                if (use_info.hastypeof)
+                    optimizeTag(orig);
+                continue;
+            }
+        }
         // The object has no fields with mix reference access
         moveToStack(orig, sz, has_ref);
     }
+    optimizeArrays();
+}
+
+// Stack-allocate small fixed-size arrays that do not escape. These enter the
+// function as calls to the `jl_alloc_array_1d` runtime ccall rather than as
+// `julia.gc_alloc_obj`, so they get their own worklist; everything after the
+// escape check reuses the machinery above. This runs after the main loop so
+// that arrays whose only uses sat inside allocations deleted above are
+// already dead here.
+void Optimizer::optimizeArrays()
+{
+    for (auto &item: array_worklist) {
+        auto orig = item.first;
+        if (orig->use_empty()) {
+            // dead on arrival, or every use was deleted along with the
+            // allocations it was stored into
+            ++RemovedAllocs;
+            ++DeletedAllocs;
+            removed.push_back(orig);
+            continue;
+        }
+        checkInst(orig);
+        // Unlike plain objects, a stack array is referenced through its
+        // (interior) data pointer, which the analysis cannot follow once
+        // loaded. Preserves and ccall roots are the mechanism that keeps such
+        // raw pointers valid beyond the uses we can see, so treat them as
+        // escapes rather than trying to remove them.
+        if (use_info.escaped || use_info.returned || use_info.haserror ||
+            use_info.addrescaped || use_info.haspreserve ||
+            use_info.refload || use_info.refstore ||
+            use_info.has_unknown_objref || use_info.has_unknown_objrefaggr ||
+            !use_info.stored_into.empty())
+            continue;
+        moveArrayToStack(orig, item.second);
+    }
+    array_worklist.clear();
+}
+
+// Second chance for the allocations deferred above: a group of objects that
+// are only stored into each other behaves like a region that lives and dies
+// as a whole. If nothing reads any member of the group and no member escapes
+// elsewhere, the entire group is dead and can be deleted, even though each
+// member on its own appears to escape into the others.
+void Optimizer::optimizeRegions()
+{
+    if (region_queue.empty())
+        return;
+    struct Member {
+        size_t sz;
+        bool removable;
+        bool hastypeof;
+        SmallVector<CallInst*,4> targets;
+    };
+    std::map<CallInst*,Member> members;
+    for (auto item: region_queue) {
+        auto orig = item.first;
+        // Redo the analysis: allocations eliminated after this one was
+        // deferred may have erased some of its uses already.
+        checkInst(orig);
+        if (use_info.stored_into.empty()) {
+            // All the objects it was stored into are gone;
+            // give it back to the normal path.
+            worklist.insert(item);
+            continue;
+        }
+        auto &member = members[orig];
+        member.sz = item.second;
+        member.hastypeof = use_info.hastypeof;
+        member.removable = !use_info.escaped && !use_info.returned &&
+            !use_info.haserror && !use_info.addrescaped && !use_info.hasload &&
+            (!use_info.haspreserve || !use_info.refstore);
+        member.targets.append(use_info.stored_into.begin(), use_info.stored_into.end());
+    }
+    region_queue.clear();
+    // Fixpoint: a member stays removable only while every object it is
+    // stored into is a removable member itself.
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (auto &it: members) {
+            if (!it.second.removable)
+                continue;
+            for (auto target: it.second.targets) {
+                auto f = members.find(target);
+                if (f != members.end() && f->second.removable)
+                    continue;
+                it.second.removable = false;
+                changed = true;
+                break;
+            }
+        }
+    }
+    for (auto &it: members) {
+        if (it.second.removable) {
+            ++RegionAllocs;
+            removeAlloc(it.first);
+        }
+        else if (it.second.hastypeof) {
+            optimizeTag(it.first);
+        }
+    }
+    // `removeAlloc` requeues values stored into the deleted objects, which
+    // includes fellow members that are gone now; drop those again.
+    for (auto &it: members) {
+        if (it.second.removable) {
+            worklist.remove(std::make_pair(it.first, it.second.sz));
+        }
+    }
 }
 
 bool Optimizer::finalize()
@@ -322,6 +525,62 @@ ssize_t Optimizer::getGCAllocSize(Instruction *I)
     return -1;
 }
 
+bool Optimizer::getArrayAllocInfo(Instruction *I, ArrayAllocInfo *info)
+{
+    auto call = dyn_cast<CallInst>(I);
+    if (!call)
+        return false;
+    if (!pass.alloc_array_1d_func || call->getCalledOperand() != pass.alloc_array_1d_func)
+        return false;
+    if (call->arg_size() != 2)
+        return false;
+    auto nel_arg = dyn_cast<ConstantInt>(call->getArgOperand(1));
+    if (!nel_arg)
+        return false;
+    // The array type is only visible to us when codegen emitted it as a
+    // literal pointer, i.e. when we are not compiling for an image.
+    auto atype_arg = dyn_cast<Constant>(call->getArgOperand(0));
+    if (!atype_arg)
+        return false;
+    auto atype_expr = dyn_cast<ConstantExpr>(atype_arg->stripPointerCasts());
+    if (!atype_expr || atype_expr->getOpcode() != Instruction::IntToPtr)
+        return false;
+    auto atype_addr = dyn_cast<ConstantInt>(atype_expr->getOperand(0));
+    if (!atype_addr)
+        return false;
+    auto atype = (jl_value_t*)(uintptr_t)atype_addr->getZExtValue();
+    if (atype == NULL || !jl_is_array_type(atype) ||
+        !jl_is_long(jl_tparam1(atype)) || jl_unbox_long(jl_tparam1(atype)) != 1)
+        return false;
+    // Only pointer-free elements stored inline: the GC never scans the stack
+    // buffer, so nothing in it may require marking, and the data pointer must
+    // not be the `how == 3` owner reference.
+    jl_value_t *eltype = jl_tparam0(atype);
+    if (!jl_is_datatype(eltype) || ((jl_datatype_t*)eltype)->layout == NULL ||
+        ((jl_datatype_t*)eltype)->layout->npointers > 0)
+        return false;
+    size_t elsz = 0, al = 0;
+    if (!jl_islayout_inline(eltype, &elsz, &al) || al > JL_SMALL_BYTE_ALIGNMENT)
+        return false;
+    elsz = LLT_ALIGN(elsz, al);
+    size_t nel = (size_t)nel_arg->getZExtValue();
+    if (elsz != 0 && nel > ARRAY_STACK_ALLOC_NBYTES / elsz)
+        return false;
+    size_t tot = nel * elsz;
+    if (elsz == 1)
+        tot++; // extra byte for all julia allocated byte arrays
+    // mirror the inline (`how == 0`) data placement in `_new_array_`
+    size_t tsz = sizeof(jl_array_t);
+    if (elsz >= 4)
+        tsz = LLT_ALIGN(tsz, JL_SMALL_BYTE_ALIGNMENT);
+    info->nel = nel;
+    info->elsz = elsz;
+    info->doffs = tsz;
+    info->tsz = tsz + tot;
+    info->zeroinit = ((jl_datatype_t*)eltype)->zeroinit != 0;
+    return true;
+}
+
 void Optimizer::checkInst(Instruction *I)
 {
     jl_alloc::EscapeAnalysisRequiredArgs required{use_info, check_stack, pass, *pass.DL};
@@ -569,7 +828,8 @@ void Optimizer::moveToStack(CallInst *orig_inst, size_t sz, bool has_ref)
     IRBuilder<> prolog_builder(&F.getEntryBlock().front());
     AllocaInst *buff;
     Instruction *ptr;
-    if (sz == 0) {
+    size_t allocsz = sz;
+    if (sz == 0 && !use_info.hasidentitycall) {
         ptr = buff = prolog_builder.CreateAlloca(Type::getInt8Ty(prolog_builder.getContext()), ConstantInt::get(Type::getInt64Ty(prolog_builder.getContext()), 0));
     }
     else if (has_ref) {
@@ -585,7 +845,15 @@ void Optimizer::moveToStack(CallInst *orig_inst, size_t sz, bool has_ref)
     }
     else {
         Type *buffty;
-        if (pass.DL->isLegalInteger(sz * 8))
+        if (use_info.hasidentitycall) {
+            // The address is passed to a callee, so the object needs to look
+            // like a real one: reserve room in front of it for a type tag in
+            // case the GC scans a rooted copy of the address.
+            align = JL_SMALL_BYTE_ALIGNMENT;
+            allocsz = sz + JL_SMALL_BYTE_ALIGNMENT;
+            buffty = ArrayType::get(Type::getInt8Ty(pass.getLLVMContext()), allocsz);
+        }
+        else if (pass.DL->isLegalInteger(sz * 8))
             buffty = Type::getIntNTy(pass.getLLVMContext(), sz * 8);
         else
             buffty = ArrayType::get(Type::getInt8Ty(pass.getLLVMContext()), sz);
@@ -593,12 +861,44 @@ void Optimizer::moveToStack(CallInst *orig_inst, size_t sz, bool has_ref)
         buff->setAlignment(Align(align));
         ptr = cast<Instruction>(prolog_builder.CreateBitCast(buff, Type::getInt8PtrTy(prolog_builder.getContext(), buff->getType()->getPointerAddressSpace())));
     }
-    insertLifetime(ptr, ConstantInt::get(Type::getInt64Ty(prolog_builder.getContext()), sz), orig_inst);
+    insertLifetime(ptr, ConstantInt::get(Type::getInt64Ty(prolog_builder.getContext()), allocsz), orig_inst);
+    if (use_info.hasidentitycall) {
+        // Initialize the tag with the GC bits preset to old and marked, the
+        // same trick permanently allocated objects use: the GC will neither
+        // try to mark nor to sweep the stack object if it ever sees it.
+        // The store is placed at the allocation site, after the inserted
+        // `lifetime_start`, so it isn't a dead store into a dead buffer.
+        assert(!has_ref); // gated in `optimizeAll`
+        IRBuilder<> hdr_builder(orig_inst);
+        auto T_size = pass.DL->getIntPtrType(prolog_builder.getContext());
+        auto tag_const = cast<Constant>(cast<Constant>(tag)->stripPointerCasts());
+        Constant *header = ConstantExpr::getOr(
+                ConstantExpr::getPtrToInt(tag_const, T_size),
+                ConstantInt::get(T_size, GC_OLD_MARKED));
+        auto hdr_slot = hdr_builder.CreateBitCast(
+                hdr_builder.CreateConstInBoundsGEP1_64(
+                        Type::getInt8Ty(prolog_builder.getContext()), ptr,
+                        JL_SMALL_BYTE_ALIGNMENT - sizeof(void*)),
+                T_size->getPointerTo());
+        // Volatile: no load of the tag is visible to LLVM (the callee is
+        // `readnone`), only the GC reads it, so DSE would delete it otherwise.
+        hdr_builder.CreateAlignedStore(header, hdr_slot, Align(sizeof(void*)),
+                                       /*isVolatile*/true);
+        ptr = cast<Instruction>(prolog_builder.CreateConstInBoundsGEP1_64(
+                Type::getInt8Ty(prolog_builder.getContext()), ptr, JL_SMALL_BYTE_ALIGNMENT));
+    }
     Instruction *new_inst = cast<Instruction>(prolog_builder.CreateBitCast(ptr, JuliaType::get_pjlvalue_ty(prolog_builder.getContext(), buff->getType()->getPointerAddressSpace())));
     if (orig_inst->getModule()->getDataLayout().getAllocaAddrSpace() != 0)
         new_inst = cast<Instruction>(prolog_builder.CreateAddrSpaceCast(new_inst, JuliaType::get_pjlvalue_ty(prolog_builder.getContext(), orig_inst->getType()->getPointerAddressSpace())));
     new_inst->takeName(orig_inst);
+    replaceWithStack(orig_inst, new_inst, buff, tag, has_ref);
+}
 
+// Rewrite all (transitive) uses of `orig_inst` to use the stack object
+// `new_inst`/`buff` instead; `tag` replaces any `julia.typeof` calls.
+void Optimizer::replaceWithStack(CallInst *orig_inst, Instruction *new_inst, AllocaInst *buff,
+                                 Value *tag, bool has_ref)
+{
     auto simple_replace = [&] (Instruction *orig_i, Instruction *new_i) {
         if (orig_i->user_empty()) {
             if (orig_i != orig_inst)
@@ -673,6 +973,18 @@ void Optimizer::moveToStack(CallInst *orig_inst, size_t sz, bool has_ref)
                     return;
                 }
             }
+            if (call->hasArgument(orig_i)) {
+                // An argument at a `nocapture readnone` parameter (nothing
+                // else reaches here, see `check_inst`): hand the callee the
+                // stack address, it can only compare it for identity. The
+                // preset tag above keeps the GC away from the object if the
+                // address is ever rooted across the call.
+                assert(use_info.hasidentitycall);
+                auto tracked = new AddrSpaceCastInst(new_i, orig_i->getType(), "", call);
+                tracked->setDebugLoc(call->getDebugLoc());
+                call->replaceUsesOfWith(orig_i, tracked);
+                return;
+            }
             // remove from operand bundle
             Value *replace = has_ref ? (Value*)buff : Constant::getNullValue(orig_i->getType());
             user->replaceUsesOfWith(orig_i, replace);
@@ -715,6 +1027,79 @@ void Optimizer::moveToStack(CallInst *orig_inst, size_t sz, bool has_ref)
     }
 }
 
+// Lower a non-escaping `jl_alloc_array_1d` call with constant type and length
+// to an alloca holding the array header and the inline data, initialized the
+// same way `_new_array_` initializes a `how == 0` array. The elements are
+// pointer-free (checked in `getArrayAllocInfo`), so the GC never needs to see
+// the object and no type tag is required.
+void Optimizer::moveArrayToStack(CallInst *orig_inst, const ArrayAllocInfo &info)
+{
+    ++RemovedAllocs;
+    ++StackAllocArrays;
+    auto atype = orig_inst->getArgOperand(0);
+    removed.push_back(orig_inst);
+    IRBuilder<> prolog_builder(&F.getEntryBlock().front());
+    auto T_int8 = Type::getInt8Ty(prolog_builder.getContext());
+    AllocaInst *buff = prolog_builder.CreateAlloca(ArrayType::get(T_int8, info.tsz));
+    // both the header and (since `al <= JL_SMALL_BYTE_ALIGNMENT`) the data
+    // are sufficiently aligned this way, matching the heap allocation
+    buff->setAlignment(Align(JL_SMALL_BYTE_ALIGNMENT));
+    auto ptr = cast<Instruction>(prolog_builder.CreateBitCast(buff, Type::getInt8PtrTy(prolog_builder.getContext(), buff->getType()->getPointerAddressSpace())));
+    insertLifetime(ptr, ConstantInt::get(Type::getInt64Ty(prolog_builder.getContext()), info.tsz), orig_inst);
+    // Initialize the header at the allocation site (after the inserted
+    // `lifetime_start`); the field loads codegen emitted read these back.
+    IRBuilder<> hdr_builder(orig_inst);
+    auto T_size = pass.DL->getIntPtrType(hdr_builder.getContext());
+    auto T_int16 = Type::getInt16Ty(hdr_builder.getContext());
+    auto T_int32 = Type::getInt32Ty(hdr_builder.getContext());
+    auto field_ptr = [&] (size_t offset, Type *ty) -> Value* {
+        Value *addr = ptr;
+        if (offset != 0)
+            addr = hdr_builder.CreateConstInBoundsGEP1_64(T_int8, ptr, offset);
+        return hdr_builder.CreateBitCast(addr, ty->getPointerTo());
+    };
+    auto data = hdr_builder.CreateConstInBoundsGEP1_64(T_int8, ptr, info.doffs);
+    hdr_builder.CreateAlignedStore(data, field_ptr(offsetof(jl_array_t, data), data->getType()),
+                                   Align(sizeof(void*)));
+    auto nel = ConstantInt::get(T_size, info.nel);
+    hdr_builder.CreateAlignedStore(nel, field_ptr(offsetof(jl_array_t, length), T_size),
+                                   Align(sizeof(void*)));
+    jl_array_flags_t flags;
+    memset(&flags, 0, sizeof(flags));
+    flags.how = 0;
+    flags.ndims = 1;
+    flags.pooled = info.tsz <= GC_MAX_SZCLASS;
+    flags.isaligned = 1;
+    uint16_t flagbits;
+    memcpy(&flagbits, &flags, sizeof(flagbits));
+    hdr_builder.CreateAlignedStore(ConstantInt::get(T_int16, flagbits),
+                                   field_ptr(offsetof(jl_array_t, flags), T_int16), Align(2));
+    hdr_builder.CreateAlignedStore(ConstantInt::get(T_int16, info.elsz),
+                                   field_ptr(offsetof(jl_array_t, elsize), T_int16), Align(2));
+    hdr_builder.CreateAlignedStore(ConstantInt::get(T_int32, 0),
+                                   field_ptr(offsetof(jl_array_t, offset), T_int32), Align(4));
+    hdr_builder.CreateAlignedStore(nel, field_ptr(offsetof(jl_array_t, nrows), T_size),
+                                   Align(sizeof(void*)));
+    hdr_builder.CreateAlignedStore(nel, field_ptr(offsetof(jl_array_t, maxsize), T_size),
+                                   Align(sizeof(void*)));
+    size_t tot = info.tsz - info.doffs;
+    if (info.zeroinit) {
+        hdr_builder.CreateMemSet(data, ConstantInt::get(T_int8, 0), tot,
+                                 MaybeAlign(MinAlign(JL_SMALL_BYTE_ALIGNMENT, info.doffs)));
+    }
+    else if (info.elsz == 1) {
+        // the extra terminating NUL byte all julia byte arrays carry
+        // (JL_ARRAY_IMPL_NUL in array.c)
+        hdr_builder.CreateAlignedStore(ConstantInt::get(T_int8, 0),
+                hdr_builder.CreateConstInBoundsGEP1_64(T_int8, data, tot - 1), Align(1));
+    }
+    Instruction *new_inst = cast<Instruction>(prolog_builder.CreateBitCast(ptr, JuliaType::get_pjlvalue_ty(prolog_builder.getContext(), buff->getType()->getPointerAddressSpace())));
+    if (orig_inst->getModule()->getDataLayout().getAllocaAddrSpace() != 0)
+        new_inst = cast<Instruction>(prolog_builder.CreateAddrSpaceCast(new_inst, JuliaType::get_pjlvalue_ty(prolog_builder.getContext(), orig_inst->getType()->getPointerAddressSpace())));
+    new_inst->takeName(orig_inst);
+    replaceWithStack(orig_inst, new_inst, buff, atype, /*has_ref*/false);
+}
+
 // This function should not erase any safepoint so that the lifetime marker can find and cache
 // all the original safepoints.
 void Optimizer::removeAlloc(CallInst *orig_inst)
@@ -849,7 +1234,10 @@ void Optimizer::splitOnStack(CallInst *orig_inst)
         auto &field = memop.second;
         // If the field has no reader and is not a object reference field that we
         // need to preserve at some point, there's no need to allocate the field.
-        if (!field.hasload && (!field.hasobjref || !use_info.haspreserve))
+        // When the object is rematerialized on an error path, every field can
+        // be observed by the throwing callee (or whoever catches the
+        // exception), so all of them must be kept.
+        if (!use_info.haserror && !field.hasload && (!field.hasobjref || !use_info.haspreserve))
             continue;
         SplitSlot slot{nullptr, field.hasobjref, offset, field.size};
         Type *allocty;
@@ -928,6 +1316,43 @@ void Optimizer::splitOnStack(CallInst *orig_inst)
         }
         return addr;
     };
+    // Rebuild the object right before an escaping call on an error path, from
+    // the current values of the split slots. The block ends in `unreachable`,
+    // so this runs at most once per allocation and the non-throwing paths pay
+    // nothing for the heap object. The fresh allocation is young and dies
+    // with the throw, so no write barriers are needed for the field stores.
+    SmallDenseMap<CallInst*,CallInst*> error_objs;
+    auto materialize_error_obj = [&] (CallInst *call) {
+        auto it = error_objs.find(call);
+        if (it != error_objs.end())
+            return it->second;
+        ++RematerializedAllocs;
+        IRBuilder<> builder(call);
+        auto new_inst = cast<CallInst>(orig_inst->clone());
+        builder.Insert(new_inst);
+        auto T_int8 = Type::getInt8Ty(builder.getContext());
+        auto ptr8 = builder.CreateBitCast(new_inst, T_int8->getPointerTo(AddressSpace::Tracked));
+        for (auto &slot: slots) {
+            Value *addr = ptr8;
+            if (slot.offset != 0)
+                addr = builder.CreateConstInBoundsGEP1_32(T_int8, ptr8, slot.offset);
+            if (slot.isref) {
+                auto ref = builder.CreateAlignedLoad(pass.T_prjlvalue, slot.slot, Align(sizeof(void*)));
+                // since we're reading back from the stack, it is safe to downgrade the atomic level to NotAtomic
+                ref->setOrdering(AtomicOrdering::NotAtomic);
+                addr = builder.CreateBitCast(addr, PointerType::get(pass.T_prjlvalue, AddressSpace::Tracked));
+                builder.CreateAlignedStore(ref, addr, Align(sizeof(void*)));
+            }
+            else {
+                auto allocty = slot.slot->getAllocatedType();
+                auto val = builder.CreateLoad(allocty, slot.slot);
+                addr = builder.CreateBitCast(addr, PointerType::get(allocty, AddressSpace::Tracked));
+                builder.CreateStore(val, addr);
+            }
+        }
+        error_objs[call] = new_inst;
+        return new_inst;
+    };
     auto replace_inst = [&] (Use *use) {
         Instruction *user = cast<Instruction>(use->getUser());
         Instruction *orig_i = cur.orig_i;
@@ -1095,8 +1520,24 @@ void Optimizer::splitOnStack(CallInst *orig_inst)
                 call->eraseFromParent();
                 return;
             }
+            if (!call->isBundleOperand(use->getOperandNo())) {
+                // The object escapes into a callee on an error path (gated in
+                // `optimizeAll`): rematerialize it from the slots here, right
+                // before it leaves the function for good.
+                assert(isa<UnreachableInst>(call->getParent()->getTerminator()));
+                Value *remat = materialize_error_obj(call);
+                IRBuilder<> builder(call);
+                if (offset != 0) {
+                    auto T_int8 = Type::getInt8Ty(builder.getContext());
+                    remat = builder.CreateBitCast(remat, T_int8->getPointerTo(AddressSpace::Tracked));
+                    remat = builder.CreateConstInBoundsGEP1_32(T_int8, remat, offset);
+                }
+                if (remat->getType() != orig_i->getType())
+                    remat = builder.CreatePointerBitCastOrAddrSpaceCast(remat, orig_i->getType());
+                *use = remat;
+                return;
+            }
             // remove from operand bundle
-            assert(call->isBundleOperand(use->getOperandNo()));
             assert(call->getOperandBundleForOperand(use->getOperandNo()).getTagName() ==
                    "jl_roots");
             SmallVector<OperandBundleDef,2> bundles;
@@ -1162,7 +1603,8 @@ cleanup:
 bool AllocOpt::doInitialization(Module &M)
 {
     initAll(M);
-    if (!alloc_obj_func)
+    alloc_array_1d_func = M.getFunction("jl_alloc_array_1d");
+    if (!alloc_obj_func && !alloc_array_1d_func)
         return false;
 
     DL = &M.getDataLayout();
@@ -1175,7 +1617,7 @@ bool AllocOpt::doInitialization(Module &M)
 
 bool AllocOpt::runOnFunction(Function &F, function_ref<DominatorTree&()> GetDT)
 {
-    if (!alloc_obj_func)
+    if (!alloc_obj_func && !alloc_array_1d_func)
         return false;
     Optimizer optimizer(F, *this, std::move(GetDT));
     optimizer.initialize();
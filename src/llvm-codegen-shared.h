@@ -234,6 +234,39 @@ static inline void emit_signal_fence(llvm::IRBuilder<> &builder)
     builder.CreateFence(AtomicOrdering::SequentiallyConsistent, SyncScope::SingleThread);
 }
 
+// Test the word read by a safepoint poll and call the rendezvous slow path
+// when it is nonzero. The word is 0 whenever the page is readable, so this
+// branch is never taken in the default page-protection mode; the membarrier
+// mode (JULIA_SAFEPOINT_MEMBARRIER, see safepoint.c) stores a flag into it
+// instead of protecting the page. Leaves the builder in the continuation
+// block.
+static inline void emit_safepoint_poll_test(llvm::IRBuilder<> &builder, llvm::Value *load)
+{
+    using namespace llvm;
+    Module *M = builder.GetInsertBlock()->getModule();
+    LLVMContext &C = builder.getContext();
+    FunctionCallee F = M->getOrInsertFunction("jl_safepoint_hit",
+            FunctionType::get(Type::getVoidTy(C), false));
+    Value *cond = builder.CreateICmpNE(load, Constant::getNullValue(load->getType()));
+    BasicBlock *BB = builder.GetInsertBlock();
+    BasicBlock *contBB;
+    if (builder.GetInsertPoint() == BB->end()) {
+        contBB = BasicBlock::Create(C, "safepoint.cont", BB->getParent());
+    }
+    else {
+        // mid-block: move the rest of the block to the continuation
+        contBB = BB->splitBasicBlock(builder.GetInsertPoint(), "safepoint.cont");
+        BB->getTerminator()->eraseFromParent();
+    }
+    BasicBlock *slowBB = BasicBlock::Create(C, "safepoint.slow", BB->getParent(), contBB);
+    builder.SetInsertPoint(BB);
+    builder.CreateCondBr(cond, slowBB, contBB);
+    builder.SetInsertPoint(slowBB);
+    builder.CreateCall(F);
+    builder.CreateBr(contBB);
+    builder.SetInsertPoint(contBB, contBB->begin());
+}
+
 static inline void emit_gc_safepoint(llvm::IRBuilder<> &builder, llvm::Value *ptls, llvm::MDNode *tbaa, bool final = false)
 {
     using namespace llvm;
@@ -244,7 +277,10 @@ static inline void emit_gc_safepoint(llvm::IRBuilder<> &builder, llvm::Value *pt
     // inline jlsafepoint_func->realize(M)
     if (final) {
         auto T_size = getSizeTy(builder.getContext());
-        builder.CreateLoad(T_size, signal_page, true);
+        Value *load = builder.CreateLoad(T_size, signal_page, true);
+        emit_signal_fence(builder);
+        emit_safepoint_poll_test(builder, load);
+        return;
     }
     else {
         Function *F = M->getFunction("julia.safepoint");
@@ -211,7 +211,7 @@ Value *FinalLowerGC::lowerGCAllocBytes(CallInst *target, Function &F)
     auto sz = (size_t)cast<ConstantInt>(target->getArgOperand(1))->getZExtValue();
     // This is strongly architecture and OS dependent
     int osize;
-    int offset = jl_gc_classify_pools(sz, &osize);
+    int offset = jl_gc_active_allocator.classify(sz, &osize);
     IRBuilder<> builder(target);
     builder.SetCurrentDebugLocation(target->getDebugLoc());
     auto ptls = target->getArgOperand(0);
@@ -235,6 +235,18 @@ Value *FinalLowerGC::lowerGCAllocBytes(CallInst *target, Function &F)
     return newI;
 }
 
+// Redeclare an allocation entry point under the name the active allocator
+// descriptor selected, keeping the prototype and attributes of the default
+// declaration.
+static Function *redeclareAllocFunc(Module &M, Function *proto, const char *name)
+{
+    if (proto->getName() == name)
+        return proto;
+    Function *f = cast<Function>(M.getOrInsertFunction(name, proto->getFunctionType()).getCallee());
+    f->setAttributes(proto->getAttributes());
+    return f;
+}
+
 bool FinalLowerGC::doInitialization(Module &M) {
     // Initialize platform-agnostic references.
     initAll(M);
@@ -243,6 +255,10 @@ bool FinalLowerGC::doInitialization(Module &M) {
     queueRootFunc = getOrDeclare(jl_well_known::GCQueueRoot);
     poolAllocFunc = getOrDeclare(jl_well_known::GCPoolAlloc);
     bigAllocFunc = getOrDeclare(jl_well_known::GCBigAlloc);
+    // the well-known descriptions declare the default pool allocator; follow
+    // the active allocator descriptor if it names different entry points
+    poolAllocFunc = redeclareAllocFunc(M, poolAllocFunc, jl_gc_active_allocator.alloc_small);
+    bigAllocFunc = redeclareAllocFunc(M, bigAllocFunc, jl_gc_active_allocator.alloc_big);
 
     GlobalValue *functionList[] = {queueRootFunc, poolAllocFunc, bigAllocFunc};
     unsigned j = 0;
@@ -333,6 +349,7 @@ bool FinalLowerGC::runOnFunction(Function &F)
     auto safepointFunc = getOrNull(jl_intrinsics::safepoint);
 
     // Lower all calls to supported intrinsics.
+    SmallVector<Instruction *, 0> safepointLoads;
     for (BasicBlock &BB : F) {
         for (auto it = BB.begin(); it != BB.end();) {
             auto *CI = dyn_cast<CallInst>(&*it);
@@ -365,7 +382,7 @@ bool FinalLowerGC::runOnFunction(Function &F)
                 replaceInstruction(CI, lowerQueueGCRoot(CI, F), it);
             }
             else if (callee == safepointFunc) {
-                lowerSafepoint(CI, F);
+                safepointLoads.push_back(cast<Instruction>(lowerSafepoint(CI, F)));
                 it = CI->eraseFromParent();
             }
             else {
@@ -374,6 +391,15 @@ bool FinalLowerGC::runOnFunction(Function &F)
         }
     }
 
+    // Each poll must test the loaded word and call the rendezvous slow path
+    // when it is set, since the membarrier stop-the-world mode delivers no
+    // fault (see safepoint.c). Splitting the blocks here, after the
+    // instruction walk, keeps the iterators above valid.
+    for (Instruction *load : safepointLoads) {
+        IRBuilder<> builder(load->getNextNode());
+        emit_safepoint_poll_test(builder, load);
+    }
+
     return true;
 }
 
@@ -256,7 +256,10 @@ struct JuliaLICM : public JuliaPassContext {
                     jl_alloc::CheckInst::Stack check_stack;
                     jl_alloc::EscapeAnalysisRequiredArgs required{use_info, check_stack, *this, DL};
                     jl_alloc::runEscapeAnalysis(call, required, jl_alloc::EscapeAnalysisOptionalArgs().with_valid_set(&L->getBlocksSet()));
-                    if (use_info.escaped || use_info.addrescaped) {
+                    if (use_info.escaped || use_info.addrescaped ||
+                        !use_info.stored_into.empty()) {
+                        // a store into another object is still an escape
+                        // for hoisting purposes
                         continue;
                     }
                     bool valid = true;
@@ -2720,9 +2720,69 @@ void LateLowerGCFrame::PlaceRootsAndUpdateCalls(std::vector<int> &Colors, State
 
         // Insert GC frame stores
         PlaceGCFrameStores(S, AllocaSlot - 2, Colors, gcframe);
+
+        // Shrink-wrap the frame push: a frame whose roots are only needed on
+        // one side of an early guard still costs every call the push/pop
+        // pair. Sink the push to the nearest common dominator of all
+        // safepoints and frame accesses and pop only on the exits it
+        // dominates, so returns on the fast side of the guard skip frame
+        // maintenance entirely. Only legal when every return is either
+        // dominated by the new position (always pushed) or unreachable from
+        // it (never pushed), and when the position is not inside a cycle,
+        // where a second push would link the frame onto itself.
+        if (!S.DT)
+            S.DT = &GetDT();
+        BasicBlock *PushBB = pushGcframe->getParent();
+        BasicBlock *Dom = nullptr;
+        for (auto &SP : S.SafepointNumbering) {
+            BasicBlock *BB = SP.first->getParent();
+            Dom = Dom ? S.DT->findNearestCommonDominator(Dom, BB) : BB;
+        }
+        Function *getGCFrameSlotFunc = getOrDeclare(jl_intrinsics::getGCFrameSlot);
+        SmallVector<Value *, 16> AddrWorklist;
+        SmallPtrSet<User *, 16> AddrSeen;
+        AddrWorklist.push_back(gcframe);
+        while (!AddrWorklist.empty()) {
+            Value *V = AddrWorklist.pop_back_val();
+            for (User *U : V->users()) {
+                if (U == pushGcframe || !AddrSeen.insert(U).second)
+                    continue;
+                auto *UCI = dyn_cast<CallInst>(U);
+                if (isa<GetElementPtrInst>(U) || isa<BitCastInst>(U) ||
+                    (UCI && UCI->getCalledOperand() == getGCFrameSlotFunc)) {
+                    // address computation; look through to the accesses
+                    AddrWorklist.push_back(U);
+                    continue;
+                }
+                BasicBlock *BB = cast<Instruction>(U)->getParent();
+                Dom = Dom ? S.DT->findNearestCommonDominator(Dom, BB) : BB;
+            }
+        }
+        bool Sunk = false;
+        if (Dom && Dom != PushBB) {
+            auto *PI = dyn_cast<Instruction>(pgcstack);
+            Sunk = !PI || (PI->getParent() != Dom && S.DT->dominates(PI->getParent(), Dom));
+            if (Sunk && isPotentiallyReachable(Dom->getTerminator(), &Dom->front(), nullptr, S.DT))
+                Sunk = false; // inside a cycle
+            if (Sunk) {
+                for (auto &BB : *F) {
+                    if (!isa<ReturnInst>(BB.getTerminator()) || S.DT->dominates(Dom, &BB))
+                        continue;
+                    if (isPotentiallyReachable(Dom->getTerminator(), BB.getTerminator(), nullptr, S.DT)) {
+                        Sunk = false; // this exit may see the frame either pushed or not
+                        break;
+                    }
+                }
+            }
+            if (Sunk)
+                pushGcframe->moveBefore(&*Dom->getFirstInsertionPt());
+        }
+
         // Insert GCFrame pops
         for (auto &BB : *F) {
             if (isa<ReturnInst>(BB.getTerminator())) {
+                if (Sunk && !S.DT->dominates(Dom, &BB))
+                    continue; // the frame is never pushed on the way to this exit
                 auto popGcframe = CallInst::Create(
                     getOrDeclare(jl_intrinsics::popGCFrame),
                     {gcframe});
@@ -2732,6 +2792,61 @@ void LateLowerGCFrame::PlaceRootsAndUpdateCalls(std::vector<int> &Colors, State
     }
 }
 
+// Rematerialize immutable loads at their uses instead of rooting the loaded
+// value across safepoints. A tracked pointer loaded from immutable (or
+// constant) memory can always be reloaded from its address, so when such a
+// value is used on the far side of a safepoint we clone the load at the use
+// rather than let the root-placement below spill both the container and the
+// loaded value to the GC frame. The address operand's live range grows
+// instead, which keeps the container rooted -- the reload is a plain
+// (usually L1-resident) load, cheaper than a frame store/reload pair plus
+// the extra slot. Uses in other blocks are reloaded unconditionally rather
+// than paying for a path-sensitive safepoint scan.
+static bool RematerializeImmutLoads(Function &F)
+{
+    bool Changed = false;
+    SmallVector<LoadInst *, 16> Candidates;
+    for (auto &BB : F) {
+        for (auto &I : BB) {
+            auto *LI = dyn_cast<LoadInst>(&I);
+            if (LI && LI->isSimple() && isTrackedValue(LI) && isLoadFromImmut(LI))
+                Candidates.push_back(LI);
+        }
+    }
+    for (LoadInst *LI : Candidates) {
+        SmallVector<Use *, 8> Reloads;
+        for (Use &U : LI->uses()) {
+            auto *UI = cast<Instruction>(U.getUser());
+            if (isa<PHINode>(UI) || UI == LI)
+                continue;
+            bool crosses = UI->getParent() != LI->getParent();
+            if (!crosses) {
+                // any non-intrinsic call between the load and the use is a
+                // potential safepoint
+                for (auto it = std::next(LI->getIterator()); &*it != UI; ++it) {
+                    if (isa<CallBase>(&*it) && !isa<IntrinsicInst>(&*it)) {
+                        crosses = true;
+                        break;
+                    }
+                }
+            }
+            if (crosses)
+                Reloads.push_back(&U);
+        }
+        for (Use *U : Reloads) {
+            auto *Reload = cast<LoadInst>(LI->clone());
+            Reload->insertBefore(cast<Instruction>(U->getUser()));
+            U->set(Reload);
+            Changed = true;
+        }
+        if (LI->use_empty()) {
+            LI->eraseFromParent();
+            Changed = true;
+        }
+    }
+    return Changed;
+}
+
 bool LateLowerGCFrame::runOnFunction(Function &F, bool *CFGModified) {
     initAll(*F.getParent());
     LLVM_DEBUG(dbgs() << "GC ROOT PLACEMENT: Processing function " << F.getName() << "\n");
@@ -2742,6 +2857,8 @@ bool LateLowerGCFrame::runOnFunction(Function &F, bool *CFGModified) {
     if (!pgcstack)
         return CleanupIR(F, nullptr, CFGModified);
 
+    RematerializeImmutLoads(F);
+
     State S = LocalScan(F);
     ComputeLiveness(S);
     std::vector<int> Colors = ColorRoots(S);
@@ -432,6 +432,49 @@ void CloneCtx::clone_bases()
     }
 }
 
+// With JULIA_MV_VECTOR_LOOPS_ONLY set, only loops that can plausibly produce
+// target-dependent code count towards `JL_TARGET_CLONE_LOOP`. By default any
+// loop marks its function for cloning on loop targets, but most loops are
+// branchy scalar code that lowers identically on every target of an
+// architecture, so cloning them only grows the image.
+static bool clone_vector_loops_only()
+{
+    static bool only = []() {
+        const char *env = getenv("JULIA_MV_VECTOR_LOOPS_ONLY");
+        return env && strcmp(env, "0") != 0;
+    }();
+    return only;
+}
+
+static bool is_profitable_loop(Loop &L)
+{
+    // Explicit loop metadata (`@simd` leaves vectorization hints behind)
+    // means the user asked for target-dependent codegen.
+    if (L.getLoopID())
+        return true;
+    for (auto *bb: L.blocks()) {
+        for (auto &I: *bb) {
+            // Floating point or vector compute, and integer multiplies or
+            // divides, are what the backend can widen or reschedule
+            // differently per target; induction arithmetic and control flow
+            // are not.
+            if (I.getType()->isVectorTy())
+                return true;
+            if (isa<FPMathOperator>(&I) && I.getType()->isFPOrFPVectorTy())
+                return true;
+            switch (I.getOpcode()) {
+            case Instruction::Mul:
+            case Instruction::UDiv:
+            case Instruction::SDiv:
+                return true;
+            default:
+                break;
+            }
+        }
+    }
+    return false;
+}
+
 bool CloneCtx::is_vector(FunctionType *ty) const
 {
     if (ty->getReturnType()->isVectorTy())
@@ -447,8 +490,20 @@ bool CloneCtx::is_vector(FunctionType *ty) const
 uint32_t CloneCtx::collect_func_info(Function &F)
 {
     uint32_t flag = 0;
-    if (!GetLI(F).empty())
-        flag |= JL_TARGET_CLONE_LOOP;
+    auto &LI = GetLI(F);
+    if (!LI.empty()) {
+        if (!clone_vector_loops_only()) {
+            flag |= JL_TARGET_CLONE_LOOP;
+        }
+        else {
+            for (auto *L: LI.getLoopsInPreorder()) {
+                if (is_profitable_loop(*L)) {
+                    flag |= JL_TARGET_CLONE_LOOP;
+                    break;
+                }
+            }
+        }
+    }
     if (is_vector(F.getFunctionType())) {
         flag |= JL_TARGET_CLONE_SIMD;
         has_veccall = true;
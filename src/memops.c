@@ -0,0 +1,187 @@
+// This file is a part of Julia. License is MIT: https://julialang.org/license
+
+/*
+  memops.c
+  runtime-internal memcpy/memset with CPU-selected copy strategies
+
+  libc's memcpy is tuned for the average process, not for the mix of
+  sizes the runtime produces: array growth and `copy` move buffers that
+  are often far larger than the last-level cache, and the destination of
+  those copies is frequently a freshly allocated buffer that will not be
+  read again soon.  jl_memcpy/jl_memset pick a strategy once at startup:
+
+    - small copies stay on libc's inlined fast path;
+    - mid-sized copies use `rep movsb`/`rep stosb` when the CPU reports
+      enhanced string operations (ERMS), which avoids the SIMD dispatch
+      and alignment preamble of the library routine;
+    - very large copies switch to non-temporal stores so they do not
+      evict the working set from the cache.
+
+  jl_memcpy_nt is for callers that know the destination is cold (e.g. a
+  buffer that was just allocated for a copy): it drops to non-temporal
+  stores at a much lower threshold.
+*/
+
+#include <string.h>
+
+#include "julia.h"
+#include "julia_internal.h"
+
+#if (defined(_CPU_X86_64_) || defined(_CPU_X86_)) && !defined(_COMPILER_MICROSOFT_)
+#include <cpuid.h>
+#define JL_HAVE_MEMOPS_ERMS
+#endif
+#if defined(_CPU_X86_64_) && !defined(_COMPILER_MICROSOFT_)
+#include <emmintrin.h>
+#define JL_HAVE_MEMOPS_NT
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Strategy thresholds, chosen once by jl_memops_init. Until then (and on
+// architectures without a better option) both stay at SIZE_MAX so every
+// call falls through to libc.
+static size_t jl_memops_rep_threshold = (size_t)-1;
+static size_t jl_memops_nt_threshold = (size_t)-1;
+
+#ifdef JL_HAVE_MEMOPS_ERMS
+static void *jl_memcpy_erms(void *dst, const void *src, size_t n) JL_NOTSAFEPOINT
+{
+    void *ret = dst;
+    __asm__ __volatile__("rep movsb"
+                         : "+D"(dst), "+S"(src), "+c"(n)
+                         :
+                         : "memory");
+    return ret;
+}
+
+static void *jl_memset_erms(void *dst, int c, size_t n) JL_NOTSAFEPOINT
+{
+    void *ret = dst;
+    __asm__ __volatile__("rep stosb"
+                         : "+D"(dst), "+c"(n)
+                         : "a"(c)
+                         : "memory");
+    return ret;
+}
+#endif
+
+#ifdef JL_HAVE_MEMOPS_NT
+static void *jl_memcpy_ntstores(void *dst, const void *src, size_t n) JL_NOTSAFEPOINT
+{
+    char *d = (char*)dst;
+    const char *s = (const char*)src;
+    // non-temporal stores need a 16-byte aligned destination; the source
+    // may stay misaligned (loadu below)
+    size_t head = (16 - ((uintptr_t)d & 15)) & 15;
+    if (head) {
+        memcpy(d, s, head);
+        d += head;
+        s += head;
+        n -= head;
+    }
+    while (n >= 64) {
+        __m128i x0 = _mm_loadu_si128((const __m128i*)(s + 0));
+        __m128i x1 = _mm_loadu_si128((const __m128i*)(s + 16));
+        __m128i x2 = _mm_loadu_si128((const __m128i*)(s + 32));
+        __m128i x3 = _mm_loadu_si128((const __m128i*)(s + 48));
+        _mm_stream_si128((__m128i*)(d + 0), x0);
+        _mm_stream_si128((__m128i*)(d + 16), x1);
+        _mm_stream_si128((__m128i*)(d + 32), x2);
+        _mm_stream_si128((__m128i*)(d + 48), x3);
+        d += 64;
+        s += 64;
+        n -= 64;
+    }
+    // order the non-temporal stores before any later release store
+    // publishing the buffer
+    _mm_sfence();
+    if (n)
+        memcpy(d, s, n);
+    return dst;
+}
+
+static void *jl_memset_ntstores(void *dst, int c, size_t n) JL_NOTSAFEPOINT
+{
+    char *d = (char*)dst;
+    size_t head = (16 - ((uintptr_t)d & 15)) & 15;
+    if (head) {
+        memset(d, c, head);
+        d += head;
+        n -= head;
+    }
+    __m128i x = _mm_set1_epi8((char)c);
+    while (n >= 64) {
+        _mm_stream_si128((__m128i*)(d + 0), x);
+        _mm_stream_si128((__m128i*)(d + 16), x);
+        _mm_stream_si128((__m128i*)(d + 32), x);
+        _mm_stream_si128((__m128i*)(d + 48), x);
+        d += 64;
+        n -= 64;
+    }
+    _mm_sfence();
+    if (n)
+        memset(d, c, n);
+    return dst;
+}
+#endif
+
+void jl_memops_init(void)
+{
+#ifdef JL_HAVE_MEMOPS_ERMS
+    uint32_t eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) && (ebx & (1u << 9))) {
+        // enhanced rep movsb/stosb: beats the library's SIMD loop from a
+        // few KiB up without its dispatch and alignment preamble
+        jl_memops_rep_threshold = 2048;
+    }
+#endif
+#ifdef JL_HAVE_MEMOPS_NT
+    // past a few MiB cached stores only evict data the mutator still
+    // wants; switch to non-temporal stores
+    jl_memops_nt_threshold = 4 * 1024 * 1024;
+#endif
+}
+
+JL_DLLEXPORT void *jl_memcpy(void *dst, const void *src, size_t n) JL_NOTSAFEPOINT
+{
+#ifdef JL_HAVE_MEMOPS_NT
+    if (n >= jl_memops_nt_threshold)
+        return jl_memcpy_ntstores(dst, src, n);
+#endif
+#ifdef JL_HAVE_MEMOPS_ERMS
+    if (n >= jl_memops_rep_threshold)
+        return jl_memcpy_erms(dst, src, n);
+#endif
+    return memcpy(dst, src, n);
+}
+
+JL_DLLEXPORT void *jl_memset(void *dst, int c, size_t n) JL_NOTSAFEPOINT
+{
+#ifdef JL_HAVE_MEMOPS_NT
+    if (n >= jl_memops_nt_threshold)
+        return jl_memset_ntstores(dst, c, n);
+#endif
+#ifdef JL_HAVE_MEMOPS_ERMS
+    if (n >= jl_memops_rep_threshold)
+        return jl_memset_erms(dst, c, n);
+#endif
+    return memset(dst, c, n);
+}
+
+JL_DLLEXPORT void *jl_memcpy_nt(void *dst, const void *src, size_t n) JL_NOTSAFEPOINT
+{
+#ifdef JL_HAVE_MEMOPS_NT
+    // the caller promises the destination will not be read soon, so even
+    // moderately sized copies should bypass the cache
+    if (jl_memops_nt_threshold != (size_t)-1 && n >= 4096)
+        return jl_memcpy_ntstores(dst, src, n);
+#endif
+    return jl_memcpy(dst, src, n);
+}
+
+#ifdef __cplusplus
+}
+#endif
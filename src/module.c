@@ -21,6 +21,7 @@ JL_DLLEXPORT jl_module_t *jl_new_module_(jl_sym_t *name, jl_module_t *parent, ui
     m->name = name;
     m->parent = parent;
     m->istopmod = 0;
+    m->sealed = 0;
     m->uuid = uuid_zero;
     static unsigned int mcounter; // simple counter backup, in case hrtime is not incrementing
     m->build_id.lo = jl_hrtime() + (++mcounter);
@@ -39,6 +40,7 @@ JL_DLLEXPORT jl_module_t *jl_new_module_(jl_sym_t *name, jl_module_t *parent, ui
     JL_MUTEX_INIT(&m->lock);
     jl_atomic_store_relaxed(&m->bindings, jl_emptysvec);
     jl_atomic_store_relaxed(&m->bindingkeyset, (jl_array_t*)jl_an_empty_vec_any);
+    jl_atomic_store_relaxed(&m->last_binding, NULL);
     arraylist_new(&m->usings, 0);
     JL_GC_PUSH1(&m);
     if (jl_core_module && default_names) {
@@ -685,6 +687,12 @@ static int bindingkey_eq(size_t idx, const void *var, jl_svec_t *data, uint_t hv
 
 JL_DLLEXPORT jl_binding_t *jl_get_module_binding(jl_module_t *m, jl_sym_t *var, int alloc)
 {
+    // hashless fast path: check the most recently returned binding first;
+    // bindings are never removed from a module, so a hit is always valid
+    // (the single-pointer cache is self-validating via the globalref name)
+    jl_binding_t *lastb = jl_atomic_load_relaxed(&m->last_binding); // consume
+    if (lastb != NULL && lastb->globalref->name == var)
+        return lastb;
     uint_t hv = var->hash;
     for (int locked = 0; ; locked++) {
         jl_array_t *bindingkeyset = jl_atomic_load_acquire(&m->bindingkeyset);
@@ -694,6 +702,7 @@ JL_DLLEXPORT jl_binding_t *jl_get_module_binding(jl_module_t *m, jl_sym_t *var,
             jl_binding_t *b = (jl_binding_t*)jl_svecref(bindings, idx); // relaxed
             if (locked)
                 JL_UNLOCK(&m->lock);
+            jl_atomic_store_release(&m->last_binding, b);
             return b;
         }
         if (!alloc) {
@@ -724,6 +733,7 @@ JL_DLLEXPORT jl_binding_t *jl_get_module_binding(jl_module_t *m, jl_sym_t *var,
             assert(jl_svecref(bindings, i) == jl_nothing);
             jl_svecset(bindings, i, b); // relaxed
             jl_smallintset_insert(&m->bindingkeyset, (jl_value_t*)m, bindingkey_hash, i, bindings); // release
+            jl_atomic_store_release(&m->last_binding, b);
             JL_UNLOCK(&m->lock);
             return b;
         }
@@ -854,6 +864,12 @@ JL_DLLEXPORT void jl_checked_assignment(jl_binding_t *b, jl_module_t *mod, jl_sy
             JL_GC_POP();
         }
     }
+    if (mod->sealed && jl_atomic_load_relaxed(&b->value) != NULL) {
+        // reassigning an already-assigned binding of a sealed module: code may
+        // have been compiled with its value embedded, so the seal is broken
+        // and all dependents are invalidated
+        jl_module_break_seal(mod);
+    }
     if (b->constp) {
         jl_value_t *old = NULL;
         if (jl_atomic_cmpswap(&b->value, &old, rhs)) {
@@ -884,6 +900,20 @@ JL_DLLEXPORT void jl_declare_constant(jl_binding_t *b, jl_module_t *mod, jl_sym_
     b->constp = 1;
 }
 
+// Seal a module: the caller promises that none of its assigned bindings will
+// be reassigned, which lets codegen embed their current values as constants
+// (see emit_globalref). Assigning to an already-assigned binding afterwards
+// breaks the seal and invalidates all code compiled under it.
+JL_DLLEXPORT void jl_module_seal(jl_module_t *m)
+{
+    m->sealed = 1;
+}
+
+JL_DLLEXPORT int jl_module_sealed(jl_module_t *m)
+{
+    return m->sealed;
+}
+
 JL_DLLEXPORT jl_value_t *jl_module_usings(jl_module_t *m)
 {
     JL_LOCK(&m->lock);
@@ -12,6 +12,21 @@
 
 #define N_CALL_CACHE 4096
 
+// number of distinct runtime-dispatch targets the JULIA_DISPATCH_TRACE
+// recorder can hold; once full, further distinct targets are dropped
+#define N_DISPATCH_TRACE 32768
+
+// number of entries in the memo table for env-free subtype queries
+#define N_SUBTYPE_CACHE 2048
+
+// number of entries in the memo table for whole-query type intersections
+#define N_INTERSECT_CACHE 1024
+
+// small-string dedup cache: strings of at most SMALL_STRING_MAX_LEN bytes
+// created by `jl_pchar_to_string` are looked up here before allocating
+#define N_SMALL_STRING_CACHE 1024
+#define SMALL_STRING_MAX_LEN 16
+
 // object layout options ------------------------------------------------------
 
 // The data for an array this size or below will be allocated within the
@@ -22,6 +37,12 @@
 // Must be bigger than GC_MAX_SZCLASS.
 #define ARRAY_CACHE_ALIGN_THRESHOLD 2048
 
+// Arrays with constant dimensions, pointer-free elements and at most this
+// much data that do not escape their allocating function are allocated on
+// the stack (see the alloc-opt pass). Must be below
+// ARRAY_CACHE_ALIGN_THRESHOLD so the inline data placement stays the same.
+#define ARRAY_STACK_ALLOC_NBYTES 256
+
 // codegen options ------------------------------------------------------------
 
 // (Experimental) Use MCJIT ELF, even where it's not the native format
@@ -82,6 +103,19 @@
 //#define ENABLE_TIMINGS
 
 
+// hybrid execution (`Experimental.@compiler_options compile=lazy`):
+// number of interpreted calls after which a method is compiled natively
+#define JL_LAZY_COMPILE_THRESHOLD 16
+// number of slots for the (approximate) per-method-instance call counts
+#define N_LAZY_COMPILE_COUNTS 1024
+
+// speculative re-specialization (JULIA_TYPE_FEEDBACK):
+// number of consecutive monomorphic calls observed at an abstract-signature
+// method instance before its concrete specialization is compiled
+#define JL_TYPE_FEEDBACK_THRESHOLD 16
+// number of slots for the (approximate) per-method-instance type profiles
+#define N_TYPE_FEEDBACK_SLOTS 1024
+
 // method dispatch profiling --------------------------------------------------
 
 // turn type inference on/off. this is for internal debugging only, and must be
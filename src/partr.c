@@ -103,6 +103,9 @@ void jl_init_threadinginfra(void)
         else
             sleep_threshold = (uint64_t)strtol(cp, NULL, 10);
     }
+    // --task-sleep-threshold takes precedence over the environment
+    if (jl_options.task_sleep_threshold)
+        sleep_threshold = jl_options.task_sleep_threshold;
 }
 
 
@@ -113,6 +116,17 @@ void jl_threadfun(void *arg)
 {
     jl_threadarg_t *targ = (jl_threadarg_t*)arg;
 
+    // wait until the runtime is ready for worker initialization; the spawn
+    // may be overlapped with the sysimage restore (see jl_spawn_threads)
+    uv_barrier_wait(targ->start_gate);
+    if (targ->tid >= jl_atomic_load_relaxed(&jl_n_threads)) {
+        // the thread count was reduced after spawning (the loaded image had
+        // no Base to schedule on); participate in the init barrier and exit
+        uv_barrier_wait(targ->barrier);
+        free(targ);
+        return;
+    }
+
     // initialize this thread (set tid, create heap, set up root task)
     jl_ptls_t ptls = jl_init_threadtls(targ->tid);
     void *stack_lo, *stack_hi;
@@ -183,6 +197,10 @@ static int sleep_check_after_threshold(uint64_t *start_cycles)
 }
 
 
+// rotating start point for wake_any, so that successive wakeups spread
+// across the threads instead of hammering the lowest sleeping tid
+static _Atomic(int) wake_cursor = 0;
+
 static int wake_thread(int16_t tid) JL_NOTSAFEPOINT
 {
     jl_ptls_t other = jl_atomic_load_relaxed(&jl_all_tls_states)[tid];
@@ -243,14 +261,21 @@ JL_DLLEXPORT void jl_wakeup_thread(int16_t tid) JL_NOTSAFEPOINT
     }
     // check if the other threads might be sleeping
     if (tid == -1) {
-        // something added to the multi-queue: notify all threads
-        // in the future, we might want to instead wake some fraction of threads,
-        // and let each of those wake additional threads if they find work
+        // something added to the multi-queue: notify one sleeping thread.
+        // The woken thread passes the wakeup along if it finds more work
+        // than it can take (see jl_task_get_next), so a burst of enqueues
+        // wakes threads in a chain instead of storming every sleeping
+        // thread's condition variable for every insert.
         int anysleep = 0;
         int nthreads = jl_atomic_load_acquire(&jl_n_threads);
-        for (tid = 0; tid < nthreads; tid++) {
-            if (tid != self)
-                anysleep |= wake_thread(tid);
+        int c = jl_atomic_load_relaxed(&wake_cursor);
+        jl_atomic_store_relaxed(&wake_cursor, c + 1 >= nthreads ? 0 : c + 1); // racy, but it only needs to rotate
+        for (int i = 0; i < nthreads; i++) {
+            tid = (int16_t)((c + i) % nthreads);
+            if (tid != self && wake_thread(tid)) {
+                anysleep = 1;
+                break;
+            }
         }
         // check if we need to notify uv_run too
         if (uvlock != ct && anysleep) {
@@ -263,6 +288,201 @@ JL_DLLEXPORT void jl_wakeup_thread(int16_t tid) JL_NOTSAFEPOINT
 }
 
 
+// timer wheel ----------------------------------------------------------------
+
+// Task wakeup deadlines live in a hierarchical wheel owned by the thread
+// that registered them (see julia_internal.h for the layout), so
+// registering or cancelling a timeout never touches the libuv timer heap
+// or jl_uv_mutex. Deadlines are serviced from jl_task_get_next: an idle
+// thread bounds its condition-variable sleep by its next deadline, and a
+// thread parked in uv_run arms a single one-shot libuv timer for the
+// whole wheel so the event loop wakes it in time.
+
+// map a deadline to its wheel slot; entries at or past the wheel's horizon
+// park in the furthest slot and cascade closer as the wheel advances
+static jl_timer_node_t **timer_wheel_slot(jl_timer_wheel_t *w, uint64_t deadline_ns) JL_NOTSAFEPOINT
+{
+    uint64_t tick = deadline_ns / JL_TIMER_WHEEL_TICK_NS;
+    if (tick <= w->last_tick)
+        tick = w->last_tick; // overdue: place at the current tick
+    uint64_t horizon = (uint64_t)1 << (JL_TIMER_WHEEL_BITS * JL_TIMER_WHEEL_LEVELS);
+    if (tick - w->last_tick >= horizon)
+        tick = w->last_tick + horizon - 1;
+    uint64_t delta = tick - w->last_tick;
+    int level = 0;
+    while (delta >= (uint64_t)1 << (JL_TIMER_WHEEL_BITS * (level + 1)))
+        level++;
+    size_t idx = (tick >> (JL_TIMER_WHEEL_BITS * level)) & (JL_TIMER_WHEEL_SLOTS - 1);
+    return &w->slots[level][idx];
+}
+
+static void timer_wheel_insert(jl_timer_wheel_t *w, jl_timer_node_t *node) JL_NOTSAFEPOINT
+{
+    jl_timer_node_t **slot = timer_wheel_slot(w, node->deadline_ns);
+    node->next = *slot;
+    node->pprev = slot;
+    if (*slot)
+        (*slot)->pprev = &node->next;
+    *slot = node;
+}
+
+static void timer_wheel_unlink(jl_timer_node_t *node) JL_NOTSAFEPOINT
+{
+    *node->pprev = node->next;
+    if (node->next)
+        node->next->pprev = node->pprev;
+}
+
+JL_DLLEXPORT void *jl_timer_wheel_add(jl_task_t *task, uint64_t deadline_ns)
+{
+    jl_ptls_t ptls = jl_current_task->ptls;
+    jl_timer_wheel_t *w = ptls->timer_wheel;
+    if (w == NULL) {
+        w = (jl_timer_wheel_t*)malloc_s(sizeof(jl_timer_wheel_t));
+        memset(w, 0, sizeof(jl_timer_wheel_t));
+        w->last_tick = jl_hrtime() / JL_TIMER_WHEEL_TICK_NS;
+        ptls->timer_wheel = w;
+    }
+    jl_timer_node_t *node = (jl_timer_node_t*)malloc_s(sizeof(jl_timer_node_t));
+    node->task = task;
+    node->deadline_ns = deadline_ns;
+    timer_wheel_insert(w, node);
+    w->count++;
+    return node;
+}
+
+JL_DLLEXPORT void jl_timer_wheel_cancel(void *handle)
+{
+    jl_timer_node_t *node = (jl_timer_node_t*)handle;
+    jl_timer_wheel_t *w = jl_current_task->ptls->timer_wheel;
+    assert(w != NULL && w->count > 0);
+    timer_wheel_unlink(node);
+    w->count--;
+    free(node);
+}
+
+// earliest instant (ns) at which the wheel needs servicing (the start of the
+// first non-empty slot, which for higher levels is when its entries cascade),
+// or 0 if the wheel is empty
+static uint64_t timer_wheel_next(jl_ptls_t ptls) JL_NOTSAFEPOINT
+{
+    jl_timer_wheel_t *w = ptls->timer_wheel;
+    if (w == NULL || w->count == 0)
+        return 0;
+    uint64_t best = UINT64_MAX;
+    for (int level = 0; level < JL_TIMER_WHEEL_LEVELS; level++) {
+        uint64_t span = (uint64_t)1 << (JL_TIMER_WHEEL_BITS * level);
+        for (size_t i = 0; i < JL_TIMER_WHEEL_SLOTS; i++) {
+            if (w->slots[level][i] == NULL)
+                continue;
+            // next tick >= last_tick that falls in this slot
+            uint64_t t = ((w->last_tick >> (JL_TIMER_WHEEL_BITS * level)) &
+                          ~(uint64_t)(JL_TIMER_WHEEL_SLOTS - 1)) | i;
+            t <<= JL_TIMER_WHEEL_BITS * level;
+            if (t + span <= w->last_tick)
+                t += span << JL_TIMER_WHEEL_BITS;
+            if (t < best)
+                best = t;
+        }
+    }
+    if (best == UINT64_MAX)
+        return 0;
+    if (best <= w->last_tick)
+        best = w->last_tick;
+    return best * JL_TIMER_WHEEL_TICK_NS;
+}
+
+// hand an expired task back to the scheduler; errors (e.g. the task was
+// already done and its timeout never cancelled) are swallowed since there
+// is no frame here to propagate them to
+static void timer_wheel_reschedule(jl_task_t *task)
+{
+    jl_value_t *sched = jl_base_module ? jl_get_global(jl_base_module, jl_symbol("schedule")) : NULL;
+    if (sched == NULL)
+        return;
+    jl_task_t *ct = jl_current_task;
+    size_t lastage = ct->world_age;
+    ct->world_age = jl_atomic_load_acquire(&jl_world_counter);
+    // the caller has already freed the wheel node, which was the task's only
+    // root, so keep it pinned while `schedule` can run the GC
+    JL_GC_PUSH1(&task);
+    JL_TRY {
+        jl_value_t *args[2] = {sched, (jl_value_t*)task};
+        jl_apply(args, 2);
+    }
+    JL_CATCH {
+    }
+    JL_GC_POP();
+    ct->world_age = lastage;
+}
+
+static void timer_wheel_expire(jl_ptls_t ptls)
+{
+    jl_timer_wheel_t *w = ptls->timer_wheel;
+    if (w == NULL)
+        return;
+    uint64_t now_tick = jl_hrtime() / JL_TIMER_WHEEL_TICK_NS;
+    if (w->count == 0) {
+        w->last_tick = now_tick;
+        return;
+    }
+    while (w->last_tick < now_tick) {
+        uint64_t t = ++w->last_tick;
+        // cascade one slot from every level whose span `t` just crossed
+        for (int level = 1; level < JL_TIMER_WHEEL_LEVELS; level++) {
+            if (t & (((uint64_t)1 << (JL_TIMER_WHEEL_BITS * level)) - 1))
+                break;
+            size_t idx = (t >> (JL_TIMER_WHEEL_BITS * level)) & (JL_TIMER_WHEEL_SLOTS - 1);
+            jl_timer_node_t *node = w->slots[level][idx];
+            w->slots[level][idx] = NULL;
+            while (node) {
+                jl_timer_node_t *next = node->next;
+                timer_wheel_insert(w, node);
+                node = next;
+            }
+        }
+        size_t idx = t & (JL_TIMER_WHEEL_SLOTS - 1);
+        jl_timer_node_t *node;
+        // reschedule one entry at a time so that entries not yet handled
+        // stay in the wheel (and thus rooted) if scheduling runs the GC
+        while ((node = w->slots[0][idx]) != NULL) {
+            timer_wheel_unlink(node);
+            w->count--;
+            jl_task_t *task = node->task;
+            free(node);
+            timer_wheel_reschedule(task);
+        }
+        if (w->count == 0) {
+            w->last_tick = now_tick;
+            break;
+        }
+    }
+}
+
+// single one-shot libuv timer covering the calling thread's wheel while it
+// is parked in uv_run; caller must hold jl_uv_mutex
+static uv_timer_t timer_wheel_uv_timer;
+static int timer_wheel_uv_timer_inited = 0;
+
+static void timer_wheel_uv_cb(uv_timer_t *t)
+{
+    // nothing to do: uv_run returning is enough, the expiry pass runs in
+    // jl_task_get_next
+    (void)t;
+}
+
+static void timer_wheel_arm_uv(uint64_t next_ns)
+{
+    if (!timer_wheel_uv_timer_inited) {
+        uv_timer_init(jl_global_event_loop(), &timer_wheel_uv_timer);
+        uv_unref((uv_handle_t*)&timer_wheel_uv_timer);
+        timer_wheel_uv_timer_inited = 1;
+    }
+    uint64_t now = jl_hrtime();
+    uint64_t delay_ms = next_ns <= now ? 0 : (next_ns - now + 999999) / 1000000;
+    uv_timer_start(&timer_wheel_uv_timer, timer_wheel_uv_cb, delay_ms, 0);
+}
+
 // get the next runnable task
 static jl_task_t *get_next_task(jl_value_t *trypoptask, jl_value_t *q)
 {
@@ -318,16 +538,32 @@ JL_DLLEXPORT jl_task_t *jl_task_get_next(jl_value_t *trypoptask, jl_value_t *q,
 {
     jl_task_t *ct = jl_current_task;
     uint64_t start_cycles = 0;
+    int spin_backoff = 0;
+    int woken = 0;
 
     while (1) {
+        timer_wheel_expire(ct->ptls);
         jl_task_t *task = get_next_task(trypoptask, q);
-        if (task)
+        if (task) {
+            // if a targeted wake got us here and there is more work than we
+            // can take, pass the wakeup along before running the task
+            if (woken && !check_empty(checkempty))
+                jl_wakeup_thread(-1);
             return task;
+        }
+        woken = 0;
 
         // quick, race-y check to see if there seems to be any stuff in there
-        jl_cpu_pause();
+        // bounded exponential backoff: poll the queues hot at first, then with
+        // progressively longer pauses, so that a pack of idle threads doesn't
+        // saturate the memory bus re-polling the same empty queues
+        if (spin_backoff < 10)
+            spin_backoff++;
+        for (int i = 1 << spin_backoff; i > 0; i--)
+            jl_cpu_pause();
         if (!check_empty(checkempty)) {
             start_cycles = 0;
+            spin_backoff = 0;
             continue;
         }
 
@@ -396,6 +632,11 @@ JL_DLLEXPORT jl_task_t *jl_task_get_next(jl_value_t *trypoptask, jl_value_t *q,
                     // the lock to do real work, we need to let them have it instead
                     enter_eventloop = 0;
                 if (enter_eventloop) {
+                    // make sure the event loop hands control back in time
+                    // for our next wheel deadline
+                    uint64_t next_timer = timer_wheel_next(ptls);
+                    if (next_timer)
+                        timer_wheel_arm_uv(next_timer);
                     uv_loop_t *loop = jl_global_event_loop();
                     loop->stop_flag = 0;
                     JULIA_DEBUG_SLEEPWAKE( ptls->uv_run_enter = cycleclock() );
@@ -411,6 +652,7 @@ JL_DLLEXPORT jl_task_t *jl_task_get_next(jl_value_t *trypoptask, jl_value_t *q,
                 // them take it from us without conflict.
                 if (active || !may_sleep(ptls)) {
                     start_cycles = 0;
+                    spin_backoff = 0;
                     continue;
                 }
                 if (!enter_eventloop && !jl_atomic_load_relaxed(&_threadedregion) && ptls->tid == 0) {
@@ -421,6 +663,7 @@ JL_DLLEXPORT jl_task_t *jl_task_get_next(jl_value_t *trypoptask, jl_value_t *q,
                         JL_PROBE_RT_SLEEP_CHECK_UV_WAKE(ptls);
                     }
                     start_cycles = 0;
+                    spin_backoff = 0;
                     continue;
                 }
             }
@@ -438,7 +681,24 @@ JL_DLLEXPORT jl_task_t *jl_task_get_next(jl_value_t *trypoptask, jl_value_t *q,
                     }
                     break;
                 }
-                uv_cond_wait(&ptls->wake_signal, &ptls->sleep_lock);
+                // bound the sleep by our next timer-wheel deadline, if any
+                uint64_t next_timer = timer_wheel_next(ptls);
+                if (next_timer) {
+                    uint64_t now = jl_hrtime();
+                    if (next_timer <= now ||
+                        uv_cond_timedwait(&ptls->wake_signal, &ptls->sleep_lock, next_timer - now) == UV_ETIMEDOUT) {
+                        // a wheel deadline is due; wake ourselves and run
+                        // the expiry pass at the top of the loop
+                        if (jl_atomic_load_relaxed(&ptls->sleep_check_state) != not_sleeping) {
+                            jl_atomic_store_relaxed(&ptls->sleep_check_state, not_sleeping);
+                            JL_PROBE_RT_SLEEP_CHECK_TASK_WAKE(ptls);
+                        }
+                        break;
+                    }
+                }
+                else {
+                    uv_cond_wait(&ptls->wake_signal, &ptls->sleep_lock);
+                }
                 // TODO: help with gc work here, if applicable
             }
             assert(jl_atomic_load_relaxed(&ptls->sleep_check_state) == not_sleeping);
@@ -446,6 +706,8 @@ JL_DLLEXPORT jl_task_t *jl_task_get_next(jl_value_t *trypoptask, jl_value_t *q,
             JULIA_DEBUG_SLEEPWAKE( ptls->sleep_leave = cycleclock() );
             jl_gc_safe_leave(ptls, gc_state); // contains jl_gc_safepoint
             start_cycles = 0;
+            spin_backoff = 0;
+            woken = 1;
             if (task) {
                 assert(task == wait_empty);
                 wait_empty = NULL;
@@ -35,6 +35,7 @@
 // NewPM needs to manually include all the pass headers
 #include <llvm/Transforms/IPO/AlwaysInliner.h>
 #include <llvm/Transforms/IPO/ConstantMerge.h>
+#include <llvm/Transforms/IPO/HotColdSplitting.h>
 #include <llvm/Transforms/InstCombine/InstCombine.h>
 #include <llvm/Transforms/Instrumentation/AddressSanitizer.h>
 #include <llvm/Transforms/Instrumentation/MemorySanitizer.h>
@@ -173,10 +174,53 @@ namespace {
         // }
     }
 
+    // Opt-in via JULIA_LLVM_VERIFY_SAMPLE=N: run the LLVM IR verifier on one
+    // of every N modules entering the pipeline instead of all of them. Unset
+    // or 0 keeps verifying every module. The GC invariant verifier is our own
+    // pass checking Julia-specific invariants and stays unconditional.
+    int verifySampleInterval() JL_NOTSAFEPOINT {
+        static int interval = 0;
+        static bool checked = false;
+        if (!checked) {
+            const char *env = getenv("JULIA_LLVM_VERIFY_SAMPLE");
+            interval = env ? atoi(env) : 0;
+            checked = true;
+        }
+        return interval;
+    }
+
+    struct SampledVerifierPass : llvm::PassInfoMixin<SampledVerifierPass> {
+        PreservedAnalyses run(Module &M, ModuleAnalysisManager &AM) JL_NOTSAFEPOINT {
+            static std::atomic<uint64_t> counter{0};
+            if (counter.fetch_add(1, std::memory_order_relaxed) % verifySampleInterval() == 0)
+                return VerifierPass().run(M, AM);
+            return PreservedAnalyses::all();
+        }
+    };
+
     void addVerificationPasses(ModulePassManager &MPM, bool llvm_only) JL_NOTSAFEPOINT {
         if (!llvm_only)
             MPM.addPass(llvm::createModuleToFunctionPassAdaptor(GCInvariantVerifierPass()));
-        MPM.addPass(VerifierPass());
+        if (verifySampleInterval() > 1)
+            MPM.addPass(SampledVerifierPass());
+        else
+            MPM.addPass(VerifierPass());
+    }
+
+    bool enableHotColdSplitting() JL_NOTSAFEPOINT {
+        // Opt-in via JULIA_HOT_COLD_SPLITTING=1: outline the cold paths
+        // emitted by `emit_function` (throws, boxed fallbacks) into separate
+        // functions placed after the hot code, so the hot code packs into
+        // fewer (huge) code pages; see cgmemmgr.cpp for the matching
+        // code-page allocation.
+        static bool enable = false;
+        static bool checked = false;
+        if (!checked) {
+            const char *env = getenv("JULIA_HOT_COLD_SPLITTING");
+            enable = env && atoi(env) != 0;
+            checked = true;
+        }
+        return enable;
     }
 
     auto basicSimplifyCFGOptions() JL_NOTSAFEPOINT {
@@ -238,7 +282,6 @@ namespace {
 //? float2int pass
 //? lower constant intrinsics pass
 //? loop sink pass
-//? hot-cold splitting pass
 
 #define JULIA_PASS(ADD_PASS) if (!options.llvm_only) { ADD_PASS; } else do { } while (0)
 
@@ -463,6 +506,12 @@ static void buildFullPipeline(ModulePassManager &MPM, PassBuilder *PB, Optimizat
             FPM.addPass(SimplifyCFGPass(aggressiveSimplifyCFGOptions()));
             MPM.addPass(createModuleToFunctionPassAdaptor(std::move(FPM)));
         }
+        if (enableHotColdSplitting()) {
+            // Must run after the GC lowering passes above: by now the GC
+            // frame is an ordinary alloca, so the outlined cold functions
+            // do not need a pgcstack of their own.
+            MPM.addPass(HotColdSplittingPass());
+        }
     } else {
         JULIA_PASS(MPM.addPass(RemoveNI()));
     }
@@ -484,9 +533,66 @@ static void buildFullPipeline(ModulePassManager &MPM, PassBuilder *PB, Optimizat
 
 #undef JULIA_PASS
 
+// Per-pass wall-time aggregation for the whole JIT session, opt-in via
+// JULIA_TIME_PASSES=1. The timing.h zones identify compilation stages by a
+// fixed enum, so individually-named passes aggregate here instead (the
+// optimizer's total still lands in the LLVM_OPT zone). The table prints to
+// stderr at process exit, or on demand through jl_print_pass_timings().
+static std::mutex pass_timing_lock;
+static StringMap<uint64_t> pass_timings;
+static thread_local SmallVector<uint64_t, 8> pass_timing_stack;
+
+static bool timePassesEnabled() JL_NOTSAFEPOINT {
+    static bool enable = false;
+    static bool checked = false;
+    if (!checked) {
+        const char *env = getenv("JULIA_TIME_PASSES");
+        enable = env && atoi(env) != 0;
+        checked = true;
+    }
+    return enable;
+}
+
+extern "C" JL_DLLEXPORT void jl_print_pass_timings(void)
+{
+    std::lock_guard<std::mutex> lock(pass_timing_lock);
+    SmallVector<std::pair<StringRef, uint64_t>, 64> rows;
+    uint64_t total = 0;
+    for (const auto &entry : pass_timings) {
+        rows.push_back({entry.getKey(), entry.getValue()});
+        total += entry.getValue();
+    }
+    std::sort(rows.begin(), rows.end(),
+              [](const auto &a, const auto &b) { return a.second > b.second; });
+    errs() << "LLVM pass timings (wall time, inclusive of nested passes):\n";
+    for (const auto &row : rows) {
+        errs() << format("%10.3f ms  %5.1f%%  ", row.second / 1e6,
+                         total ? 100.0 * row.second / total : 0.0)
+               << row.first << "\n";
+    }
+}
+
 namespace {
     auto createPIC(StandardInstrumentations &SI) JL_NOTSAFEPOINT {
         auto PIC = std::make_unique<PassInstrumentationCallbacks>();
+        if (timePassesEnabled()) {
+            PIC->registerBeforeNonSkippedPassCallback(
+                [](StringRef, Any) { pass_timing_stack.push_back(jl_hrtime()); });
+            auto record = [](StringRef Name) {
+                uint64_t t = jl_hrtime() - pass_timing_stack.pop_back_val();
+                std::lock_guard<std::mutex> lock(pass_timing_lock);
+                pass_timings[Name] += t;
+            };
+            PIC->registerAfterPassCallback(
+                [record](StringRef Name, Any, const PreservedAnalyses &) { record(Name); });
+            PIC->registerAfterPassInvalidatedCallback(
+                [record](StringRef Name, const PreservedAnalyses &) { record(Name); });
+            static bool registered_atexit = false;
+            if (!registered_atexit) {
+                atexit(jl_print_pass_timings);
+                registered_atexit = true;
+            }
+        }
 //Borrowed from LLVM PassBuilder.cpp:386
 #define MODULE_PASS(NAME, CREATE_PASS)                                         \
 PIC->addClassToPassName(decltype(CREATE_PASS)::name(), NAME);
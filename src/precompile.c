@@ -21,6 +21,14 @@ JL_DLLEXPORT int jl_generating_output(void)
     return jl_options.outputo || jl_options.outputbc || jl_options.outputunoptbc || jl_options.outputji || jl_options.outputasm;
 }
 
+// One unique source-text blob already written to the cache file
+typedef struct {
+    uint64_t hash;    // memhash of the contents
+    int64_t offset;   // file offset of the blob's uint64 length field
+    size_t len;
+    char *buf;        // the contents, kept to rule out hash collisions
+} srctext_blob_t;
+
 void write_srctext(ios_t *f, jl_array_t *udeps, int64_t srctextpos) {
     // Write the source-text for the dependent files
     if (udeps) {
@@ -34,9 +42,14 @@ void write_srctext(ios_t *f, jl_array_t *udeps, int64_t srctextpos) {
         //   char*: abspath
         //   uint64: length of src text
         //   char*: src text
+        // Files whose contents are identical to an earlier entry are stored
+        // once: the length field is (uint64)-1 followed by a uint64 giving
+        // the file offset of the earlier entry's length field.
         // At the end we write int32(0) as a terminal sentinel.
+        arraylist_t blobs;
+        arraylist_new(&blobs, 0);
         size_t len = jl_array_len(udeps);
-        ios_t srctext;
+        ios_t srctext, srcbuf;
         for (size_t i = 0; i < len; i++) {
             jl_value_t *deptuple = jl_array_ptr_ref(udeps, i);
             jl_value_t *depmod = jl_fieldref(deptuple, 0);  // module
@@ -53,18 +66,48 @@ void write_srctext(ios_t *f, jl_array_t *udeps, int64_t srctextpos) {
                             jl_string_data(dep));
                     continue;
                 }
+                ios_mem(&srcbuf, 0);
+                uint64_t filelen = (uint64_t) ios_copyall(&srcbuf, &srctext);
+                ios_close(&srctext);
+                size_t bufsz;
+                char *fbuf = ios_take_buffer(&srcbuf, &bufsz);
+                uint64_t hash = memhash(fbuf, (size_t)filelen);
+                srctext_blob_t *prev = NULL;
+                for (size_t j = 0; j < blobs.len; j++) {
+                    srctext_blob_t *blob = (srctext_blob_t*)blobs.items[j];
+                    if (blob->hash == hash && blob->len == (size_t)filelen &&
+                            memcmp(blob->buf, fbuf, (size_t)filelen) == 0) {
+                        prev = blob;
+                        break;
+                    }
+                }
                 size_t slen = jl_string_len(dep);
                 write_int32(f, slen);
                 ios_write(f, depstr, slen);
-                posfile = ios_pos(f);
-                write_uint64(f, 0);   // placeholder for length of this file in bytes
-                uint64_t filelen = (uint64_t) ios_copyall(f, &srctext);
-                ios_close(&srctext);
-                ios_seek(f, posfile);
-                write_uint64(f, filelen);
-                ios_seek_end(f);
+                if (prev) {
+                    // identical contents already stored; emit a back-reference
+                    write_uint64(f, (uint64_t)-1);
+                    write_uint64(f, (uint64_t)prev->offset);
+                    free(fbuf);
+                }
+                else {
+                    srctext_blob_t *blob = (srctext_blob_t*)malloc_s(sizeof(srctext_blob_t));
+                    blob->hash = hash;
+                    blob->offset = ios_pos(f);
+                    blob->len = (size_t)filelen;
+                    blob->buf = fbuf;
+                    arraylist_push(&blobs, blob);
+                    write_uint64(f, filelen);
+                    ios_write(f, fbuf, (size_t)filelen);
+                }
             }
         }
+        for (size_t j = 0; j < blobs.len; j++) {
+            srctext_blob_t *blob = (srctext_blob_t*)blobs.items[j];
+            free(blob->buf);
+            free(blob);
+        }
+        arraylist_free(&blobs);
     }
     write_int32(f, 0); // mark the end of the source text
 }
@@ -15,6 +15,10 @@
 #include <map>
 #include <algorithm>
 
+#ifndef _OS_WINDOWS_
+#include <sys/mman.h>
+#endif
+
 #include "julia_assert.h"
 
 // CPU target string is a list of strings separated by `;` each string starts with a CPU
@@ -728,6 +732,28 @@ static inline jl_image_fptrs_t parse_sysimg(void *hdl, F &&callback)
         (void)found;
     }
 
+#if !defined(_OS_WINDOWS_)
+    // The text section is demand-paged from the mapped sysimage, but the
+    // kernel's default readahead faults in a sizable neighborhood around
+    // every first call, so a process that executes a small fraction of the
+    // sysimage still ends up with much of its code resident. With
+    // JULIA_SYSIMG_LAZY_TEXT=1, turn readahead off for the function range so
+    // resident code pages track what is actually called, at the cost of more
+    // minor faults during warmup.
+    if (text_base) {
+        const char *lazy = getenv("JULIA_SYSIMG_LAZY_TEXT");
+        if (lazy && strcmp(lazy, "0") != 0) {
+            int32_t max_off = 0;
+            for (uint32_t i = 0; i < nfunc; i++)
+                if (res.offsets[i] > max_off)
+                    max_off = res.offsets[i];
+            uintptr_t start = (uintptr_t)text_base & ~(uintptr_t)(jl_page_size - 1);
+            uintptr_t end = LLT_ALIGN((uintptr_t)text_base + (size_t)max_off + jl_page_size, jl_page_size);
+            posix_madvise((void*)start, end - start, POSIX_MADV_RANDOM);
+        }
+    }
+#endif
+
     return res;
 }
 
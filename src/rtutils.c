@@ -222,6 +222,58 @@ JL_DLLEXPORT void __stack_chk_fail(void)
 
 // exceptions -----------------------------------------------------------------
 
+#if (defined(_OS_LINUX_) || defined(_OS_FREEBSD_)) && defined(_CPU_X86_64_) && \
+    !defined(_COMPILER_ASAN_ENABLED_) && !defined(_COMPILER_TSAN_ENABLED_) && \
+    !defined(_COMPILER_MSAN_ENABLED_)
+// Minimal setjmp/longjmp pair for exception handler registration; see the
+// declarations and rationale in julia.h. Saves the SysV callee-saved
+// register file (rbx, rbp, r12-r15), the post-return stack pointer and the
+// return address -- nothing else: no signal mask, no pointer mangling, no
+// unwind checks. The longjmp works across stacks, as siglongjmp does for
+// the copy-stack task switch. The savemask argument (rsi/esi) is accepted
+// for signature compatibility with sigsetjmp and ignored.
+__asm__(
+    ".text\n"
+    ".p2align 4\n"
+    ".globl jl_fast_setjmp\n"
+    ".type jl_fast_setjmp, @function\n"
+    "jl_fast_setjmp:\n"
+    ".cfi_startproc\n"
+    "\tmovq %rbx, (%rdi)\n"
+    "\tmovq %rbp, 8(%rdi)\n"
+    "\tmovq %r12, 16(%rdi)\n"
+    "\tmovq %r13, 24(%rdi)\n"
+    "\tmovq %r14, 32(%rdi)\n"
+    "\tmovq %r15, 40(%rdi)\n"
+    "\tleaq 8(%rsp), %rax\n"
+    "\tmovq %rax, 48(%rdi)\n"
+    "\tmovq (%rsp), %rax\n"
+    "\tmovq %rax, 56(%rdi)\n"
+    "\txorl %eax, %eax\n"
+    "\tret\n"
+    ".cfi_endproc\n"
+    ".size jl_fast_setjmp, .-jl_fast_setjmp\n"
+    ".p2align 4\n"
+    ".globl jl_fast_longjmp\n"
+    ".type jl_fast_longjmp, @function\n"
+    "jl_fast_longjmp:\n"
+    ".cfi_startproc\n"
+    "\tmovq (%rdi), %rbx\n"
+    "\tmovq 8(%rdi), %rbp\n"
+    "\tmovq 16(%rdi), %r12\n"
+    "\tmovq 24(%rdi), %r13\n"
+    "\tmovq 32(%rdi), %r14\n"
+    "\tmovq 40(%rdi), %r15\n"
+    "\tmovq 48(%rdi), %rsp\n"
+    "\tmovl %esi, %eax\n"
+    "\ttestl %eax, %eax\n"
+    "\tjnz 1f\n"
+    "\tincl %eax\n"
+    "1:\tjmpq *56(%rdi)\n"
+    ".cfi_endproc\n"
+    ".size jl_fast_longjmp, .-jl_fast_longjmp\n");
+#endif
+
 JL_DLLEXPORT void jl_enter_handler(jl_handler_t *eh)
 {
     jl_task_t *ct = jl_current_task;
@@ -301,6 +353,18 @@ JL_DLLEXPORT size_t jl_excstack_state(void) JL_NOTSAFEPOINT
     return s ? s->top : 0;
 }
 
+// Hand back an emergency arena acquired in jl_push_excstack: a thread's
+// pre-committed arena is marked free for the next holder, a single-use
+// malloc'd overflow arena is released outright.
+static void jl_release_excstack_arena(jl_excstack_t *s) JL_NOTSAFEPOINT
+{
+    assert(s->preallocated);
+    if (s->preallocated == 1)
+        free(s);
+    else
+        jl_atomic_store_release(&((jl_ptls_t)s->preallocated)->emergency_excstack_inuse, 0);
+}
+
 JL_DLLEXPORT void jl_restore_excstack(size_t state) JL_NOTSAFEPOINT
 {
     jl_task_t *ct = jl_current_task;
@@ -308,6 +372,12 @@ JL_DLLEXPORT void jl_restore_excstack(size_t state) JL_NOTSAFEPOINT
     if (s) {
         assert(s->top >= state);
         s->top = state;
+        if (state == 0 && s->preallocated) {
+            // the catch that borrowed an emergency arena has fully unwound;
+            // hand it back rather than keeping it pinned across later yields
+            ct->excstack = NULL;
+            jl_release_excstack_arena(s);
+        }
     }
 }
 
@@ -322,15 +392,32 @@ static void jl_reserve_excstack(jl_excstack_t **stack JL_REQUIRE_ROOTED_SLOT,
                                 size_t reserved_size)
 {
     jl_excstack_t *s = *stack;
-    if (s && s->reserved_size >= reserved_size)
+    if (s && s->preallocated) {
+        // migrate off the thread's emergency arena on the first regular
+        // push, even if it still has room: the arena must stay available
+        // for the next out-of-memory throw, and it is shared by all tasks
+        // that run on the thread
+        if (reserved_size < s->top)
+            reserved_size = s->top;
+    }
+    else if (s && s->reserved_size >= reserved_size)
         return;
+    // grow geometrically: with exact-sized buffers every push that outgrows
+    // the stack copies all of it, which shows up in workloads that unwind
+    // and rethrow deeply nested exceptions
+    if (s && !s->preallocated && 2*s->reserved_size > reserved_size)
+        reserved_size = 2*s->reserved_size;
     size_t bufsz = sizeof(jl_excstack_t) + sizeof(uintptr_t)*reserved_size;
     jl_task_t *ct = jl_current_task;
     jl_excstack_t *new_s = (jl_excstack_t*)jl_gc_alloc_buf(ct->ptls, bufsz);
     new_s->top = 0;
     new_s->reserved_size = reserved_size;
-    if (s)
+    new_s->preallocated = 0;
+    if (s) {
         jl_copy_excstack(new_s, s);
+        if (s->preallocated)
+            jl_release_excstack_arena(s);
+    }
     *stack = new_s;
 }
 
@@ -338,7 +425,56 @@ void jl_push_excstack(jl_excstack_t **stack JL_REQUIRE_ROOTED_SLOT JL_ROOTING_AR
                       jl_value_t *exception JL_ROOTED_ARGUMENT,
                       jl_bt_element_t *bt_data, size_t bt_size)
 {
-    jl_reserve_excstack(stack, (*stack ? (*stack)->top : 0) + bt_size + 2);
+    size_t needed = (*stack ? (*stack)->top : 0) + bt_size + 2;
+    if (__unlikely(exception == jl_memory_exception ||
+                   exception == jl_stackovf_exception) &&
+        (!*stack || (*stack)->reserved_size < needed)) {
+        // Growing the stack allocates from the GC, which must not happen
+        // while throwing the preallocated out-of-memory or stack-overflow
+        // exceptions: the allocation could itself fail (or hit the guard
+        // page again). Use a pre-committed arena instead, truncating the
+        // backtrace if it does not fit.
+        jl_excstack_t *es = *stack;
+        if (!es || !es->preallocated) {
+            // Acquire an arena. Another task on this thread can hold the
+            // pre-committed one across a catch block (and a yield inside
+            // it), so claim it first; when it is taken, commit a fresh
+            // single-use arena with plain malloc, which does not touch the
+            // GC heap whose exhaustion got us here.
+            jl_ptls_t ptls = jl_current_task->ptls;
+            if (jl_atomic_exchange(&ptls->emergency_excstack_inuse, 1) == 0) {
+                es = ptls->emergency_excstack;
+            }
+            else {
+                es = (jl_excstack_t*)malloc_s(sizeof(jl_excstack_t) +
+                        sizeof(jl_bt_element_t) * JL_EMERGENCY_EXCSTACK_SIZE);
+                es->reserved_size = JL_EMERGENCY_EXCSTACK_SIZE;
+                es->preallocated = 1; // freed when released
+            }
+            if (*stack && (*stack)->top <= es->reserved_size)
+                jl_copy_excstack(es, *stack);
+            else
+                es->top = 0; // enclosing exceptions do not fit; drop them
+            *stack = es;
+        }
+        if (es->reserved_size - es->top < 2)
+            es->top = 0; // arena exhausted by nested throws; keep the newest
+        if (es->reserved_size - es->top < bt_size + 2) {
+            // truncate on a frame boundary (entries have variable size)
+            size_t budget = es->reserved_size - es->top - 2;
+            size_t fit = 0;
+            while (fit < bt_size) {
+                size_t entsz = jl_bt_entry_size(bt_data + fit);
+                if (fit + entsz > budget)
+                    break;
+                fit += entsz;
+            }
+            bt_size = fit;
+        }
+    }
+    else {
+        jl_reserve_excstack(stack, needed);
+    }
     jl_excstack_t *s = *stack;
     jl_bt_element_t *rawstack = jl_excstack_raw(s);
     memcpy(rawstack + s->top, bt_data, sizeof(jl_bt_element_t)*bt_size);
@@ -1156,15 +1292,17 @@ static size_t jl_static_show_x_(JL_STREAM *out, jl_value_t *v, jl_datatype_t *vt
                     jl_value_t *fname = isnamedtuple ? jl_fieldref_noalloc(names, i) : jl_svecref(names, i);
                     n += jl_printf(out, "%s=", jl_symbol_name((jl_sym_t*)fname));
                 }
-                size_t offs = jl_field_offset(vt, i);
+                uint32_t offs, fldsz;
+                int isptr;
+                jl_field_getdesc(vt, i, &offs, &fldsz, &isptr);
                 char *fld_ptr = (char*)v + offs;
-                if (jl_field_isptr(vt, i)) {
+                if (isptr) {
                     n += jl_static_show_x(out, *(jl_value_t**)fld_ptr, depth);
                 }
                 else {
                     jl_datatype_t *ft = (jl_datatype_t*)jl_field_type_concrete(vt, i);
                     if (jl_is_uniontype(ft)) {
-                        uint8_t sel = ((uint8_t*)fld_ptr)[jl_field_size(vt, i) - 1];
+                        uint8_t sel = ((uint8_t*)fld_ptr)[fldsz - 1];
                         ft = (jl_datatype_t*)jl_nth_union_component((jl_value_t*)ft, sel);
                     }
                     n += jl_static_show_x_(out, (jl_value_t*)fld_ptr, ft, depth);
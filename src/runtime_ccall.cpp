@@ -53,15 +53,95 @@ void *jl_get_library_(const char *f_lib, int throw_err)
     return hnd;
 }
 
+// Called once on the main thread after the startup preload workers
+// (dlload.c) join, to publish the handles they opened into the library map
+// so the first ccall into each library skips its dlopen.
+extern "C" void jl_preload_register_library(const char *name, void *hnd)
+{
+    JL_LOCK(&libmap_lock);
+    void **map_slot = &libMap[name];
+    if (*map_slot == NULL)
+        *map_slot = hnd;
+    JL_UNLOCK(&libmap_lock);
+}
+
+// Cross-call-site cache of resolved (library handle, symbol name) pairs.
+// Codegen gives every ccall site its own lazily-initialized pointer slot, so
+// each site pays one cold lookup here; with thousands of sites resolving the
+// same few hundred symbols at worker startup that turned into a storm of
+// dlsym calls. This is a fixed-size seqlock table in the style of the subtype
+// memo cache (subtype.c): lock-free reads, best-effort writes, collisions
+// simply overwrite. Names are interned as jl_sym_t so entries key on pointer
+// identity. Resolved addresses are process-local and never serialized; call
+// sites restored from a package image re-resolve through this cache on first
+// use, which is exactly the cheap path it provides.
+#define N_DLSYM_CACHE 1024
+typedef struct {
+    _Atomic(uint32_t) ver;
+    _Atomic(void*) handle;
+    _Atomic(jl_sym_t*) name;
+    _Atomic(void*) ptr;
+} jl_dlsym_cache_entry_t;
+static jl_dlsym_cache_entry_t jl_dlsym_cache[N_DLSYM_CACHE];
+
+static unsigned dlsym_cache_idx(void *handle, jl_sym_t *name) JL_NOTSAFEPOINT
+{
+    uintptr_t h = inthash((uintptr_t)handle ^ ((uintptr_t)name >> 3));
+    return (unsigned)(h & (N_DLSYM_CACHE - 1));
+}
+
+static void *dlsym_cache_lookup(void *handle, jl_sym_t *name) JL_NOTSAFEPOINT
+{
+    jl_dlsym_cache_entry_t *entry = &jl_dlsym_cache[dlsym_cache_idx(handle, name)];
+    uint32_t ver = jl_atomic_load_acquire(&entry->ver);
+    if (ver & 1)
+        return NULL; // a writer owns the slot
+    void *h = jl_atomic_load_relaxed(&entry->handle);
+    jl_sym_t *n = jl_atomic_load_relaxed(&entry->name);
+    void *ptr = jl_atomic_load_relaxed(&entry->ptr);
+    jl_fence(); // order the field reads before the recheck
+    if (jl_atomic_load_relaxed(&entry->ver) != ver)
+        return NULL; // raced with a writer
+    if (h != handle || n != name)
+        return NULL;
+    return ptr;
+}
+
+static void dlsym_cache_insert(void *handle, jl_sym_t *name, void *ptr) JL_NOTSAFEPOINT
+{
+    jl_dlsym_cache_entry_t *entry = &jl_dlsym_cache[dlsym_cache_idx(handle, name)];
+    uint32_t ver = jl_atomic_load_relaxed(&entry->ver);
+    // claim the slot; insertion is best-effort, so losing the race just
+    // drops this result. The cmpswap must acquire so that the field stores
+    // below cannot be reordered before the claim becomes visible (a reader
+    // could otherwise pair a fresh key with a stale ptr under an even `ver`).
+    if ((ver & 1) || !jl_atomic_cmpswap(&entry->ver, &ver, ver + 1))
+        return;
+    jl_atomic_store_relaxed(&entry->handle, handle);
+    jl_atomic_store_relaxed(&entry->name, name);
+    jl_atomic_store_relaxed(&entry->ptr, ptr);
+    jl_atomic_store_release(&entry->ver, ver + 2);
+}
+
+static void *jl_cached_dlsym(void *handle, const char *f_name)
+{
+    jl_sym_t *name = jl_symbol(f_name);
+    void *ptr = dlsym_cache_lookup(handle, name);
+    if (ptr != NULL)
+        return ptr;
+    // throws on failure, so failed lookups are never cached
+    jl_dlsym(handle, f_name, &ptr, 1);
+    dlsym_cache_insert(handle, name, ptr);
+    return ptr;
+}
+
 extern "C" JL_DLLEXPORT
 void *jl_load_and_lookup(const char *f_lib, const char *f_name, _Atomic(void*) *hnd)
 {
     void *handle = jl_atomic_load_acquire(hnd);
     if (!handle)
         jl_atomic_store_release(hnd, (handle = jl_get_library(f_lib)));
-    void * ptr;
-    jl_dlsym(handle, f_name, &ptr, 1);
-    return ptr;
+    return jl_cached_dlsym(handle, f_name);
 }
 
 // jl_load_and_lookup, but with library computed at run time on first call
@@ -76,9 +156,7 @@ void *jl_lazy_load_and_lookup(jl_value_t *lib_val, const char *f_name)
         f_lib = jl_string_data(lib_val);
     else
         jl_type_error("ccall", (jl_value_t*)jl_symbol_type, lib_val);
-    void *ptr;
-    jl_dlsym(jl_get_library(f_lib), f_name, &ptr, 1);
-    return ptr;
+    return jl_cached_dlsym(jl_get_library(f_lib), f_name);
 }
 
 // miscellany
@@ -273,6 +351,32 @@ static void trampoline_deleter(void **f) JL_NOTSAFEPOINT
 
 typedef void *(*init_trampoline_t)(void *tramp, void **nval) JL_NOTSAFEPOINT;
 
+static int cfunc_result_permanent(jl_value_t *fobj, jl_datatype_t *result_type)
+{
+    if (result_type == jl_voidpointer_type ||
+        jl_is_concrete_type(fobj) ||
+        ((jl_datatype_t*)jl_typeof(fobj))->instance == fobj)
+        return 1;
+    if (jl_is_unionall(fobj)) {
+        jl_value_t *uw = jl_unwrap_unionall(fobj);
+        if (jl_is_datatype(uw) && ((jl_datatype_t*)uw)->name->wrapper == fobj)
+            return 1;
+    }
+    return 0;
+}
+
+// Publish a permanent result into the call site's inline cache. Must be
+// called with the trampoline lock held; the slot is write-once so that
+// unlocked readers can never observe a torn (fobj, result) pair, and only
+// immortal results are stored since the slot is not scanned by the GC.
+static void cfunc_callsite_cache_set(jl_cfunc_cache_t *callsite, jl_value_t *fobj, jl_value_t *result) JL_NOTSAFEPOINT
+{
+    if (jl_atomic_load_relaxed(&callsite->ic_fobj) != NULL)
+        return;
+    jl_atomic_store_relaxed(&callsite->ic_result, result);
+    jl_atomic_store_release(&callsite->ic_fobj, fobj);
+}
+
 // Use of `cache` is not clobbered in JL_TRY
 JL_GCC_IGNORE_START("-Wclobbered")
 extern "C" JL_DLLEXPORT
@@ -281,12 +385,19 @@ jl_value_t *jl_get_cfunction_trampoline(
     jl_value_t *fobj,
     jl_datatype_t *result_type,
     // call-site constants:
-    htable_t *cache, // weakref htable indexed by (fobj, vals)
+    jl_cfunc_cache_t *callsite, // inline cache + weakref htable indexed by (fobj, vals)
     jl_svec_t *fill,
     init_trampoline_t init_trampoline,
     jl_unionall_t *env,
     jl_value_t **vals)
 {
+    // lock-free fast path: repeated registration of the same (singleton)
+    // callback at a call site hits the inline cache without contending on
+    // the trampoline lock
+    if (fill == jl_emptysvec &&
+        jl_atomic_load_acquire(&callsite->ic_fobj) == fobj)
+        return jl_atomic_load_relaxed(&callsite->ic_result);
+    htable_t *cache = &callsite->tab;
     // lookup (fobj, vals) in cache
     uv_mutex_lock(&trampoline_lock);
     if (!cache->table)
@@ -300,6 +411,9 @@ jl_value_t *jl_get_cfunction_trampoline(
         }
     }
     void *tramp = ptrhash_get(cache, (void*)fobj);
+    if (tramp != HT_NOTFOUND && fill == jl_emptysvec &&
+        cfunc_result_permanent(fobj, result_type))
+        cfunc_callsite_cache_set(callsite, fobj, (jl_value_t*)tramp);
     uv_mutex_unlock(&trampoline_lock);
     if (tramp != HT_NOTFOUND) {
         assert((jl_datatype_t*)jl_typeof(tramp) == result_type);
@@ -311,6 +425,7 @@ jl_value_t *jl_get_cfunction_trampoline(
     void **nval = (void**)malloc_s(sizeof(void*) * (n + 1));
     nval[0] = (void*)fobj;
     jl_value_t *result;
+    int permanent = 0;
     JL_TRY {
         for (size_t i = 0; i < n; i++) {
             jl_value_t *sparam_val = jl_instantiate_type_in_env(jl_svecref(fill, i), env, vals);
@@ -319,15 +434,7 @@ jl_value_t *jl_get_cfunction_trampoline(
                     sparam_val = NULL;
             nval[i + 1] = (void*)sparam_val;
         }
-        int permanent =
-            (result_type == jl_voidpointer_type) ||
-            jl_is_concrete_type(fobj) ||
-            (((jl_datatype_t*)jl_typeof(fobj))->instance == fobj);
-        if (jl_is_unionall(fobj)) {
-            jl_value_t *uw = jl_unwrap_unionall(fobj);
-            if (jl_is_datatype(uw) && ((jl_datatype_t*)uw)->name->wrapper == fobj)
-                permanent = true;
-        }
+        permanent = cfunc_result_permanent(fobj, result_type);
         if (permanent) {
             result = jl_gc_permobj(sizeof(jl_taggedvalue_t) + jl_datatype_size(result_type), result_type);
             memset(result, 0, jl_datatype_size(result_type));
@@ -355,6 +462,8 @@ jl_value_t *jl_get_cfunction_trampoline(
     ((void**)result)[0] = tramp;
     tramp = init_trampoline(tramp, nval);
     ptrhash_put(cache, (void*)fobj, result);
+    if (permanent && fill == jl_emptysvec)
+        cfunc_callsite_cache_set(callsite, fobj, result);
     uv_mutex_unlock(&trampoline_lock);
     return result;
 }
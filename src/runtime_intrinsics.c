@@ -642,6 +642,35 @@ static void jl_##name##16(unsigned runtime_nbits, void *pa, void *pb, void *pr)
     *(uint16_t*)pr = julia__gnu_f2h_ieee(R); \
 }
 
+// float or integer inputs, contiguous buffers of n operands
+// OP::Function macro(inputa, inputb)
+// name::unique string
+// nbits::number of bits
+// c_type::c_type corresponding to nbits
+#define bi_intrinsic_batch_ctype(OP, name, nbits, c_type) \
+static void jl_##name##nbits##_batch(unsigned runtime_nbits, void *pa, void *pb, void *pr, size_t n) JL_NOTSAFEPOINT \
+{ \
+    c_type *a = (c_type*)pa; \
+    c_type *b = (c_type*)pb; \
+    c_type *r = (c_type*)pr; \
+    for (size_t i = 0; i < n; i++) \
+        r[i] = (c_type)OP(a[i], b[i]); \
+}
+
+#define bi_intrinsic_batch_half(OP, name) \
+static void jl_##name##16_batch(unsigned runtime_nbits, void *pa, void *pb, void *pr, size_t n) JL_NOTSAFEPOINT \
+{ \
+    uint16_t *a = (uint16_t*)pa; \
+    uint16_t *b = (uint16_t*)pb; \
+    uint16_t *r = (uint16_t*)pr; \
+    for (size_t i = 0; i < n; i++) { \
+        float A = julia__gnu_h2f_ieee(a[i]); \
+        float B = julia__gnu_h2f_ieee(b[i]); \
+        float R = OP(A, B); \
+        r[i] = julia__gnu_f2h_ieee(R); \
+    } \
+}
+
 // float or integer inputs, bool output
 // OP::Function macro(inputa, inputb)
 // name::unique string
@@ -829,6 +858,10 @@ typedef unsigned (*intrinsic_cvt_check_t)(unsigned, unsigned, void*);
 JL_DLLEXPORT jl_value_t *jl_##name(jl_value_t *ty, jl_value_t *a) \
 { \
     return jl_intrinsic_cvt(ty, a, #name, LLVMOP); \
+} \
+JL_DLLEXPORT jl_value_t *jl_##name##_batch(jl_value_t *ty, jl_value_t *a) \
+{ \
+    return jl_intrinsic_cvt_batch(ty, a, #name "_batch", LLVMOP); \
 }
 
 static inline jl_value_t *jl_intrinsic_cvt(jl_value_t *ty, jl_value_t *a, const char *name, intrinsic_cvt_t op)
@@ -848,6 +881,65 @@ static inline jl_value_t *jl_intrinsic_cvt(jl_value_t *ty, jl_value_t *a, const
     return jl_new_bits(ty, pr);
 }
 
+// batch variant: convert a whole `Vector{Any}` of boxed values of one
+// primitive type, unboxing into a contiguous scratch buffer up front so the
+// conversions run back to back instead of interleaved with type checks
+static jl_value_t *jl_intrinsic_cvt_batch(jl_value_t *ty, jl_value_t *a, const char *name, intrinsic_cvt_t op)
+{
+    if (!jl_is_array(a) || !((jl_array_t*)a)->flags.ptrarray)
+        jl_errorf("%s: expected an array of boxed values", name);
+    if (!jl_is_primitivetype(ty))
+        jl_errorf("%s: type is not a primitive type", name);
+    jl_array_t *aa = (jl_array_t*)a;
+    size_t n = jl_array_len(aa);
+    jl_array_t *r = jl_alloc_vec_any(n);
+    if (n == 0)
+        return (jl_value_t*)r;
+    JL_GC_PUSH1(&r);
+    jl_value_t *elt0 = jl_array_ptr_ref(aa, 0);
+    if (elt0 == NULL)
+        jl_throw(jl_undefref_exception);
+    jl_value_t *aty = jl_typeof(elt0);
+    if (!jl_is_primitivetype(aty))
+        jl_errorf("%s: value is not a primitive type", name);
+    unsigned isize = jl_datatype_size(aty);
+    unsigned osize = jl_datatype_size(ty);
+    char *buf = (char*)malloc_s(n * ((size_t)isize + osize));
+    char *pa = buf, *pr = buf + n * isize;
+    size_t i;
+    for (i = 0; i < n; i++) {
+        jl_value_t *ai = jl_array_ptr_ref(aa, i);
+        if (ai == NULL) {
+            free(buf);
+            jl_throw(jl_undefref_exception);
+        }
+        if (jl_typeof(ai) != aty)
+            break;
+        memcpy(pa + i * isize, jl_data_ptr(ai), isize);
+    }
+    if (i != n) {
+        // mixed element types: take the scalar path one element at a time
+        free(buf);
+        for (i = 0; i < n; i++) {
+            jl_value_t *ai = jl_array_ptr_ref(aa, i);
+            if (ai == NULL)
+                jl_throw(jl_undefref_exception);
+            jl_array_ptr_set(r, i, jl_intrinsic_cvt(ty, ai, name, op));
+        }
+        JL_GC_POP();
+        return (jl_value_t*)r;
+    }
+    unsigned isize_bits = isize * host_char_bit;
+    unsigned osize_bits = osize * host_char_bit;
+    for (i = 0; i < n; i++)
+        op(isize_bits, pa + i * isize, osize_bits, pr + i * osize);
+    for (i = 0; i < n; i++)
+        jl_array_ptr_set(r, i, jl_new_bits(ty, pr + i * osize));
+    free(buf);
+    JL_GC_POP();
+    return (jl_value_t*)r;
+}
+
 // floating point
 
 #define un_fintrinsic_withtype(OP, name) \
@@ -912,6 +1004,10 @@ bi_intrinsic_ctype(OP, name, 8, u##int##8_t) \
 bi_intrinsic_ctype(OP, name, 16, u##int##16_t) \
 bi_intrinsic_ctype(OP, name, 32, u##int##32_t) \
 bi_intrinsic_ctype(OP, name, 64, u##int##64_t) \
+bi_intrinsic_batch_ctype(OP, name, 8, u##int##8_t) \
+bi_intrinsic_batch_ctype(OP, name, 16, u##int##16_t) \
+bi_intrinsic_batch_ctype(OP, name, 32, u##int##32_t) \
+bi_intrinsic_batch_ctype(OP, name, 64, u##int##64_t) \
 static const select_intrinsic_2_t name##_list = { \
     LLVMOP, \
     jl_##name##8, \
@@ -919,7 +1015,18 @@ static const select_intrinsic_2_t name##_list = { \
     jl_##name##32, \
     jl_##name##64, \
 }; \
-bi_iintrinsic(name, u, cvtb)
+static const select_intrinsic_2_batch_t name##_batch_list = { \
+    NULL, \
+    jl_##name##8_batch, \
+    jl_##name##16_batch, \
+    jl_##name##32_batch, \
+    jl_##name##64_batch, \
+}; \
+bi_iintrinsic(name, u, cvtb) \
+JL_DLLEXPORT jl_value_t *jl_##name##_batch(jl_value_t *a, jl_value_t *b) \
+{ \
+    return jl_intrinsic_2_batch(a, b, #name "_batch", jl_##name, name##_batch_list); \
+}
 #define bi_iintrinsic_fast(LLVMOP, OP, name, u) \
     bi_iintrinsic_cnvtb_fast(LLVMOP, OP, name, u, 0)
 
@@ -1057,12 +1164,96 @@ static inline jl_value_t *jl_intrinsiclambda_checkeddiv(jl_value_t *ty, void *pa
     return jl_new_bits(ty, pr);
 }
 
+// batch binary operators //
+
+typedef void (*intrinsic_2_batch_t)(unsigned, void*, void*, void*, size_t);
+SELECTOR_FUNC(intrinsic_2_batch)
+
+// Type-unstable code pays one full unbox/rebox round trip per element when it
+// reaches the scalar fallbacks above. The batch entries take `Vector{Any}`s
+// of operands of one uniform primitive type, unbox everything into contiguous
+// scratch buffers once, run the scalar kernel over the buffers (a loop the C
+// compiler can vectorize), and rebox the results in a final pass.
+static jl_value_t *jl_intrinsic_2_batch(jl_value_t *a, jl_value_t *b, const char *name,
+                                        jl_value_t *(*scalar2)(jl_value_t*, jl_value_t*),
+                                        const select_intrinsic_2_batch_t list)
+{
+    if (!jl_is_array(a) || !jl_is_array(b) ||
+        !((jl_array_t*)a)->flags.ptrarray || !((jl_array_t*)b)->flags.ptrarray)
+        jl_errorf("%s: expected arrays of boxed values", name);
+    jl_array_t *aa = (jl_array_t*)a;
+    jl_array_t *ab = (jl_array_t*)b;
+    size_t n = jl_array_len(aa);
+    if (jl_array_len(ab) != n)
+        jl_errorf("%s: operand arrays must have matching lengths", name);
+    jl_array_t *r = jl_alloc_vec_any(n);
+    if (n == 0)
+        return (jl_value_t*)r;
+    JL_GC_PUSH1(&r);
+    jl_value_t *elt0 = jl_array_ptr_ref(aa, 0);
+    if (elt0 == NULL)
+        jl_throw(jl_undefref_exception);
+    jl_value_t *ty = jl_typeof(elt0);
+    unsigned sz = jl_is_primitivetype(ty) ? jl_datatype_size(ty) : 0;
+    // the contiguous kernels only handle c-sized operands; everything else
+    // (including non-uniform element types, handled below) falls back to the
+    // scalar entry one element at a time
+    intrinsic_2_batch_t op = sz && next_power_of_two(sz) == sz ?
+        select_intrinsic_2_batch(sz, list) : NULL;
+    size_t i = 0;
+    char *buf = NULL;
+    if (op) {
+        buf = (char*)malloc_s(3 * n * (size_t)sz);
+        char *pa = buf, *pb = buf + n * sz, *pr = buf + 2 * n * sz;
+        for (i = 0; i < n; i++) {
+            jl_value_t *ai = jl_array_ptr_ref(aa, i);
+            jl_value_t *bi = jl_array_ptr_ref(ab, i);
+            if (ai == NULL || bi == NULL) {
+                free(buf);
+                jl_throw(jl_undefref_exception);
+            }
+            if (jl_typeof(ai) != ty || jl_typeof(bi) != ty)
+                break;
+            memcpy(pa + i * sz, jl_data_ptr(ai), sz);
+            memcpy(pb + i * sz, jl_data_ptr(bi), sz);
+        }
+        if (i == n) {
+            op(sz * host_char_bit, pa, pb, pr, n);
+            for (i = 0; i < n; i++)
+                jl_array_ptr_set(r, i, jl_new_bits(ty, pr + i * sz));
+            free(buf);
+            JL_GC_POP();
+            return (jl_value_t*)r;
+        }
+        free(buf);
+    }
+    for (i = 0; i < n; i++) {
+        jl_value_t *ai = jl_array_ptr_ref(aa, i);
+        jl_value_t *bi = jl_array_ptr_ref(ab, i);
+        if (ai == NULL || bi == NULL)
+            jl_throw(jl_undefref_exception);
+        jl_array_ptr_set(r, i, scalar2(ai, bi));
+    }
+    JL_GC_POP();
+    return (jl_value_t*)r;
+}
+
 // floating point
 
 #define bi_fintrinsic(OP, name) \
     bi_intrinsic_half(OP, name) \
     bi_intrinsic_ctype(OP, name, 32, float) \
     bi_intrinsic_ctype(OP, name, 64, double) \
+    bi_intrinsic_batch_half(OP, name) \
+    bi_intrinsic_batch_ctype(OP, name, 32, float) \
+    bi_intrinsic_batch_ctype(OP, name, 64, double) \
+    static const select_intrinsic_2_batch_t name##_batch_list = { \
+        NULL, \
+        NULL, \
+        jl_##name##16_batch, \
+        jl_##name##32_batch, \
+        jl_##name##64_batch, \
+    }; \
 JL_DLLEXPORT jl_value_t *jl_##name(jl_value_t *a, jl_value_t *b) \
 { \
     jl_task_t *ct = jl_current_task; \
@@ -1089,6 +1280,10 @@ JL_DLLEXPORT jl_value_t *jl_##name(jl_value_t *a, jl_value_t *b) \
         jl_error(#name ": runtime floating point intrinsics are not implemented for bit sizes other than 16, 32 and 64"); \
     } \
     return newv; \
+} \
+JL_DLLEXPORT jl_value_t *jl_##name##_batch(jl_value_t *a, jl_value_t *b) \
+{ \
+    return jl_intrinsic_2_batch(a, b, #name "_batch", jl_##name, name##_batch_list); \
 }
 
 #define bool_fintrinsic(OP, name) \
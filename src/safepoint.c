@@ -9,12 +9,61 @@
 #define MAP_ANONYMOUS MAP_ANON
 #endif
 #endif
+#if defined(_OS_LINUX_)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 #include "julia_assert.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// With JULIA_SAFEPOINT_MEMBARRIER=1 (Linux only), stop-the-world stores a
+// nonzero flag into the safepoint poll words and pairs it with a
+// membarrier() rendezvous instead of protecting the pages; the poll's
+// otherwise never-taken slow-path branch (see julia_threads.h) then calls
+// jl_safepoint_hit, avoiding signal delivery entirely.
+JL_DLLEXPORT int jl_safepoint_membarrier_enabled = 0;
+
+#if defined(_OS_LINUX_) && defined(__NR_membarrier)
+#ifndef MEMBARRIER_CMD_PRIVATE_EXPEDITED
+#define MEMBARRIER_CMD_PRIVATE_EXPEDITED (1 << 3)
+#define MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED (1 << 4)
+#endif
+#define JL_HAVE_MEMBARRIER
+#endif
+
+static void jl_safepoint_membarrier_sync(void) JL_NOTSAFEPOINT
+{
+#ifdef JL_HAVE_MEMBARRIER
+    if (jl_safepoint_membarrier_enabled)
+        // execute a full barrier on every running thread: the asymmetric
+        // counterpart of the poll's compiler-only fences, replacing the
+        // TLB shootdown the mprotect path pays for the same guarantee
+        syscall(__NR_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0);
+#endif
+}
+
+// store `v` to the words the safepoint loads actually read (see the page
+// layout comment below): the master thread's sigint load reads the last
+// word of page 0 and its gc load the first word of page 1; the other
+// threads' sigint and gc loads read the first two words of page 2
+static void jl_safepoint_set_poll_words(int idx, size_t v) JL_NOTSAFEPOINT
+{
+    char *pageaddr = jl_safepoint_pages + jl_page_size * idx;
+    if (idx == 0) {
+        *(volatile size_t*)(pageaddr + jl_page_size - sizeof(size_t)) = v;
+    }
+    else if (idx == 1) {
+        *(volatile size_t*)pageaddr = v;
+    }
+    else {
+        *(volatile size_t*)pageaddr = v;
+        *(volatile size_t*)(pageaddr + sizeof(size_t)) = v;
+    }
+}
+
 // 0: no sigint is pending
 // 1: at least one sigint is pending, only the sigint page is enabled.
 // 2: at least one sigint is pending, both safepoint pages are enabled.
@@ -56,6 +105,10 @@ static void jl_safepoint_enable(int idx) JL_NOTSAFEPOINT
         assert(jl_safepoint_enable_cnt[idx] <= 2);
         return;
     }
+    if (jl_safepoint_membarrier_enabled) {
+        jl_safepoint_set_poll_words(idx, 1);
+        return;
+    }
     // Now that we are requested to mprotect the page and it wasn't already.
     char *pageaddr = jl_safepoint_pages + jl_page_size * idx;
 #ifdef _OS_WINDOWS_
@@ -74,6 +127,10 @@ static void jl_safepoint_disable(int idx) JL_NOTSAFEPOINT
         assert(jl_safepoint_enable_cnt[idx] > 0);
         return;
     }
+    if (jl_safepoint_membarrier_enabled) {
+        jl_safepoint_set_poll_words(idx, 0);
+        return;
+    }
     // Now that we are requested to un-mprotect the page and no one else
     // want it to be kept protected.
     char *pageaddr = jl_safepoint_pages + jl_page_size * idx;
@@ -85,6 +142,77 @@ static void jl_safepoint_disable(int idx) JL_NOTSAFEPOINT
 #endif
 }
 
+// Enable/disable both GC pages (the master thread's and the other threads')
+// in one protection change when possible. The pages are adjacent, so the
+// common transition -- neither page held by SIGINT -- needs only a single
+// mprotect call, halving the TLB-shootdown broadcasts paid on every
+// stop-the-world with many threads.
+static void jl_safepoint_enable_gc_pages(void) JL_NOTSAFEPOINT
+{
+    // safepoint_lock should be held
+    int prot1 = jl_safepoint_enable_cnt[1]++ == 0;
+    int prot2 = jl_safepoint_enable_cnt[2]++ == 0;
+    assert(jl_safepoint_enable_cnt[1] <= 2 && jl_safepoint_enable_cnt[2] <= 2);
+    if (jl_safepoint_membarrier_enabled) {
+        if (prot1)
+            jl_safepoint_set_poll_words(1, 1);
+        if (prot2)
+            jl_safepoint_set_poll_words(2, 1);
+        return;
+    }
+    if (prot1 && prot2) {
+        char *pageaddr = jl_safepoint_pages + jl_page_size;
+#ifdef _OS_WINDOWS_
+        DWORD old_prot;
+        VirtualProtect(pageaddr, 2 * jl_page_size, PAGE_NOACCESS, &old_prot);
+#else
+        mprotect(pageaddr, 2 * jl_page_size, PROT_NONE);
+#endif
+    }
+    else if (prot1 || prot2) {
+        char *pageaddr = jl_safepoint_pages + jl_page_size * (prot1 ? 1 : 2);
+#ifdef _OS_WINDOWS_
+        DWORD old_prot;
+        VirtualProtect(pageaddr, jl_page_size, PAGE_NOACCESS, &old_prot);
+#else
+        mprotect(pageaddr, jl_page_size, PROT_NONE);
+#endif
+    }
+}
+
+static void jl_safepoint_disable_gc_pages(void) JL_NOTSAFEPOINT
+{
+    // safepoint_lock should be held
+    int prot1 = --jl_safepoint_enable_cnt[1] == 0;
+    int prot2 = --jl_safepoint_enable_cnt[2] == 0;
+    assert(jl_safepoint_enable_cnt[1] <= 1 && jl_safepoint_enable_cnt[2] <= 1);
+    if (jl_safepoint_membarrier_enabled) {
+        if (prot1)
+            jl_safepoint_set_poll_words(1, 0);
+        if (prot2)
+            jl_safepoint_set_poll_words(2, 0);
+        return;
+    }
+    if (prot1 && prot2) {
+        char *pageaddr = jl_safepoint_pages + jl_page_size;
+#ifdef _OS_WINDOWS_
+        DWORD old_prot;
+        VirtualProtect(pageaddr, 2 * jl_page_size, PAGE_READONLY, &old_prot);
+#else
+        mprotect(pageaddr, 2 * jl_page_size, PROT_READ);
+#endif
+    }
+    else if (prot1 || prot2) {
+        char *pageaddr = jl_safepoint_pages + jl_page_size * (prot1 ? 1 : 2);
+#ifdef _OS_WINDOWS_
+        DWORD old_prot;
+        VirtualProtect(pageaddr, jl_page_size, PAGE_READONLY, &old_prot);
+#else
+        mprotect(pageaddr, jl_page_size, PROT_READ);
+#endif
+    }
+}
+
 void jl_safepoint_init(void)
 {
     uv_mutex_init(&safepoint_lock);
@@ -107,6 +235,16 @@ void jl_safepoint_init(void)
     // The signal page is for the gc safepoint.
     // The page before it is the sigint pending flag.
     jl_safepoint_pages = addr;
+#ifdef JL_HAVE_MEMBARRIER
+    const char *mb = getenv("JULIA_SAFEPOINT_MEMBARRIER");
+    if (mb && atoi(mb) != 0 &&
+        syscall(__NR_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0) == 0 &&
+        mprotect(addr, pgsz * 3, PROT_READ | PROT_WRITE) == 0) {
+        // the pages stay writable and the enable/disable paths toggle the
+        // poll words instead of the protection; polls never fault
+        jl_safepoint_membarrier_enabled = 1;
+    }
+#endif
 }
 
 int jl_safepoint_start_gc(void)
@@ -124,8 +262,8 @@ int jl_safepoint_start_gc(void)
         jl_safepoint_wait_gc();
         return 0;
     }
-    jl_safepoint_enable(1);
-    jl_safepoint_enable(2);
+    jl_safepoint_enable_gc_pages();
+    jl_safepoint_membarrier_sync();
     uv_mutex_unlock(&safepoint_lock);
     return 1;
 }
@@ -137,8 +275,7 @@ void jl_safepoint_end_gc(void)
     // Need to reset the page protection before resetting the flag since
     // the thread will trigger a segfault immediately after returning from
     // the signal handler.
-    jl_safepoint_disable(2);
-    jl_safepoint_disable(1);
+    jl_safepoint_disable_gc_pages();
     jl_atomic_store_release(&jl_gc_running, 0);
 #  ifdef __APPLE__
     // This wakes up other threads on mac.
@@ -183,6 +320,7 @@ void jl_safepoint_enable_sigint(void)
     case 2:
         jl_signal_pending = 2;
     }
+    jl_safepoint_membarrier_sync();
     uv_mutex_unlock(&safepoint_lock);
 }
 
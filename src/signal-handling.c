@@ -9,6 +9,7 @@
 #include <unistd.h>
 #ifndef _OS_WINDOWS_
 #include <sys/mman.h>
+#include <time.h>
 #endif
 
 #ifdef __cplusplus
@@ -32,6 +33,128 @@ JL_DLLEXPORT int jl_profile_start_timer(void);
 ///////////////////////
 // Utility functions //
 ///////////////////////
+
+#ifndef _OS_WINDOWS_
+// --- incremental profile aggregation (opt-in via JULIA_PROFILE_AGGREGATE) ---
+// Long profiling sessions exhaust the flat sample buffer: every sample is
+// stored as raw IPs and the run stops (or the memory is lost) once the
+// buffer fills. In aggregate mode a background thread drains the buffer,
+// whenever it passes half full, into a histogram of unique stacks keyed by
+// a content hash, so memory use is bounded by the number of distinct
+// stacks instead of the session length. The histogram is printed at
+// process exit (most frequent stacks first); since duplicates are
+// collapsed, each unique stack is symbolized only once.
+typedef struct _profile_agg_entry_t {
+    struct _profile_agg_entry_t *next; // chain of hash collisions
+    uint64_t hash;
+    uint64_t count;
+    size_t len; // elements, including the 4 trailing metadata words
+    jl_bt_element_t data[];
+} profile_agg_entry_t;
+
+static htable_t profile_agg_table; // hash -> profile_agg_entry_t chain
+static size_t profile_agg_nsamples = 0;
+static int profile_agg_started = 0;
+static uv_thread_t profile_agg_thread;
+
+// `sample` includes the metadata words but not the two 0 terminators
+static void profile_agg_add_sample(jl_bt_element_t *sample, size_t len) JL_NOTSAFEPOINT
+{
+    // canonicalize: zero the cycle-clock word so identical stacks collide
+    sample[len - 2].uintptr = 0;
+    uint64_t hash = memhash((char*)sample, len * sizeof(jl_bt_element_t));
+    void **slot = ptrhash_bp(&profile_agg_table, (void*)(uintptr_t)hash);
+    profile_agg_entry_t *head = *slot == HT_NOTFOUND ? NULL : (profile_agg_entry_t*)*slot;
+    for (profile_agg_entry_t *e = head; e != NULL; e = e->next) {
+        if (e->len == len && !memcmp(e->data, sample, len * sizeof(jl_bt_element_t))) {
+            e->count++;
+            profile_agg_nsamples++;
+            return;
+        }
+    }
+    profile_agg_entry_t *e = (profile_agg_entry_t*)malloc_s(
+            sizeof(profile_agg_entry_t) + len * sizeof(jl_bt_element_t));
+    e->next = head;
+    e->hash = hash;
+    e->count = 1;
+    e->len = len;
+    memcpy(e->data, sample, len * sizeof(jl_bt_element_t));
+    *slot = e;
+    profile_agg_nsamples++;
+}
+
+// caller must hold the profile lock so the signal listener cannot append
+static void profile_agg_drain(void) JL_NOTSAFEPOINT
+{
+    jl_bt_element_t *buf = (jl_bt_element_t*)bt_data_prof;
+    size_t i = 0, n = bt_size_cur;
+    while (i < n) {
+        size_t start = i;
+        // the metadata words are all nonzero and parse as plain frames
+        while (i < n && buf[i].uintptr != 0)
+            i += jl_bt_entry_size(buf + i);
+        if (i >= n || i - start < 4)
+            break; // drop a truncated trailing sample
+        profile_agg_add_sample(buf + start, i - start);
+        i += (i + 1 < n && buf[i + 1].uintptr == 0) ? 2 : 1;
+    }
+    bt_size_cur = 0;
+}
+
+static int profile_agg_entry_cmp(const void *a, const void *b) JL_NOTSAFEPOINT
+{
+    uint64_t ca = (*(profile_agg_entry_t**)a)->count;
+    uint64_t cb = (*(profile_agg_entry_t**)b)->count;
+    return ca < cb ? 1 : ca > cb ? -1 : 0;
+}
+
+JL_DLLEXPORT void jl_profile_print_aggregate(void)
+{
+    if (!profile_agg_started || profile_agg_nsamples == 0)
+        return;
+    arraylist_t entries;
+    arraylist_new(&entries, 0);
+    for (size_t i = 0; i < profile_agg_table.size; i += 2) {
+        if (profile_agg_table.table[i + 1] == HT_NOTFOUND)
+            continue;
+        profile_agg_entry_t *e = (profile_agg_entry_t*)profile_agg_table.table[i + 1];
+        for (; e != NULL; e = e->next)
+            arraylist_push(&entries, e);
+    }
+    qsort(entries.items, entries.len, sizeof(void*), profile_agg_entry_cmp);
+    size_t nshow = entries.len < 50 ? entries.len : 50;
+    jl_safe_printf("profile-aggregate: %zu samples in %zu unique stacks, showing top %zu\n",
+                   profile_agg_nsamples, entries.len, nshow);
+    for (size_t i = 0; i < nshow; i++) {
+        profile_agg_entry_t *e = (profile_agg_entry_t*)entries.items[i];
+        // metadata layout matches the signal listener: tid+1, task,
+        // cycle clock (zeroed here), sleep state + 1
+        uintptr_t tid = e->data[e->len - 4].uintptr - 1;
+        uintptr_t sleeping = e->data[e->len - 1].uintptr - 1;
+        jl_safe_printf("%10" PRIu64 " samples, thread %u%s:\n", e->count,
+                       (unsigned)tid, sleeping ? " (sleeping)" : "");
+        for (size_t j = 0; j < e->len - 4; j += jl_bt_entry_size(e->data + j))
+            jl_print_bt_entry_codeloc(e->data + j);
+    }
+    arraylist_free(&entries);
+}
+
+static void profile_agg_loop(void *arg)
+{
+    (void)arg;
+    while (1) {
+        struct timespec ts = {0, 100 * 1000 * 1000}; // 100ms
+        nanosleep(&ts, NULL);
+        if (!running)
+            continue;
+        jl_lock_profile();
+        if (bt_size_cur > bt_size_max / 2)
+            profile_agg_drain();
+        jl_unlock_profile();
+    }
+}
+#endif
+
 JL_DLLEXPORT int jl_profile_init(size_t maxsize, uint64_t delay_nsec)
 {
     bt_size_max = maxsize;
@@ -42,6 +165,17 @@ JL_DLLEXPORT int jl_profile_init(size_t maxsize, uint64_t delay_nsec)
     if (bt_data_prof == NULL && maxsize > 0)
         return -1;
     bt_size_cur = 0;
+#ifndef _OS_WINDOWS_
+    if (!profile_agg_started) {
+        char *env = getenv("JULIA_PROFILE_AGGREGATE");
+        if (env && atoi(env) != 0) {
+            profile_agg_started = 1;
+            htable_new(&profile_agg_table, 0);
+            atexit(jl_profile_print_aggregate);
+            uv_thread_create(&profile_agg_thread, profile_agg_loop, NULL);
+        }
+    }
+#endif
     return 0;
 }
 
@@ -75,6 +209,19 @@ JL_DLLEXPORT int jl_profile_is_running(void)
     return running;
 }
 
+// Whether the profiler should sample with the frame-pointer fast unwinder
+// (opt-in via JULIA_PROFILE_FP_UNWIND=1). Sampling becomes much cheaper,
+// but native frames compiled without frame pointers are not reported.
+int jl_profile_use_fp_unwind(void)
+{
+    static int use_fp = -1;
+    if (use_fp == -1) {
+        char *env = getenv("JULIA_PROFILE_FP_UNWIND");
+        use_fp = (env && env[0] && strcmp(env, "0") != 0) ? 1 : 0;
+    }
+    return use_fp;
+}
+
 // Any function that acquires this lock must be either a unmanaged thread
 // or in the GC safe region and must NOT allocate anything through the GC
 // while holding this lock.
@@ -218,6 +365,34 @@ static int jl_check_force_sigint(void)
     return 0;
 }
 
+// Slow path of the safepoint poll (see julia_threads.h): taken when the
+// loaded poll word is nonzero, which only happens in the membarrier
+// rendezvous mode (JULIA_SAFEPOINT_MEMBARRIER, see safepoint.c). Mirrors
+// what the segv handler does for a safepoint fault, but runs synchronously
+// in the polling thread, so the pending sigint can be thrown directly.
+JL_DLLEXPORT void jl_safepoint_hit(void)
+{
+    jl_task_t *ct = jl_get_current_task();
+    if (ct == NULL || ct->ptls == NULL)
+        return;
+    if (jl_atomic_load_relaxed(&jl_gc_running)) {
+        int8_t state = jl_atomic_load_relaxed(&ct->ptls->gc_state);
+        jl_atomic_store_release(&ct->ptls->gc_state, JL_GC_STATE_WAITING);
+        jl_safepoint_wait_gc();
+        jl_atomic_store_release(&ct->ptls->gc_state, state);
+    }
+    // Do not raise sigint on worker thread
+    if (jl_atomic_load_relaxed(&ct->tid) != 0)
+        return;
+    if (ct->ptls->defer_signal) {
+        jl_safepoint_defer_sigint();
+    }
+    else if (jl_safepoint_consume_sigint()) {
+        jl_clear_force_sigint();
+        jl_throw(jl_interrupt_exception);
+    }
+}
+
 #ifndef _OS_WINDOWS_
 // Not thread local, should only be accessed by the signal handler thread.
 static volatile int jl_sigint_passed = 0;
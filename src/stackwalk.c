@@ -47,6 +47,57 @@ static jl_gcframe_t *is_enter_interpreter_frame(jl_gcframe_t **ppgcstack, uintpt
     return NULL;
 }
 
+// Fast frame-pointer unwinding, for the sampling profiler. Stepping through
+// the chain of saved frame pointers is far cheaper than consulting unwind
+// tables, at the cost of accuracy: julia code always preserves frame
+// pointers, but the walk terminates at the first native frame compiled
+// without them. Reads through a broken chain are caught by the caller's
+// safe_restore, like any other failed unwind.
+typedef struct {
+    uintptr_t ip;
+    uintptr_t sp;
+    uintptr_t fp;
+} jl_fp_cursor_t;
+
+#if defined(_OS_LINUX_) && (defined(_CPU_X86_64_) || defined(_CPU_AARCH64_)) && !defined(JL_DISABLE_LIBUNWIND)
+#define JL_HAVE_FP_UNWIND
+
+static int jl_unw_init_fp(jl_fp_cursor_t *cursor, bt_context_t *context) JL_NOTSAFEPOINT
+{
+    ucontext_t *ctx = (ucontext_t*)context;
+#if defined(_CPU_X86_64_)
+    cursor->ip = ctx->uc_mcontext.gregs[REG_RIP];
+    cursor->sp = ctx->uc_mcontext.gregs[REG_RSP];
+    cursor->fp = ctx->uc_mcontext.gregs[REG_RBP];
+#else // _CPU_AARCH64_
+    cursor->ip = ctx->uc_mcontext.pc;
+    cursor->sp = ctx->uc_mcontext.sp;
+    cursor->fp = ctx->uc_mcontext.regs[29];
+#endif
+    return cursor->ip != 0;
+}
+
+// Matches the contract of jl_unw_step: report the current frame through
+// `ip`/`sp` and advance the cursor to the caller's frame, returning whether
+// that succeeded.
+static int jl_unw_step_fp(jl_fp_cursor_t *cursor, uintptr_t *ip, uintptr_t *sp) JL_NOTSAFEPOINT
+{
+    *ip = cursor->ip;
+    *sp = cursor->sp;
+    uintptr_t fp = cursor->fp;
+    // The frame record ([fp] = caller's fp, [fp + 8] = return address) must
+    // sit above the current stack pointer and be pointer-aligned, or the
+    // chain is broken (typically by a frame-pointer-less native frame).
+    if (fp < cursor->sp || (fp & (sizeof(void*) - 1)))
+        return 0;
+    cursor->ip = ((uintptr_t*)fp)[1];
+    cursor->sp = fp + 2 * sizeof(void*);
+    cursor->fp = ((uintptr_t*)fp)[0];
+    return cursor->ip != 0;
+}
+
+#endif
+
 
 // Record backtrace entries into bt_data by stepping cursor with jl_unw_step
 // until the outermost frame is encountered or the buffer bt_data is (close to)
@@ -66,7 +117,11 @@ static jl_gcframe_t *is_enter_interpreter_frame(jl_gcframe_t **ppgcstack, uintpt
 //
 // jl_unw_stepn will return 1 if there are more frames to come. The number of
 // elements written to bt_data (and sp if non-NULL) are returned in bt_size.
-static int jl_unw_stepn(bt_cursor_t *cursor, jl_bt_element_t *bt_data, size_t *bt_size,
+//
+// If `fp_cursor != NULL`, the walk steps it through the frame-pointer chain
+// instead of stepping `cursor` (which may then be NULL).
+static int jl_unw_stepn(bt_cursor_t *cursor, jl_fp_cursor_t *fp_cursor,
+                        jl_bt_element_t *bt_data, size_t *bt_size,
                         uintptr_t *sp, size_t maxsize, int skip, jl_gcframe_t **ppgcstack,
                         int from_signal_handler) JL_NOTSAFEPOINT
 {
@@ -96,6 +151,11 @@ static int jl_unw_stepn(bt_cursor_t *cursor, jl_bt_element_t *bt_data, size_t *b
                 break;
             }
             uintptr_t oldsp = thesp;
+#ifdef JL_HAVE_FP_UNWIND
+            if (fp_cursor)
+                have_more_frames = jl_unw_step_fp(fp_cursor, &return_ip, &thesp);
+            else
+#endif
             have_more_frames = jl_unw_step(cursor, from_signal_handler, &return_ip, &thesp);
             if (oldsp >= thesp && !jl_running_under_rr(0)) {
                 // The stack pointer is clearly bad, as it must grow downwards.
@@ -198,10 +258,28 @@ NOINLINE size_t rec_backtrace_ctx(jl_bt_element_t *bt_data, size_t maxsize,
     if (!jl_unw_init(&cursor, context))
         return 0;
     size_t bt_size = 0;
-    jl_unw_stepn(&cursor, bt_data, &bt_size, NULL, maxsize, 0, &pgcstack, 1);
+    jl_unw_stepn(&cursor, NULL, bt_data, &bt_size, NULL, maxsize, 0, &pgcstack, 1);
     return bt_size;
 }
 
+// Frame-pointer variant of `rec_backtrace_ctx`, cheap enough for
+// high-frequency sampling. Falls back to the table-driven unwinder on
+// platforms without frame-pointer walk support.
+NOINLINE size_t rec_backtrace_ctx_fp(jl_bt_element_t *bt_data, size_t maxsize,
+                                     bt_context_t *context, jl_gcframe_t *pgcstack) JL_NOTSAFEPOINT
+{
+#ifdef JL_HAVE_FP_UNWIND
+    jl_fp_cursor_t cursor;
+    if (!jl_unw_init_fp(&cursor, context))
+        return 0;
+    size_t bt_size = 0;
+    jl_unw_stepn(NULL, &cursor, bt_data, &bt_size, NULL, maxsize, 0, &pgcstack, 1);
+    return bt_size;
+#else
+    return rec_backtrace_ctx(bt_data, maxsize, context, pgcstack);
+#endif
+}
+
 // Record backtrace into buffer `bt_data`, using a maximum of `maxsize`
 // elements, and returning the number of elements written.
 //
@@ -219,10 +297,49 @@ NOINLINE size_t rec_backtrace(jl_bt_element_t *bt_data, size_t maxsize, int skip
         return 0;
     jl_gcframe_t *pgcstack = jl_pgcstack;
     size_t bt_size = 0;
-    jl_unw_stepn(&cursor, bt_data, &bt_size, NULL, maxsize, skip + 1, &pgcstack, 0);
+    jl_unw_stepn(&cursor, NULL, bt_data, &bt_size, NULL, maxsize, skip + 1, &pgcstack, 0);
     return bt_size;
 }
 
+// Frame-pointer variant of `rec_backtrace`, for callers (such as the
+// allocation profiler) that record backtraces too often to afford the
+// table-driven unwinder. Starts from this function's own frame record, so
+// no context capture is needed at all.
+NOINLINE size_t rec_backtrace_fp(jl_bt_element_t *bt_data, size_t maxsize, int skip) JL_NOTSAFEPOINT
+{
+#ifdef JL_HAVE_FP_UNWIND
+    uintptr_t fp = (uintptr_t)__builtin_frame_address(0);
+    jl_fp_cursor_t cursor;
+    cursor.ip = ((uintptr_t*)fp)[1];
+    cursor.sp = fp + 2 * sizeof(void*);
+    cursor.fp = ((uintptr_t*)fp)[0];
+    if (cursor.ip == 0 || maxsize == 0)
+        return 0;
+    jl_gcframe_t *pgcstack = jl_pgcstack;
+    size_t bt_size = 0;
+    jl_unw_stepn(NULL, &cursor, bt_data, &bt_size, NULL, maxsize, skip, &pgcstack, 0);
+    return bt_size;
+#else
+    return rec_backtrace(bt_data, maxsize, skip);
+#endif
+}
+
+// Whether error-path backtraces (jl_throw) should use the frame-pointer fast
+// unwinder instead of the table-driven one (opt-in via
+// JULIA_ERROR_FP_BACKTRACE=1). Codegen additionally keeps frame pointers in
+// every emitted prologue when this is set, so the chain covers Julia frames
+// even in builds without JL_DISABLE_FPO; native frames compiled without frame
+// pointers are still skipped.
+int jl_error_fp_backtrace(void) JL_NOTSAFEPOINT
+{
+    static int use_fp = -1;
+    if (use_fp == -1) {
+        char *env = getenv("JULIA_ERROR_FP_BACKTRACE");
+        use_fp = (env && env[0] && strcmp(env, "0") != 0) ? 1 : 0;
+    }
+    return use_fp;
+}
+
 static jl_value_t *array_ptr_void_type JL_ALWAYS_LEAFTYPE = NULL;
 // Return backtrace information as an svec of (bt1, bt2, [sp])
 //
@@ -263,7 +380,7 @@ JL_DLLEXPORT jl_value_t *jl_backtrace_from_here(int returnsp, int skip)
                 sp_ptr = (uintptr_t*)jl_array_data(sp) + offset;
             }
             size_t size_incr = 0;
-            have_more_frames = jl_unw_stepn(&cursor, (jl_bt_element_t*)jl_array_data(ip) + offset,
+            have_more_frames = jl_unw_stepn(&cursor, NULL, (jl_bt_element_t*)jl_array_data(ip) + offset,
                                             &size_incr, sp_ptr, maxincr, skip, &pgcstack, 0);
             skip = 0;
             offset += size_incr;
@@ -561,7 +678,7 @@ NOINLINE size_t rec_backtrace_ctx_dwarf(jl_bt_element_t *bt_data, size_t maxsize
     bt_cursor_t cursor;
     if (unw_init_local_dwarf(&cursor, context) != UNW_ESUCCESS)
         return 0;
-    jl_unw_stepn(&cursor, bt_data, &bt_size, NULL, maxsize, 0, &pgcstack, 1);
+    jl_unw_stepn(&cursor, NULL, bt_data, &bt_size, NULL, maxsize, 0, &pgcstack, 1);
     return bt_size;
 }
 #endif
@@ -697,6 +814,104 @@ void jl_print_bt_entry_codeloc(jl_bt_element_t *bt_entry) JL_NOTSAFEPOINT
     }
 }
 
+// Compact relocatable serialization of a backtrace buffer, for shipping
+// traces across processes. Native instruction pointers are stored relative
+// to the load base of the object containing them, next to a table of object
+// file paths, so a trace stays symbolizable offline against the matching
+// binaries no matter where they were mapped. All integers are LEB128; a
+// typical trace fits in tens of bytes plus the module paths, versus the
+// kilobytes of the printed form.
+//
+// Layout:
+//   uint8     format version (currently 1)
+//   uleb128   nmodules; then for each module:
+//     uleb128 path length, followed by that many path bytes
+//   uleb128   nframes; then for each frame:
+//     uleb128 1-based module index, or 0 for a frame with no containing
+//             object (JIT and interpreter frames, which are meaningless in
+//             another process and are recorded only to keep frame counts)
+//     uleb128 module-relative offset (only when the index is nonzero)
+
+#define BT_SERIALIZE_MAX_MODULES 64
+
+static void write_uleb128(ios_t *s, uint64_t n) JL_NOTSAFEPOINT
+{
+    do {
+        uint8_t b = n & 0x7f;
+        n >>= 7;
+        if (n)
+            b |= 0x80;
+        ios_write(s, (char*)&b, 1);
+    } while (n);
+}
+
+JL_DLLEXPORT jl_array_t *jl_serialize_backtrace(jl_bt_element_t *bt_data, size_t bt_size)
+{
+    uint64_t bases[BT_SERIALIZE_MAX_MODULES];
+    char *paths[BT_SERIALIZE_MAX_MODULES];
+    size_t nmodules = 0;
+    ios_t frames;
+    ios_mem(&frames, 0);
+    size_t nframes = 0;
+    for (size_t i = 0; i < bt_size; i += jl_bt_entry_size(bt_data + i), nframes++) {
+        jl_bt_element_t *bt_entry = bt_data + i;
+        uint64_t fbase = 0;
+        char *fname = NULL;
+        if (!jl_bt_is_native(bt_entry) ||
+                !jl_object_for_ip(bt_entry[0].uintptr, &fbase, &fname)) {
+            write_uleb128(&frames, 0);
+            continue;
+        }
+        size_t m = 0;
+        while (m < nmodules && bases[m] != fbase)
+            m++;
+        if (m == nmodules) {
+            if (nmodules == BT_SERIALIZE_MAX_MODULES) {
+                // too many distinct objects; record the frame as unresolved
+                free(fname);
+                write_uleb128(&frames, 0);
+                continue;
+            }
+            bases[nmodules] = fbase;
+            paths[nmodules] = fname;
+            nmodules++;
+        }
+        else {
+            free(fname);
+        }
+        write_uleb128(&frames, m + 1);
+        write_uleb128(&frames, bt_entry[0].uintptr - fbase);
+    }
+    ios_t dest;
+    ios_mem(&dest, 0);
+    uint8_t version = 1;
+    ios_write(&dest, (char*)&version, 1);
+    write_uleb128(&dest, nmodules);
+    for (size_t m = 0; m < nmodules; m++) {
+        size_t len = strlen(paths[m]);
+        write_uleb128(&dest, len);
+        ios_write(&dest, paths[m], len);
+        free(paths[m]);
+    }
+    write_uleb128(&dest, nframes);
+    size_t framesz;
+    char *framebuf = ios_take_buffer(&frames, &framesz);
+    ios_write(&dest, framebuf, framesz - 1); // psize counts the added NUL
+    free(framebuf);
+    ios_close(&frames);
+    jl_array_t *r = jl_take_buffer(&dest);
+    ios_close(&dest);
+    return r;
+}
+
+// Serialize the current task's most recently recorded backtrace (as saved
+// by `record_backtrace`, i.e. the trace of the exception being handled).
+JL_DLLEXPORT jl_array_t *jl_serialize_current_backtrace(void)
+{
+    jl_ptls_t ptls = jl_current_task->ptls;
+    return jl_serialize_backtrace(ptls->bt_data, ptls->bt_size);
+}
+
 
 #ifdef _OS_LINUX_
 #if defined(__GLIBC__) && defined(_CPU_AARCH64_)
@@ -83,6 +83,7 @@ External links:
 
 #ifndef _OS_WINDOWS_
 #include <dlfcn.h>
+#include <sys/mman.h>
 #endif
 
 #include "valgrind.h"
@@ -489,6 +490,14 @@ static void jl_load_sysimg_so(void)
     jl_dlsym(jl_sysimg_handle, "jl_system_image_data", (void **)&sysimg_data, 1);
     size_t *plen;
     jl_dlsym(jl_sysimg_handle, "jl_system_image_size", (void **)&plen, 1);
+#if !defined(_OS_WINDOWS_) && defined(MADV_WILLNEED)
+    // deserialization walks almost the entire data section; start readahead
+    // now so a cold start streams it in instead of faulting page by page
+    {
+        uintptr_t start = (uintptr_t)sysimg_data & ~(uintptr_t)(jl_page_size - 1);
+        madvise((void*)start, *plen + ((uintptr_t)sysimg_data - start), MADV_WILLNEED);
+    }
+#endif
     jl_restore_system_image_data(sysimg_data, *plen);
 }
 
@@ -668,6 +677,29 @@ static void jl_insert_into_serialization_queue(jl_serializer_state *s, jl_value_
             record_field_change((jl_value_t**)&mi->callbacks, NULL);
             record_field_change((jl_value_t**)&mi->cache, NULL);
         }
+        else {
+            // a method instance owned by the worklist: code instances that
+            // were invalidated before this save point can never become valid
+            // again after loading (`jl_write_values` would serialize them
+            // with max_world = 0), so skip over them instead of spending
+            // image space and load-time relocation work on them
+            jl_code_instance_t *codeinst = jl_atomic_load_relaxed(&mi->cache);
+            while (codeinst && codeinst->max_world != ~(size_t)0)
+                codeinst = jl_atomic_load_relaxed(&codeinst->next);
+            if (codeinst != jl_atomic_load_relaxed(&mi->cache))
+                record_field_change((jl_value_t**)&mi->cache, (jl_value_t*)codeinst);
+        }
+    }
+    if (s->incremental && jl_is_code_instance(v)) {
+        // likewise unlink invalidated entries from the middle of a cache
+        // chain (this also covers the chains hanging off the external code
+        // instances collected in `new_specializations`)
+        jl_code_instance_t *ci = (jl_code_instance_t*)v;
+        jl_code_instance_t *next = jl_atomic_load_relaxed(&ci->next);
+        while (next && next->max_world != ~(size_t)0)
+            next = jl_atomic_load_relaxed(&next->next);
+        if (next != jl_atomic_load_relaxed(&ci->next))
+            record_field_change((jl_value_t**)&ci->next, (jl_value_t*)next);
     }
     if (s->incremental && jl_is_globalref(v)) {
         jl_globalref_t *gr = (jl_globalref_t*)v;
@@ -998,6 +1030,7 @@ static void jl_write_module(jl_serializer_state *s, uintptr_t item, jl_module_t
     newm->bindingkeyset = NULL;
     arraylist_push(&s->relocs_list, (void*)(reloc_offset + offsetof(jl_module_t, bindingkeyset)));
     arraylist_push(&s->relocs_list, (void*)backref_id(s, m->bindingkeyset, s->link_ids_relocs));
+    newm->last_binding = NULL; // drop the lookup cache; repopulated on first use
     newm->primary_world = ~(size_t)0;
 
     // write out the usings list
@@ -1054,6 +1087,120 @@ static void record_external_fns(jl_serializer_state *s, arraylist_t *external_fn
 }
 
 jl_value_t *jl_find_ptr = NULL;
+// Large isbits array payloads are not copied into the const_data stream
+// inline. `jl_write_values` only reserves their space and records
+// (dest offset, src, nbytes) triples; the copies happen in one pass at the
+// end, spread over worker threads. The copies are plain memcpy with no
+// runtime calls, so they are safe off-thread, and for big packages they
+// are most of the bytes written. Objects stay rooted by
+// `serialization_queue` (and the GC is disabled) for the whole save.
+#define DEFERRED_COPY_MIN_SIZE (1 * 1024 * 1024)
+#define DEFERRED_COPY_MAX_THREADS 8
+static arraylist_t deferred_copies; // (dest offset, src, nbytes) triples
+
+static void jl_defer_const_data_copy(jl_serializer_state *s, const char *src, size_t nbytes) JL_NOTSAFEPOINT
+{
+    size_t pos = ios_pos(s->const_data);
+    ios_trunc(s->const_data, pos + nbytes);
+    ios_seek(s->const_data, pos + nbytes);
+    arraylist_push(&deferred_copies, (void*)pos);
+    arraylist_push(&deferred_copies, (void*)src);
+    arraylist_push(&deferred_copies, (void*)nbytes);
+}
+
+typedef struct {
+    uv_thread_t tid;
+    char *base;
+    size_t begin; // first triple handled by this worker
+    size_t end;   // one past the last triple
+} jl_deferred_copy_worker_t;
+
+static void jl_deferred_copy_worker(void *vp)
+{
+    jl_deferred_copy_worker_t *w = (jl_deferred_copy_worker_t*)vp;
+    for (size_t i = w->begin; i < w->end; i++) {
+        size_t dest = (size_t)deferred_copies.items[3 * i];
+        const char *src = (const char*)deferred_copies.items[3 * i + 1];
+        size_t nbytes = (size_t)deferred_copies.items[3 * i + 2];
+        memcpy(w->base + dest, src, nbytes);
+    }
+}
+
+static void jl_flush_deferred_copies(jl_serializer_state *s)
+{
+    size_t ncopies = deferred_copies.len / 3;
+    if (ncopies == 0) {
+        arraylist_free(&deferred_copies);
+        return;
+    }
+    // no further writes happen while we copy, so the buffer is stable
+    char *base = &s->const_data->buf[0];
+    size_t total = 0;
+    for (size_t i = 0; i < ncopies; i++)
+        total += (size_t)deferred_copies.items[3 * i + 2];
+    int nworkers = jl_effective_threads();
+    if (nworkers > DEFERRED_COPY_MAX_THREADS)
+        nworkers = DEFERRED_COPY_MAX_THREADS;
+    if ((size_t)nworkers > ncopies)
+        nworkers = (int)ncopies;
+    jl_deferred_copy_worker_t workers[DEFERRED_COPY_MAX_THREADS];
+    // contiguous split of the triple list, balanced by payload bytes
+    size_t next = 0;
+    size_t acc = 0;
+    for (int i = 0; i < nworkers; i++) {
+        workers[i].base = base;
+        workers[i].begin = next;
+        size_t goal = total / nworkers * (i + 1);
+        while (next < ncopies && (i == nworkers - 1 || acc < goal)) {
+            acc += (size_t)deferred_copies.items[3 * next + 2];
+            next++;
+        }
+        workers[i].end = next;
+    }
+    for (int i = 1; i < nworkers; i++)
+        uv_thread_create(&workers[i].tid, jl_deferred_copy_worker, &workers[i]);
+    jl_deferred_copy_worker(&workers[0]);
+    for (int i = 1; i < nworkers; i++)
+        uv_thread_join(&workers[i].tid);
+    arraylist_free(&deferred_copies);
+}
+
+// Content-addressed sharing of isbits array payloads in the const_data
+// stream. Dependencies shared by several packages serialize identical data
+// tables (and compressed code arrays) over and over; since const_data
+// payloads carry no relocations, two identical payloads are fully
+// interchangeable, so later copies are dropped and their relocations
+// pointed at the first. The index keys on `memhash` of the source bytes;
+// source objects stay valid for the whole save (see the deferred-copy note
+// above), so verification never has to touch the (possibly still
+// unwritten) stream.
+#define CONST_DATA_DEDUP_MIN_SIZE 64
+static htable_t const_data_dedup;         // memhash(bytes) => index+2 into const_data_dedup_list
+static arraylist_t const_data_dedup_list; // (src, nbytes, const_data offset) triples
+
+// Look up `nbytes` at `src`: the offset of an identical payload already in
+// the stream, or -1 after recording that the caller will write this
+// payload at `offset`.
+static int64_t jl_const_data_lookup(const char *src, size_t nbytes, size_t align, size_t offset) JL_NOTSAFEPOINT
+{
+    uint64_t hash = memhash(src, nbytes);
+    void **bp = ptrhash_bp(&const_data_dedup, (void*)(uintptr_t)hash);
+    if (*bp != HT_NOTFOUND) {
+        size_t i = ((size_t)*bp - 2) * 3;
+        const char *src0 = (const char*)const_data_dedup_list.items[i];
+        size_t nbytes0 = (size_t)const_data_dedup_list.items[i + 1];
+        size_t offset0 = (size_t)const_data_dedup_list.items[i + 2];
+        if (nbytes0 == nbytes && offset0 % align == 0 && !memcmp(src0, src, nbytes))
+            return (int64_t)offset0;
+        return -1; // hash collision or insufficient alignment; write a fresh (unindexed) copy
+    }
+    *bp = (void*)(const_data_dedup_list.len / 3 + 2);
+    arraylist_push(&const_data_dedup_list, (void*)src);
+    arraylist_push(&const_data_dedup_list, (void*)nbytes);
+    arraylist_push(&const_data_dedup_list, (void*)offset);
+    return -1;
+}
+
 // The main function for serializing all the items queued in `serialization_order`
 // (They are also stored in `serialization_queue` which is order-preserving, unlike the hash table used
 //  for `serialization_order`).
@@ -1061,6 +1208,9 @@ static void jl_write_values(jl_serializer_state *s) JL_GC_DISABLED
 {
     size_t l = serialization_queue.len;
 
+    arraylist_new(&deferred_copies, 0);
+    htable_new(&const_data_dedup, 0);
+    arraylist_new(&const_data_dedup_list, 0);
     arraylist_new(&layout_table, 0);
     arraylist_grow(&layout_table, l * 2);
     memset(layout_table.items, 0, l * 2 * sizeof(void*));
@@ -1139,7 +1289,17 @@ static void jl_write_values(jl_serializer_state *s) JL_GC_DISABLED
             if (!ar->flags.ptrarray && !ar->flags.hasptr) {
                 // Non-pointer eltypes get encoded in the const_data section
                 uintptr_t data = LLT_ALIGN(ios_pos(s->const_data), alignment_amt);
-                write_padding(s->const_data, data - ios_pos(s->const_data));
+                int shared = 0;
+                if (!jl_is_cpointer_type(et) && !isbitsunion && tot >= CONST_DATA_DEDUP_MIN_SIZE) {
+                    int64_t prior = jl_const_data_lookup((const char*)jl_array_data(ar), tot, alignment_amt, data);
+                    if (prior >= 0) {
+                        // an identical payload is already in the stream; point at it
+                        data = (uintptr_t)prior;
+                        shared = 1;
+                    }
+                }
+                if (!shared)
+                    write_padding(s->const_data, data - ios_pos(s->const_data));
                 // write data and relocations
                 newa->data = NULL; // relocation offset
                 data /= sizeof(void*);
@@ -1157,11 +1317,14 @@ static void jl_write_values(jl_serializer_state *s) JL_GC_DISABLED
                             ios_write(s->const_data, (char*)&data[i], sizeof(data[i]));
                     }
                 }
-                else {
+                else if (!shared) {
                     if (isbitsunion) {
                         ios_write(s->const_data, (char*)jl_array_data(ar), datasize);
                         ios_write(s->const_data, jl_array_typetagdata(ar), alen);
                     }
+                    else if (tot >= DEFERRED_COPY_MIN_SIZE) {
+                        jl_defer_const_data_copy(s, (char*)jl_array_data(ar), tot);
+                    }
                     else {
                         ios_write(s->const_data, (char*)jl_array_data(ar), tot);
                     }
@@ -1478,6 +1641,10 @@ static void jl_write_values(jl_serializer_state *s) JL_GC_DISABLED
             }
         }
     }
+
+    jl_flush_deferred_copies(s);
+    htable_free(&const_data_dedup);
+    arraylist_free(&const_data_dedup_list);
 }
 
 // In deserialization, create Symbols and set up the
@@ -2171,7 +2338,8 @@ JL_DLLEXPORT jl_value_t *jl_as_global_root(jl_value_t *val JL_MAYBE_UNROOTED)
 
 static void jl_prepare_serialization_data(jl_array_t *mod_array, jl_array_t *newly_inferred, uint64_t worklist_key,
                            /* outputs */  jl_array_t **extext_methods, jl_array_t **new_specializations,
-                                          jl_array_t **method_roots_list, jl_array_t **ext_targets, jl_array_t **edges)
+                                          jl_array_t **method_roots_list, jl_array_t **ext_targets, jl_array_t **edges,
+                                          jl_array_t **ext_mt_caches)
 {
     // extext_methods: [method1, ...], worklist-owned "extending external" methods added to functions owned by modules outside the worklist
     // ext_targets: [invokesig1, callee1, matches1, ...] non-worklist callees of worklist-owned methods
@@ -2179,6 +2347,7 @@ static void jl_prepare_serialization_data(jl_array_t *mod_array, jl_array_t *new
     //              `invoke` dispatch: invokesig is signature, callee is MethodInstance
     //              abstract call: callee is signature
     // edges: [caller1, ext_targets_indexes1, ...] for worklist-owned methods calling external methods
+    // ext_mt_caches: [sig1, mi1, ...] dispatch cache entries added to method tables owned by other images
     assert(edges_map == NULL);
 
     htable_new(&external_mis, 0);  // we need external_mis until after `jl_collect_edges` finishes
@@ -2216,6 +2385,8 @@ static void jl_prepare_serialization_data(jl_array_t *mod_array, jl_array_t *new
         htable_free(&methods_with_newspecs);
         jl_collect_edges(*edges, *ext_targets);
     }
+    if (ext_mt_caches)
+        *ext_mt_caches = jl_collect_ext_mt_caches();
     htable_free(&external_mis);
     assert(edges_map == NULL); // jl_collect_edges clears this when done
 
@@ -2226,7 +2397,8 @@ static void jl_prepare_serialization_data(jl_array_t *mod_array, jl_array_t *new
 static void jl_save_system_image_to_stream(ios_t *f,
                                            jl_array_t *worklist, jl_array_t *extext_methods,
                                            jl_array_t *new_specializations, jl_array_t *method_roots_list,
-                                           jl_array_t *ext_targets, jl_array_t *edges) JL_GC_DISABLED
+                                           jl_array_t *ext_targets, jl_array_t *edges,
+                                           jl_array_t *ext_mt_caches) JL_GC_DISABLED
 {
     htable_new(&field_replace, 0);
     // strip metadata and IR when requested
@@ -2347,6 +2519,8 @@ static void jl_save_system_image_to_stream(ios_t *f,
             // Queue the edges
             jl_queue_for_serialization(&s, ext_targets);
             jl_queue_for_serialization(&s, edges);
+            // Queue the saved dispatch cache entries of external method tables
+            jl_queue_for_serialization(&s, ext_mt_caches);
         }
         jl_serialize_reachable(&s);
         // step 1.2: ensure all gvars are part of the sysimage too
@@ -2462,6 +2636,7 @@ static void jl_save_system_image_to_stream(ios_t *f,
             jl_write_value(&s, method_roots_list);
             jl_write_value(&s, ext_targets);
             jl_write_value(&s, edges);
+            jl_write_value(&s, ext_mt_caches);
         }
         write_uint32(f, jl_array_len(s.link_ids_gctags));
         ios_write(f, (char*)jl_array_data(s.link_ids_gctags), jl_array_len(s.link_ids_gctags)*sizeof(uint64_t));
@@ -2503,6 +2678,53 @@ static void jl_save_system_image_to_stream(ios_t *f,
     jl_gc_enable(en);
 }
 
+// Image checksumming: for buffers large enough to be worth the thread
+// spawns, split the buffer into per-thread chunks and merge the per-chunk
+// CRCs with jl_crc32c_combine. The result is identical to a single
+// jl_crc32c pass, so images written and validated by differently-threaded
+// processes still agree.
+#define CRC32C_PARALLEL_MIN_CHUNK (64 * 1024 * 1024)
+#define CRC32C_PARALLEL_MAX_THREADS 8
+
+typedef struct {
+    uv_thread_t tid;
+    const char *buf;
+    size_t len;
+    uint32_t crc;
+} jl_crc32c_worker_t;
+
+static void jl_crc32c_worker(void *vp)
+{
+    jl_crc32c_worker_t *w = (jl_crc32c_worker_t*)vp;
+    w->crc = jl_crc32c(0, w->buf, w->len);
+}
+
+static uint32_t jl_crc32c_parallel(const char *buf, size_t len)
+{
+    int nworkers = jl_effective_threads();
+    if (nworkers > CRC32C_PARALLEL_MAX_THREADS)
+        nworkers = CRC32C_PARALLEL_MAX_THREADS;
+    if ((size_t)nworkers > len / CRC32C_PARALLEL_MIN_CHUNK)
+        nworkers = (int)(len / CRC32C_PARALLEL_MIN_CHUNK);
+    if (nworkers < 2)
+        return jl_crc32c(0, buf, len);
+    jl_crc32c_worker_t workers[CRC32C_PARALLEL_MAX_THREADS];
+    size_t chunk = len / nworkers;
+    for (int i = 0; i < nworkers; i++) {
+        workers[i].buf = buf + i * chunk;
+        workers[i].len = i == nworkers - 1 ? len - i * chunk : chunk;
+        workers[i].crc = 0;
+    }
+    for (int i = 1; i < nworkers; i++)
+        uv_thread_create(&workers[i].tid, jl_crc32c_worker, &workers[i]);
+    uint32_t crc = jl_crc32c(0, workers[0].buf, workers[0].len);
+    for (int i = 1; i < nworkers; i++) {
+        uv_thread_join(&workers[i].tid);
+        crc = jl_crc32c_combine(crc, workers[i].crc, workers[i].len);
+    }
+    return crc;
+}
+
 static void jl_write_header_for_incremental(ios_t *f, jl_array_t *worklist, jl_array_t *mod_array, jl_array_t **udeps, int64_t *srctextpos, int64_t *checksumpos)
 {
     assert(jl_precompile_toplevel_module == NULL);
@@ -2546,18 +2768,18 @@ JL_DLLEXPORT void jl_create_system_image(void **_native_data, jl_array_t *workli
     }
 
     jl_array_t *mod_array = NULL, *extext_methods = NULL, *new_specializations = NULL;
-    jl_array_t *method_roots_list = NULL, *ext_targets = NULL, *edges = NULL;
+    jl_array_t *method_roots_list = NULL, *ext_targets = NULL, *edges = NULL, *ext_mt_caches = NULL;
     int64_t checksumpos = 0;
     int64_t checksumpos_ff = 0;
     int64_t datastartpos = 0;
-    JL_GC_PUSH6(&mod_array, &extext_methods, &new_specializations, &method_roots_list, &ext_targets, &edges);
+    JL_GC_PUSH7(&mod_array, &extext_methods, &new_specializations, &method_roots_list, &ext_targets, &edges, &ext_mt_caches);
 
     if (worklist) {
         mod_array = jl_get_loaded_modules();  // __toplevel__ modules loaded in this session (from Base.loaded_modules_array)
         // Generate _native_data`
         if (jl_options.outputo || jl_options.outputbc || jl_options.outputunoptbc || jl_options.outputasm) {
             jl_prepare_serialization_data(mod_array, newly_inferred, jl_worklist_key(worklist),
-                                          &extext_methods, &new_specializations, NULL, NULL, NULL);
+                                          &extext_methods, &new_specializations, NULL, NULL, NULL, NULL);
             jl_precompile_toplevel_module = (jl_module_t*)jl_array_ptr_ref(worklist, jl_array_len(worklist)-1);
             *_native_data = jl_precompile_worklist(worklist, extext_methods, new_specializations);
             jl_precompile_toplevel_module = NULL;
@@ -2585,7 +2807,8 @@ JL_DLLEXPORT void jl_create_system_image(void **_native_data, jl_array_t *workli
     ct->reentrant_inference = (uint16_t)-1;
     if (worklist) {
         jl_prepare_serialization_data(mod_array, newly_inferred, jl_worklist_key(worklist),
-                                      &extext_methods, &new_specializations, &method_roots_list, &ext_targets, &edges);
+                                      &extext_methods, &new_specializations, &method_roots_list, &ext_targets, &edges,
+                                      &ext_mt_caches);
         if (!emit_split) {
             write_int32(f, 0); // No clone_targets
             write_padding(f, LLT_ALIGN(ios_pos(f), JL_CACHE_BYTE_ALIGNMENT) - ios_pos(f));
@@ -2596,7 +2819,7 @@ JL_DLLEXPORT void jl_create_system_image(void **_native_data, jl_array_t *workli
         datastartpos = ios_pos(ff);
     }
     native_functions = *_native_data;
-    jl_save_system_image_to_stream(ff, worklist, extext_methods, new_specializations, method_roots_list, ext_targets, edges);
+    jl_save_system_image_to_stream(ff, worklist, extext_methods, new_specializations, method_roots_list, ext_targets, edges, ext_mt_caches);
     native_functions = NULL;
     // make sure we don't run any Julia code concurrently before this point
     // Re-enable running julia code for postoutput hooks, atexit, etc.
@@ -2607,7 +2830,7 @@ JL_DLLEXPORT void jl_create_system_image(void **_native_data, jl_array_t *workli
     if (worklist) {
         // Go back and update the checksum in the header
         int64_t dataendpos = ios_pos(ff);
-        uint32_t checksum = jl_crc32c(0, &ff->buf[datastartpos], dataendpos - datastartpos);
+        uint32_t checksum = jl_crc32c_parallel(&ff->buf[datastartpos], dataendpos - datastartpos);
         ios_seek(ff, checksumpos_ff);
         write_uint64(ff, checksum | ((uint64_t)0xfafbfcfd << 32));
         write_uint64(ff, datastartpos);
@@ -2674,6 +2897,7 @@ static void jl_restore_system_image_from_stream_(ios_t *f, jl_image_t *image, jl
                                                  jl_array_t **extext_methods,
                                                  jl_array_t **new_specializations, jl_array_t **method_roots_list,
                                                  jl_array_t **ext_targets, jl_array_t **edges,
+                                                 jl_array_t **ext_mt_caches,
                                                  char **base, arraylist_t *ccallable_list, pkgcachesizes *cachesizes) JL_GC_DISABLED
 {
     JL_TIMING(SYSIMG_LOAD);
@@ -2737,7 +2961,7 @@ static void jl_restore_system_image_from_stream_(ios_t *f, jl_image_t *image, jl
     assert(!ios_eof(f));
     s.s = f;
     uintptr_t offset_restored = 0, offset_init_order = 0, offset_extext_methods = 0, offset_new_specializations = 0, offset_method_roots_list = 0;
-    uintptr_t offset_ext_targets = 0, offset_edges = 0;
+    uintptr_t offset_ext_targets = 0, offset_edges = 0, offset_ext_mt_caches = 0;
     if (!s.incremental) {
         size_t i;
         for (i = 0; tags[i] != NULL; i++) {
@@ -2767,6 +2991,7 @@ static void jl_restore_system_image_from_stream_(ios_t *f, jl_image_t *image, jl
         offset_method_roots_list = jl_read_offset(&s);
         offset_ext_targets = jl_read_offset(&s);
         offset_edges = jl_read_offset(&s);
+        offset_ext_mt_caches = jl_read_offset(&s);
     }
     size_t nlinks_gctags = read_uint32(f);
     if (nlinks_gctags > 0) {
@@ -2791,7 +3016,7 @@ static void jl_restore_system_image_from_stream_(ios_t *f, jl_image_t *image, jl
     uint32_t external_fns_begin = read_uint32(f);
     jl_read_arraylist(s.s, ccallable_list ? ccallable_list : &s.ccallable_list);
     if (s.incremental) {
-        assert(restored && init_order && extext_methods && new_specializations && method_roots_list && ext_targets && edges);
+        assert(restored && init_order && extext_methods && new_specializations && method_roots_list && ext_targets && edges && ext_mt_caches);
         *restored = (jl_array_t*)jl_delayed_reloc(&s, offset_restored);
         *init_order = (jl_array_t*)jl_delayed_reloc(&s, offset_init_order);
         *extext_methods = (jl_array_t*)jl_delayed_reloc(&s, offset_extext_methods);
@@ -2799,6 +3024,7 @@ static void jl_restore_system_image_from_stream_(ios_t *f, jl_image_t *image, jl
         *method_roots_list = (jl_array_t*)jl_delayed_reloc(&s, offset_method_roots_list);
         *ext_targets = (jl_array_t*)jl_delayed_reloc(&s, offset_ext_targets);
         *edges = (jl_array_t*)jl_delayed_reloc(&s, offset_edges);
+        *ext_mt_caches = (jl_array_t*)jl_delayed_reloc(&s, offset_ext_mt_caches);
     }
     s.s = NULL;
 
@@ -3223,18 +3449,46 @@ static jl_value_t *jl_restore_package_image_from_stream(ios_t *f, jl_image_t *im
 
     jl_value_t *restored = NULL;
     jl_array_t *init_order = NULL, *extext_methods = NULL, *new_specializations = NULL, *method_roots_list = NULL, *ext_targets = NULL, *edges = NULL;
+    jl_array_t *ext_mt_caches = NULL;
     jl_svec_t *cachesizes_sv = NULL;
     char *base;
     arraylist_t ccallable_list;
-    JL_GC_PUSH8(&restored, &init_order, &extext_methods, &new_specializations, &method_roots_list, &ext_targets, &edges, &cachesizes_sv);
+    JL_GC_PUSH9(&restored, &init_order, &extext_methods, &new_specializations, &method_roots_list, &ext_targets, &edges, &ext_mt_caches, &cachesizes_sv);
 
     { // make a permanent in-memory copy of f (excluding the header)
         ios_bufmode(f, bm_none);
         JL_SIGATOMIC_BEGIN();
         size_t len = dataendpos - datastartpos;
-        char *sysimg = (char*)jl_gc_perm_alloc(len, 0, 64, 0);
-        ios_seek(f, datastartpos);
-        if (ios_readall(f, sysimg, len) != len || jl_crc32c(0, sysimg, len) != (uint32_t)checksum) {
+        char *sysimg = NULL;
+#ifndef _OS_WINDOWS_
+        if (f->fd != -1) {
+            // map the cache data instead of copying it: relocation writes
+            // dirty only the pages they touch (private COW), while the rest
+            // of the image stays file-backed and is paged in on first use
+            uintptr_t mapstart = (uintptr_t)datastartpos & ~(uintptr_t)(jl_page_size - 1);
+            size_t pgoff = (size_t)datastartpos - mapstart;
+            // the serializer aligns the data section, so the page offset
+            // preserves the expected buffer alignment
+            assert(pgoff % JL_CACHE_BYTE_ALIGNMENT == 0);
+            char *map = (char*)mmap(NULL, len + pgoff, PROT_READ | PROT_WRITE,
+                                    MAP_PRIVATE, (int)f->fd, (off_t)mapstart);
+            if (map != MAP_FAILED) {
+#ifdef MADV_WILLNEED
+                // the checksum and relocation passes stream through the
+                // data; readahead turns their page faults into one scan
+                madvise(map, len + pgoff, MADV_WILLNEED);
+#endif
+                sysimg = map + pgoff;
+            }
+        }
+#endif
+        if (sysimg == NULL) {
+            sysimg = (char*)jl_gc_perm_alloc(len, 0, 64, 0);
+            ios_seek(f, datastartpos);
+            if (ios_readall(f, sysimg, len) != len)
+                sysimg = NULL;
+        }
+        if (sysimg == NULL || jl_crc32c_parallel(sysimg, len) != (uint32_t)checksum) {
             restored = jl_get_exceptionf(jl_errorexception_type, "Error reading system image file.");
             JL_SIGATOMIC_END();
         }
@@ -3243,7 +3497,7 @@ static jl_value_t *jl_restore_package_image_from_stream(ios_t *f, jl_image_t *im
             ios_static_buffer(f, sysimg, len);
             htable_new(&new_code_instance_validate, 0);
             pkgcachesizes cachesizes;
-            jl_restore_system_image_from_stream_(f, image, depmods, checksum, (jl_array_t**)&restored, &init_order, &extext_methods, &new_specializations, &method_roots_list, &ext_targets, &edges, &base, &ccallable_list, &cachesizes);
+            jl_restore_system_image_from_stream_(f, image, depmods, checksum, (jl_array_t**)&restored, &init_order, &extext_methods, &new_specializations, &method_roots_list, &ext_targets, &edges, &ext_mt_caches, &base, &ccallable_list, &cachesizes);
             JL_SIGATOMIC_END();
 
             // Insert method extensions
@@ -3255,6 +3509,8 @@ static jl_value_t *jl_restore_package_image_from_stream(ios_t *f, jl_image_t *im
             jl_insert_backedges((jl_array_t*)edges, (jl_array_t*)ext_targets, (jl_array_t*)new_specializations); // restore external backedges (needs to be last)
             // check new CodeInstances and validate any that lack external backedges
             validate_new_code_instances();
+            // warm the dispatch caches of external method tables
+            jl_insert_ext_mt_caches(ext_mt_caches);
             // reinit ccallables
             jl_reinit_ccallable(&ccallable_list, base, NULL);
             arraylist_free(&ccallable_list);
@@ -3282,7 +3538,7 @@ static jl_value_t *jl_restore_package_image_from_stream(ios_t *f, jl_image_t *im
 static void jl_restore_system_image_from_stream(ios_t *f, jl_image_t *image)
 {
     uint64_t checksum = 0; // TODO: make this real
-    jl_restore_system_image_from_stream_(f, image, NULL, checksum, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+    jl_restore_system_image_from_stream_(f, image, NULL, checksum, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
 }
 
 JL_DLLEXPORT jl_value_t *jl_restore_incremental_from_buf(const char *buf, jl_image_t *image, size_t sz, jl_array_t *depmods, int complete)
@@ -3316,6 +3572,10 @@ JL_DLLEXPORT void jl_restore_system_image(const char *fname)
     assert((is_ji || jl_sysimg_handle) && "System image file not preloaded");
 #endif
 
+    // overlap dlopen of the libraries named by JULIA_PRELOAD_LIBS with the
+    // image restore; the workers are joined before we return
+    jl_preload_libraries_start();
+
     if (jl_sysimg_handle) {
         // load the pre-compiled sysimage from jl_sysimg_handle
         jl_load_sysimg_so();
@@ -3328,16 +3588,30 @@ JL_DLLEXPORT void jl_restore_system_image(const char *fname)
         JL_SIGATOMIC_BEGIN();
         ios_seek_end(&f);
         size_t len = ios_pos(&f);
-        char *sysimg = (char*)jl_gc_perm_alloc(len, 0, 64, 0);
-        ios_seek(&f, 0);
-        if (ios_readall(&f, sysimg, len) != len)
-            jl_errorf("Error reading system image file.");
+        char *sysimg = NULL;
+#ifndef _OS_WINDOWS_
+        // Map the image copy-on-write instead of reading it all up front:
+        // pages are faulted in lazily as the deserializer relocates them,
+        // pages it never writes stay file-backed (shared, evictable), and the
+        // page-aligned base satisfies every alignment the layout needs.
+        sysimg = (char*)mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE, (int)f.fd, 0);
+        if (sysimg == (char*)MAP_FAILED)
+            sysimg = NULL;
+#endif
+        if (sysimg == NULL) {
+            sysimg = (char*)jl_gc_perm_alloc(len, 0, 64, 0);
+            ios_seek(&f, 0);
+            if (ios_readall(&f, sysimg, len) != len)
+                jl_errorf("Error reading system image file.");
+        }
         ios_close(&f);
         ios_static_buffer(&f, sysimg, len);
         jl_restore_system_image_from_stream(&f, &sysimage);
         ios_close(&f);
         JL_SIGATOMIC_END();
     }
+
+    jl_preload_libraries_finish();
 }
 
 JL_DLLEXPORT void jl_restore_system_image_data(const char *buf, size_t len)
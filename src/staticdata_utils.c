@@ -399,6 +399,59 @@ static void jl_collect_extext_methods_from_mod(jl_array_t *s, jl_module_t *m)
     foreach_mtable_in_module(m, jl_collect_methtable_from_mod, s);
 }
 
+static int jl_collect_mt_cache_entry(jl_typemap_entry_t *ml, void *closure)
+{
+    if (jl_object_in_image((jl_value_t*)ml))
+        return 1; // already owned by another image
+    if (ml->max_world != ~(size_t)0)
+        return 1; // no longer valid
+    jl_tupletype_t *sig = ml->sig;
+    if (!jl_is_datatype(sig) || !sig->isdispatchtuple)
+        return 1;
+    if (jl_svec_len(ml->guardsigs) != 0 || (jl_value_t*)ml->simplesig != jl_nothing)
+        return 1; // guard layout is not re-derived on restore
+    jl_method_instance_t *mi = ml->func.linfo;
+    if (mi == NULL || !jl_is_method_instance((jl_value_t*)mi) || !jl_is_method(mi->def.value))
+        return 1;
+    jl_array_t *caches = (jl_array_t*)closure;
+    jl_array_ptr_1d_push(caches, (jl_value_t*)sig);
+    jl_array_ptr_1d_push(caches, (jl_value_t*)mi);
+    return 1;
+}
+
+static int jl_collect_mt_caches_visitor(jl_methtable_t *mt, void *env)
+{
+    if (!jl_object_in_image((jl_value_t*)mt))
+        return 1; // worklist-owned: its caches are serialized with the method table itself
+    jl_typemap_visitor(jl_atomic_load_relaxed(&mt->cache), jl_collect_mt_cache_entry, env);
+    jl_array_t *leafcache = jl_atomic_load_relaxed(&mt->leafcache);
+    size_t i, l = jl_array_len(leafcache);
+    for (i = 1; i < l; i += 2) {
+        jl_typemap_entry_t *entry = (jl_typemap_entry_t*)jl_array_ptr_ref(leafcache, i);
+        if (entry) {
+            while ((jl_value_t*)entry != jl_nothing) {
+                jl_collect_mt_cache_entry(entry, env);
+                entry = jl_atomic_load_relaxed(&entry->next);
+            }
+        }
+    }
+    return 1;
+}
+
+// Collect [sig1, mi1, sig2, mi2, ...] pairs for the dispatch cache entries
+// added during this session to method tables owned by other images. The
+// tables themselves are not serialized, so without this every call target
+// cached while precompiling is re-derived from scratch each time the package
+// is loaded (see jl_insert_ext_mt_caches).
+static jl_array_t *jl_collect_ext_mt_caches(void)
+{
+    jl_array_t *caches = jl_alloc_vec_any(0);
+    JL_GC_PUSH1(&caches);
+    jl_foreach_reachable_mtable(jl_collect_mt_caches_visitor, (void*)caches);
+    JL_GC_POP();
+    return caches;
+}
+
 static void jl_record_edges(jl_method_instance_t *caller, arraylist_t *wq, jl_array_t *edges)
 {
     jl_array_t *callees = NULL;
@@ -615,7 +668,7 @@ JL_DLLEXPORT uint8_t jl_match_cache_flags(uint8_t flags)
 }
 
 // "magic" string and version header of .ji file
-static const int JI_FORMAT_VERSION = 12;
+static const int JI_FORMAT_VERSION = 14;
 static const char JI_MAGIC[] = "\373jli\r\n\032\n"; // based on PNG signature
 static const uint16_t BOM = 0xFEFF; // byte-order marker
 static int64_t write_header(ios_t *s, uint8_t pkgimage)
@@ -815,6 +868,22 @@ static void jl_copy_roots(jl_array_t *method_roots_list, uint64_t key)
     }
 }
 
+// Restore the dispatch cache entries collected by jl_collect_ext_mt_caches
+// into the running system's method tables, warming them for the loaded code.
+// Each entry is re-validated against the current world before insertion, so
+// mappings invalidated by methods defined since the image was saved are
+// silently dropped.
+static void jl_insert_ext_mt_caches(jl_array_t *ext_mt_caches)
+{
+    size_t world = jl_atomic_load_acquire(&jl_world_counter);
+    size_t i, l = jl_array_len(ext_mt_caches);
+    for (i = 0; i < l; i += 2) {
+        jl_tupletype_t *tt = (jl_tupletype_t*)jl_array_ptr_ref(ext_mt_caches, i);
+        jl_method_instance_t *mi = (jl_method_instance_t*)jl_array_ptr_ref(ext_mt_caches, i + 1);
+        jl_mt_cache_restore(tt, mi, world);
+    }
+}
+
 static int remove_code_instance_from_validation(jl_code_instance_t *codeinst)
 {
     return ptrhash_remove(&new_code_instance_validate, codeinst);
@@ -863,10 +932,23 @@ static jl_array_t *jl_verify_edges(jl_array_t *targets)
             else
                 sig = callee;
             assert(jl_is_array(expected));
+            // Fast path: for a concrete call signature a dispatch cache hit
+            // names the unique method the search would return, so a cached
+            // method equal to the single expected one revalidates the edge
+            // without walking the method table. This makes reloading into an
+            // unchanged world near-free for leaf-call edges.
+            if (jl_array_len(expected) == 1 &&
+                    jl_mt_dispatch_cached(sig, world) == (jl_method_t*)jl_array_ptr_ref(expected, 0))
+                continue; // valids[i] is already 1
             int ambig = 0;
             // TODO: possibly need to included ambiguities too (for the optimizer correctness)?
+            // Bound the search by the number of expected matches: any
+            // additional intersecting method makes the edge invalid anyway,
+            // so there is no point enumerating the rest of a large method
+            // table. Only the invalidation log wants the full list.
+            int lim = _jl_debug_method_invalidation ? -1 : (int)jl_array_len(expected);
             matches = jl_matching_methods((jl_tupletype_t*)sig, jl_nothing,
-                    -1, 0, world, &min_valid, &max_valid, &ambig);
+                    lim, 0, world, &min_valid, &max_valid, &ambig);
             if (matches == jl_nothing) {
                 valid = 0;
             }
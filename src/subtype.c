@@ -574,7 +574,12 @@ static jl_unionall_t *rename_unionall(jl_unionall_t *u)
     jl_tvar_t *v = jl_new_typevar(u->var->name, u->var->lb, u->var->ub);
     jl_value_t *t = NULL;
     JL_GC_PUSH2(&v, &t);
-    t = jl_instantiate_unionall(u, (jl_value_t*)v);
+    if (!jl_has_typevar(u->body, u->var))
+        // the body never mentions the var: renaming only needs a fresh
+        // binder, not a substituted copy of the whole body
+        t = u->body;
+    else
+        t = jl_instantiate_unionall(u, (jl_value_t*)v);
     t = jl_new_struct(jl_unionall_type, v, t);
     JL_GC_POP();
     return (jl_unionall_t*)t;
@@ -1938,6 +1943,55 @@ JL_DLLEXPORT int jl_obvious_subtype(jl_value_t *x, jl_value_t *y, int *subtype)
     return obvious_subtype(x, y, y, subtype);
 }
 
+// Bounded memo tables for env-free subtype and specificity queries on closed
+// (typevar-free) types, keyed on pointer identity of the pair. Closed types
+// are immutable and neither query consults the world age, so entries never
+// need to be invalidated; a colliding pair simply overwrites the slot. The
+// tables are marked as part of the GC root set, which keeps the keys valid.
+jl_subtype_cache_entry_t jl_subtype_cache[N_SUBTYPE_CACHE] JL_GLOBALLY_ROOTED;
+jl_subtype_cache_entry_t jl_morespecific_cache[N_SUBTYPE_CACHE] JL_GLOBALLY_ROOTED;
+jl_intersect_cache_entry_t jl_intersect_cache[N_INTERSECT_CACHE] JL_GLOBALLY_ROOTED;
+
+static unsigned subtype_cache_idx(jl_value_t *x, jl_value_t *y) JL_NOTSAFEPOINT
+{
+    uintptr_t h = inthash((uintptr_t)x ^ ((uintptr_t)y >> 3));
+    return (unsigned)(h & (N_SUBTYPE_CACHE - 1));
+}
+
+// returns the memoized answer for the pair, or -1 if not cached
+static int type_pair_memo_lookup(jl_subtype_cache_entry_t *table, jl_value_t *x, jl_value_t *y) JL_NOTSAFEPOINT
+{
+    jl_subtype_cache_entry_t *entry = &table[subtype_cache_idx(x, y)];
+    uint32_t ver = jl_atomic_load_acquire(&entry->ver);
+    if (ver & 1)
+        return -1; // a writer owns the slot
+    jl_value_t *a = jl_atomic_load_relaxed(&entry->a);
+    jl_value_t *b = jl_atomic_load_relaxed(&entry->b);
+    int result = jl_atomic_load_relaxed(&entry->result);
+    jl_fence(); // order the field reads before the recheck
+    if (jl_atomic_load_relaxed(&entry->ver) != ver)
+        return -1; // raced with a writer
+    if (a != x || b != y)
+        return -1;
+    return result;
+}
+
+static void type_pair_memo_insert(jl_subtype_cache_entry_t *table, jl_value_t *x, jl_value_t *y, int result) JL_NOTSAFEPOINT
+{
+    jl_subtype_cache_entry_t *entry = &table[subtype_cache_idx(x, y)];
+    uint32_t ver = jl_atomic_load_relaxed(&entry->ver);
+    // claim the slot; insertion is best-effort, so losing the race just
+    // drops this result. The cmpswap must acquire so that the field stores
+    // below cannot be reordered before the claim becomes visible (a reader
+    // could otherwise see an even `ver` paired with a half-updated entry).
+    if ((ver & 1) || !jl_atomic_cmpswap(&entry->ver, &ver, ver + 1))
+        return;
+    jl_atomic_store_relaxed(&entry->a, x);
+    jl_atomic_store_relaxed(&entry->b, y);
+    jl_atomic_store_relaxed(&entry->result, (uint8_t)result);
+    jl_atomic_store_release(&entry->ver, ver + 2);
+}
+
 // `env` is NULL if no typevar information is requested, or otherwise
 // points to a rooted array of length `jl_subtype_env_size(y)`.
 // This will be populated with the values of variables from unionall
@@ -1962,13 +2016,20 @@ JL_DLLEXPORT int jl_subtype_env(jl_value_t *x, jl_value_t *y, jl_value_t **env,
         }
         return 1;
     }
+    int memoize = envsz == 0 && !jl_has_free_typevars(x) && !jl_has_free_typevars(y);
+    if (memoize) {
+        int memo = type_pair_memo_lookup(jl_subtype_cache, x, y);
+        if (memo >= 0)
+            return memo;
+    }
     int obvious_subtype = 2;
     if (jl_obvious_subtype(x, y, &obvious_subtype)) {
 #ifdef NDEBUG
-        if (obvious_subtype == 0)
-            return obvious_subtype;
-        else if (envsz == 0)
+        if (obvious_subtype == 0 || envsz == 0) {
+            if (memoize)
+                type_pair_memo_insert(jl_subtype_cache, x, y, obvious_subtype);
             return obvious_subtype;
+        }
 #endif
     }
     else {
@@ -1991,6 +2052,8 @@ JL_DLLEXPORT int jl_subtype_env(jl_value_t *x, jl_value_t *y, jl_value_t **env,
             ub = (jl_unionall_t*)ub->body;
         }
     }
+    if (memoize)
+        type_pair_memo_insert(jl_subtype_cache, x, y, subtype);
     return subtype;
 }
 
@@ -2218,6 +2281,67 @@ JL_DLLEXPORT int jl_isa(jl_value_t *x, jl_value_t *t)
     return jl_subtype(jl_typeof(x), t);
 }
 
+// collect the components of `t` as concrete hash-cached datatypes, so that
+// membership can be decided by type-tag identity; returns the number of
+// components collected, or 0 if `t` has any component that cannot be
+// handled that way
+#define JL_ISA_MANY_MAX_TAGS 8
+static size_t isa_concrete_tags(jl_value_t *t, jl_value_t **tags, size_t ntags)
+{
+    if (jl_is_uniontype(t)) {
+        size_t na = isa_concrete_tags(((jl_uniontype_t*)t)->a, tags, ntags);
+        if (na == 0)
+            return 0;
+        return isa_concrete_tags(((jl_uniontype_t*)t)->b, tags, na);
+    }
+    if (ntags == JL_ISA_MANY_MAX_TAGS)
+        return 0;
+    if (!jl_is_concrete_type(t) || jl_is_kind(t) ||
+        !((jl_datatype_t*)t)->cached_by_hash ||
+        ((jl_datatype_t*)t)->name == jl_type_typename)
+        return 0;
+    tags[ntags] = t;
+    return ntags + 1;
+}
+
+// Bulk isa over `n` values: checks values[i] against `t` and returns the
+// index of the first value that fails (`n` if all pass). The target type is
+// decomposed once, outside the loop: a concrete target, or a union of
+// concrete targets, reduces each element check to a handful of type-tag
+// comparisons instead of a full jl_isa call per element.
+JL_DLLEXPORT size_t jl_isa_many(jl_value_t **values, size_t n, jl_value_t *t)
+{
+    size_t i;
+    if (t == (jl_value_t*)jl_any_type)
+        return n;
+    jl_value_t *tags[JL_ISA_MANY_MAX_TAGS];
+    size_t ntags = isa_concrete_tags(t, tags, 0);
+    if (ntags == 0) {
+        for (i = 0; i < n; i++) {
+            if (!jl_isa(values[i], t))
+                break;
+        }
+        return i;
+    }
+    for (i = 0; i < n; i++) {
+        jl_value_t *tag = jl_typeof(values[i]);
+        size_t j;
+        for (j = 0; j < ntags; j++) {
+            if (tag == tags[j])
+                break;
+        }
+        if (j == ntags) {
+            // no tag matched; since every target is hash-cached, type
+            // equality is identity for any tag that is also hash-cached,
+            // making the mismatch definitive (same test as jl_isa)
+            if (!((jl_datatype_t*)tag)->cached_by_hash && jl_isa(values[i], t))
+                continue;
+            break;
+        }
+    }
+    return i;
+}
+
 // type intersection
 
 static jl_value_t *intersect(jl_value_t *x, jl_value_t *y, jl_stenv_t *e, int param);
@@ -3731,7 +3855,7 @@ static int might_intersect_concrete(jl_value_t *a)
 }
 
 // sets *issubty to 1 iff `a` is a subtype of `b`
-jl_value_t *jl_type_intersection_env_s(jl_value_t *a, jl_value_t *b, jl_svec_t **penv, int *issubty)
+static jl_value_t *type_intersection_env_s(jl_value_t *a, jl_value_t *b, jl_svec_t **penv, int *issubty)
 {
     if (issubty) *issubty = 0;
     if (obviously_disjoint(a, b, 0)) {
@@ -3823,6 +3947,73 @@ jl_value_t *jl_type_intersection_env_s(jl_value_t *a, jl_value_t *b, jl_svec_t *
     return *ans;
 }
 
+// Memoized wrapper around the worker above, using the same bounded seqlock
+// table design as the subtype memo. Method signatures and cached tuple types
+// are unique objects, so the alpha-equivalent queries that match analysis
+// repeats for one call site are also pointer-identical; keying on identity
+// captures them without a canonicalizing traversal of every query. Entries
+// record the result, the subtype flag and (when it was requested) the env,
+// so a hit can serve either flavor of caller; a hit whose entry lacks a
+// stored env falls through, recomputes and upgrades the slot.
+static unsigned intersect_cache_idx(jl_value_t *x, jl_value_t *y) JL_NOTSAFEPOINT
+{
+    uintptr_t h = inthash((uintptr_t)x ^ ((uintptr_t)y >> 3));
+    return (unsigned)(h & (N_INTERSECT_CACHE - 1));
+}
+
+jl_value_t *jl_type_intersection_env_s(jl_value_t *a, jl_value_t *b, jl_svec_t **penv, int *issubty)
+{
+    int memoize = !jl_has_free_typevars(a) && !jl_has_free_typevars(b);
+    if (memoize) {
+        jl_intersect_cache_entry_t *entry = &jl_intersect_cache[intersect_cache_idx(a, b)];
+        uint32_t ver = jl_atomic_load_acquire(&entry->ver);
+        if (!(ver & 1)) {
+            jl_value_t *ea = jl_atomic_load_relaxed(&entry->a);
+            jl_value_t *eb = jl_atomic_load_relaxed(&entry->b);
+            jl_value_t *ti = jl_atomic_load_relaxed(&entry->ti);
+            jl_svec_t *env = jl_atomic_load_relaxed(&entry->env);
+            int sub = jl_atomic_load_relaxed(&entry->issubty);
+            int has_env = jl_atomic_load_relaxed(&entry->has_env);
+            jl_fence(); // order the field reads before the recheck
+            if (jl_atomic_load_relaxed(&entry->ver) == ver && ea == a && eb == b &&
+                (penv == NULL || ti == jl_bottom_type || has_env)) {
+                if (issubty)
+                    *issubty = sub;
+                if (penv && ti != jl_bottom_type)
+                    *penv = env;
+                return ti;
+            }
+        }
+    }
+    int sub = 0;
+    jl_svec_t *env = NULL;
+    jl_value_t *ti = NULL;
+    JL_GC_PUSH2(&env, &ti);
+    ti = type_intersection_env_s(a, b, penv ? &env : NULL, &sub);
+    if (issubty)
+        *issubty = sub;
+    if (penv && ti != jl_bottom_type)
+        *penv = env;
+    if (memoize) {
+        jl_intersect_cache_entry_t *entry = &jl_intersect_cache[intersect_cache_idx(a, b)];
+        uint32_t ver = jl_atomic_load_relaxed(&entry->ver);
+        // claim the slot; insertion is best-effort, so losing the race just
+        // drops this result. As in type_pair_memo_insert, the cmpswap must
+        // acquire so the field stores cannot be reordered before the claim.
+        if (!(ver & 1) && jl_atomic_cmpswap(&entry->ver, &ver, ver + 1)) {
+            jl_atomic_store_relaxed(&entry->a, a);
+            jl_atomic_store_relaxed(&entry->b, b);
+            jl_atomic_store_relaxed(&entry->ti, ti);
+            jl_atomic_store_relaxed(&entry->env, penv ? env : NULL);
+            jl_atomic_store_relaxed(&entry->issubty, (uint8_t)sub);
+            jl_atomic_store_relaxed(&entry->has_env, (uint8_t)(penv != NULL));
+            jl_atomic_store_release(&entry->ver, ver + 2);
+        }
+    }
+    JL_GC_POP();
+    return ti;
+}
+
 jl_value_t *jl_type_intersection_env(jl_value_t *a, jl_value_t *b, jl_svec_t **penv)
 {
     return jl_type_intersection_env_s(a, b, penv, NULL);
@@ -4305,11 +4496,21 @@ JL_DLLEXPORT int jl_type_morespecific(jl_value_t *a, jl_value_t *b)
         return 0;
     if (jl_has_free_typevars(a) || jl_has_free_typevars(b))
         return 0;
+    // sorted insertion into a large method table compares each new signature
+    // against most of the existing ones, revisiting the same pairs on every
+    // insertion, so this is worth memoizing just like subtyping
+    int memo = type_pair_memo_lookup(jl_morespecific_cache, a, b);
+    if (memo >= 0)
+        return memo;
+    int result;
     if (jl_subtype(b, a))
-        return 0;
-    if (jl_subtype(a, b))
-        return 1;
-    return type_morespecific_(a, b, 0, NULL);
+        result = 0;
+    else if (jl_subtype(a, b))
+        result = 1;
+    else
+        result = type_morespecific_(a, b, 0, NULL);
+    type_pair_memo_insert(jl_morespecific_cache, a, b, result);
+    return result;
 }
 
 JL_DLLEXPORT int jl_type_morespecific_no_subtype(jl_value_t *a, jl_value_t *b)
@@ -56,6 +56,116 @@ uint32_t bitvector_get(uint32_t *b, uint64_t n)
     return b[n>>5] & (1<<(n&31));
 }
 
+STATIC_INLINE uint32_t bit_count_32(uint32_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcount(x);
+#else
+    x = x - ((x >> 1) & 0x55555555);
+    x = (x & 0x33333333) + ((x >> 2) & 0x33333333);
+    x = (x + (x >> 4)) & 0x0f0f0f0f;
+    return (x * 0x01010101) >> 24;
+#endif
+}
+
+STATIC_INLINE uint32_t bit_trailing_zeros_32(uint32_t x)  // x != 0
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(x);
+#else
+    uint32_t c = 31;
+    x &= -(int32_t)x;
+    if (x & 0x0000ffff) c -= 16;
+    if (x & 0x00ff00ff) c -= 8;
+    if (x & 0x0f0f0f0f) c -= 4;
+    if (x & 0x33333333) c -= 2;
+    if (x & 0x55555555) c -= 1;
+    return c;
+#endif
+}
+
+// index of the first set bit in [n0, n), or n if there is none
+uint64_t bitvector_next(uint32_t *b, uint64_t n0, uint64_t n)
+{
+    if (n0 >= n)
+        return n;
+    uint64_t i = n0 >> 5;
+    uint64_t nw = (n + 31) >> 5;
+    uint32_t w = b[i] & (~(uint32_t)0 << (n0 & 31));
+    while (!w) {
+        if (++i >= nw)
+            return n;
+        w = b[i];
+    }
+    uint64_t bit = (i << 5) + bit_trailing_zeros_32(w);
+    return bit < n ? bit : n;
+}
+
+// number of set bits in [offs, offs+nbits)
+uint64_t bitvector_count(uint32_t *b, uint64_t offs, uint64_t nbits)
+{
+    if (nbits == 0)
+        return 0;
+    uint64_t i = offs >> 5;
+    uint64_t lastbit = offs + nbits - 1;
+    uint64_t lastw = lastbit >> 5;
+    uint32_t mask = ~(uint32_t)0 << (offs & 31);
+    if (i == lastw) {
+        mask &= ~(uint32_t)0 >> (31 - (lastbit & 31));
+        return bit_count_32(b[i] & mask);
+    }
+    uint64_t c = bit_count_32(b[i] & mask);
+    for (i++; i < lastw; i++)
+        c += bit_count_32(b[i]);
+    return c + bit_count_32(b[lastw] & (~(uint32_t)0 >> (31 - (lastbit & 31))));
+}
+
+// Bulk logical kernels. These are plain word loops on purpose: the bodies
+// have no loop-carried dependencies, so the compiler vectorizes them to the
+// widest integer ops the target has (AVX2/NEON), and they run at memory
+// bandwidth without any hand-written intrinsics to maintain per-arch.
+// `dest` may alias either input. Bits past `nbits` in the last word hold
+// whatever the inputs had there, matching `bitvector_resize`.
+void bitvector_and(uint32_t *dest, const uint32_t *a, const uint32_t *b, uint64_t nbits)
+{
+    size_t i, nw = bitvector_nwords(nbits);
+    for (i = 0; i < nw; i++)
+        dest[i] = a[i] & b[i];
+}
+
+void bitvector_or(uint32_t *dest, const uint32_t *a, const uint32_t *b, uint64_t nbits)
+{
+    size_t i, nw = bitvector_nwords(nbits);
+    for (i = 0; i < nw; i++)
+        dest[i] = a[i] | b[i];
+}
+
+void bitvector_xor(uint32_t *dest, const uint32_t *a, const uint32_t *b, uint64_t nbits)
+{
+    size_t i, nw = bitvector_nwords(nbits);
+    for (i = 0; i < nw; i++)
+        dest[i] = a[i] ^ b[i];
+}
+
+// a & ~b, the usual way to subtract one bit set from another
+void bitvector_andnot(uint32_t *dest, const uint32_t *a, const uint32_t *b, uint64_t nbits)
+{
+    size_t i, nw = bitvector_nwords(nbits);
+    for (i = 0; i < nw; i++)
+        dest[i] = a[i] & ~b[i];
+}
+
+// the complement would set the bits past `nbits`, so mask the last word to
+// keep them clear for consumers that count or scan whole words
+void bitvector_not(uint32_t *dest, const uint32_t *a, uint64_t nbits)
+{
+    size_t i, nw = bitvector_nwords(nbits);
+    for (i = 0; i < nw; i++)
+        dest[i] = ~a[i];
+    if (nbits & 31)
+        dest[nw-1] &= ~(uint32_t)0 >> (32 - (nbits & 31));
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -15,6 +15,16 @@ size_t bitvector_nwords(uint64_t nbits);
 JL_DLLEXPORT void bitvector_set(uint32_t *b, uint64_t n, uint32_t c);
 JL_DLLEXPORT uint32_t bitvector_get(uint32_t *b, uint64_t n);
 
+// word-at-a-time scan and count
+JL_DLLEXPORT uint64_t bitvector_next(uint32_t *b, uint64_t n0, uint64_t n);
+JL_DLLEXPORT uint64_t bitvector_count(uint32_t *b, uint64_t offs, uint64_t nbits);
+// bulk logical kernels; `dest` may alias either input
+JL_DLLEXPORT void bitvector_and(uint32_t *dest, const uint32_t *a, const uint32_t *b, uint64_t nbits);
+JL_DLLEXPORT void bitvector_or(uint32_t *dest, const uint32_t *a, const uint32_t *b, uint64_t nbits);
+JL_DLLEXPORT void bitvector_xor(uint32_t *dest, const uint32_t *a, const uint32_t *b, uint64_t nbits);
+JL_DLLEXPORT void bitvector_andnot(uint32_t *dest, const uint32_t *a, const uint32_t *b, uint64_t nbits);
+JL_DLLEXPORT void bitvector_not(uint32_t *dest, const uint32_t *a, uint64_t nbits);
+
 #ifdef __cplusplus
 }
 #endif
@@ -29,13 +29,15 @@ htable_t *htable_new(htable_t *h, size_t size)
         size *= 2;  // 2 pointers per key/value pair
         size *= 2;  // aim for 50% occupancy
         h->size = size;
-        h->table = (void**)LLT_ALLOC(size * sizeof(void*));
+        h->table = (void**)LLT_ALLOC(size * sizeof(void*) + ht_ctrl_bytes(size));
     }
     if (h->table == NULL)
         return NULL;
     size_t i;
     for (i = 0; i < size; i++)
         h->table[i] = HT_NOTFOUND;
+    if (h->table != &h->_space[0])
+        memset(ht_ctrl(h->table, size), HT_CTRL_EMPTY, ht_ctrl_bytes(size));
     return h;
 }
 
@@ -59,6 +61,8 @@ void htable_reset(htable_t *h, size_t sz)
         size_t i, hsz = h->size;
         for (i = 0; i < hsz; i++)
             h->table[i] = HT_NOTFOUND;
+        if (h->table != &h->_space[0])
+            memset(ht_ctrl(h->table, hsz), HT_CTRL_EMPTY, ht_ctrl_bytes(hsz));
     }
 }
 
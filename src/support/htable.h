@@ -30,6 +30,18 @@ typedef struct {
 // define this to be an invalid key/value
 #define HT_NOTFOUND ((void*)1)
 
+// Every heap-allocated table block reserves one control byte per slot (plus
+// one group of wraparound mirror bytes) after the key/value region, for
+// implementations generated with HTIMPL_SWISS: EMPTY, or the low 7 bits of
+// the key's hash for occupied slots, probed a group at a time. Tables living
+// in `_space` carry no control bytes and are probed linearly. A given table
+// must only ever be accessed through one HTIMPL instantiation; plain HTIMPL
+// implementations leave the control bytes untouched.
+#define HT_GROUP_SIZE 16
+#define HT_CTRL_EMPTY 0x80
+#define ht_ctrl(tab, size) ((unsigned char*)&(tab)[size])
+#define ht_ctrl_bytes(size) ((size)/2 + HT_GROUP_SIZE)
+
 // initialize hash table, reserving space for `size` expected number of
 // elements. (Expect `h->size > size` for efficient occupancy factor.)
 htable_t *htable_new(htable_t *h, size_t size) JL_NOTSAFEPOINT;
@@ -1028,6 +1028,14 @@ ios_t *ios_static_buffer(ios_t *s, char *buf, size_t sz)
     return s;
 }
 
+ios_t *ios_own_buffer(ios_t *s, char *buf, size_t sz, size_t maxsz)
+{
+    ios_mem(s, 0);
+    ios_setbuf(s, buf, maxsz, 1);
+    s->size = sz;
+    return s;
+}
+
 ios_t *ios_fd(ios_t *s, long fd, int isfile, int own)
 {
     _ios_init(s);
@@ -119,6 +119,10 @@ JL_DLLEXPORT ios_t *ios_mkstemp(ios_t *f, char *fname);
 JL_DLLEXPORT ios_t *ios_mem(ios_t *s, size_t initsize) JL_NOTSAFEPOINT;
 ios_t *ios_str(ios_t *s, char *str);
 ios_t *ios_static_buffer(ios_t *s, char *buf, size_t sz);
+// as ios_static_buffer, but writable, with `sz` valid bytes in a malloc'd
+// buffer of `maxsz` bytes whose ownership moves to the stream: writes past
+// the end grow it in place and ios_take_buffer releases it without copying
+ios_t *ios_own_buffer(ios_t *s, char *buf, size_t sz, size_t maxsz);
 JL_DLLEXPORT ios_t *ios_fd(ios_t *s, long fd, int isfile, int own);
 // todo: ios_socket
 extern JL_DLLEXPORT ios_t *ios_stdin;
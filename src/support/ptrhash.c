@@ -23,7 +23,7 @@
 extern "C" {
 #endif
 
-HTIMPL(ptrhash, inthash, OP_EQ)
+HTIMPL_SWISS(ptrhash, inthash, OP_EQ)
 
 #ifdef __cplusplus
 }
@@ -220,15 +220,40 @@ size_t u8_offset(const char *s, size_t charnum)
     return i;
 }
 
+/* skip over ASCII-only bytes, a word at a time */
+static const unsigned char *u8_scan_ascii(const unsigned char *pnt, const unsigned char *pend)
+{
+    while (pnt + sizeof(uint64_t) <= pend) {
+        uint64_t w;
+        memcpy(&w, pnt, sizeof(uint64_t));
+        if (w & UINT64_C(0x8080808080808080))
+            break;
+        pnt += sizeof(uint64_t);
+    }
+    while (pnt < pend && !(*pnt & 0x80))
+        pnt++;
+    return pnt;
+}
+
 /* byte offset => charnum */
 size_t u8_charnum(const char *s, size_t offset)
 {
     size_t charnum = 0;
+    // Simply not count continuation bytes (of the form 10xxxxxx)
+    // Since we are not doing validation anyway, we can just
+    // assume this is a valid UTF-8 string
+    while (offset >= sizeof(uint64_t)) {
+        // count the non-continuation bytes a word at a time: per byte,
+        // flag = ~bit7 | bit6, then sum the flags horizontally
+        uint64_t w;
+        memcpy(&w, s, sizeof(uint64_t));
+        uint64_t flags = ((~w >> 7) | (w >> 6)) & UINT64_C(0x0101010101010101);
+        charnum += (flags * UINT64_C(0x0101010101010101)) >> 56;
+        s += sizeof(uint64_t);
+        offset -= sizeof(uint64_t);
+    }
     if (offset) {
        do {
-          // Simply not count continuation bytes
-          // Since we are not doing validation anyway, we can just
-          // assume this is a valid UTF-8 string
           charnum += ((*(unsigned char *)s++ & 0xc0) != 0x80);
        } while (--offset);
     }
@@ -550,10 +575,10 @@ int u8_isvalid(const char *str, size_t len)
     pnt = (unsigned char *)str;
     pend = (unsigned char *)str + len;
     // First scan for non-ASCII characters as fast as possible
-    do {
-        if (*pnt++ & 0x80) goto chkutf8;
-    } while (pnt < pend);
-    return 1;
+    pnt = u8_scan_ascii(pnt, pend);
+    if (pnt == pend)
+        return 1;
+    pnt++;
 
     // Check validity of UTF-8 sequences
 chkutf8:
@@ -590,8 +615,10 @@ chkutf8:
         pnt += 3;
     }
     // Find next non-ASCII characters as fast as possible
-    while (pnt < pend) {
-        if (*pnt++ & 0x80) goto chkutf8;
+    pnt = u8_scan_ascii(pnt, pend);
+    if (pnt < pend) {
+        pnt++;
+        goto chkutf8;
     }
     return 2;   // Valid UTF-8
 }
@@ -17,6 +17,13 @@ extern "C" {
 
 static _Atomic(jl_sym_t*) symtab = NULL;
 
+// Direct-mapped cache in front of the tree, indexed by hash. Interning is
+// dominated by re-interning of recently seen names (field names, keyword
+// names), which can skip the tree walk entirely on a cache hit. Symbols are
+// permanently allocated, so a stale entry is always safe to inspect.
+#define SYMCACHE_LEN 1024 // power of two
+static _Atomic(jl_sym_t*) symcache[SYMCACHE_LEN];
+
 #define MAX_SYM_LEN ((size_t)INTPTR_MAX - sizeof(jl_taggedvalue_t) - sizeof(jl_sym_t) - 1)
 
 static uintptr_t hash_symbol(const char *str, size_t len) JL_NOTSAFEPOINT
@@ -31,7 +38,7 @@ static size_t symbol_nbytes(size_t len) JL_NOTSAFEPOINT
     return (sizeof(jl_taggedvalue_t) + sizeof(jl_sym_t) + len + 1 + 7) & -8;
 }
 
-static jl_sym_t *mk_symbol(const char *str, size_t len) JL_NOTSAFEPOINT
+static jl_sym_t *mk_symbol(const char *str, size_t len, uintptr_t h) JL_NOTSAFEPOINT
 {
     jl_sym_t *sym;
     size_t nb = symbol_nbytes(len);
@@ -43,16 +50,21 @@ static jl_sym_t *mk_symbol(const char *str, size_t len) JL_NOTSAFEPOINT
     tag->header = ((uintptr_t)jl_symbol_type) | GC_OLD_MARKED;
     jl_atomic_store_relaxed(&sym->left, NULL);
     jl_atomic_store_relaxed(&sym->right, NULL);
-    sym->hash = hash_symbol(str, len);
+    sym->hash = h;
     memcpy(jl_symbol_name(sym), str, len);
     jl_symbol_name(sym)[len] = 0;
     return sym;
 }
 
-static jl_sym_t *symtab_lookup(_Atomic(jl_sym_t*) *ptree, const char *str, size_t len, _Atomic(jl_sym_t*) **slot) JL_NOTSAFEPOINT
+static int sym_name_matches(jl_sym_t *sym, const char *str, size_t len) JL_NOTSAFEPOINT
+{
+    return strncmp(str, jl_symbol_name(sym), len) == 0 && jl_symbol_name(sym)[len] == 0;
+}
+
+static jl_sym_t *symtab_lookup(_Atomic(jl_sym_t*) *ptree, const char *str, size_t len,
+                               uintptr_t h, _Atomic(jl_sym_t*) **slot) JL_NOTSAFEPOINT
 {
     jl_sym_t *node = jl_atomic_load_relaxed(ptree); // consume
-    uintptr_t h = hash_symbol(str, len);
 
     // Tree nodes sorted by major key of (int(hash)) and minor key of (str).
     while (node != NULL) {
@@ -85,19 +97,24 @@ jl_sym_t *_jl_symbol(const char *str, size_t len) JL_NOTSAFEPOINT // (or throw)
         jl_exceptionf(jl_argumenterror_type, "Symbol name too long");
 #endif
     assert(!memchr(str, 0, len));
+    uintptr_t h = hash_symbol(str, len);
+    _Atomic(jl_sym_t*) *cache = &symcache[h & (SYMCACHE_LEN - 1)];
+    jl_sym_t *node = jl_atomic_load_relaxed(cache); // consume
+    if (node != NULL && node->hash == h && sym_name_matches(node, str, len))
+        return node;
     _Atomic(jl_sym_t*) *slot;
-    jl_sym_t *node = symtab_lookup(&symtab, str, len, &slot);
+    node = symtab_lookup(&symtab, str, len, h, &slot);
     if (node == NULL) {
         uv_mutex_lock(&gc_perm_lock);
         // Someone might have updated it, check and look up again
-        if (jl_atomic_load_relaxed(slot) != NULL && (node = symtab_lookup(slot, str, len, &slot))) {
-            uv_mutex_unlock(&gc_perm_lock);
-            return node;
+        if (jl_atomic_load_relaxed(slot) == NULL ||
+            (node = symtab_lookup(slot, str, len, h, &slot)) == NULL) {
+            node = mk_symbol(str, len, h);
+            jl_atomic_store_release(slot, node);
         }
-        node = mk_symbol(str, len);
-        jl_atomic_store_release(slot, node);
         uv_mutex_unlock(&gc_perm_lock);
     }
+    jl_atomic_store_release(cache, node);
     return node;
 }
 
@@ -108,7 +125,8 @@ JL_DLLEXPORT jl_sym_t *jl_symbol(const char *str) JL_NOTSAFEPOINT // (or throw)
 
 JL_DLLEXPORT jl_sym_t *jl_symbol_lookup(const char *str) JL_NOTSAFEPOINT
 {
-    return symtab_lookup(&symtab, str, strlen(str), NULL);
+    size_t len = strlen(str);
+    return symtab_lookup(&symtab, str, len, hash_symbol(str, len), NULL);
 }
 
 JL_DLLEXPORT jl_sym_t *jl_symbol_n(const char *str, size_t len)
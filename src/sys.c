@@ -258,6 +258,32 @@ JL_DLLEXPORT jl_array_t *jl_take_buffer(ios_t *s)
     return a;
 }
 
+// Hand the contents of `a` to the stream `s` (the reverse of `jl_take_buffer`),
+// leaving `s` a writable in-memory stream positioned at the start of the data.
+// When `a` owns a plain malloc'd buffer, ownership moves to the stream and no
+// bytes are copied, so the data can also come back out through
+// `jl_take_buffer` copy-free; otherwise the contents are copied. Either way
+// the array contents must not be accessed again by the caller.
+JL_DLLEXPORT void jl_give_buffer(ios_t *s, jl_array_t *a)
+{
+    assert(jl_is_array(a) && jl_array_ndims(a) == 1 && a->elsize == 1);
+    size_t n = jl_array_len(a);
+    if (a->flags.how == 2 && !a->flags.isaligned && !a->flags.isshared &&
+        a->offset == 0) {
+        // the buffer came from plain malloc, so the stream allocator can
+        // resize and free it
+        ios_own_buffer(s, (char*)a->data, n, a->maxsize);
+        // the data pointer stays valid, but the GC no longer frees it
+        a->flags.how = 0;
+        a->flags.isshared = 1;
+    }
+    else {
+        ios_mem(s, n);
+        ios_write(s, (char*)a->data, n);
+        ios_seek(s, 0);
+    }
+}
+
 // str: if 1 return a string, otherwise return a Vector{UInt8}
 // chomp:
 //   0 - keep delimiter
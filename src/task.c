@@ -215,10 +215,15 @@ static void NOINLINE save_stack(jl_ptls_t ptls, jl_task_t *lastt, jl_task_t **pt
     size_t nb = stackbase - frame_addr;
     void *buf;
     if (lastt->bufsz < nb) {
+        // round the buffer up to a whole number of pages, so that a task
+        // yielding from a slightly different depth each time settles into
+        // one buffer instead of reallocating (a GC safepoint) on the
+        // switch path
+        size_t bufsz = LLT_ALIGN(nb, jl_page_size);
         asan_free_copy_stack(lastt->stkbuf, lastt->bufsz);
-        buf = (void*)jl_gc_alloc_buf(ptls, nb);
+        buf = (void*)jl_gc_alloc_buf(ptls, bufsz);
         lastt->stkbuf = buf;
-        lastt->bufsz = nb;
+        lastt->bufsz = bufsz;
     }
     else {
         buf = lastt->stkbuf;
@@ -410,7 +415,10 @@ JL_DLLEXPORT void jl_active_task_stack(jl_task_t *task,
 NOINLINE static void record_backtrace(jl_ptls_t ptls, int skip) JL_NOTSAFEPOINT
 {
     // storing bt_size in ptls ensures roots in bt_data will be found
-    ptls->bt_size = rec_backtrace(ptls->bt_data, JL_MAX_BT_SIZE, skip + 1);
+    if (jl_error_fp_backtrace())
+        ptls->bt_size = rec_backtrace_fp(ptls->bt_data, JL_MAX_BT_SIZE, skip + 1);
+    else
+        ptls->bt_size = rec_backtrace(ptls->bt_data, JL_MAX_BT_SIZE, skip + 1);
 }
 
 JL_DLLEXPORT void jl_set_next_task(jl_task_t *task) JL_NOTSAFEPOINT
@@ -450,6 +458,18 @@ JL_NO_ASAN static void ctx_switch(jl_task_t *lastt)
 #endif
 
     int killed = jl_atomic_load_relaxed(&lastt->_state) != JL_TASK_STATE_RUNNABLE;
+    // per-task allocation accounting: close the outgoing task's window and
+    // open the incoming one's (the counter rebase at GC is handled in
+    // reset_thread_gc_counts). A finished task rolls its total up into its
+    // creator here, at the last switch it will ever make.
+    int64_t allocd = jl_atomic_load_relaxed(&ptls->gc_num.allocd);
+    int64_t total = jl_atomic_fetch_add_relaxed(&lastt->alloc_bytes, allocd - lastt->alloc_base) +
+        (allocd - lastt->alloc_base);
+    t->alloc_base = allocd;
+    if (killed && lastt->parent_task) {
+        jl_atomic_fetch_add_relaxed(&lastt->parent_task->alloc_bytes, total);
+        lastt->parent_task = NULL;
+    }
     if (!t->started && !t->copy_stack) {
         // may need to allocate the stack
         if (t->stkbuf == NULL) {
@@ -630,13 +650,17 @@ JL_DLLEXPORT void jl_switch(void) JL_NOTSAFEPOINT_LEAVE JL_NOTSAFEPOINT_ENTER
         return;
     }
     int8_t gc_state = jl_gc_unsafe_enter(ptls);
-    if (t->started && t->stkbuf == NULL)
-        jl_error("attempt to switch to exited task");
-    if (ptls->in_finalizer)
-        jl_error("task switch not allowed from inside gc finalizer");
-    if (ptls->in_pure_callback)
+    // merge the rare refusal conditions into one predicted-not-taken branch;
+    // the slow path re-derives which condition fired
+    if (__unlikely(ptls->in_finalizer | ptls->in_pure_callback |
+                   (t->started && t->stkbuf == NULL))) {
+        if (t->started && t->stkbuf == NULL)
+            jl_error("attempt to switch to exited task");
+        if (ptls->in_finalizer)
+            jl_error("task switch not allowed from inside gc finalizer");
         jl_error("task switch not allowed from inside staged nor pure functions");
-    if (!jl_set_task_tid(t, jl_atomic_load_relaxed(&ct->tid))) // manually yielding to a task
+    }
+    if (__unlikely(!jl_set_task_tid(t, jl_atomic_load_relaxed(&ct->tid)))) // manually yielding to a task
         jl_error("cannot switch to task running on another thread");
 
     JL_PROBE_RT_PAUSE_TASK(ct);
@@ -682,9 +706,13 @@ JL_DLLEXPORT void jl_switch(void) JL_NOTSAFEPOINT_LEAVE JL_NOTSAFEPOINT_ENTER
     (void)ct;
 #endif
 
+    // the deferred-signal check must stay at the switch for correctness (a
+    // signal deferred by the resumed task has to fire as soon as we restore
+    // a non-deferring state), but in the common no-signal case it is a
+    // single predicted-not-taken branch on state already in cache
     sig_atomic_t other_defer_signal = ptls->defer_signal;
     ptls->defer_signal = defer_signal;
-    if (other_defer_signal && !defer_signal)
+    if (__unlikely(other_defer_signal && !defer_signal))
         jl_sigint_safepoint(ptls);
 
     JL_PROBE_RT_RUN_TASK(ct);
@@ -866,28 +894,38 @@ uint64_t jl_genrandom(uint64_t rngState[4]) JL_NOTSAFEPOINT
     return res;
 }
 
-void jl_rng_split(uint64_t to[4], uint64_t from[4]) JL_NOTSAFEPOINT
+void jl_rng_split(uint64_t to[JL_RNG_SIZE], uint64_t from[JL_RNG_SIZE]) JL_NOTSAFEPOINT
 {
-    /* TODO: consider a less ad-hoc construction
-       Ideally we could just use the output of the random stream to seed the initial
-       state of the child. Out of an overabundance of caution we multiply with
-       effectively random coefficients, to break possible self-interactions.
-
-       It is not the goal to mix bits -- we work under the assumption that the
-       source is well-seeded, and its output looks effectively random.
-       However, xoshiro has never been studied in the mode where we seed the
-       initial state with the output of another xoshiro instance.
-
-       Constants have nothing up their sleeve:
+    /* The child's xoshiro words are derived from an internal splitmix-style
+       counter (the fifth state word) rather than from draws on the parent's
+       output stream: forking a task leaves the parent's visible stream
+       untouched and costs only a few integer operations per word. The
+       counter advances through a full-period LCG, so each child observes a
+       distinct value even when a task spawns many children without drawing
+       any random numbers itself.
+
+       It is not the goal to mix bits -- we work under the assumption that
+       the source is well-seeded, and run the combined counter/state words
+       through a splitmix64-style finalizer to decorrelate them.
+
+       The multiplier is a spectrally good one for 64-bit LCGs from
+       Steele & Vigna (2021), arXiv:2001.05304; the per-word constants are
+       carried over from the previous construction:
        0x02011ce34bce797f == hash(UInt(1))|0x01
        0x5a94851fb48a6e05 == hash(UInt(2))|0x01
        0x3688cf5d48899fa7 == hash(UInt(3))|0x01
        0x867b4bb4c42e5661 == hash(UInt(4))|0x01
     */
-    to[0] = 0x02011ce34bce797f * jl_genrandom(from);
-    to[1] = 0x5a94851fb48a6e05 * jl_genrandom(from);
-    to[2] = 0x3688cf5d48899fa7 * jl_genrandom(from);
-    to[3] = 0x867b4bb4c42e5661 * jl_genrandom(from);
+    static const uint64_t c[4] = {0x02011ce34bce797f, 0x5a94851fb48a6e05,
+                                  0x3688cf5d48899fa7, 0x867b4bb4c42e5661};
+    uint64_t x = from[4];
+    from[4] = to[4] = x * 0xd1342543de82ef95 + 1;
+    for (int i = 0; i < 4; i++) {
+        uint64_t z = (x + from[i]) * c[i];
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        to[i] = z ^ (z >> 31);
+    }
 }
 
 JL_DLLEXPORT jl_task_t *jl_new_task(jl_function_t *start, jl_value_t *completion_future, size_t ssize)
@@ -908,13 +946,14 @@ JL_DLLEXPORT jl_task_t *jl_new_task(jl_function_t *start, jl_value_t *completion
         t->stkbuf = NULL;
     }
     else {
-        // user requested dedicated stack of a certain size
+        // user requested dedicated stack of a certain size; allocation is
+        // deferred to the first switch (ctx_switch), just like the default
+        // path, so tasks that never run never touch the stack pools (if the
+        // allocation fails there, the task falls back to stack copying)
         if (ssize < MINSTKSZ)
             ssize = MINSTKSZ;
         t->bufsz = ssize;
-        t->stkbuf = jl_alloc_fiber(&t->ctx.ctx, &t->bufsz, t);
-        if (t->stkbuf == NULL)
-            jl_throw(jl_memory_exception);
+        t->stkbuf = NULL;
     }
     t->next = jl_nothing;
     t->queue = jl_nothing;
@@ -942,6 +981,9 @@ JL_DLLEXPORT jl_task_t *jl_new_task(jl_function_t *start, jl_value_t *completion
     t->reentrant_timing = 0;
     t->reentrant_inference = 0;
     t->inference_start_time = 0;
+    jl_atomic_store_relaxed(&t->alloc_bytes, 0);
+    t->alloc_base = 0;
+    t->parent_task = ct;
 
 #ifdef COPY_STACKS
     if (!t->copy_stack) {
@@ -1085,7 +1127,7 @@ CFI_NORETURN
     }
     else {
         JL_TRY {
-            if (ptls->defer_signal) {
+            if (__unlikely(ptls->defer_signal)) {
                 ptls->defer_signal = 0;
                 jl_sigint_safepoint(ptls);
             }
@@ -1530,6 +1572,9 @@ jl_task_t *jl_init_root_task(jl_ptls_t ptls, void *stack_lo, void *stack_hi)
     ct->reentrant_timing = 0;
     ct->reentrant_inference = 0;
     ct->inference_start_time = 0;
+    jl_atomic_store_relaxed(&ct->alloc_bytes, 0);
+    ct->alloc_base = jl_atomic_load_relaxed(&ptls->gc_num.allocd);
+    ct->parent_task = NULL;
     ptls->root_task = ct;
     jl_atomic_store_relaxed(&ptls->current_task, ct);
     JL_GC_PROMISE_ROOTED(ct);
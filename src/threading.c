@@ -309,6 +309,7 @@ void jl_pgcstack_getkey(jl_get_pgcstack_func **f, jl_pgcstack_key_t *k)
 static uv_mutex_t tls_lock; // controls write-access to these variables:
 _Atomic(jl_ptls_t*) jl_all_tls_states JL_GLOBALLY_ROOTED;
 int jl_all_tls_states_size;
+int jl_n_gcthreads;
 static uv_cond_t cond;
 
 // return calling thread's ID
@@ -339,7 +340,19 @@ jl_ptls_t jl_init_threadtls(int16_t tid)
 #endif
     if (jl_get_pgcstack() != NULL)
         abort();
-    jl_ptls_t ptls = (jl_ptls_t)calloc(1, sizeof(jl_tls_states_t));
+    // allocated cache-aligned (the struct requests it for the contended
+    // fields, and it also keeps neighboring threads' states off shared lines)
+#ifdef _OS_WINDOWS_
+    jl_ptls_t ptls = (jl_ptls_t)_aligned_malloc(sizeof(jl_tls_states_t), JL_CACHE_BYTE_ALIGNMENT);
+    if (ptls == NULL)
+        abort();
+#else
+    void *ptls_buf = NULL;
+    if (posix_memalign(&ptls_buf, JL_CACHE_BYTE_ALIGNMENT, sizeof(jl_tls_states_t)))
+        abort();
+    jl_ptls_t ptls = (jl_ptls_t)ptls_buf;
+#endif
+    memset(ptls, 0, sizeof(jl_tls_states_t));
 #ifndef _OS_WINDOWS_
     pthread_setspecific(jl_task_exit_key, (void*)ptls);
 #endif
@@ -371,6 +384,22 @@ jl_ptls_t jl_init_threadtls(int16_t tid)
         malloc_s(sizeof(jl_bt_element_t) * (JL_MAX_BT_SIZE + 1));
     memset(bt_data, 0, sizeof(jl_bt_element_t) * (JL_MAX_BT_SIZE + 1));
     ptls->bt_data = bt_data;
+    // pre-commit the emergency exception arena (see jl_push_excstack); the
+    // memset both zeroes it and faults the pages in up front
+    size_t estksz = sizeof(jl_excstack_t) +
+        sizeof(jl_bt_element_t) * JL_EMERGENCY_EXCSTACK_SIZE;
+    jl_excstack_t *estk = (jl_excstack_t*)malloc_s(estksz);
+    memset(estk, 0, estksz);
+    estk->reserved_size = JL_EMERGENCY_EXCSTACK_SIZE;
+    // records the owning thread, so releasing the arena can clear the claim
+    // flag even if the holding task migrated to another thread meanwhile
+    estk->preallocated = (size_t)(uintptr_t)ptls;
+    ptls->emergency_excstack = estk;
+#ifdef ENABLE_TIMINGS
+    // only slots below the published head are ever read, no need to zero
+    ptls->timing_events = (jl_timing_event_t*)
+        malloc_s(sizeof(jl_timing_event_t) * JL_TIMING_EVENT_RING_SIZE);
+#endif
     small_arraylist_new(&ptls->locks, 0);
     jl_init_thread_heap(ptls);
 
@@ -399,13 +428,87 @@ jl_ptls_t jl_init_threadtls(int16_t tid)
     jl_fence();
     uv_mutex_unlock(&tls_lock);
 
+    // must come after the thread is visible in jl_all_tls_states, so that a
+    // concurrently assigned counter page cannot be missed (see coverage.cpp)
+    if (jl_options.code_coverage != JL_LOG_NONE)
+        jl_coverage_init_thread(ptls);
+
+    return ptls;
+}
+
+// TLS blocks of exited threads, parked for re-adoption (opt-in via
+// JULIA_ADOPT_TLS_CACHE). An exited thread's ptls is never freed -- it keeps
+// its slot in jl_all_tls_states so the GC and profiler can still walk it --
+// so a host that adopts and releases threads per callback pays the full
+// jl_init_threadtls cost (heap, pools, backtrace buffers) on every adoption
+// and grows jl_n_threads without bound. Reviving a parked block instead
+// reuses both the initialized heap and the tid slot. Guarded by tls_lock.
+static arraylist_t retired_tls_states;
+static int retired_tls_states_init = 0;
+
+static int jl_tls_reuse_enabled(void) JL_NOTSAFEPOINT
+{
+    static int enabled = -1;
+    if (enabled == -1)
+        enabled = getenv("JULIA_ADOPT_TLS_CACHE") != NULL;
+    return enabled;
+}
+
+static void jl_retire_threadtls(jl_ptls_t ptls) JL_NOTSAFEPOINT
+{
+    uv_mutex_lock(&tls_lock);
+    if (!retired_tls_states_init) {
+        arraylist_new(&retired_tls_states, 0);
+        retired_tls_states_init = 1;
+    }
+    arraylist_push(&retired_tls_states, (void*)ptls);
+    uv_mutex_unlock(&tls_lock);
+}
+
+static jl_ptls_t jl_reclaim_threadtls(void) JL_NOTSAFEPOINT
+{
+    jl_thread_t self = (jl_thread_t)(uintptr_t)uv_thread_self();
+    jl_ptls_t ptls = NULL;
+    uv_mutex_lock(&tls_lock);
+    if (retired_tls_states_init && retired_tls_states.len > 0) {
+        // prefer the block this OS thread identity retired earlier (thread
+        // pools commonly hand back the same pthread), else take any
+        size_t pick = retired_tls_states.len - 1;
+        for (size_t i = 0; i < retired_tls_states.len; i++) {
+            if (((jl_ptls_t)retired_tls_states.items[i])->system_id == self) {
+                pick = i;
+                break;
+            }
+        }
+        ptls = (jl_ptls_t)retired_tls_states.items[pick];
+        retired_tls_states.items[pick] =
+            retired_tls_states.items[retired_tls_states.len - 1];
+        retired_tls_states.len--;
+    }
+    uv_mutex_unlock(&tls_lock);
+    if (ptls == NULL)
+        return NULL;
+#ifndef _OS_WINDOWS_
+    pthread_setspecific(jl_task_exit_key, (void*)ptls);
+#endif
+    ptls->system_id = self;
+    ptls->rngseed = jl_rand();
+    jl_atomic_store_relaxed(&ptls->sleep_check_state, 0);
+    // the block parked in a GC-safe region; it stays there until the caller
+    // transitions to unsafe, exactly like a freshly initialized one
     return ptls;
 }
 
 JL_DLLEXPORT jl_gcframe_t **jl_adopt_thread(void) JL_NOTSAFEPOINT_LEAVE
 {
-    // initialize this thread (assign tid, create heap, set up root task)
-    jl_ptls_t ptls = jl_init_threadtls(-1);
+    // revive a retired TLS block when one is parked (a few loads plus the
+    // state transition below), else initialize this thread from scratch
+    // (assign tid, create heap, set up root task)
+    jl_ptls_t ptls = NULL;
+    if (jl_tls_reuse_enabled())
+        ptls = jl_reclaim_threadtls();
+    if (ptls == NULL)
+        ptls = jl_init_threadtls(-1);
     void *stack_lo, *stack_hi;
     jl_init_stack_limits(0, &stack_lo, &stack_hi);
 
@@ -472,6 +575,11 @@ static void jl_delete_thread(void *value) JL_NOTSAFEPOINT_ENTER
 #endif
     // then park in safe-region
     (void)jl_gc_safe_enter(ptls);
+    // once parked, this thread touches the block no further, so it is safe to
+    // hand it to a future jl_adopt_thread (the main thread's block keeps its
+    // special safepoint page and disable_gc setting and is never recycled)
+    if (jl_tls_reuse_enabled() && ptls->tid != 0)
+        jl_retire_threadtls(ptls);
 }
 
 //// debugging hack: if we are exiting too fast for error message printing on threads,
@@ -585,6 +693,8 @@ static void jl_check_tls(void)
 JL_DLLEXPORT const int jl_tls_elf_support = 0;
 #endif
 
+extern jl_mutex_t jl_modules_mutex;
+
 // interface to Julia; sets up to make the runtime thread-safe
 void jl_init_threading(void)
 {
@@ -596,6 +706,14 @@ void jl_init_threading(void)
     jl_check_tls();
 #endif
 
+    if ((cp = getenv("JULIA_LOCK_PROFILE")) && strcmp(cp, "0") != 0)
+        jl_atomic_store_relaxed(&jl_lock_profile_enabled, 1);
+    // pre-register the well-known global locks so the profile is readable
+    jl_lock_profile_name(&jl_codegen_lock, "codegen");
+    jl_lock_profile_name(&jl_uv_mutex, "uv");
+    jl_lock_profile_name(&typecache_lock, "typecache");
+    jl_lock_profile_name(&jl_modules_mutex, "modules");
+
     // Determine how many threads and pools are requested. This may have been
     // specified on the command line (and so are in `jl_options`) or by the
     // environment variable. Set the globals `jl_n_threadpools`, `jl_n_threads`
@@ -647,11 +765,26 @@ void jl_init_threading(void)
 
     jl_atomic_store_release(&jl_all_tls_states, (jl_ptls_t*)calloc(jl_all_tls_states_size, sizeof(jl_ptls_t)));
     jl_atomic_store_release(&jl_n_threads, jl_all_tls_states_size);
+
+    // how many threads the GC may use for its parallel phases, independent
+    // of the mutator thread count; the workers are created by the GC for the
+    // duration of a collection, so this only records the requested size
+    int ngcthreads = jl_options.ngcthreads;
+    if (ngcthreads < 0) // --gcthreads=auto
+        ngcthreads = jl_effective_threads();
+    jl_n_gcthreads = ngcthreads;
 }
 
 static uv_barrier_t thread_init_done;
-
-void jl_start_threads(void)
+// Gate between spawning the worker OS threads and letting them touch the
+// runtime. Spawning is cheap to overlap with the sysimage restore, but a
+// worker's own initialization allocates its heap and root task and so has to
+// wait until the runtime is ready; workers park here until
+// jl_release_threads opens the gate.
+static uv_barrier_t thread_start_gate;
+static int threads_spawned = 0;
+
+void jl_spawn_threads(void)
 {
     int nthreads = jl_atomic_load_relaxed(&jl_n_threads);
     int cpumasksize = uv_cpumask_size();
@@ -684,12 +817,14 @@ void jl_start_threads(void)
     }
 
     // create threads
+    uv_barrier_init(&thread_start_gate, nthreads);
     uv_barrier_init(&thread_init_done, nthreads);
 
     for (i = 1; i < nthreads; ++i) {
         jl_threadarg_t *t = (jl_threadarg_t *)malloc_s(sizeof(jl_threadarg_t)); // ownership will be passed to the thread
         t->tid = i;
         t->barrier = &thread_init_done;
+        t->start_gate = &thread_start_gate;
         uv_thread_create(&uvtid, jl_threadfun, t);
         if (exclusive) {
             mask[i] = 1;
@@ -698,10 +833,23 @@ void jl_start_threads(void)
         }
         uv_thread_detach(&uvtid);
     }
+    threads_spawned = 1;
+}
 
+void jl_release_threads(void)
+{
+    if (!threads_spawned)
+        jl_spawn_threads();
+    uv_barrier_wait(&thread_start_gate);
     uv_barrier_wait(&thread_init_done);
 }
 
+void jl_start_threads(void)
+{
+    jl_spawn_threads();
+    jl_release_threads();
+}
+
 _Atomic(unsigned) _threadedregion; // HACK: keep track of whether to prioritize IO or threading
 
 JL_DLLEXPORT int jl_in_threaded_region(void)
@@ -727,6 +875,96 @@ JL_DLLEXPORT void jl_exit_threaded_region(void)
     }
 }
 
+// Lock contention profiling
+// Activated by jl_lock_profile_enable (jlapi.c) or JULIA_LOCK_PROFILE=1.
+// Contended jl_mutex_t acquisitions record their wait time into a global
+// insert-only table keyed by lock address, probed and updated with relaxed
+// atomics so recording never blocks. Uncontended acquisitions never reach
+// the enable-flag test, and contended ones only test it once per wait.
+
+#define LOCK_PROFILE_SLOTS 256 // power of two
+
+typedef struct {
+    _Atomic(void*) lock;
+    _Atomic(const char*) name;
+    _Atomic(uint64_t) ncontended;
+    _Atomic(uint64_t) total_wait_ns;
+    _Atomic(uint64_t) hist[JL_LOCK_PROFILE_NBUCKETS];
+} lock_profile_slot_t;
+
+static lock_profile_slot_t lock_profile[LOCK_PROFILE_SLOTS];
+_Atomic(int) jl_lock_profile_enabled;
+
+static lock_profile_slot_t *lock_profile_slot(jl_mutex_t *lock) JL_NOTSAFEPOINT
+{
+    uint64_t hv = (uint64_t)(uintptr_t)lock * 0x9e3779b97f4a7c15ULL;
+    size_t index = (size_t)(hv >> 32) & (LOCK_PROFILE_SLOTS - 1);
+    size_t i;
+    for (i = 0; i < LOCK_PROFILE_SLOTS; i++) {
+        lock_profile_slot_t *s = &lock_profile[index];
+        void *k = jl_atomic_load_relaxed(&s->lock);
+        if (k == NULL && jl_atomic_cmpswap(&s->lock, &k, (void*)lock))
+            return s;
+        if (k == (void*)lock)
+            return s;
+        index = (index + 1) & (LOCK_PROFILE_SLOTS - 1);
+    }
+    return NULL; // table full; drop the sample
+}
+
+void jl_lock_profile_name(jl_mutex_t *lock, const char *name)
+{
+    lock_profile_slot_t *s = lock_profile_slot(lock);
+    if (s != NULL)
+        jl_atomic_store_relaxed(&s->name, name);
+}
+
+static void lock_profile_record(jl_mutex_t *lock, uint64_t wait_ns) JL_NOTSAFEPOINT
+{
+    lock_profile_slot_t *s = lock_profile_slot(lock);
+    if (s == NULL)
+        return;
+    jl_atomic_fetch_add_relaxed(&s->ncontended, 1);
+    jl_atomic_fetch_add_relaxed(&s->total_wait_ns, wait_ns);
+    // bucket b counts waits in [2^b, 2^(b+1)) microseconds
+    uint64_t us = wait_ns / 1000;
+    int b = 0;
+    while (us > 1 && b < JL_LOCK_PROFILE_NBUCKETS - 1) {
+        us >>= 1;
+        b++;
+    }
+    jl_atomic_fetch_add_relaxed(&s->hist[b], 1);
+}
+
+int jl_lock_profile_read(int i, const char **name, void **lock,
+                         uint64_t *ncontended, uint64_t *total_wait_ns, uint64_t *hist)
+{
+    if (i < 0 || i >= LOCK_PROFILE_SLOTS)
+        return -1;
+    lock_profile_slot_t *s = &lock_profile[i];
+    void *k = jl_atomic_load_relaxed(&s->lock);
+    if (k == NULL)
+        return 0;
+    *name = jl_atomic_load_relaxed(&s->name);
+    *lock = k;
+    *ncontended = jl_atomic_load_relaxed(&s->ncontended);
+    *total_wait_ns = jl_atomic_load_relaxed(&s->total_wait_ns);
+    for (int b = 0; b < JL_LOCK_PROFILE_NBUCKETS; b++)
+        hist[b] = jl_atomic_load_relaxed(&s->hist[b]);
+    return 1;
+}
+
+void jl_lock_profile_reset(void)
+{
+    for (size_t i = 0; i < LOCK_PROFILE_SLOTS; i++) {
+        lock_profile_slot_t *s = &lock_profile[i];
+        jl_atomic_store_relaxed(&s->ncontended, 0);
+        jl_atomic_store_relaxed(&s->total_wait_ns, 0);
+        for (int b = 0; b < JL_LOCK_PROFILE_NBUCKETS; b++)
+            jl_atomic_store_relaxed(&s->hist[b], 0);
+    }
+}
+
 void _jl_mutex_wait(jl_task_t *self, jl_mutex_t *lock, int safepoint)
 {
     jl_task_t *owner = jl_atomic_load_relaxed(&lock->owner);
@@ -734,11 +972,16 @@ void _jl_mutex_wait(jl_task_t *self, jl_mutex_t *lock, int safepoint)
         lock->count++;
         return;
     }
+    uint64_t t0 = 0;
     while (1) {
         if (owner == NULL && jl_atomic_cmpswap(&lock->owner, &owner, self)) {
             lock->count = 1;
+            if (t0 != 0)
+                lock_profile_record(lock, jl_hrtime() - t0);
             return;
         }
+        if (t0 == 0 && jl_atomic_load_relaxed(&jl_lock_profile_enabled))
+            t0 = jl_hrtime();
         if (safepoint) {
             jl_gc_safepoint_(self->ptls);
         }
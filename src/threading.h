@@ -17,6 +17,7 @@ extern _Atomic(jl_ptls_t*) jl_all_tls_states JL_GLOBALLY_ROOTED; /* thread local
 typedef struct _jl_threadarg_t {
     int16_t tid;
     uv_barrier_t *barrier;
+    uv_barrier_t *start_gate;
     void *arg;
 } jl_threadarg_t;
 
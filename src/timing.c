@@ -3,6 +3,7 @@
 #include <inttypes.h>
 #include "julia.h"
 #include "julia_internal.h"
+#include "threading.h"
 #include "options.h"
 #include "stdio.h"
 
@@ -18,6 +19,7 @@ extern "C" {
 #endif
 
 static uint64_t t0;
+JL_DLLEXPORT _Atomic(uint64_t) jl_timing_enable_mask = ~(uint64_t)0;
 JL_DLLEXPORT uint64_t jl_timing_data[(int)JL_TIMING_LAST] = {0};
 const char *jl_timing_names[(int)JL_TIMING_LAST] =
     {
@@ -41,9 +43,78 @@ void jl_print_timings(void)
     }
 }
 
+// Binary zone trace: while a window is open (jl_timing_trace_start),
+// every completed zone appends one fixed-size record to the trace file
+// under `timing_trace_lock`. Zone exits are rare enough (inference,
+// codegen, package loads) that a mutex plus buffered fwrite costs
+// nothing measurable, and nothing is paid at all outside a window.
+static uv_mutex_t timing_trace_lock;
+static FILE *timing_trace_file = NULL;
+JL_DLLEXPORT _Atomic(int) jl_timing_trace_on = 0;
+
+JL_DLLEXPORT int jl_timing_trace_start(const char *path)
+{
+    uv_mutex_lock(&timing_trace_lock);
+    if (timing_trace_file != NULL) {
+        // a window is already open
+        uv_mutex_unlock(&timing_trace_lock);
+        return -1;
+    }
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) {
+        uv_mutex_unlock(&timing_trace_lock);
+        return -1;
+    }
+    // header: magic, version, owner name table (see timing.h)
+    uint32_t version = 1;
+    uint32_t nowners = (uint32_t)JL_TIMING_LAST;
+    fwrite("JLTZ", 1, 4, f);
+    fwrite(&version, sizeof(version), 1, f);
+    fwrite(&nowners, sizeof(nowners), 1, f);
+    for (uint32_t i = 0; i < nowners; i++) {
+        const char *name = jl_timing_names[i];
+        uint8_t len = (uint8_t)strlen(name);
+        fwrite(&len, 1, 1, f);
+        fwrite(name, 1, len, f);
+    }
+    timing_trace_file = f;
+    uv_mutex_unlock(&timing_trace_lock);
+    jl_atomic_store_release(&jl_timing_trace_on, 1);
+    return 0;
+}
+
+JL_DLLEXPORT void jl_timing_trace_stop(void)
+{
+    jl_atomic_store_release(&jl_timing_trace_on, 0);
+    uv_mutex_lock(&timing_trace_lock);
+    if (timing_trace_file != NULL) {
+        fclose(timing_trace_file);
+        timing_trace_file = NULL;
+    }
+    uv_mutex_unlock(&timing_trace_lock);
+}
+
+void jl_timing_trace_record(int owner, uint16_t depth, uint64_t t_enter,
+                            uint64_t t_exit, int16_t tid)
+{
+    jl_timing_trace_record_t rec;
+    rec.t_enter = t_enter;
+    rec.t_exit = t_exit;
+    rec.owner = (uint16_t)owner;
+    rec.tid = tid;
+    rec.depth = depth;
+    rec._unused = 0;
+    uv_mutex_lock(&timing_trace_lock);
+    // the window may have been closed since the caller's check
+    if (timing_trace_file != NULL)
+        fwrite(&rec, sizeof(rec), 1, timing_trace_file);
+    uv_mutex_unlock(&timing_trace_lock);
+}
+
 void jl_init_timing(void)
 {
     t0 = cycleclock();
+    uv_mutex_init(&timing_trace_lock);
 }
 
 void jl_destroy_timing(void)
@@ -72,11 +143,110 @@ void jl_timing_block_stop(jl_timing_block_t *cur_block)
     _jl_timing_block_stop(cur_block, cycleclock());
 }
 
+JL_DLLEXPORT void jl_timing_enable(int owner, int enable)
+{
+    if (owner < 0) {
+        jl_atomic_store_relaxed(&jl_timing_enable_mask, enable ? ~(uint64_t)0 : 0);
+        return;
+    }
+    if (owner >= (int)JL_TIMING_LAST)
+        return;
+    uint64_t bit = ((uint64_t)1) << owner;
+    if (enable)
+        jl_atomic_fetch_or_relaxed(&jl_timing_enable_mask, bit);
+    else
+        jl_atomic_fetch_and_relaxed(&jl_timing_enable_mask, ~bit);
+}
+
+JL_DLLEXPORT int jl_timing_enabled(int owner)
+{
+    if (owner < 0 || owner >= (int)JL_TIMING_LAST)
+        return 0;
+    return (jl_atomic_load_relaxed(&jl_timing_enable_mask) >> owner) & 1;
+}
+
+// Copy events recorded by thread `tid` with sequence number at least
+// `*cursor` into `events` (oldest first) and advance `*cursor` past the
+// last event copied. Start with `*cursor == 0` and keep one cursor per
+// scraped thread; events are lost (skipped, never duplicated or torn)
+// when the reader falls more than JL_TIMING_EVENT_RING_SIZE behind.
+JL_DLLEXPORT size_t jl_timing_read_events(int16_t tid, uint64_t *cursor,
+                                          jl_timing_event_t *events, size_t nevents)
+{
+    if (tid < 0 || tid >= jl_atomic_load_acquire(&jl_n_threads))
+        return 0;
+    jl_ptls_t ptls2 = jl_atomic_load_relaxed(&jl_all_tls_states)[tid];
+    if (ptls2 == NULL || ptls2->timing_events == NULL)
+        return 0;
+    uint64_t head = jl_atomic_load_acquire(&ptls2->timing_events_head);
+    uint64_t first = *cursor;
+    if (first >= head)
+        return 0;
+    if (head - first > JL_TIMING_EVENT_RING_SIZE)
+        first = head - JL_TIMING_EVENT_RING_SIZE;
+    uint64_t n = head - first;
+    if (n > nevents)
+        n = nevents;
+    for (uint64_t i = 0; i < n; i++)
+        events[i] = ptls2->timing_events[(first + i) & (JL_TIMING_EVENT_RING_SIZE - 1)];
+    // The writer may have wrapped around into the copied range; anything
+    // it can have been touching since we read `head` is suspect, so drop
+    // events up to (and including) the slot the next event will land in.
+    uint64_t head2 = jl_atomic_load_acquire(&ptls2->timing_events_head);
+    if (head2 + 1 > JL_TIMING_EVENT_RING_SIZE) {
+        uint64_t oldest = head2 + 1 - JL_TIMING_EVENT_RING_SIZE;
+        if (oldest > first) {
+            uint64_t drop = oldest - first;
+            if (drop >= n) {
+                *cursor = first + n;
+                return 0;
+            }
+            memmove(events, events + drop, (size_t)(n - drop) * sizeof(jl_timing_event_t));
+            first += drop;
+            n -= drop;
+        }
+    }
+    *cursor = first + n;
+    return (size_t)n;
+}
+
 #else
 
 void jl_init_timing(void) { }
 void jl_destroy_timing(void) { }
 
+JL_DLLEXPORT void jl_timing_enable(int owner, int enable)
+{
+    (void)owner;
+    (void)enable;
+}
+
+JL_DLLEXPORT int jl_timing_enabled(int owner)
+{
+    (void)owner;
+    return 0;
+}
+
+JL_DLLEXPORT size_t jl_timing_read_events(int16_t tid, uint64_t *cursor,
+                                          jl_timing_event_t *events, size_t nevents)
+{
+    (void)tid;
+    (void)cursor;
+    (void)events;
+    (void)nevents;
+    return 0;
+}
+
+JL_DLLEXPORT int jl_timing_trace_start(const char *path)
+{
+    (void)path;
+    return -1;
+}
+
+JL_DLLEXPORT void jl_timing_trace_stop(void)
+{
+}
+
 #endif
 
 #ifdef __cplusplus
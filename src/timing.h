@@ -8,6 +8,47 @@ extern "C" {
 #endif
 void jl_init_timing(void);
 void jl_destroy_timing(void) JL_NOTSAFEPOINT;
+
+// A completed timing zone, as recorded in the per-thread event ring.
+// `t` is the `cycleclock()` value at the moment the zone was left,
+// `duration` the exclusive cycles spent in it (time in nested zones is
+// attributed to those zones).
+typedef struct _jl_timing_event_t {
+    uint64_t t;
+    uint64_t duration;
+    uint16_t owner; // enum jl_timing_owners
+    int16_t tid;
+    uint16_t depth; // nesting depth of the zone (0 = outermost)
+    uint16_t _unused;
+} jl_timing_event_t;
+
+// One record of the binary zone trace (see jl_timing_trace_start).
+// `t_enter`/`t_exit` are the inclusive `cycleclock()` bounds of the zone;
+// records of one thread appear in exit order, so a record's parent is the
+// next later record of the same tid with a smaller depth.
+typedef struct _jl_timing_trace_record_t {
+    uint64_t t_enter;
+    uint64_t t_exit;
+    uint16_t owner; // enum jl_timing_owners
+    int16_t tid;
+    uint16_t depth;
+    uint16_t _unused;
+} jl_timing_trace_record_t;
+
+// Runtime control and export for the timing zones. These are always
+// callable; without ENABLE_TIMINGS no events are ever produced.
+JL_DLLEXPORT void jl_timing_enable(int owner, int enable) JL_NOTSAFEPOINT;
+JL_DLLEXPORT int jl_timing_enabled(int owner) JL_NOTSAFEPOINT;
+JL_DLLEXPORT size_t jl_timing_read_events(int16_t tid, uint64_t *cursor,
+                                          jl_timing_event_t *events,
+                                          size_t nevents) JL_NOTSAFEPOINT;
+// Open (close) a bounded tracing window during which every completed zone
+// appends one jl_timing_trace_record_t to the file at `path`. The file
+// starts with a header: "JLTZ", uint32 version (1), uint32 nowners, then
+// nowners length-prefixed (uint8) owner names, followed by fixed-size
+// records until EOF — enough to render a per-thread flamegraph directly.
+JL_DLLEXPORT int jl_timing_trace_start(const char *path);
+JL_DLLEXPORT void jl_timing_trace_stop(void);
 #ifdef __cplusplus
 }
 #endif
@@ -77,11 +118,29 @@ enum jl_timing_owners {
 extern uint64_t jl_timing_data[(int)JL_TIMING_LAST];
 extern const char *jl_timing_names[(int)JL_TIMING_LAST];
 
+// Bit i enables accounting and event recording for owner i (all owners fit
+// in 64 bits). Toggled at runtime via `jl_timing_enable`; the block stack
+// discipline is maintained regardless so zones may straddle a toggle.
+extern JL_DLLEXPORT _Atomic(uint64_t) jl_timing_enable_mask;
+
+// Capacity (a power of two) of each thread's event ring. The ring is
+// written only by its own thread; readers scrape it with
+// `jl_timing_read_events` and lose the oldest events when they fall more
+// than a full ring behind.
+#define JL_TIMING_EVENT_RING_SIZE 4096
+
+// Nonzero while a trace window is open (jl_timing_trace_start).
+extern JL_DLLEXPORT _Atomic(int) jl_timing_trace_on;
+void jl_timing_trace_record(int owner, uint16_t depth, uint64_t t_enter,
+                            uint64_t t_exit, int16_t tid) JL_NOTSAFEPOINT;
+
 struct _jl_timing_block_t { // typedef in julia.h
     jl_timing_block_t *prev;
     uint64_t total;
     uint64_t t0;
+    uint64_t t_enter;
     int owner;
+    uint16_t depth;
 #ifdef JL_DEBUG_BUILD
     uint8_t running;
 #endif
@@ -107,6 +166,8 @@ STATIC_INLINE uint64_t _jl_timing_block_init(jl_timing_block_t *block, int owner
     uint64_t t = cycleclock();
     block->owner = owner;
     block->total = 0;
+    block->t_enter = t;
+    block->depth = 0;
 #ifdef JL_DEBUG_BUILD
     block->running = 0;
 #endif
@@ -119,8 +180,10 @@ STATIC_INLINE void _jl_timing_block_ctor(jl_timing_block_t *block, int owner) JL
     jl_task_t *ct = jl_current_task;
     jl_timing_block_t **prevp = &ct->ptls->timing_stack;
     block->prev = *prevp;
-    if (block->prev)
+    if (block->prev) {
         _jl_timing_block_stop(block->prev, t);
+        block->depth = block->prev->depth + 1;
+    }
     *prevp = block;
 }
 
@@ -128,7 +191,25 @@ STATIC_INLINE void _jl_timing_block_destroy(jl_timing_block_t *block) JL_NOTSAFE
     uint64_t t = cycleclock();
     jl_task_t *ct = jl_current_task;
     _jl_timing_block_stop(block, t);
-    jl_timing_data[block->owner] += block->total;
+    if (jl_atomic_load_relaxed(&jl_timing_enable_mask) & (((uint64_t)1) << block->owner)) {
+        jl_timing_data[block->owner] += block->total;
+        jl_ptls_t ptls = ct->ptls;
+        if (jl_atomic_load_relaxed(&jl_timing_trace_on))
+            jl_timing_trace_record(block->owner, block->depth, block->t_enter, t, ptls->tid);
+        jl_timing_event_t *ring = ptls->timing_events;
+        if (ring) {
+            uint64_t head = jl_atomic_load_relaxed(&ptls->timing_events_head);
+            jl_timing_event_t *ev = &ring[head & (JL_TIMING_EVENT_RING_SIZE - 1)];
+            ev->t = t;
+            ev->duration = block->total;
+            ev->owner = (uint16_t)block->owner;
+            ev->tid = ptls->tid;
+            ev->depth = block->depth;
+            ev->_unused = 0;
+            // publish the event before the new head becomes visible
+            jl_atomic_store_release(&ptls->timing_events_head, head + 1);
+        }
+    }
     jl_timing_block_t **pcur = &ct->ptls->timing_stack;
     assert(*pcur == block);
     *pcur = block->prev;
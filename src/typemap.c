@@ -439,6 +439,8 @@ static int jl_typemap_intersection_node_visitor(jl_typemap_entry_t *ml, struct t
     // that can be absolutely critical for speed
     register jl_typemap_intersection_visitor_fptr fptr = closure->fptr;
     while (ml != (void*)jl_nothing) {
+        if (closure->budget && --closure->budget == 0)
+            return 0; // cancellation point: the query exceeded its work budget
         if (closure->type == (jl_value_t*)ml->sig) {
             // fast-path for the intersection of a type with itself
             if (closure->env)
@@ -82,13 +82,30 @@ function _prof_expr(expr, opts)
 end
 
 """
-    Profile.Allocs.start(sample_rate::Real)
+    Profile.Allocs.start(; sample_rate::Real)
+    Profile.Allocs.start(; sample_interval::Integer)
 
 Begin recording allocations with the given sample rate
 A sample rate of 1.0 will record everything; 0.0 will record nothing.
+
+Alternatively, pass `sample_interval` to sample by allocated bytes instead:
+roughly one allocation is recorded per `sample_interval` bytes allocated.
+This bounds the profiling overhead by allocation volume rather than
+allocation count, making it suitable for always-on use.
+
+!!! compat "Julia 1.10"
+    `sample_interval` requires at least Julia 1.10.
 """
-function start(; sample_rate::Real)
-    ccall(:jl_start_alloc_profile, Cvoid, (Cdouble,), Float64(sample_rate))
+function start(; sample_rate::Union{Real,Nothing}=nothing,
+                 sample_interval::Union{Integer,Nothing}=nothing)
+    if (sample_rate === nothing) == (sample_interval === nothing)
+        throw(ArgumentError("pass exactly one of `sample_rate` and `sample_interval`"))
+    end
+    if sample_interval !== nothing
+        ccall(:jl_start_alloc_profile_sampled, Cvoid, (UInt64,), UInt64(sample_interval))
+    else
+        ccall(:jl_start_alloc_profile, Cvoid, (Cdouble,), Float64(sample_rate))
+    end
 end
 
 """
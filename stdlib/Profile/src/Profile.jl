@@ -1240,9 +1240,9 @@ end
 
 
 """
-    Profile.take_heap_snapshot(io::IOStream, all_one::Bool=false)
-    Profile.take_heap_snapshot(filepath::String, all_one::Bool=false)
-    Profile.take_heap_snapshot(all_one::Bool=false)
+    Profile.take_heap_snapshot(io::IOStream, all_one::Bool=false; incremental::Bool=false)
+    Profile.take_heap_snapshot(filepath::String, all_one::Bool=false; incremental::Bool=false)
+    Profile.take_heap_snapshot(all_one::Bool=false; incremental::Bool=false)
 
 Write a snapshot of the heap, in the JSON format expected by the Chrome
 Devtools Heap Snapshot viewer (.heapsnapshot extension), to a file
@@ -1250,19 +1250,28 @@ Devtools Heap Snapshot viewer (.heapsnapshot extension), to a file
 file path, or IO stream. If `all_one` is true, then report the size of
 every object as one so they can be easily counted. Otherwise, report the
 actual size.
+
+If `incremental` is true, only the portion of the heap allocated or mutated
+since the last collection (as tracked by the generational write barrier) is
+walked and recorded, producing a diff-style snapshot whose pause scales with
+the young generation instead of the whole heap.
 """
-function take_heap_snapshot(io::IOStream, all_one::Bool=false)
-    Base.@_lock_ios(io, ccall(:jl_gc_take_heap_snapshot, Cvoid, (Ptr{Cvoid}, Cchar), io.handle, Cchar(all_one)))
+function take_heap_snapshot(io::IOStream, all_one::Bool=false; incremental::Bool=false)
+    if incremental
+        Base.@_lock_ios(io, ccall(:jl_gc_take_incremental_heap_snapshot, Cvoid, (Ptr{Cvoid}, Cchar), io.handle, Cchar(all_one)))
+    else
+        Base.@_lock_ios(io, ccall(:jl_gc_take_heap_snapshot, Cvoid, (Ptr{Cvoid}, Cchar), io.handle, Cchar(all_one)))
+    end
 end
-function take_heap_snapshot(filepath::String, all_one::Bool=false)
+function take_heap_snapshot(filepath::String, all_one::Bool=false; incremental::Bool=false)
     open(filepath, "w") do io
-        take_heap_snapshot(io, all_one)
+        take_heap_snapshot(io, all_one; incremental)
     end
     return filepath
 end
-function take_heap_snapshot(all_one::Bool=false)
+function take_heap_snapshot(all_one::Bool=false; incremental::Bool=false)
     f = abspath("$(getpid())_$(time_ns()).heapsnapshot")
-    return take_heap_snapshot(f, all_one)
+    return take_heap_snapshot(f, all_one; incremental)
 end
 
 
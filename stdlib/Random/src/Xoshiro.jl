@@ -96,8 +96,10 @@ end
     TaskLocalRNG
 
 The `TaskLocalRNG` has state that is local to its task, not its thread.
-It is seeded upon task creation, from the state of its parent task.
-Therefore, task creation is an event that changes the parent's RNG state.
+It is seeded upon task creation, from an internal counter carried alongside
+the state of its parent task. Task creation therefore does not advance the
+parent's visible random stream, and is cheap for tasks that never draw
+random numbers.
 
 As an upside, the `TaskLocalRNG` is pretty fast, and permits reproducible
 multithreaded simulations (barring race conditions), independent of scheduler
@@ -113,12 +115,17 @@ struct TaskLocalRNG <: AbstractRNG end
 TaskLocalRNG(::Nothing) = TaskLocalRNG()
 rng_native_52(::TaskLocalRNG) = UInt64
 
-function setstate!(x::TaskLocalRNG, s0::UInt64, s1::UInt64, s2::UInt64, s3::UInt64)
+function setstate!(x::TaskLocalRNG, s0::UInt64, s1::UInt64, s2::UInt64, s3::UInt64,
+                   # also reset the internal splitmix word which seeds the states of
+                   # child tasks (see jl_rng_split in src/task.c), so that spawn
+                   # sequences are reproducible after seeding
+                   s4::UInt64 = 0x0000000000000001)
     t = current_task()
     t.rngState0 = s0
     t.rngState1 = s1
     t.rngState2 = s2
     t.rngState3 = s3
+    t.rngState4 = s4
     x
 end
 
@@ -177,8 +184,7 @@ function copy(rng::TaskLocalRNG)
 end
 
 function copy!(dst::TaskLocalRNG, src::Xoshiro)
-    t = current_task()
-    t.rngState0, t.rngState1, t.rngState2, t.rngState3 = src.s0, src.s1, src.s2, src.s3
+    setstate!(dst, src.s0, src.s1, src.s2, src.s3)
     dst
 end
 
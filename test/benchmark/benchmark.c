@@ -0,0 +1,169 @@
+// This file is a part of Julia. License is MIT: https://julialang.org/license
+
+// Microbenchmark suite for runtime primitives, run via `make benchmark` (or
+// `make -C test benchmark`). Each benchmark times a hot runtime entry point
+// in isolation through the embedding API and reports nanoseconds per
+// iteration as one JSON document, suitable for regression tracking.
+
+#include <julia.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+JULIA_DEFINE_FAST_TLS // only define this once, in an executable
+
+// monotonic clock from libjulia, so no platform-specific timing is needed here
+extern uint64_t jl_hrtime(void);
+
+// how long each benchmark should run for; long enough to make timer
+// resolution and scheduler noise irrelevant for ns-scale operations
+#define TARGET_NS (200 * 1000 * 1000)
+
+static jl_value_t *checked_eval_string(const char *code)
+{
+    jl_value_t *result = jl_eval_string(code);
+    if (jl_exception_occurred()) {
+        jl_call2(jl_get_function(jl_base_module, "showerror"),
+                 jl_stderr_obj(),
+                 jl_exception_occurred());
+        jl_printf(jl_stderr_stream(), "\n");
+        jl_atexit_hook(1);
+        exit(1);
+    }
+    return result;
+}
+
+// a volatile sink keeps the compiler from discarding benchmark results
+static volatile void *sink;
+
+typedef uint64_t (*bench_fn_t)(uint64_t n);
+
+static uint64_t bench_dispatch(uint64_t n)
+{
+    jl_value_t **argv;
+    JL_GC_PUSHARGS(argv, 3);
+    argv[0] = (jl_value_t*)jl_get_function(jl_base_module, "+");
+    argv[1] = jl_box_int64(3);
+    argv[2] = jl_box_int64(4);
+    uint64_t t0 = jl_hrtime();
+    for (uint64_t i = 0; i < n; i++)
+        sink = jl_apply_generic(argv[0], &argv[1], 2);
+    uint64_t t1 = jl_hrtime();
+    JL_GC_POP();
+    return t1 - t0;
+}
+
+static uint64_t bench_pool_alloc(uint64_t n)
+{
+    uint64_t t0 = jl_hrtime();
+    for (uint64_t i = 0; i < n; i++)
+        sink = jl_box_float64((double)i); // one pool allocation per iteration
+    uint64_t t1 = jl_hrtime();
+    return t1 - t0;
+}
+
+static uint64_t bench_subtype(uint64_t n)
+{
+    jl_value_t **argv;
+    JL_GC_PUSHARGS(argv, 2);
+    argv[0] = checked_eval_string("Vector{Int}");
+    argv[1] = checked_eval_string("AbstractArray{T,1} where T<:Real");
+    uint64_t t0 = jl_hrtime();
+    for (uint64_t i = 0; i < n; i++)
+        sink = (void*)(uintptr_t)jl_subtype(argv[0], argv[1]);
+    uint64_t t1 = jl_hrtime();
+    JL_GC_POP();
+    return t1 - t0;
+}
+
+static uint64_t bench_egal(uint64_t n)
+{
+    jl_value_t **argv;
+    JL_GC_PUSHARGS(argv, 2);
+    argv[0] = checked_eval_string("(1, 2.0, \"abc\", (3, 4))");
+    argv[1] = checked_eval_string("(1, 2.0, \"abc\", (3, 4))");
+    uint64_t t0 = jl_hrtime();
+    for (uint64_t i = 0; i < n; i++)
+        sink = (void*)(uintptr_t)jl_egal(argv[0], argv[1]);
+    uint64_t t1 = jl_hrtime();
+    JL_GC_POP();
+    return t1 - t0;
+}
+
+static uint64_t bench_task_switch(uint64_t n)
+{
+    // ping-pong between the root task and one spawned task; each `yield`
+    // in the driver is matched by one in the helper, so the reported cost
+    // is per context switch
+    static int defined = 0;
+    if (!defined) {
+        checked_eval_string(
+            "function bench_task_switch_jl(n)\n"
+            "    done = Ref(false)\n"
+            "    t = @async while !done[]; yield(); end\n"
+            "    for i in 1:n; yield(); end\n"
+            "    done[] = true\n"
+            "    wait(t)\n"
+            "    nothing\n"
+            "end");
+        defined = 1;
+    }
+    jl_value_t **argv;
+    JL_GC_PUSHARGS(argv, 2);
+    argv[0] = jl_get_global(jl_main_module, jl_symbol("bench_task_switch_jl"));
+    argv[1] = jl_box_int64((int64_t)(n / 2)); // two switches per loop iteration
+    uint64_t t0 = jl_hrtime();
+    jl_apply_generic(argv[0], &argv[1], 1);
+    uint64_t t1 = jl_hrtime();
+    JL_GC_POP();
+    if (jl_exception_occurred()) {
+        jl_printf(jl_stderr_stream(), "exception in task-switch benchmark\n");
+        jl_atexit_hook(1);
+        exit(1);
+    }
+    return t1 - t0;
+}
+
+static void run_benchmark(FILE *out, const char *name, bench_fn_t fn, int first)
+{
+    // warm up (compilation, caches), then grow the iteration count until the
+    // run is long enough to time reliably
+    fn(1000);
+    uint64_t n = 10000;
+    uint64_t elapsed = fn(n);
+    while (elapsed < TARGET_NS && n < (UINT64_C(1) << 32)) {
+        n *= 4;
+        elapsed = fn(n);
+    }
+    double ns_per_op = (double)elapsed / (double)n;
+    fprintf(out, "%s\n    {\"name\": \"%s\", \"iterations\": %llu, \"ns_per_iteration\": %.3f}",
+            first ? "" : ",", name, (unsigned long long)n, ns_per_op);
+    fprintf(stderr, "%-16s %12.3f ns/iteration\n", name, ns_per_op);
+}
+
+int main(int argc, char *argv[])
+{
+    jl_init();
+
+    FILE *out = stdout;
+    if (argc > 1) {
+        out = fopen(argv[1], "w");
+        if (out == NULL) {
+            fprintf(stderr, "benchmark: cannot open %s\n", argv[1]);
+            return 1;
+        }
+    }
+
+    fprintf(out, "{\n  \"julia_version\": \"%s\",\n  \"benchmarks\": [", jl_ver_string());
+    run_benchmark(out, "dispatch", bench_dispatch, 1);
+    run_benchmark(out, "pool_alloc", bench_pool_alloc, 0);
+    run_benchmark(out, "subtype", bench_subtype, 0);
+    run_benchmark(out, "egal", bench_egal, 0);
+    run_benchmark(out, "task_switch", bench_task_switch, 0);
+    fprintf(out, "\n  ]\n}\n");
+
+    if (out != stdout)
+        fclose(out);
+    jl_atexit_hook(0);
+    return 0;
+}
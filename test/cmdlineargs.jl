@@ -261,6 +261,13 @@ let exename = `$(Base.julia_cmd()) --startup-file=no --color=no`
     # Combining --threads and invalid -C should yield a decent error
     @test errors_not_signals(`$exename -t 2 -C invalidtarget`)
 
+    # --gcthreads
+    code = "print(Base.JLOptions().ngcthreads)"
+    @test read(`$exename --gcthreads=2 -e $code`, String) == "2"
+    @test read(`$exename --gcthreads=auto -e $code`, String) == "-1"
+    @test errors_not_signals(`$exename --gcthreads=0`)
+    @test errors_not_signals(`$exename --gcthreads=-1`)
+
     # --procs
     @test readchomp(`$exename -q -p 2 -e "println(nworkers())"`) == "2"
     @test errors_not_signals(`$exename -p 0`)
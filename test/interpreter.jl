@@ -30,3 +30,8 @@ let p = Pipe(),
     wait(proc)
     close(p)
 end
+
+# control-flow nodes must not be treated as literals by the trivial-thunk
+# fast path: this thunk is all literals except for the goto
+@test Core.eval(@__MODULE__, :(if false; 1; else; 2; end)) == 2
+@test Core.eval(@__MODULE__, :(while false; end)) === nothing
@@ -0,0 +1,80 @@
+# This file is a part of Julia. License is MIT: https://julialang.org/license
+
+# RUN: julia --startup-file=no -O2 %s %t -O
+# RUN: cat %t/* | FileCheck %s
+
+include(joinpath("..", "testhelpers", "llvmpasses.jl"))
+
+# COM: The array stack allocation in alloc-opt only fires for JIT-compiled
+# COM: code (the array type must be a literal pointer), so it is tested
+# COM: through the full pipeline rather than with textual IR.
+
+# COM: A small fixed-size array with pointer-free elements that does not
+# COM: escape is moved to the stack.
+# CHECK-LABEL: @julia_array_on_stack
+# CHECK-NOT: @jl_alloc_array_1d
+# CHECK: ret double
+function array_on_stack(x::Float64)
+    a = Vector{Float64}(undef, 4)
+    @inbounds for i in 1:4
+        a[i] = x + i
+    end
+    s = 0.0
+    @inbounds for i in 1:4
+        s += a[i]
+    end
+    s
+end
+
+# COM: returning the array escapes it
+# CHECK-LABEL: @julia_array_escapes
+# CHECK: @jl_alloc_array_1d
+function array_escapes(x::Float64)
+    a = Vector{Float64}(undef, 4)
+    @inbounds a[1] = x
+    a
+end
+
+# COM: the length must be a compile-time constant
+# CHECK-LABEL: @julia_array_dyn_length
+# CHECK: @jl_alloc_array_1d
+function array_dyn_length(x::Float64, n::Int)
+    a = Vector{Float64}(undef, n)
+    @inbounds a[1] = x
+    length(a)
+end
+
+# COM: data larger than ARRAY_STACK_ALLOC_NBYTES stays on the heap
+# CHECK-LABEL: @julia_array_too_big
+# CHECK: @jl_alloc_array_1d
+function array_too_big(x::Float64)
+    a = Vector{Float64}(undef, 64)
+    @inbounds a[1] = x
+    @inbounds a[1]
+end
+
+# COM: a preserved array may have raw pointers into it that outlive the uses
+# COM: visible to the analysis
+# CHECK-LABEL: @julia_array_preserved
+# CHECK: @jl_alloc_array_1d
+function array_preserved(x::Float64)
+    a = Vector{Float64}(undef, 4)
+    @inbounds a[1] = x
+    GC.@preserve a unsafe_load(pointer(a))
+end
+
+# COM: elements with pointers would have to be visible to the GC
+# CHECK-LABEL: @julia_array_of_refs
+# CHECK: @jl_alloc_array_1d
+function array_of_refs(x::Base.RefValue{Int})
+    a = Vector{Base.RefValue{Int}}(undef, 2)
+    @inbounds a[1] = x
+    nothing
+end
+
+emit(array_on_stack, Float64)
+emit(array_escapes, Float64)
+emit(array_dyn_length, Float64, Int)
+emit(array_too_big, Float64)
+emit(array_preserved, Float64)
+emit(array_of_refs, Base.RefValue{Int})
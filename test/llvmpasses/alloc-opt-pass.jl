@@ -7,6 +7,7 @@ isz = sizeof(UInt) == 8 ? "i64" : "i32"
 
 println("""
 @tag = external addrspace(10) global {}
+@tag0 = external global {}
 """)
 
 # Test that the gc_preserve intrinsics are deleted directly.
@@ -111,6 +112,8 @@ declare {}* @julia.pointer_from_objref({} addrspace(11)*)
 declare void @llvm.memcpy.p11i8.p0i8.i64(i8 addrspace(11)* nocapture writeonly, i8* nocapture readonly, i64, i32, i1)
 declare token @llvm.julia.gc_preserve_begin(...)
 declare void @llvm.julia.gc_preserve_end(token)
+declare i1 @identity_check({} addrspace(10)* nocapture readnone, {} addrspace(10)* nocapture readnone)
+declare i1 @reading_check({} addrspace(10)* nocapture readonly, {} addrspace(10)* nocapture readonly)
 """)
 
 # CHECK-LABEL: @memref_collision
@@ -144,3 +147,150 @@ L2:
 }
 """)
 # CHECK-LABEL: }{{$}}
+
+# Objects that are only stored into each other and never read form a dead
+# region and are deleted as a group.
+
+# CHECK-LABEL: @dead_region
+# CHECK-NOT: @julia.gc_alloc_obj
+# CHECK: ret void
+println("""
+define void @dead_region() {
+  %pgcstack = call {}*** @julia.get_pgcstack()
+  %ptls = call {}*** @julia.ptls_states()
+  %ptls_i8 = bitcast {}*** %ptls to i8*
+  %a = call noalias {} addrspace(10)* @julia.gc_alloc_obj(i8* %ptls_i8, $isz 8, {} addrspace(10)* @tag)
+  %b = call noalias {} addrspace(10)* @julia.gc_alloc_obj(i8* %ptls_i8, $isz 8, {} addrspace(10)* @tag)
+  %a_p = bitcast {} addrspace(10)* %a to {} addrspace(10)* addrspace(10)*
+  store {} addrspace(10)* %b, {} addrspace(10)* addrspace(10)* %a_p
+  %b_p = bitcast {} addrspace(10)* %b to {} addrspace(10)* addrspace(10)*
+  store {} addrspace(10)* %a, {} addrspace(10)* addrspace(10)* %b_p
+  ret void
+}
+""")
+# CHECK-LABEL: }{{$}}
+
+# Both objects must stay if any member of the region escapes.
+
+# CHECK-LABEL: @region_escape
+# CHECK: @julia.gc_alloc_obj
+# CHECK: @julia.gc_alloc_obj
+# CHECK: ret {} addrspace(10)* %a
+println("""
+define {} addrspace(10)* @region_escape() {
+  %pgcstack = call {}*** @julia.get_pgcstack()
+  %ptls = call {}*** @julia.ptls_states()
+  %ptls_i8 = bitcast {}*** %ptls to i8*
+  %a = call noalias {} addrspace(10)* @julia.gc_alloc_obj(i8* %ptls_i8, $isz 8, {} addrspace(10)* @tag)
+  %b = call noalias {} addrspace(10)* @julia.gc_alloc_obj(i8* %ptls_i8, $isz 8, {} addrspace(10)* @tag)
+  %a_p = bitcast {} addrspace(10)* %a to {} addrspace(10)* addrspace(10)*
+  store {} addrspace(10)* %b, {} addrspace(10)* addrspace(10)* %a_p
+  ret {} addrspace(10)* %a
+}
+""")
+# CHECK-LABEL: }{{$}}
+
+# A callee parameter marked both `nocapture` and `readnone` can only observe
+# the pointer's identity, so passing the object there does not force it onto
+# the heap. The stack object gets a type tag with the GC bits preset to
+# old+marked so that rooted copies of its address are inert.
+
+# CHECK-LABEL: @nocapture_readnone
+# CHECK-NOT: @julia.gc_alloc_obj
+# CHECK: alloca [24 x i8]
+# CHECK: store volatile $isz or ($isz ptrtoint ({}* @tag0 to $isz), $isz 3)
+# CHECK: call i1 @identity_check({} addrspace(10)*
+println("""
+define i1 @nocapture_readnone({} addrspace(10)* %other) {
+  %pgcstack = call {}*** @julia.get_pgcstack()
+  %ptls = call {}*** @julia.ptls_states()
+  %ptls_i8 = bitcast {}*** %ptls to i8*
+  %v = call noalias {} addrspace(10)* @julia.gc_alloc_obj(i8* %ptls_i8, $isz 8, {} addrspace(10)* addrspacecast ({}* @tag0 to {} addrspace(10)*))
+  %eq = call i1 @identity_check({} addrspace(10)* %v, {} addrspace(10)* %other)
+  ret i1 %eq
+}
+""")
+# CHECK-LABEL: }{{$}}
+
+# `readonly` is not enough: the callee may read the object's memory, including
+# the type tag.
+
+# CHECK-LABEL: @nocapture_readonly
+# CHECK: @julia.gc_alloc_obj
+# CHECK: call i1 @reading_check
+println("""
+define i1 @nocapture_readonly({} addrspace(10)* %other) {
+  %pgcstack = call {}*** @julia.get_pgcstack()
+  %ptls = call {}*** @julia.ptls_states()
+  %ptls_i8 = bitcast {}*** %ptls to i8*
+  %v = call noalias {} addrspace(10)* @julia.gc_alloc_obj(i8* %ptls_i8, $isz 8, {} addrspace(10)* addrspacecast ({}* @tag0 to {} addrspace(10)*))
+  %eq = call i1 @reading_check({} addrspace(10)* %v, {} addrspace(10)* %other)
+  ret i1 %eq
+}
+""")
+# CHECK-LABEL: }{{$}}
+
+# An object whose only escape is into a noreturn callee on an error path is
+# still split; the object is rebuilt from the slots right before the throw.
+
+# CHECK-LABEL: @split_remat_throw
+# CHECK: alloca
+# CHECK-NOT: @julia.gc_alloc_obj
+# CHECK: err:
+# CHECK: @julia.gc_alloc_obj
+# CHECK: store i64
+# CHECK: call void @noreturn_throw
+println("""
+define i64 @split_remat_throw(i1 %b, i64 %x) {
+  %pgcstack = call {}*** @julia.get_pgcstack()
+  %ptls = call {}*** @julia.ptls_states()
+  %ptls_i8 = bitcast {}*** %ptls to i8*
+  %v = call noalias {} addrspace(10)* @julia.gc_alloc_obj(i8* %ptls_i8, $isz 8, {} addrspace(10)* @tag)
+  %vp = bitcast {} addrspace(10)* %v to i64 addrspace(10)*
+  store i64 %x, i64 addrspace(10)* %vp
+  br i1 %b, label %err, label %ok
+
+err:
+  call void @noreturn_throw({} addrspace(10)* %v)
+  unreachable
+
+ok:
+  %r = load i64, i64 addrspace(10)* %vp
+  ret i64 %r
+}
+""")
+# CHECK-LABEL: }{{$}}
+
+# A callee that can return may mutate the escaped copy, which would diverge
+# from the split slots, so only noreturn callees allow the rematerialization
+# even when the block ends in `unreachable`.
+
+# CHECK-LABEL: @no_remat_may_return
+# CHECK-NOT: alloca
+# CHECK: @julia.gc_alloc_obj
+# CHECK: call void @log_error
+println("""
+define i64 @no_remat_may_return(i1 %b, i64 %x) {
+  %pgcstack = call {}*** @julia.get_pgcstack()
+  %ptls = call {}*** @julia.ptls_states()
+  %ptls_i8 = bitcast {}*** %ptls to i8*
+  %v = call noalias {} addrspace(10)* @julia.gc_alloc_obj(i8* %ptls_i8, $isz 8, {} addrspace(10)* @tag)
+  %vp = bitcast {} addrspace(10)* %v to i64 addrspace(10)*
+  store i64 %x, i64 addrspace(10)* %vp
+  br i1 %b, label %err, label %ok
+
+err:
+  call void @log_error({} addrspace(10)* %v)
+  unreachable
+
+ok:
+  %r = load i64, i64 addrspace(10)* %vp
+  ret i64 %r
+}
+""")
+# CHECK-LABEL: }{{$}}
+
+println("""
+declare void @noreturn_throw({} addrspace(10)*) noreturn
+declare void @log_error({} addrspace(10)*)
+""")
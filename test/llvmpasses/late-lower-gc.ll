@@ -10,6 +10,7 @@ declare void @jl_safepoint()
 declare {} addrspace(10)* @jl_apply_generic({} addrspace(10)*, {} addrspace(10)**, i32)
 declare noalias nonnull {} addrspace(10)* @julia.gc_alloc_obj({}**, i64, {} addrspace(10)*)
 declare i32 @rooting_callee({} addrspace(12)*, {} addrspace(12)*)
+declare void @one_arg_boxed({} addrspace(10)*)
 
 define void @gc_frame_lowering(i64 %a, i64 %b) {
 top:
@@ -167,6 +168,159 @@ define void @decayar([2 x {} addrspace(10)* addrspace(11)*] %ar) {
 ; CHECK: %r = call i32 @callee_root({} addrspace(10)* %l0, {} addrspace(10)* %l1)
 ; CHECK: call void @julia.pop_gc_frame({} addrspace(10)** %gcframe)
 
+; The frame push is sunk to the block that needs it, so the fast path
+; returns without any frame maintenance.
+define void @shrink_wrap(i1 %cond, i64 %a, i64 %b) {
+top:
+; CHECK-LABEL: @shrink_wrap
+; CHECK: top:
+; CHECK: %gcframe = call {} addrspace(10)** @julia.new_gc_frame(i32 2)
+; CHECK-NOT: @julia.push_gc_frame
+; CHECK: fast:
+; CHECK-NOT: @julia.pop_gc_frame
+; CHECK: slow:
+; CHECK-NEXT: call void @julia.push_gc_frame({} addrspace(10)** %gcframe, i32 2)
+; CHECK: call void @julia.pop_gc_frame({} addrspace(10)** %gcframe)
+  %pgcstack = call {}*** @julia.get_pgcstack()
+  br i1 %cond, label %fast, label %slow
+fast:
+  ret void
+slow:
+  %aboxed = call {} addrspace(10)* @jl_box_int64(i64 signext %a)
+  %bboxed = call {} addrspace(10)* @jl_box_int64(i64 signext %b)
+  call void @boxed_simple({} addrspace(10)* %aboxed,
+                          {} addrspace(10)* %bboxed)
+  ret void
+}
+
+; No sinking when the exit is reachable both with and without the frame
+; pushed: the push must stay in the entry block.
+define void @shrink_wrap_mixed_exit(i1 %cond, i64 %a, i64 %b) {
+top:
+; CHECK-LABEL: @shrink_wrap_mixed_exit
+; CHECK: top:
+; CHECK: call void @julia.push_gc_frame({} addrspace(10)** %gcframe, i32 2)
+; CHECK: join:
+; CHECK: call void @julia.pop_gc_frame({} addrspace(10)** %gcframe)
+  %pgcstack = call {}*** @julia.get_pgcstack()
+  br i1 %cond, label %slow, label %join
+slow:
+  %aboxed = call {} addrspace(10)* @jl_box_int64(i64 signext %a)
+  %bboxed = call {} addrspace(10)* @jl_box_int64(i64 signext %b)
+  call void @boxed_simple({} addrspace(10)* %aboxed,
+                          {} addrspace(10)* %bboxed)
+  br label %join
+join:
+  ret void
+}
+
+; No sinking into a cycle: a second push would link the frame onto itself.
+define void @shrink_wrap_loop(i64 %n) {
+top:
+; CHECK-LABEL: @shrink_wrap_loop
+; CHECK: top:
+; CHECK: call void @julia.push_gc_frame({} addrspace(10)** %gcframe, i32 2)
+; CHECK: loop:
+; CHECK-NOT: @julia.push_gc_frame
+; CHECK: exit:
+; CHECK: call void @julia.pop_gc_frame({} addrspace(10)** %gcframe)
+  %pgcstack = call {}*** @julia.get_pgcstack()
+  br label %loop
+loop:
+  %i = phi i64 [ 0, %top ], [ %inext, %loop ]
+  %aboxed = call {} addrspace(10)* @jl_box_int64(i64 signext %i)
+  %bboxed = call {} addrspace(10)* @jl_box_int64(i64 signext %i)
+  call void @boxed_simple({} addrspace(10)* %aboxed,
+                          {} addrspace(10)* %bboxed)
+  %inext = add i64 %i, 1
+  %done = icmp eq i64 %inext, %n
+  br i1 %done, label %exit, label %loop
+exit:
+  ret void
+}
+
+; A tracked pointer loaded from immutable memory is reloaded after the
+; safepoint instead of being rooted; the container stays rooted through the
+; address operand.
+define void @remat_immut_load(i64 %a) {
+top:
+; CHECK-LABEL: @remat_immut_load
+; CHECK-NOT: load {} addrspace(10)*
+; CHECK: store {} addrspace(10)* %aboxed
+; CHECK: call void @jl_safepoint()
+; CHECK: [[RELOAD:%.*]] = load {} addrspace(10)*, {} addrspace(10)* addrspace(11)* %fieldptr
+; CHECK: call void @one_arg_boxed({} addrspace(10)* [[RELOAD]])
+  %pgcstack = call {}*** @julia.get_pgcstack()
+  %aboxed = call {} addrspace(10)* @jl_box_int64(i64 signext %a)
+  %derived = addrspacecast {} addrspace(10)* %aboxed to {} addrspace(11)*
+  %fieldptr = bitcast {} addrspace(11)* %derived to {} addrspace(10)* addrspace(11)*
+  %field = load {} addrspace(10)*, {} addrspace(10)* addrspace(11)* %fieldptr, align 8, !tbaa !3
+  call void @jl_safepoint()
+  call void @one_arg_boxed({} addrspace(10)* %field)
+  ret void
+}
+
+; A load from mutable memory cannot be repeated: it keeps its position and the
+; loaded value is rooted across the safepoint.
+define void @no_remat_mut_load(i64 %a) {
+top:
+; CHECK-LABEL: @no_remat_mut_load
+; CHECK: %field = load {} addrspace(10)*, {} addrspace(10)* addrspace(11)* %fieldptr
+; CHECK: store {} addrspace(10)* %field
+; CHECK: call void @jl_safepoint()
+; CHECK-NOT: load {} addrspace(10)*
+; CHECK: call void @one_arg_boxed({} addrspace(10)* %field)
+  %pgcstack = call {}*** @julia.get_pgcstack()
+  %aboxed = call {} addrspace(10)* @jl_box_int64(i64 signext %a)
+  %derived = addrspacecast {} addrspace(10)* %aboxed to {} addrspace(11)*
+  %fieldptr = bitcast {} addrspace(11)* %derived to {} addrspace(10)* addrspace(11)*
+  %field = load {} addrspace(10)*, {} addrspace(10)* addrspace(11)* %fieldptr, align 8
+  call void @jl_safepoint()
+  call void @one_arg_boxed({} addrspace(10)* %field)
+  ret void
+}
+
+; Atomic loads are not duplicated even when the memory is immutable.
+define void @no_remat_atomic_load(i64 %a) {
+top:
+; CHECK-LABEL: @no_remat_atomic_load
+; CHECK: %field = load atomic {} addrspace(10)*, {} addrspace(10)* addrspace(11)* %fieldptr
+; CHECK: call void @jl_safepoint()
+; CHECK-NOT: load {} addrspace(10)*
+; CHECK: call void @one_arg_boxed({} addrspace(10)* %field)
+  %pgcstack = call {}*** @julia.get_pgcstack()
+  %aboxed = call {} addrspace(10)* @jl_box_int64(i64 signext %a)
+  %derived = addrspacecast {} addrspace(10)* %aboxed to {} addrspace(11)*
+  %fieldptr = bitcast {} addrspace(11)* %derived to {} addrspace(10)* addrspace(11)*
+  %field = load atomic {} addrspace(10)*, {} addrspace(10)* addrspace(11)* %fieldptr unordered, align 8, !tbaa !3
+  call void @jl_safepoint()
+  call void @one_arg_boxed({} addrspace(10)* %field)
+  ret void
+}
+
+; Phi uses are left alone: the load stays where it was.
+define void @no_remat_phi_use(i1 %cond, i64 %a) {
+top:
+; CHECK-LABEL: @no_remat_phi_use
+; CHECK: %field = load {} addrspace(10)*, {} addrspace(10)* addrspace(11)* %fieldptr
+; CHECK: join:
+; CHECK-NOT: load {} addrspace(10)*
+; CHECK: call void @one_arg_boxed({} addrspace(10)* %phi)
+  %pgcstack = call {}*** @julia.get_pgcstack()
+  %aboxed = call {} addrspace(10)* @jl_box_int64(i64 signext %a)
+  %derived = addrspacecast {} addrspace(10)* %aboxed to {} addrspace(11)*
+  %fieldptr = bitcast {} addrspace(11)* %derived to {} addrspace(10)* addrspace(11)*
+  %field = load {} addrspace(10)*, {} addrspace(10)* addrspace(11)* %fieldptr, align 8, !tbaa !3
+  br i1 %cond, label %other, label %join
+other:
+  %oboxed = call {} addrspace(10)* @jl_box_int64(i64 signext %a)
+  br label %join
+join:
+  %phi = phi {} addrspace(10)* [ %oboxed, %other ], [ %field, %top ]
+  call void @one_arg_boxed({} addrspace(10)* %phi)
+  ret void
+}
+
 !0 = !{i64 0, i64 23}
 !1 = !{!1}
 !2 = !{!7} ; scope list
@@ -408,3 +408,22 @@ wc_aiw2 = get_world_counter()
 @test Base.invoke_in_world(wc_aiw2, f_inworld, 2) == "world two; x=2"
 @test Base.invoke_in_world(wc_aiw1, g_inworld, 2, y=3) == "world one; x=2, y=3"
 @test Base.invoke_in_world(wc_aiw2, g_inworld, 2, y=3) == "world two; x=2, y=3"
+
+# type-feedback re-specialization (JULIA_TYPE_FEEDBACK)
+# =====================================================
+
+# The concrete signature built from the observed arguments must include all of
+# them; dropping the trailing argument used to install (and invoke) a
+# wrong-arity specialization for vararg methods.
+let code = """
+        @noinline g(@nospecialize(a), @nospecialize(b...)) = (a, b)
+        for i in 1:100
+            r = g(1, 2.5)
+            r == (1, (2.5,)) || error("wrong result after re-specialization: ", r)
+        end
+        println("ok")
+        """
+    cmd = addenv(`$(Base.julia_cmd()) --startup-file=no -e $code`,
+                 "JULIA_TYPE_FEEDBACK" => "1")
+    @test read(cmd, String) == "ok\n"
+end